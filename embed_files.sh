@@ -15,12 +15,16 @@ rm $outputfile
 
 function minify_html_css {
 	file=$1
-	post_To https://html-minifier.com/raw $file
+	post_To https://html-minifier.com/raw $file || exit 1
 }
 
+# Falls back to a local minifier, which only strips comments and whitespace, when the online one is not reachable.
 function minify_js {
 	file=$1
-	post_To https://javascript-minifier.com/raw $file
+	if ! post_To https://javascript-minifier.com/raw $file; then
+		echo "  using tools/minify_js.py"
+		python3 ../tools/minify_js.py $file > /tmp/converter.temp || exit 1
+	fi
 }
 
 function post_To {
@@ -36,7 +40,8 @@ function post_To {
 		rm $HEADERS
 	else
 		echo "can not minify $file error $status"
-		exit 1
+		rm -f $RESPONSE $HEADERS
+		return 1
 	fi
 }
 
@@ -50,6 +55,19 @@ function ascii2hexCstyle {
 	result=$(cat /tmp/converter.temp | hexdump -ve '1/1 "0x%.2x,"')
 	result=$(echo $result | sed 's/,$//')
 	echo "const char DATA_${file_name}[] PROGMEM = {$result,0};"
+	ascii2hexCstyle_gz $1
+}
+
+# Gzip compressed variant, served by the web server when the browser accepts gzip.
+# Not zero terminated, use sizeof() for its length.
+# -n: do not store name and timestamp, so the output only changes with the content.
+function ascii2hexCstyle_gz {
+	file_name=$(constFileName $1)
+	result=$(gzip -9 -n -c /tmp/converter.temp | hexdump -ve '1/1 "0x%.2x,"')
+	result=$(echo $result | sed 's/,$//')
+	echo "#ifdef WEBSERVER_EMBED_GZIP"
+	echo "static const char DATA_${file_name}_GZ[] PROGMEM = {$result};"
+	echo "#endif"
 }
 
 function constFileName {
@@ -61,7 +79,12 @@ function constFileName {
 
 
 
-file_list=$(find . -type f)
+# Optional: only process the files given as arguments (relative to the static folder).
+if [[ $# -gt 0 ]]; then
+	file_list="$@"
+else
+	file_list=$(find . -type f)
+fi
 
 for file in $file_list; do
 	echo "Processing: $file"
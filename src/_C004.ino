@@ -9,6 +9,8 @@
 # define CPLUGIN_ID_004         4
 # define CPLUGIN_NAME_004       "ThingSpeak"
 
+# include "src/Globals/ESPEasy_time.h"
+
 bool CPlugin_004(CPlugin::Function function, struct EventStruct *event, String& string)
 {
   bool success = false;
@@ -23,6 +25,7 @@ bool CPlugin_004(CPlugin::Function function, struct EventStruct *event, String&
       Protocol[protocolCount].usesPassword = true;
       Protocol[protocolCount].defaultPort  = 80;
       Protocol[protocolCount].usesID       = true;
+      Protocol[protocolCount].supportsBatch = true;
       break;
     }
 
@@ -50,7 +53,8 @@ bool CPlugin_004(CPlugin::Function function, struct EventStruct *event, String&
 
       switch (event->idx) {
         case ControllerSettingsStruct::CONTROLLER_USER:
-          string = F("ThingHTTP Name");
+          // Only needed to send in batches, using the bulk update API
+          string = F("Channel ID");
           break;
         case ControllerSettingsStruct::CONTROLLER_PASS:
           string = F("API Key");
@@ -133,4 +137,86 @@ bool do_process_c004_delay_queue(int controller_number, const C004_queue_element
   return send_via_http(controller_number, client, postStr, ControllerSettings.MustCheckReply);
 }
 
+// Uncrustify may change this into multi line, which will result in failed builds
+// *INDENT-OFF*
+size_t do_process_c004_delay_queue_batch(int controller_number, const std::vector<const C004_queue_element *>& elements, ControllerSettingsStruct& ControllerSettings);
+
+size_t do_process_c004_delay_queue_batch(int controller_number, const std::vector<const C004_queue_element *>& elements, ControllerSettingsStruct& ControllerSettings) {
+// *INDENT-ON*
+  // The bulk update API needs the channel ID and the time of each sample.
+  unsigned int channelId = 0;
+
+  if ((elements.size() == 1) ||
+      !validUIntFromString(getControllerUser(elements[0]->controller_idx, ControllerSettings), channelId) ||
+      !node_time.systemTimePresent()) {
+    return do_process_c004_delay_queue(controller_number, *elements[0], ControllerSettings) ? 1 : 0;
+  }
+
+  WiFiClient client;
+
+  if (!try_connect_host(controller_number, client, ControllerSettings)) {
+    return 0;
+  }
+
+  // See: https://nl.mathworks.com/help/thingspeak/bulkwritejsondata.html
+  String postDataStr = F("{\"write_api_key\":\"");
+
+  postDataStr += getControllerPass(elements[0]->controller_idx, ControllerSettings); // used for API key
+  postDataStr += F("\",\"updates\":[");
+
+  for (size_t i = 0; i < elements.size(); ++i) {
+    const C004_queue_element& element = *elements[i];
+
+    if (i != 0) {
+      postDataStr += ',';
+    }
+
+    struct tm ts;
+    ESPEasy_time::breakTime(node_time.getUnixTime() - (timePassedSince(element._timestamp) / 1000), ts);
+    postDataStr += F("{\"created_at\":\"");
+    postDataStr += ESPEasy_time::getDateTimeString(ts, '-', ':', 'T');
+    postDataStr += F("Z\"");
+
+    if (element.sensorType == Sensor_VType::SENSOR_TYPE_STRING) {
+      postDataStr += ',';
+      postDataStr += to_json_object_value(F("status"), element.txt[0]);
+    } else {
+      for (byte x = 0; x < element.valueCount; x++)
+      {
+        String field = F("field");
+        field       += element.idx + x;
+        postDataStr += ',';
+        postDataStr += to_json_object_value(field, element.txt[x]);
+      }
+    }
+    postDataStr += '}';
+  }
+  postDataStr += F("]}");
+
+  String hostName = F("api.thingspeak.com");
+
+  if (ControllerSettings.UseDNS) {
+    hostName = ControllerSettings.HostName;
+  }
+
+  String uri = F("/channels/");
+
+  uri += channelId;
+  uri += F("/bulk_update.json");
+
+  String postStr = do_create_http_request(
+    hostName, F("POST"),
+    uri,
+    EMPTY_STRING, // auth_header
+    F("Content-Type: application/json\r\n"),
+    postDataStr.length());
+
+  postStr += postDataStr;
+
+  if (!send_via_http(controller_number, client, postStr, ControllerSettings.MustCheckReply)) {
+    return 0;
+  }
+  return elements.size();
+}
+
 #endif // ifdef USES_C004
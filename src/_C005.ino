@@ -2,8 +2,10 @@
 #ifdef USES_C005
 
 # include "src/Commands/InternalCommands.h"
+# include "src/Globals/Cache.h"
 # include "src/Globals/EventQueue.h"
 # include "src/Globals/ExtraTaskSettings.h"
+# include "src/Helpers/Numerical.h"
 # include "src/Helpers/PeriodicalActions.h"
 # include "src/Helpers/StringParser.h"
 # include "_Plugin_Helper.h"
@@ -18,6 +20,10 @@
 
 String CPlugin_005_pubname;
 bool   CPlugin_005_mqtt_retainFlag = false;
+bool   CPlugin_005_sendJSON        = false;
+
+// Publish topic used to send all values of a task as one JSON object, thus without %valname%
+String CPlugin_005_JSON_pubname;
 
 
 bool CPlugin_005(CPlugin::Function function, struct EventStruct *event, String& string)
@@ -47,7 +53,20 @@ bool CPlugin_005(CPlugin::Function function, struct EventStruct *event, String&
 
     case CPlugin::Function::CPLUGIN_INIT:
     {
-      success = init_mqtt_delay_queue(event->ControllerIndex, CPlugin_005_pubname, CPlugin_005_mqtt_retainFlag);
+      {
+        MakeControllerSettings(ControllerSettings);
+
+        if (!AllocatedControllerSettings()) {
+          break;
+        }
+        LoadControllerSettings(event->ControllerIndex, ControllerSettings);
+        CPlugin_005_sendJSON = ControllerSettings.sendJSON();
+        success              = init_mqtt_delay_queue(event->ControllerIndex, ControllerSettings, CPlugin_005_pubname, CPlugin_005_mqtt_retainFlag);
+      }
+
+      CPlugin_005_JSON_pubname = CPlugin_005_pubname;
+      CPlugin_005_JSON_pubname.replace(F("/%valname%"), EMPTY_STRING);
+      CPlugin_005_JSON_pubname.replace(F("%valname%"), EMPTY_STRING);
       break;
     }
 
@@ -57,6 +76,20 @@ bool CPlugin_005(CPlugin::Function function, struct EventStruct *event, String&
       break;
     }
 
+    case CPlugin::Function::CPLUGIN_WEBFORM_LOAD:
+    {
+      // Place in scope to delete ControllerSettings as soon as it is no longer needed
+      MakeControllerSettings(ControllerSettings);
+
+      if (!AllocatedControllerSettings()) {
+        addHtmlError(F("Out of memory, cannot load page"));
+      } else {
+        LoadControllerSettings(event->ControllerIndex, ControllerSettings);
+        addControllerParameterForm(ControllerSettings, event->ControllerIndex, ControllerSettingsStruct::CONTROLLER_SEND_JSON);
+      }
+      break;
+    }
+
     case CPlugin::Function::CPLUGIN_PROTOCOL_TEMPLATE:
     {
       event->String1 = F("%sysname%/#");
@@ -132,10 +165,15 @@ bool CPlugin_005(CPlugin::Function function, struct EventStruct *event, String&
 
     case CPlugin::Function::CPLUGIN_PROTOCOL_SEND:
     {
-      String pubname         = CPlugin_005_pubname;
-      bool   mqtt_retainFlag = CPlugin_005_mqtt_retainFlag;
+      bool mqtt_retainFlag = CPlugin_005_mqtt_retainFlag;
 
       LoadTaskSettings(event->TaskIndex);
+
+      if (CPlugin_005_sendJSON) {
+        success = C005_publishTaskJSON(event, mqtt_retainFlag);
+        break;
+      }
+      String pubname = CPlugin_005_pubname;
       parseControllerVariables(pubname, event, false);
 
       byte valueCount = getValueCountForTask(event->TaskIndex);
@@ -190,4 +228,95 @@ bool CPlugin_005(CPlugin::Function function, struct EventStruct *event, String&
   return success;
 }
 
+// JSON object keys of the task value names, like: "Temperature":
+// Built once per task and kept until the task settings change.
+// Values with empty labels have an empty key, as they are not published.
+const std::vector<String>& C005_getTaskJSONKeys(taskIndex_t TaskIndex)
+{
+  auto it = Cache.taskValueJSONKeys.find(TaskIndex);
+
+  if (it != Cache.taskValueJSONKeys.end()) {
+    return it->second;
+  }
+  std::vector<String>& keys = Cache.taskValueJSONKeys[TaskIndex];
+  const byte valueCount     = getValueCountForTask(TaskIndex);
+
+  for (byte x = 0; x < valueCount && x < VARS_PER_TASK; x++)
+  {
+    keys.emplace_back();
+
+    if (ExtraTaskSettings.TaskDeviceValueNames[x][0] != 0) {
+      const String name(ExtraTaskSettings.TaskDeviceValueNames[x]);
+      keys[x].reserve(to_json_value_length(name, true) + 1);
+      to_json_value(name, true, keys[x]);
+      keys[x] += ':';
+    }
+  }
+  return keys;
+}
+
+// Publish all values of a task as one JSON object, like: {"Temperature":21.50,"Humidity":45.20}
+// The values are formatted and quoted like in the /json output.
+bool C005_publishTaskJSON(struct EventStruct *event, bool mqtt_retainFlag)
+{
+  const std::vector<String>& keys = C005_getTaskJSONKeys(event->TaskIndex);
+  const bool isStringSensor       = event->sensorType == Sensor_VType::SENSOR_TYPE_STRING;
+
+  // Format all values first, so the payload can be allocated at once.
+  String values[VARS_PER_TASK];
+  bool   quoted[VARS_PER_TASK] = { false };
+  size_t payloadLength         = 1; // Closing '}'
+
+  for (byte x = 0; x < keys.size(); x++)
+  {
+    if (keys[x].isEmpty()) {
+      continue;
+    }
+
+    if (!isStringSensor) {
+      values[x] = formatUserVarNoCheck(event, x);
+    }
+    const String& value = isStringSensor ? event->String2 : values[x];
+    quoted[x]      = to_json_value_mustQuote(value);
+    payloadLength += 1 + keys[x].length() + to_json_value_length(value, quoted[x]); // '{' or ',' + key + value
+  }
+
+  if (payloadLength == 1) {
+    return false;
+  }
+  String payload;
+
+  if (!payload.reserve(payloadLength)) {
+    return false;
+  }
+
+  for (byte x = 0; x < keys.size(); x++)
+  {
+    if (keys[x].isEmpty()) {
+      continue;
+    }
+    payload += payload.isEmpty() ? '{' : ',';
+    payload += keys[x];
+    to_json_value(isStringSensor ? event->String2 : values[x], quoted[x], payload);
+  }
+  payload += '}';
+
+  String pubname = CPlugin_005_JSON_pubname;
+
+  parseControllerVariables(pubname, event, false);
+# ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    String log = F("MQTT : ");
+    log += pubname;
+    log += ' ';
+    log += payload.substring(0, 40); // For the log
+    addLog(LOG_LEVEL_DEBUG, log);
+  }
+# endif // ifndef BUILD_NO_DEBUG
+
+  // Publish using move operator, thus pubname and payload are empty after this call
+  return MQTTpublish(event->ControllerIndex, event->TaskIndex, std::move(pubname), std::move(payload), mqtt_retainFlag);
+}
+
 #endif // ifdef USES_C005
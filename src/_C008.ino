@@ -75,14 +75,10 @@ bool CPlugin_008(CPlugin::Function function, struct EventStruct *event, String&
 
       
       byte valueCount = getValueCountForTask(event->TaskIndex);
-      success = C008_DelayHandler->addToQueue(C008_queue_element(event, valueCount));
-
-      if (success) {
-        // Element was added.
-        // Now we try to append to the existing element
-        // and thus preventing the need to create a long string only to copy it to a queue element.
-        C008_queue_element& element = C008_DelayHandler->sendQueue.back();
 
+      // Fill the element before adding it to the queue, as it may be stored in the spill file.
+      C008_queue_element element(event, valueCount);
+      {
         // Collect the values at the same run, to make sure all are from the same sample
         LoadTaskSettings(event->TaskIndex);
         parseControllerVariables(pubname, event, true);
@@ -105,6 +101,7 @@ bool CPlugin_008(CPlugin::Function function, struct EventStruct *event, String&
           }
         }
       }
+      success = C008_DelayHandler->addToQueue(std::move(element));
       Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C008_DELAY_QUEUE, C008_DelayHandler->getNextScheduleTime());
       break;
     }
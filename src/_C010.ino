@@ -24,6 +24,7 @@ bool CPlugin_010(CPlugin::Function function, struct EventStruct *event, String&
       Protocol[protocolCount].usesPassword = false;
       Protocol[protocolCount].defaultPort  = 514;
       Protocol[protocolCount].usesID       = false;
+      Protocol[protocolCount].supportsBatch = true;
       break;
     }
 
@@ -153,4 +154,55 @@ bool do_process_c010_delay_queue(int controller_number, const C010_queue_element
   return element.checkDone(true);
 }
 
+// Uncrustify may change this into multi line, which will result in failed builds
+// *INDENT-OFF*
+size_t do_process_c010_delay_queue_batch(int controller_number, const std::vector<const C010_queue_element *>& elements, ControllerSettingsStruct& ControllerSettings);
+
+size_t do_process_c010_delay_queue_batch(int controller_number, const std::vector<const C010_queue_element *>& elements, ControllerSettingsStruct& ControllerSettings) {
+// *INDENT-ON*
+  if (!ControllerSettings.sendBatch()) {
+    return do_process_c010_delay_queue(controller_number, *elements[0], ControllerSettings) ? 1 : 0;
+  }
+
+  // Send all values not sent yet in a single packet, one value per line.
+  String packet;
+
+  for (auto it = elements.begin(); it != elements.end(); ++it) {
+    const C010_queue_element& element = **it;
+
+    for (byte x = element.valuesSent; x < element.valueCount && x < VARS_PER_TASK; ++x) {
+      if (!element.txt[x].isEmpty()) {
+        if (!packet.isEmpty()) {
+          packet += '\n';
+        }
+        packet += element.txt[x];
+      }
+    }
+  }
+
+  if (packet.isEmpty()) {
+    // Nothing valid to send
+    return elements.size();
+  }
+  WiFiUDP C010_portUDP;
+
+  if (!beginWiFiUDP_randomPort(C010_portUDP)) { return 0; }
+
+  if (!try_connect_host(controller_number, C010_portUDP, ControllerSettings)) {
+    return 0;
+  }
+
+  C010_portUDP.write(
+    (uint8_t *)packet.c_str(),
+    packet.length());
+  bool reply = C010_portUDP.endPacket();
+
+  C010_portUDP.stop();
+
+  if (ControllerSettings.MustCheckReply && !reply) {
+    return 0;
+  }
+  return elements.size();
+}
+
 #endif // ifdef USES_C010
@@ -47,6 +47,7 @@ bool CPlugin_011(CPlugin::Function function, struct EventStruct *event, String&
       Protocol[protocolCount].usesExtCreds = true;
       Protocol[protocolCount].defaultPort  = 80;
       Protocol[protocolCount].usesID       = false;
+      Protocol[protocolCount].supportsBatch = true;
       break;
     }
 
@@ -122,6 +123,8 @@ bool CPlugin_011(CPlugin::Function function, struct EventStruct *event, String&
           LoadControllerSettings(event->ControllerIndex, ControllerSettings);
           addControllerParameterForm(ControllerSettings, event->ControllerIndex, ControllerSettingsStruct::CONTROLLER_SEND_BINARY);
           addFormNote(F("Do not 'percent escape' body when send binary checked"));
+          addFormNote(F("Send in Batches: requests with the same URI, method and header are combined. "
+                        "JSON object bodies are sent as a JSON array, other bodies one per line"));
         }
       }
       break;
@@ -209,6 +212,90 @@ bool do_process_c011_delay_queue(int controller_number, const C011_queue_element
   return httpCode >= 100 && httpCode < 300;
 }
 
+// Uncrustify may change this into multi line, which will result in failed builds
+// *INDENT-OFF*
+size_t do_process_c011_delay_queue_batch(int controller_number, const std::vector<const C011_queue_element *>& elements, ControllerSettingsStruct& ControllerSettings);
+
+size_t do_process_c011_delay_queue_batch(int controller_number, const std::vector<const C011_queue_element *>& elements, ControllerSettingsStruct& ControllerSettings) {
+// *INDENT-ON*
+  const C011_queue_element& first = *elements[0];
+
+  // Requests to the same URI with the same method and header are combined into a single request.
+  // JSON object bodies are combined into a JSON array.
+  // Other bodies are sent as separate lines, like the line protocol used by InfluxDB.
+  const bool isJson   = C011_isJsonObject(first.postStr);
+  size_t   nrElements = 1;
+
+  if (!first.postStr.isEmpty()) {
+    while (nrElements < elements.size() &&
+           !elements[nrElements]->postStr.isEmpty() &&
+           (C011_isJsonObject(elements[nrElements]->postStr) == isJson) &&
+           elements[nrElements]->uri.equals(first.uri) &&
+           elements[nrElements]->HttpMethod.equals(first.HttpMethod) &&
+           elements[nrElements]->header.equals(first.header)) {
+      ++nrElements;
+    }
+  }
+
+  if (nrElements == 1) {
+    return do_process_c011_delay_queue(controller_number, first, ControllerSettings) ? 1 : 0;
+  }
+
+  if (!NetworkConnected()) { return 0; }
+
+  String postStr;
+  size_t totalLength = 2;
+
+  for (size_t i = 0; i < nrElements; ++i) {
+    totalLength += elements[i]->postStr.length() + 1;
+  }
+  postStr.reserve(totalLength);
+
+  if (isJson) {
+    postStr += '[';
+  }
+
+  for (size_t i = 0; i < nrElements; ++i) {
+    if (i != 0) {
+      postStr += isJson ? ',' : '\n';
+    }
+    postStr += elements[i]->postStr;
+  }
+
+  if (isJson) {
+    postStr += ']';
+  }
+
+  WiFiClient client;
+  int httpCode = -1;
+
+  send_via_http(
+    controller_number,
+    ControllerSettings,
+    first.controller_idx,
+    client,
+    first.uri,
+    first.HttpMethod,
+    first.header,
+    postStr,
+    httpCode);
+
+  if (httpCode >= 100 && httpCode < 300) {
+    return nrElements;
+  }
+  return 0;
+}
+
+// Body starts with '{', so it must be combined with other bodies as a JSON array.
+bool C011_isJsonObject(const String& body) {
+  for (size_t i = 0; i < body.length(); ++i) {
+    if (!isspace(body[i])) {
+      return body[i] == '{';
+    }
+  }
+  return false;
+}
+
 bool load_C011_ConfigStruct(controllerIndex_t ControllerIndex, String& HttpMethod, String& HttpUri, String& HttpHeader, String& HttpBody) {
   // Just copy the needed strings and destruct the C011_ConfigStruct as soon as possible
   std::shared_ptr<C011_ConfigStruct> customConfig(new C011_ConfigStruct);
@@ -236,37 +323,34 @@ boolean Create_schedule_HTTP_C011(struct EventStruct *event)
   }
   LoadTaskSettings(event->TaskIndex);
 
-  // Add a new element to the queue with the minimal payload
-  bool success = C011_DelayHandler->addToQueue(C011_queue_element(event));
+  // Fill the element before adding it to the queue, as it may be stored in the spill file.
+  C011_queue_element element(event);
 
-  if (success) {
-    // Element was added.
-    // Now we try to append to the existing element
-    // and thus preventing the need to create a long string only to copy it to a queue element.
-    C011_queue_element& element = C011_DelayHandler->sendQueue.back();
-
-    if (!load_C011_ConfigStruct(event->ControllerIndex, element.HttpMethod, element.uri, element.header, element.postStr))
-    {
-      if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
-        String log = F("C011   : ");
-        log += element.HttpMethod;
-        log += element.uri;
-        log += element.header;
-        log += element.postStr;
-        addLog(LOG_LEVEL_ERROR, log);
-      }
-      C011_DelayHandler->sendQueue.pop_back();
-      return false;
+  if (!load_C011_ConfigStruct(event->ControllerIndex, element.HttpMethod, element.uri, element.header, element.postStr))
+  {
+    if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+      String log = F("C011   : ");
+      log += element.HttpMethod;
+      log += element.uri;
+      log += element.header;
+      log += element.postStr;
+      addLog(LOG_LEVEL_ERROR, log);
     }
+    return false;
+  }
 
-    ReplaceTokenByValue(element.uri,    event, false);
-    ReplaceTokenByValue(element.header, event, false);
+  // Each template has its own number, so the parsed templates are kept apart.
+  ReplaceTokenByValue(element.uri,    event, false, 0);
+  ReplaceTokenByValue(element.header, event, false, 1);
 
-    if (element.postStr.length() > 0)
-    {
-      ReplaceTokenByValue(element.postStr, event, C011_sendBinary);
-    }
-  } else {
+  if (element.postStr.length() > 0)
+  {
+    ReplaceTokenByValue(element.postStr, event, C011_sendBinary, 2);
+  }
+
+  const bool success = C011_DelayHandler->addToQueue(std::move(element));
+
+  if (!success) {
     addLog(LOG_LEVEL_ERROR, F("C011  : Could not add to delay handler"));
   }
 
@@ -328,7 +412,7 @@ void DeleteNotNeededValues(String& s, byte numberOfValuesWanted)
 // in case of a sensor with 2 values:
 // SENSORVALUENAME1____TASKNAME1____VALUE1__SENSORVALUENAME2____TASKNAME2____VALUE2
 // ********************************************************************************
-void ReplaceTokenByValue(String& s, struct EventStruct *event, bool sendBinary)
+void ReplaceTokenByValue(String& s, struct EventStruct *event, bool sendBinary, uint8_t templateNr)
 {
   // example string:
   // write?db=testdb&type=%1%%vname1%%/1%%2%;%vname2%%/2%%3%;%vname3%%/3%%4%;%vname4%%/4%&value=%1%%val1%%/1%%2%;%val2%%/2%%3%;%val3%%/3%%4%;%val4%%/4%
@@ -347,7 +431,7 @@ void ReplaceTokenByValue(String& s, struct EventStruct *event, bool sendBinary)
     addLog(LOG_LEVEL_DEBUG_MORE, s);
   }
 
-  parseControllerVariables(s, event, !sendBinary);
+  parseControllerVariables(s, event, !sendBinary, templateNr);
 
   if (loglevelActiveFor(LOG_LEVEL_DEBUG_MORE)) {
     addLog(LOG_LEVEL_DEBUG_MORE, F("HTTP after replacements: "));
@@ -3,6 +3,7 @@
 
 # include "src/Globals/Nodes.h"
 # include "src/DataStructs/C013_p2p_dataStructs.h"
+# include "src/DataStructs/C013_p2p_SensorDataBatch.h"
 # include "src/ESPEasyCore/ESPEasyRules.h"
 # include "src/Helpers/Misc.h"
 # include "src/Helpers/Network.h"
@@ -15,8 +16,15 @@
 # define CPLUGIN_ID_013         13
 # define CPLUGIN_NAME_013       "ESPEasy P2P Networking"
 
+// Interval to send the full state of all tasks to nodes receiving batched sensor data
+# define C013_FULL_STATE_INTERVAL  60000
+
 WiFiUDP C013_portUDP;
 
+C013_SensorDataBatchEncoder *C013_batchEncoder = nullptr;
+C013_SensorDataSequence      C013_receivedSequence;
+unsigned long                C013_nextFullState = 0;
+
 
 bool CPlugin_013(CPlugin::Function function, struct EventStruct *event, String& string)
 {
@@ -43,15 +51,58 @@ bool CPlugin_013(CPlugin::Function function, struct EventStruct *event, String&
       break;
     }
 
+    case CPlugin::Function::CPLUGIN_INIT:
+    {
+      if (C013_batchEncoder == nullptr) {
+        C013_batchEncoder = new (std::nothrow) C013_SensorDataBatchEncoder();
+      }
+      C013_nextFullState = millis() + C013_FULL_STATE_INTERVAL;
+      success            = true;
+      break;
+    }
+
+    case CPlugin::Function::CPLUGIN_EXIT:
+    {
+      if (C013_batchEncoder != nullptr) {
+        delete C013_batchEncoder;
+        C013_batchEncoder = nullptr;
+      }
+      break;
+    }
+
     case CPlugin::Function::CPLUGIN_TASK_CHANGE_NOTIFICATION:
     {
+      if (C013_batchEncoder != nullptr) {
+        C013_batchEncoder->remove(event->TaskIndex);
+      }
       C013_SendUDPTaskInfo(0, event->TaskIndex, event->TaskIndex);
       break;
     }
 
     case CPlugin::Function::CPLUGIN_PROTOCOL_SEND:
     {
+      // Nodes supporting batched frames receive the data with the next call to C013_SendUDPTaskDataBatch()
       C013_SendUDPTaskData(0, event->TaskIndex, event->TaskIndex);
+
+      if (C013_batchEncoder != nullptr) {
+        float values[VARS_PER_TASK];
+
+        for (byte x = 0; x < VARS_PER_TASK; x++) {
+          const userVarIndex_t userVarIndex = event->TaskIndex * VARS_PER_TASK + x;
+          values[x] = validUserVarIndex(userVarIndex) ? UserVar[userVarIndex] : 0.0f;
+        }
+        C013_batchEncoder->update(event->TaskIndex, values, VARS_PER_TASK);
+      }
+      break;
+    }
+
+    case CPlugin::Function::CPLUGIN_TEN_PER_SECOND:
+    {
+      if ((C013_batchEncoder != nullptr) && timeOutReached(C013_nextFullState)) {
+        C013_nextFullState = millis() + C013_FULL_STATE_INTERVAL;
+        C013_batchEncoder->requestFullState();
+      }
+      C013_SendUDPTaskDataBatch();
       break;
     }
 
@@ -124,6 +175,18 @@ void C013_SendUDPTaskInfo(byte destUnit, byte sourceTaskIndex, byte destTaskInde
   delay(50);
 }
 
+// Nodes running a build supporting the batched sensor data frames, see C013_p2p_SensorDataBatch.h
+bool C013_supportsBatch(const NodeStruct& node)
+{
+  switch (node.nodeType) {
+    case NODE_TYPE_ID_ESP_EASY_STD:
+    case NODE_TYPE_ID_ESP_EASYM_STD:
+    case NODE_TYPE_ID_ESP_EASY32_STD:
+      return node.build >= C013_BATCH_MIN_BUILD;
+  }
+  return false;
+}
+
 void C013_SendUDPTaskData(byte destUnit, byte sourceTaskIndex, byte destTaskIndex)
 {
   if (!NetworkConnected(10)) {
@@ -149,17 +212,56 @@ void C013_SendUDPTaskData(byte destUnit, byte sourceTaskIndex, byte destTaskInde
     C013_sendUDP(destUnit, (byte *)&dataReply, sizeof(C013_SensorDataStruct));
     delay(10);
   } else {
+    bool sent = false;
+
     for (NodesMap::iterator it = Nodes.begin(); it != Nodes.end(); ++it) {
-      if (it->first != Settings.Unit) {
+      if ((it->first != Settings.Unit) &&
+          ((C013_batchEncoder == nullptr) || !C013_supportsBatch(it->second))) {
         dataReply.destUnit = it->first;
         C013_sendUDP(it->first, (byte *)&dataReply, sizeof(C013_SensorDataStruct));
         delay(10);
+        sent = true;
       }
     }
+
+    if (!sent) { return; }
   }
   delay(50);
 }
 
+// Send the pending task updates to all nodes supporting batched frames.
+void C013_SendUDPTaskDataBatch()
+{
+  if ((C013_batchEncoder == nullptr) || !C013_batchEncoder->hasPending() || !NetworkConnected(10)) {
+    return;
+  }
+  bool hasBatchNodes = false;
+
+  for (NodesMap::iterator it = Nodes.begin(); it != Nodes.end() && !hasBatchNodes; ++it) {
+    hasBatchNodes = (it->first != Settings.Unit) && C013_supportsBatch(it->second);
+  }
+
+  if (!hasBatchNodes) {
+    // Keep the updates until a node is found which can receive them.
+    return;
+  }
+  byte frame[C013_BATCH_FRAME_SIZE_MAX];
+
+  while (C013_batchEncoder->hasPending()) {
+    const size_t size = C013_batchEncoder->encodeFrame(Settings.Unit, 0, frame);
+
+    if (size == 0) { return; }
+
+    for (NodesMap::iterator it = Nodes.begin(); it != Nodes.end(); ++it) {
+      if ((it->first != Settings.Unit) && C013_supportsBatch(it->second)) {
+        frame[3] = it->first;
+        C013_sendUDP(it->first, frame, size);
+        delay(10);
+      }
+    }
+  }
+}
+
 /*********************************************************************************************\
    Send UDP message (unit 255=broadcast)
 \*********************************************************************************************/
@@ -217,7 +319,7 @@ void C013_Receive(struct EventStruct *event) {
 # ifndef BUILD_NO_DEBUG
 
   if (loglevelActiveFor(LOG_LEVEL_DEBUG_MORE)) {
-    if ((event->Data[1] > 1) && (event->Data[1] < 6))
+    if ((event->Data[1] > 1) && (event->Data[1] <= C013_BATCH_FRAME_ID))
     {
       String log = (F("C013 : msg "));
 
@@ -307,6 +409,47 @@ void C013_Receive(struct EventStruct *event) {
       }
       break;
     }
+
+    case C013_BATCH_FRAME_ID: // batched sensor data
+    {
+      C013_SensorDataBatchDecoder decoder;
+      C013_SensorDataBatchRecord  record;
+
+      if (!decoder.init(event->Data, event->Par2)) { break; }
+
+      while (decoder.next(record)) {
+        if (!validTaskIndex(record.taskIndex)) { continue; }
+
+        // only if this task has a remote feed, update values
+        const byte remoteFeed = Settings.TaskDeviceDataFeed[record.taskIndex];
+
+        if ((remoteFeed == 0) || (remoteFeed != decoder.sourceUnit())) { continue; }
+
+        if (!Settings.TaskDeviceEnabled[record.taskIndex]) {
+          // Start again with the next update received when the task is enabled.
+          C013_receivedSequence.reset(record.taskIndex);
+          continue;
+        }
+        bool newUpdate = false;
+
+        if (!C013_receivedSequence.accept(record.taskIndex, decoder.sourceUnit(), record.sequence, record.fullState, newUpdate)) { continue; }
+
+        for (byte x = 0; x < VARS_PER_TASK; x++)
+        {
+          if (record.valueMask & (1 << x)) {
+            UserVar[record.taskIndex * VARS_PER_TASK + x] = record.values[x];
+          }
+        }
+
+        // Like with the single task frames, every task update generates rule events,
+        // also when no value changed. A resend of the full state does not.
+        if (Settings.UseRules && newUpdate) {
+          struct EventStruct TempEvent(record.taskIndex);
+          createRuleEvents(&TempEvent);
+        }
+      }
+      break;
+    }
   }
 }
 
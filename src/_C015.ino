@@ -167,14 +167,9 @@ bool CPlugin_015(CPlugin::Function function, struct EventStruct *event, String&
       // Collect the values at the same run, to make sure all are from the same sample
       byte valueCount = getValueCountForTask(event->TaskIndex);
 
-      
-      success = C015_DelayHandler->addToQueue(C015_queue_element(event, valueCount));
-
-      if (success) {
-        // Element was added.
-        // Now we try to append to the existing element
-        // and thus preventing the need to create a long string only to copy it to a queue element.
-        C015_queue_element& element = C015_DelayHandler->sendQueue.back();
+      // Fill the element before adding it to the queue, as it may be stored in the spill file.
+      C015_queue_element element(event, valueCount);
+      {
         LoadTaskSettings(event->TaskIndex);
 
         for (byte x = 0; x < valueCount; x++)
@@ -220,6 +215,7 @@ bool CPlugin_015(CPlugin::Function function, struct EventStruct *event, String&
           element.txt[x]  = formattedValue;
         }
       }
+      success = C015_DelayHandler->addToQueue(std::move(element));
       Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C015_DELAY_QUEUE, C015_DelayHandler->getNextScheduleTime());
       break;
     }
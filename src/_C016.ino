@@ -15,6 +15,9 @@
    - task index delivering the data
    - 4 float values
 
+   Samples are stored in a compact format, see src/DataStructs/ControllerCacheBlock.h
+   Optionally values are rounded to the number of decimals set in the task, to store them as small integers.
+
    These are the result of any plugin sending data to this controller.
 
    The controller can save the samples from RTC memory to several places on the flash:
@@ -33,6 +36,8 @@
 # define CPLUGIN_ID_016         16
 # define CPLUGIN_NAME_016       "Cache Controller [Experimental]"
 
+bool C016_cacheQuantize = false;
+
 // #include <ArduinoJson.h>
 
 bool CPlugin_016(CPlugin::Function function, struct EventStruct *event, String& string)
@@ -66,6 +71,14 @@ bool CPlugin_016(CPlugin::Function function, struct EventStruct *event, String&
 
     case CPlugin::Function::CPLUGIN_INIT:
     {
+      {
+        MakeControllerSettings(ControllerSettings);
+
+        if (AllocatedControllerSettings()) {
+          LoadControllerSettings(event->ControllerIndex, ControllerSettings);
+          C016_cacheQuantize = ControllerSettings.cacheQuantize();
+        }
+      }
       success = init_c016_delay_queue(event->ControllerIndex);
       ControllerCache.init();
       break;
@@ -79,6 +92,15 @@ bool CPlugin_016(CPlugin::Function function, struct EventStruct *event, String&
 
     case CPlugin::Function::CPLUGIN_WEBFORM_LOAD:
     {
+      // Place in scope to delete ControllerSettings as soon as it is no longer needed
+      MakeControllerSettings(ControllerSettings);
+
+      if (!AllocatedControllerSettings()) {
+        addHtmlError(F("Out of memory, cannot load page"));
+      } else {
+        LoadControllerSettings(event->ControllerIndex, ControllerSettings);
+        addControllerParameterForm(ControllerSettings, event->ControllerIndex, ControllerSettingsStruct::CONTROLLER_CACHE_QUANTIZE);
+      }
       break;
     }
 
@@ -99,7 +121,29 @@ bool CPlugin_016(CPlugin::Function function, struct EventStruct *event, String&
       // Collect the values at the same run, to make sure all are from the same sample
       byte valueCount = getValueCountForTask(event->TaskIndex);
       C016_queue_element element(event, valueCount, node_time.getUnixTime());
-      success = ControllerCache.write((uint8_t *)&element, sizeof(element));
+      ControllerCacheSample sample;
+
+      for (byte i = 0; i < VARS_PER_TASK; ++i) {
+        sample.values[i] = element.values[i];
+      }
+      sample.timestamp      = element._timestamp;
+      sample.TaskIndex      = element.TaskIndex;
+      sample.controller_idx = element.controller_idx;
+      sample.sensorType     = element.sensorType;
+      sample.valueCount     = element.valueCount;
+
+      if (C016_cacheQuantize) {
+        // Use the largest number of decimals of the task values, so no value loses precision.
+        LoadTaskSettings(event->TaskIndex);
+        sample.decimals = 0;
+
+        for (byte i = 0; i < valueCount; ++i) {
+          if (ExtraTaskSettings.TaskDeviceValueDecimals[i] > sample.decimals) {
+            sample.decimals = ExtraTaskSettings.TaskDeviceValueDecimals[i];
+          }
+        }
+      }
+      success = ControllerCache.write(sample);
 
       /*
               if (C016_DelayHandler == nullptr) {
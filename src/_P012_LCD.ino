@@ -217,7 +217,7 @@ boolean Plugin_012(byte function, struct EventStruct *event, String& string)
 
           if (tmpString.length())
           {
-            String newString = P012_data->P012_parseTemplate(tmpString, P012_data->Plugin_012_cols);
+            String newString = P012_data->P012_parseTemplate(tmpString, P012_data->Plugin_012_cols, event->TaskIndex, x);
             P012_data->lcdWrite(newString, 0, x);
           }
         }
@@ -232,7 +232,7 @@ boolean Plugin_023(byte function, struct EventStruct *event, String& string)
         {
           if (strings[x].length())
           {
-            String newString = P023_data->parseTemplate(strings[x], 16);
+            String newString = P023_data->parseTemplate(strings[x], 16, event->TaskIndex, x);
             P023_data->sendStrXY(newString.c_str(), x, 0);
           }
         }
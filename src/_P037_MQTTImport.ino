@@ -109,10 +109,21 @@ boolean Plugin_037(byte function, struct EventStruct *event, String& string)
           //		Subscribe to ALL the topics from ALL instance of this import module
           MQTTSubscribe_037(event);
           success = true;
+        } else {
+          // Register the subscriptions, to be able to route messages as soon as connected.
+          String subscriptions[VARS_PER_TASK];
+          P037_loadSubscriptions(event->TaskIndex, subscriptions);
+          P037_registerSubscriptions(event->TaskIndex, subscriptions);
         }
       }
       break;
 
+    case PLUGIN_EXIT:
+      {
+        P037_MQTTImport_subscriptions.remove(event->TaskIndex);
+        break;
+      }
+
     case PLUGIN_READ:
       {
         // This routine does not output any data and so we do not need to respond to regular read requests
@@ -144,69 +155,67 @@ boolean Plugin_037(byte function, struct EventStruct *event, String& string)
         //   Topic:   event->String1;
         //   Payload: event->String2;
 
-        // Get the Topic and see if it matches any of the subscriptions
-        char deviceTemplate[VARS_PER_TASK][41];		// variable for saving the subscription topics
+        // This event is scheduled once per incoming message, not per task.
+        // Look up all task values subscribed to the topic and set them.
+        std::vector<MQTT_TopicTrie::Subscriber> subscribers;
+        P037_MQTTImport_subscriptions.match(event->String1.c_str(), subscribers);
 
-        LoadTaskSettings(event->TaskIndex);
-        LoadCustomTaskSettings(event->TaskIndex, (byte*)&deviceTemplate, sizeof(deviceTemplate));
+        // FIXME TD-er: It may be useful to generate events with string values.
+        float floatPayload;
+        const bool validPayload = string2float(event->String2, floatPayload);
 
-        for (byte x = 0; x < VARS_PER_TASK; x++)
+        for (auto it = subscribers.begin(); it != subscribers.end(); ++it)
         {
-          String subscriptionTopic = deviceTemplate[x];
-          subscriptionTopic.trim();
-          if (subscriptionTopic.isEmpty()) continue;							// skip blank subscriptions
+          if (!Settings.TaskDeviceEnabled[it->taskIndex] || (Settings.TaskDeviceNumber[it->taskIndex] != PLUGIN_ID_037)) {
+            continue;
+          }
+          event->setTaskIndex(it->taskIndex);
+          LoadTaskSettings(event->TaskIndex);
 
-          // Now check if the incoming topic matches one of our subscriptions
-          parseSystemVariables(subscriptionTopic, false);
-          if (MQTTCheckSubscription_037(event->String1, subscriptionTopic))
-          {
-            // FIXME TD-er: It may be useful to generate events with string values.
-            float floatPayload;
-            if (!string2float(event->String2, floatPayload)) {
-              if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
-                String log = F("IMPT : Bad Import MQTT Command ");
-                log += event->String1;
-                addLog(LOG_LEVEL_ERROR, log);
-              }
-              if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-                String log = F("ERR  : Illegal Payload ");
-                log += event->String2;
-                log += ' ';
-                log += getTaskDeviceName(event->TaskIndex);
-                addLog(LOG_LEVEL_INFO, log);
-              }
-              success = false;
-              break;
+          if (!validPayload) {
+            if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+              String log = F("IMPT : Bad Import MQTT Command ");
+              log += event->String1;
+              addLog(LOG_LEVEL_ERROR, log);
             }
-
-            UserVar[event->BaseVarIndex + x] = floatPayload;							// Save the new value
-
-            // Log the event
             if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-              String log = F("IMPT : [");
+              String log = F("ERR  : Illegal Payload ");
+              log += event->String2;
+              log += ' ';
               log += getTaskDeviceName(event->TaskIndex);
-              log += F("#");
-              log += ExtraTaskSettings.TaskDeviceValueNames[x];
-              log += F("] : ");
-              log += floatPayload;
               addLog(LOG_LEVEL_INFO, log);
             }
+            continue;
+          }
+          const byte x = it->valueIndex;
+
+          UserVar[event->BaseVarIndex + x] = floatPayload;							// Save the new value
+
+          // Log the event
+          if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+            String log = F("IMPT : [");
+            log += getTaskDeviceName(event->TaskIndex);
+            log += F("#");
+            log += ExtraTaskSettings.TaskDeviceValueNames[x];
+            log += F("] : ");
+            log += floatPayload;
+            addLog(LOG_LEVEL_INFO, log);
+          }
 
-            // Generate event for rules processing - proposed by TridentTD
-
-            if (Settings.UseRules)
-            {
-              String RuleEvent;
-              RuleEvent += getTaskDeviceName(event->TaskIndex);
-              RuleEvent += '#';
-              RuleEvent += ExtraTaskSettings.TaskDeviceValueNames[x];
-              RuleEvent += '=';
-              RuleEvent += floatPayload;
-              eventQueue.addMove(std::move(RuleEvent));
-            }
+          // Generate event for rules processing - proposed by TridentTD
 
-            success = true;
+          if (Settings.UseRules)
+          {
+            String RuleEvent;
+            RuleEvent += getTaskDeviceName(event->TaskIndex);
+            RuleEvent += '#';
+            RuleEvent += ExtraTaskSettings.TaskDeviceValueNames[x];
+            RuleEvent += '=';
+            RuleEvent += floatPayload;
+            eventQueue.addMove(std::move(RuleEvent));
           }
+
+          success = true;
         }
 
         break;
@@ -216,20 +225,54 @@ boolean Plugin_037(byte function, struct EventStruct *event, String& string)
 
   return success;
 }
+
+// Load the subscriptions of the task, with system variables parsed.
+// Blank subscriptions are returned as empty strings.
+void P037_loadSubscriptions(taskIndex_t taskIndex, String subscriptions[])
+{
+  char deviceTemplate[VARS_PER_TASK][41];		// variable for saving the subscription topics
+  LoadCustomTaskSettings(taskIndex, (byte*)&deviceTemplate, sizeof(deviceTemplate));
+
+  for (byte x = 0; x < VARS_PER_TASK; x++)
+  {
+    subscriptions[x] = deviceTemplate[x];
+    subscriptions[x].trim();
+
+    if (subscriptions[x].length() > 0) {
+      parseSystemVariables(subscriptions[x], false);
+    }
+  }
+}
+
+// (Re)register the subscriptions of the task.
+// Incoming messages are matched against the subscriptions of all MQTT import tasks at once.
+void P037_registerSubscriptions(taskIndex_t taskIndex, const String subscriptions[])
+{
+  P037_MQTTImport_subscriptions.remove(taskIndex);
+  for (byte x = 0; x < VARS_PER_TASK; x++)
+  {
+    if (subscriptions[x].length() > 0) {
+      P037_MQTTImport_subscriptions.add(subscriptions[x], taskIndex, x);
+    }
+  }
+}
+
 bool MQTTSubscribe_037(struct EventStruct *event)
 {
   // We must subscribe to the topics.
-  char deviceTemplate[VARS_PER_TASK][41];		// variable for saving the subscription topics
-  LoadCustomTaskSettings(event->TaskIndex, (byte*)&deviceTemplate, sizeof(deviceTemplate));
+  String subscriptions[VARS_PER_TASK];
+  P037_loadSubscriptions(event->TaskIndex, subscriptions);
+
+  // System variables in the topics may have changed since the task was initialized.
+  P037_registerSubscriptions(event->TaskIndex, subscriptions);
 
   // Now loop over all import variables and subscribe to those that are not blank
   for (byte x = 0; x < VARS_PER_TASK; x++)
   {
-    String subscribeTo = deviceTemplate[x];
+    const String& subscribeTo = subscriptions[x];
 
     if (subscribeTo.length() > 0)
     {
-      parseSystemVariables(subscribeTo, false);
       if (MQTTclient.subscribe(subscribeTo.c_str()))
       {
         if (loglevelActiveFor(LOG_LEVEL_INFO)) {
@@ -257,71 +300,4 @@ bool MQTTSubscribe_037(struct EventStruct *event)
   return true;
 }
 
-//
-// Check to see if Topic matches the MQTT subscription
-//
-bool MQTTCheckSubscription_037(const String& Topic, const String& Subscription) {
-  if (Topic.isEmpty() || Subscription.isEmpty())  {
-    return false;
-  }
-
-  String tmpTopic = Topic;
-  String tmpSub = Subscription;
-
-  tmpTopic.trim();
-  tmpSub.trim();
-
-  // Get rid of leading '/'
-  if (tmpTopic[0] == '/') { tmpTopic = tmpTopic.substring(1); }
-  if (tmpSub[0] == '/') { tmpSub = tmpSub.substring(1); }
-
-  // Add trailing / if required
-
-  int lenTopic = tmpTopic.length();
-  if (tmpTopic.substring(lenTopic - 1, lenTopic) != "/")tmpTopic += '/';
-
-  int lenSub = tmpSub.length();
-  if (tmpSub.substring(lenSub - 1, lenSub) != "/")tmpSub += '/';
-
-  // Now get first part
-
-  int SlashTopic;
-  int SlashSub;
-  int count = 0;
-
-  String pTopic;
-  String pSub;
-
-  while (count < 10) {
-
-    //  Get locations of the first /
-
-    SlashTopic = tmpTopic.indexOf('/');
-    SlashSub = tmpSub.indexOf('/');
-
-    //  If no slashes found then match is OK
-    //  If only one slash found then not OK
-
-    if ((SlashTopic == -1) && (SlashSub == -1)) return true;
-    if ((SlashTopic == -1) && (SlashSub != -1)) return false;
-    if ((SlashTopic != -1) && (SlashSub == -1)) return false;
-
-    //  Get the values for the current subtopic
-
-    pTopic = tmpTopic.substring(0, SlashTopic);
-    pSub = tmpSub.substring(0, SlashSub);
-
-    //  And strip the subtopic from the topic
-
-    tmpTopic = tmpTopic.substring(SlashTopic + 1);
-    tmpSub = tmpSub.substring(SlashSub + 1);
-
-    //  If the subtopics match then OK - otherwise fail
-    if (pSub == "#")  return true;
-    if ((pTopic != pSub) && (pSub != "+"))return false;
-
-    count = count + 1;
-  }
-  return false;
-}
 #endif // USES_P037
@@ -29,10 +29,12 @@
 #include "../Helpers/Convert.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Memory.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/PortStatus.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringParser.h"
+#include "../Helpers/msecTimerHandlerStruct.h"
 
 #include <map>
 #include <stdint.h>
@@ -143,6 +145,127 @@ const __FlashStringHelper * Command_Background(struct EventStruct *event, const
   serialPrintln(F("end"));
   return return_see_serial(event);
 }
+
+struct TimerBenchmarkStats {
+  void add(unsigned long duration) {
+    total += duration;
+    ++count;
+
+    if (duration > worst) { worst = duration; }
+  }
+
+  void appendTo(String& result, const __FlashStringHelper *label) const {
+    result += label;
+    result += count > 0 ? total / count : 0;
+    result += '/';
+    result += worst;
+  }
+
+  unsigned long total = 0;
+  unsigned long worst = 0;
+  unsigned long count = 0;
+};
+
+String Command_TimerBenchmark(struct EventStruct *event, const char *Line)
+{
+  // Syntax: timerbenchmark[,<nr timers>]
+  // Stress test of the scheduler timer queue, using a separate queue so the scheduled jobs are not affected.
+  // Reports average/worst case duration in usec.
+  const int nrTimers = event->Par1 > 0 ? event->Par1 : 1000;
+
+  const unsigned long freeMemBefore = FreeMem();
+  unsigned long freeMemLoaded       = 0;
+  TimerBenchmarkStats insertStats, rescheduleStats, scheduleStats, cancelStats;
+
+  {
+    msecTimerHandlerStruct timerQueue;
+    timerQueue.setEcoMode(false);
+    const unsigned long now = millis();
+
+    // Spread the timers over 1 second, like a mix of task, rules and controller timers.
+    for (int i = 1; i <= nrTimers; ++i) {
+      const unsigned long start = micros();
+      timerQueue.registerAt(i, now + ((i * 7919) % 1000));
+      insertStats.add(usecPassedSince(start));
+    }
+    freeMemLoaded = FreeMem();
+
+    for (int i = 1; i <= nrTimers; ++i) {
+      const unsigned long start = micros();
+      timerQueue.registerAt(i, now + ((i * 104729) % 1000) - 2000);
+      rescheduleStats.add(usecPassedSince(start));
+    }
+
+    // All timers are due, handle each and set it again like an interval timer does.
+    for (int i = 0; i < nrTimers; ++i) {
+      const unsigned long start = micros();
+      unsigned long timer       = 0;
+      const unsigned long id    = timerQueue.getNextId(timer);
+
+      if (id != 0) {
+        timerQueue.registerAt(id, timer + 10000);
+      }
+      scheduleStats.add(usecPassedSince(start));
+    }
+
+    for (int i = 1; i <= nrTimers; ++i) {
+      const unsigned long start = micros();
+      timerQueue.remove(i);
+      cancelStats.add(usecPassedSince(start));
+    }
+    delay(0);
+  }
+
+  String result = F("Timers: ");
+
+  result += nrTimers;
+  insertStats.appendTo(result, F(" insert: "));
+  rescheduleStats.appendTo(result, F(" reschedule: "));
+  scheduleStats.appendTo(result, F(" handle: "));
+  cancelStats.appendTo(result, F(" cancel: "));
+  result += F(" usec (avg/max), free heap: ");
+  result += freeMemBefore;
+  result += F(" -> ");
+  result += freeMemLoaded;
+  return return_result(event, result);
+}
+
+String Command_SysVarBenchmark(struct EventStruct *event, const char *Line)
+{
+  // Syntax: sysvarbenchmark[,<nr runs>]
+  // Parse a 200 character template with 10 system variables.
+  // Reports average/worst case duration in usec, also included in the PARSE_SYSVAR timing stats.
+  const int nrRuns = event->Par1 > 0 ? event->Par1 : 100;
+
+  const String  sysvarTemplate = F("Unit %unit% %sysname% up %uptime% min, heap %sysheap% load %sysload%% "
+                                   "at %systime% on %sysday_0%-%sysmonth_0%-%sysyear% RSSI %rssi% dBm - "
+                                   "some text to fill up a typical display, or controller message.");
+  TimerBenchmarkStats parseStats;
+  size_t outputLength = 0;
+
+  for (int i = 0; i < nrRuns; ++i) {
+    String s(sysvarTemplate);
+    const unsigned long start = micros();
+    parseSystemVariables(s, false);
+    parseStats.add(usecPassedSince(start));
+    outputLength = s.length();
+
+    if ((i % 10) == 0) {
+      delay(0);
+    }
+  }
+
+  String result = F("Template: ");
+
+  result += sysvarTemplate.length();
+  result += F(" -> ");
+  result += outputLength;
+  result += F(" chars, runs: ");
+  result += nrRuns;
+  parseStats.appendTo(result, F(" parse: "));
+  result += F(" usec (avg/max)");
+  return return_result(event, result);
+}
 #endif // BUILD_NO_DIAGNOSTIC_COMMANDS
 
 const __FlashStringHelper * Command_Debug(struct EventStruct *event, const char *Line)
@@ -17,6 +17,8 @@ const __FlashStringHelper * Command_SerialFloat(struct EventStruct *event, const
 const __FlashStringHelper * Command_MemInfo(struct EventStruct *event, const char* Line);
 const __FlashStringHelper * Command_MemInfo_detail(struct EventStruct *event, const char* Line);
 const __FlashStringHelper * Command_Background(struct EventStruct *event, const char* Line);
+String Command_TimerBenchmark(struct EventStruct *event, const char* Line);
+String Command_SysVarBenchmark(struct EventStruct *event, const char* Line);
 #endif
 const __FlashStringHelper * Command_Debug(struct EventStruct *event, const char* Line);
 const __FlashStringHelper * Command_logentry(struct EventStruct *event, const char* Line);
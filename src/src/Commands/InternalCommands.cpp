@@ -303,6 +303,12 @@ bool executeInternalCommand(command_case_data & data)
       COMMAND_CASE_A("executerules", Command_Rules_Execute, -1); // Rule.h
       break;
     }
+    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+    case 'f': {
+      COMMAND_CASE_R("formulabenchmark", Command_Rules_FormulaBenchmark, 1); // Rule.h
+      break;
+    }
+    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
     case 'g': {
       COMMAND_CASE_R(   "gateway", Command_Gateway,     1); // Network Command
       COMMAND_CASE_A(      "gpio", Command_GPIO,        2); // Gpio.h
@@ -394,6 +400,9 @@ bool executeInternalCommand(command_case_data & data)
       COMMAND_CASE_A(               "restart", Command_System_Reboot,              0); // System.h
       COMMAND_CASE_A(                 "rtttl", Command_GPIO_RTTTL,                -1); // GPIO.h
       COMMAND_CASE_A(                 "rules", Command_Rules_UseRules,             1); // Rule.h
+    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+      COMMAND_CASE_R(        "rulesbenchmark", Command_Rules_Benchmark,           -1); // Rule.h
+    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
       break;
     }
     case 's': {
@@ -422,6 +431,7 @@ bool executeInternalCommand(command_case_data & data)
     #endif // USES_MQTT
     #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
       COMMAND_CASE_A(  "sysload", Command_SysLoad,        0);     // Diagnostic.h
+      COMMAND_CASE_R("sysvarbenchmark", Command_SysVarBenchmark, -1); // Diagnostic.h
     #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
       break;
     }
@@ -436,6 +446,9 @@ bool executeInternalCommand(command_case_data & data)
         COMMAND_CASE_A(   "taskvaluetoggle", Command_Task_ValueToggle,    2); // Tasks.h
         COMMAND_CASE_A("taskvaluesetandrun", Command_Task_ValueSetAndRun, 3); // Tasks.h
       } else if (data.cmd_lc[1] == 'i') {
+      #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+        COMMAND_CASE_R("timerbenchmark", Command_TimerBenchmark, -1);         // Diagnostic.h
+      #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
         COMMAND_CASE_A( "timerpause", Command_Timer_Pause,  1);               // Timers.h
         COMMAND_CASE_A("timerresume", Command_Timer_Resume, 1);               // Timers.h
         COMMAND_CASE_A(   "timerset", Command_Timer_Set,    2);               // Timers.h
@@ -12,9 +12,12 @@
 #include "../ESPEasyCore/ESPEasyRules.h"
 
 #include "../Globals/EventQueue.h"
+#include "../Globals/RulesIndex.h"
 #include "../Globals/RuntimeData.h"
 #include "../Globals/Settings.h"
 
+#include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Memory.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/Rules_calculate.h"
 #include "../Helpers/StringConverter.h"
@@ -68,6 +71,114 @@ const __FlashStringHelper * Command_Rules_Events(struct EventStruct *event, cons
   return return_command_success();
 }
 
+#ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+String Command_Rules_Benchmark(struct EventStruct *event, const char *Line)
+{
+  // Syntax: rulesbenchmark,<nr runs>,<event>
+  // Process the event repeatedly, first by parsing the rules files and then via the rules index.
+  // N.B. The actions in the matching rules are executed as well.
+  String eventName = parseStringToEndKeepCase(Line, 3);
+
+  if (!Settings.UseRules || (event->Par1 <= 0) || eventName.isEmpty()) {
+    return return_command_failed();
+  }
+  eventName.replace('$', '#');
+
+  // Make sure the time to build the index is included in the measurement.
+  rulesIndex.invalidate();
+  const unsigned long freeMemBefore = FreeMem();
+
+  String result;
+
+  for (int useRulesIndex = 0; useRulesIndex < 2; ++useRulesIndex) {
+    const unsigned long start = micros();
+
+    for (int i = 0; i < event->Par1; ++i) {
+      rulesProcessingActiveFiles(eventName, useRulesIndex != 0);
+    }
+    const unsigned long duration = usecPassedSince(start);
+
+    result += useRulesIndex ? F(" indexed: ") : F("file: ");
+    result += duration / event->Par1;
+    result += F(" usec/event (");
+    result += duration > 0 ? static_cast<unsigned long>((1000000ull * event->Par1) / duration) : 0ul;
+    result += F(" events/s)");
+  }
+  result += F(" index: ");
+  result += rulesIndex.getMemoryUsage();
+  result += F(" bytes, free heap: ");
+  result += freeMemBefore;
+  result += F(" -> ");
+  result += FreeMem();
+  return return_result(event, result);
+}
+
+String Command_Rules_FormulaBenchmark(struct EventStruct *event, const char *Line)
+{
+  // Syntax: formulabenchmark,<nr runs>
+  // Compute 4 formulas for 32 tasks, first by parsing the formula text like
+  // it was done before formulas were compiled and then via the compiled formulas.
+  if (event->Par1 <= 0) {
+    return return_command_failed();
+  }
+  const __FlashStringHelper * formulas[] = {
+    F("%value%*1.8+32"),
+    F("(%value%-%pvalue%)/60"),
+    F("sqrt(%value%)*2"),
+    F("round(%value%*100)/100")
+  };
+  const int nrTasks    = 32;
+  const int nrFormulas = sizeof(formulas) / sizeof(formulas[0]);
+
+  std::vector<String> formulaText;
+
+  for (int i = 0; i < nrFormulas; ++i) {
+    formulaText.emplace_back(formulas[i]);
+  }
+  RulesCalculateFormulaCache formulaCache;
+  String result;
+  double checksum[2] = { 0.0, 0.0 };
+
+  for (int useCompiled = 0; useCompiled < 2; ++useCompiled) {
+    const unsigned long start = micros();
+
+    for (int run = 0; run < event->Par1; ++run) {
+      for (int task = 0; task < nrTasks; ++task) {
+        for (int varNr = 0; varNr < nrFormulas; ++varNr) {
+          const float value     = 20.0f + task + varNr * 0.25f + run * 0.01f;
+          const float prevValue = value - 1.5f;
+          double res            = 0.0;
+
+          if (useCompiled) {
+            formulaCache.calculate(task * nrFormulas + varNr, formulaText[varNr].c_str(), value, prevValue, res);
+          } else {
+            String formula = formulaText[varNr];
+            formula.replace(F("%pvalue%"), String(prevValue));
+            formula.replace(F("%value%"),  String(value));
+            RulesCalculate.doCalculate(RulesCalculate_t::preProces(formula).c_str(), &res);
+          }
+          checksum[useCompiled] += res;
+        }
+      }
+    }
+    const unsigned long duration = usecPassedSince(start);
+
+    result += useCompiled ? F(" compiled: ") : F("text: ");
+    result += duration / event->Par1;
+    result += F(" usec/");
+    result += nrTasks * nrFormulas;
+    result += F(" formulas (sum ");
+    result += doubleToString(checksum[useCompiled], 2);
+    result += ')';
+  }
+  result += F(" cache: ");
+  result += formulaCache.getMemoryUsage();
+  result += F(" bytes");
+  return return_result(event, result);
+}
+
+#endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+
 const __FlashStringHelper * Command_Rules_Let(struct EventStruct *event, const char *Line)
 {
   String TmpStr1;
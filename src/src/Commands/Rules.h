@@ -1,12 +1,16 @@
 #ifndef COMMAND_RULES_H
 #define COMMAND_RULES_H
 
-#include <Arduino.h>
+#include "../../ESPEasy_common.h"
 
 const __FlashStringHelper * Command_Rules_Execute(struct EventStruct *event, const char *Line);
 String Command_Rules_UseRules(struct EventStruct *event, const char *Line);
 const __FlashStringHelper * Command_Rules_Async_Events(struct EventStruct *event, const char *Line);
 const __FlashStringHelper * Command_Rules_Events(struct EventStruct *event, const char *Line);
 const __FlashStringHelper * Command_Rules_Let(struct EventStruct *event, const char *Line);
+#ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+String Command_Rules_Benchmark(struct EventStruct *event, const char *Line);
+String Command_Rules_FormulaBenchmark(struct EventStruct *event, const char *Line);
+#endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
 
 #endif // COMMAND_RULES_H
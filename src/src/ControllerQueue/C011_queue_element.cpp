@@ -34,4 +34,48 @@ bool C011_queue_element::isDuplicate(const C011_queue_element& other) const {
          other.postStr.equals(postStr);
 }
 
+uint32_t C011_queue_element::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(static_cast<uint8_t>(sensorType));
+  fingerprint.add(idx);
+  fingerprint.add(uri);
+  fingerprint.add(HttpMethod);
+  fingerprint.add(header);
+  fingerprint.add(postStr);
+
+  return fingerprint.get();
+}
+
+void C011_queue_element::serialize(ControllerQueueRecord& record) const {
+  record.writeUint32(idx);
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeByte(static_cast<uint8_t>(sensorType));
+  record.writeString(uri);
+  record.writeString(HttpMethod);
+  record.writeString(header);
+  record.writeString(postStr);
+}
+
+bool C011_queue_element::deserialize(ControllerQueueRecord& record) {
+  uint32_t tmp_idx        = 0;
+  uint8_t  tmp_sensorType = 0;
+
+  if (!record.readUint32(tmp_idx) ||
+      !record.readByte(TaskIndex) ||
+      !record.readByte(controller_idx) ||
+      !record.readByte(tmp_sensorType)) {
+    return false;
+  }
+  idx        = tmp_idx;
+  sensorType = static_cast<Sensor_VType>(tmp_sensorType);
+  return record.readString(uri) &&
+         record.readString(HttpMethod) &&
+         record.readString(header) &&
+         record.readString(postStr);
+}
+
 #endif // ifdef USES_C011
@@ -2,6 +2,8 @@
 #define CONTROLLERQUEUE_C011_QUEUE_ELEMENT_H
 
 #include "../../ESPEasy_common.h"
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/QueueFingerprintSet.h"
 #include "../CustomBuild/ESPEasyLimits.h"
 #include "../DataStructs/DeviceStruct.h"
 #include "../DataStructs/UnitMessageCount.h"
@@ -31,6 +33,14 @@ public:
 
   const UnitMessageCount_t* getUnitMessageCount() const { return nullptr; }
 
+  // Hash of the content compared by isDuplicate(), used for a fast duplicate check.
+  uint32_t getFingerprint() const;
+
+  // Store and restore the element, when spilled to the file system.
+  void serialize(ControllerQueueRecord& record) const;
+
+  bool deserialize(ControllerQueueRecord& record);
+
   size_t getSize() const;
 
   String uri;
@@ -56,4 +56,57 @@ bool C015_queue_element::isDuplicate(const C015_queue_element& other) const {
   return true;
 }
 
+uint32_t C015_queue_element::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(valueCount);
+  fingerprint.add(idx);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    fingerprint.add(txt[i]);
+    fingerprint.add(vPin[i]);
+  }
+
+  return fingerprint.get();
+}
+
+void C015_queue_element::serialize(ControllerQueueRecord& record) const {
+  record.writeUint32(idx);
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeByte(valuesSent);
+  record.writeByte(valueCount);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    record.writeString(txt[i]);
+    record.writeUint32(vPin[i]);
+  }
+}
+
+bool C015_queue_element::deserialize(ControllerQueueRecord& record) {
+  uint32_t tmp_idx = 0;
+
+  if (!record.readUint32(tmp_idx) ||
+      !record.readByte(TaskIndex) ||
+      !record.readByte(controller_idx) ||
+      !record.readByte(valuesSent) ||
+      !record.readByte(valueCount)) {
+    return false;
+  }
+  idx = tmp_idx;
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    uint32_t tmp_vPin = 0;
+
+    if (!record.readString(txt[i]) ||
+        !record.readUint32(tmp_vPin)) {
+      return false;
+    }
+    vPin[i] = tmp_vPin;
+  }
+  return true;
+}
+
 #endif // ifdef USES_C015
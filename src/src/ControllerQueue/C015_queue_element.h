@@ -2,6 +2,8 @@
 #define CONTROLLERQUEUE_C015_QUEUE_ELEMENT_H
 
 #include "../../ESPEasy_common.h"
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/QueueFingerprintSet.h"
 #include "../CustomBuild/ESPEasyLimits.h"
 #include "../DataStructs/UnitMessageCount.h"
 #include "../Globals/CPlugins.h"
@@ -35,6 +37,14 @@ public:
 
   const UnitMessageCount_t* getUnitMessageCount() const { return nullptr; }
 
+  // Hash of the content compared by isDuplicate(), used for a fast duplicate check.
+  uint32_t getFingerprint() const;
+
+  // Store and restore the element, when spilled to the file system.
+  void serialize(ControllerQueueRecord& record) const;
+
+  bool deserialize(ControllerQueueRecord& record);
+
   String txt[VARS_PER_TASK];
   int vPin[VARS_PER_TASK]          = { 0 };
   int idx                          = 0;
@@ -57,4 +57,54 @@ bool C016_queue_element::isDuplicate(const C016_queue_element& other) const {
   return true;
 }
 
+uint32_t C016_queue_element::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(static_cast<uint8_t>(sensorType));
+  fingerprint.add(valueCount);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    fingerprint.addFloat(values[i]);
+  }
+
+  return fingerprint.get();
+}
+
+void C016_queue_element::serialize(ControllerQueueRecord& record) const {
+  // The timestamp is a unix timestamp, so it is still valid after a reboot.
+  record.writeUint32(_timestamp);
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeByte(static_cast<uint8_t>(sensorType));
+  record.writeByte(valueCount);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    record.writeFloat(values[i]);
+  }
+}
+
+bool C016_queue_element::deserialize(ControllerQueueRecord& record) {
+  uint32_t tmp_timestamp  = 0;
+  uint8_t  tmp_sensorType = 0;
+
+  if (!record.readUint32(tmp_timestamp) ||
+      !record.readByte(TaskIndex) ||
+      !record.readByte(controller_idx) ||
+      !record.readByte(tmp_sensorType) ||
+      !record.readByte(valueCount)) {
+    return false;
+  }
+  _timestamp = tmp_timestamp;
+  sensorType = static_cast<Sensor_VType>(tmp_sensorType);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    if (!record.readFloat(values[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 #endif // ifdef USES_C016
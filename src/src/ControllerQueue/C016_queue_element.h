@@ -2,6 +2,8 @@
 #define CONTROLLERQUEUE_C016_QUEUE_ELEMENT_H
 
 #include "../../ESPEasy_common.h"
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/QueueFingerprintSet.h"
 #include "../CustomBuild/ESPEasyLimits.h"
 #include "../DataStructs/DeviceStruct.h"
 #include "../DataStructs/UnitMessageCount.h"
@@ -35,6 +37,14 @@ public:
 
   const UnitMessageCount_t* getUnitMessageCount() const { return nullptr; }
 
+  // Hash of the content compared by isDuplicate(), used for a fast duplicate check.
+  uint32_t getFingerprint() const;
+
+  // Store and restore the element, when spilled to the file system.
+  void serialize(ControllerQueueRecord& record) const;
+
+  bool deserialize(ControllerQueueRecord& record);
+
   float values[VARS_PER_TASK] = { 0 };
   unsigned long _timestamp    = 0; // Unix timestamp
   taskIndex_t TaskIndex       = INVALID_TASK_INDEX;
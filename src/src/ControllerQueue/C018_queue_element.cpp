@@ -36,4 +36,26 @@ bool C018_queue_element::isDuplicate(const C018_queue_element& other) const {
   return true;
 }
 
+uint32_t C018_queue_element::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(packed);
+
+  return fingerprint.get();
+}
+
+void C018_queue_element::serialize(ControllerQueueRecord& record) const {
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeString(packed);
+}
+
+bool C018_queue_element::deserialize(ControllerQueueRecord& record) {
+  return record.readByte(TaskIndex) &&
+         record.readByte(controller_idx) &&
+         record.readString(packed);
+}
+
 #endif // ifdef USES_C018
@@ -2,6 +2,8 @@
 #define CONTROLLERQUEUE_C018_QUEUE_ELEMENT_H
 
 #include "../../ESPEasy_common.h"
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/QueueFingerprintSet.h"
 #include "../CustomBuild/ESPEasyLimits.h"
 #include "../DataStructs/UnitMessageCount.h"
 #include "../Globals/CPlugins.h"
@@ -34,6 +36,14 @@ public:
 
   const UnitMessageCount_t* getUnitMessageCount() const { return nullptr; }
 
+  // Hash of the content compared by isDuplicate(), used for a fast duplicate check.
+  uint32_t getFingerprint() const;
+
+  // Store and restore the element, when spilled to the file system.
+  void serialize(ControllerQueueRecord& record) const;
+
+  bool deserialize(ControllerQueueRecord& record);
+
   String packed;
   unsigned long _timestamp         = millis();
   taskIndex_t TaskIndex            = INVALID_TASK_INDEX;
@@ -1,6 +1,8 @@
 #ifndef CONTROLLERQUEUE_CONTROLLER_DELAY_HANDLER_STRUCT_H
 #define CONTROLLERQUEUE_CONTROLLER_DELAY_HANDLER_STRUCT_H
 
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/QueueFingerprintSet.h"
 #include "../DataStructs/ControllerSettingsStruct.h"
 #include "../DataStructs/TimingStats.h"
 #include "../DataStructs/UnitMessageCount.h"
@@ -19,11 +21,20 @@
 #include <list>
 #include <memory> // For std::shared_ptr
 #include <new>    // std::nothrow
+#include <vector>
 
 #ifndef CONTROLLER_QUEUE_MINIMAL_EXPIRE_TIME
   #define CONTROLLER_QUEUE_MINIMAL_EXPIRE_TIME 10000
 #endif
 
+// Limits for the number of queued elements sent in a single batch.
+#ifndef CONTROLLER_QUEUE_BATCH_MAX_COUNT
+  #define CONTROLLER_QUEUE_BATCH_MAX_COUNT     25
+#endif
+#ifndef CONTROLLER_QUEUE_BATCH_MAX_BYTES
+  #define CONTROLLER_QUEUE_BATCH_MAX_BYTES     1024
+#endif
+
 /*********************************************************************************************\
 * ControllerDelayHandlerStruct
 \*********************************************************************************************/
@@ -38,7 +49,9 @@ struct ControllerDelayHandlerStruct {
     max_retries(CONTROLLER_DELAY_QUEUE_RETRY_DFLT),
     delete_oldest(false),
     must_check_reply(false),
-    deduplicate(false) {}
+    deduplicate(false),
+    send_batch(false),
+    spill_to_file(false) {}
 
   void configureControllerSettings(const ControllerSettingsStruct& settings) {
     minTimeBetweenMessages = settings.MinimalTimeBetweenMessages;
@@ -46,7 +59,12 @@ struct ControllerDelayHandlerStruct {
     max_retries            = settings.MaxRetry;
     delete_oldest          = settings.DeleteOldest;
     must_check_reply       = settings.MustCheckReply;
-    deduplicate            = settings.deduplicate();
+    if (deduplicate != settings.deduplicate()) {
+      deduplicate = settings.deduplicate();
+      rebuildFingerprints();
+    }
+    send_batch             = settings.sendBatch();
+    spill_to_file          = settings.spillToFile();
     if (settings.allowExpire()) {
       expire_timeout = max_queue_depth * max_retries * (minTimeBetweenMessages + settings.ClientTimeout);
       if (expire_timeout < CONTROLLER_QUEUE_MINIMAL_EXPIRE_TIME) {
@@ -89,16 +107,11 @@ struct ControllerDelayHandlerStruct {
 #ifndef BUILD_NO_DEBUG
 
     if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-      String log = "Controller-";
-      log += element.controller_idx + 1;
-      log += " : Memory used: ";
-      log += getQueueMemorySize();
-      log += " bytes ";
-      log += sendQueue.size();
-      log += " items ";
-      log += freeHeap;
-      log += " free";
-      addLog(LOG_LEVEL_DEBUG, log);
+      addLogFmt(LOG_LEVEL_DEBUG, F("Controller-%d : Memory used: %u bytes %u items %d free"),
+                element.controller_idx + 1,
+                getQueueMemorySize(),
+                sendQueue.size(),
+                freeHeap);
     }
 #endif // ifndef BUILD_NO_DEBUG
     return true;
@@ -106,6 +119,11 @@ struct ControllerDelayHandlerStruct {
 
   // Return true if message is already present in the queue
   bool isDuplicate(const T& element) const {
+    return isDuplicate(element, deduplicate ? element.getFingerprint() : 0);
+  }
+
+  // Same as isDuplicate(element), with the fingerprint already computed.
+  bool isDuplicate(const T& element, uint32_t fingerprint) const {
     // Some controllers may receive duplicate messages, due to lost acknowledgement
     // This is actually the same message, so this should not be processed.
     if (!unitLastMessageCount.isNew(element.getUnitMessageCount())) {
@@ -116,18 +134,14 @@ struct ControllerDelayHandlerStruct {
     unitLastMessageCount.add(element.getUnitMessageCount());
 
     // the setting 'deduplicate' does look at the content of the message and only compares it to messages in the queue.
-    if (deduplicate && !sendQueue.empty()) {
+    // Only when an element with the same fingerprint is queued, the content must be compared.
+    if (deduplicate && fingerprints.contains(fingerprint)) {
       // Use reverse iterator here, as it is more likely a duplicate is added shortly after another.
       auto it = sendQueue.rbegin(); // Same as back()
       for (; it != sendQueue.rend(); ++it) {
         if (element.isDuplicate(*it)) {
 #ifndef BUILD_NO_DEBUG
-          if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-            const cpluginID_t cpluginID = getCPluginID_from_ControllerIndex(it->controller_idx);
-            String log = get_formatted_Controller_number(cpluginID);
-            log += F(" : Remove duplicate");
-            addLog(LOG_LEVEL_DEBUG, log);
-          }
+          addLogFmt(LOG_LEVEL_DEBUG, F("C%03u : Remove duplicate"), getCPluginID_from_ControllerIndex(it->controller_idx));
 #endif // ifndef BUILD_NO_DEBUG
           return true;
         }
@@ -136,34 +150,48 @@ struct ControllerDelayHandlerStruct {
     return false;
   }
 
+  // Check whether an element can be added, either to the queue in memory or to the spill file.
+  bool canAdd(const T& element) const {
+    return spill_to_file || !queueFull(element);
+  }
+
   // Try to add to the queue, if permitted by "delete_oldest"
+  // When "spill_to_file" is set, elements not fitting in memory are stored in the spill file.
   // Return true when item was added, or skipped as it was considered a duplicate
   bool addToQueue(T&& element) {
-    if (isDuplicate(element)) {
+    const uint32_t fingerprint = deduplicate ? element.getFingerprint() : 0;
+
+    if (isDuplicate(element, fingerprint)) {
       return true;
     }
 
+    if (spill_to_file && (!spillFile.empty() || queueFull(element))) {
+      // Once elements are stored in the spill file, new ones must be appended to keep them in order.
+      ControllerQueueRecord record;
+      element.serialize(record);
+
+      if (spillFile.write(record, delete_oldest)) {
+        return true;
+      }
+    }
+
     if (delete_oldest) {
       // Force add to the queue.
       // If max buffer is reached, the oldest in the queue (first to be served) will be removed.
-      while (queueFull(element)) {
-        sendQueue.pop_front();
+      // queueFull() also checks the free memory, so it may remain true with an empty queue.
+      while (queueFull(element) && !sendQueue.empty()) {
+        popFront();
         attempt = 0;
       }
     }
 
     if (!queueFull(element)) {
-      sendQueue.push_back(std::move(element));
+      pushBack(std::move(element), fingerprint);
       return true;
     }
 #ifndef BUILD_NO_DEBUG
 
-    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-      const cpluginID_t cpluginID = getCPluginID_from_ControllerIndex(element.controller_idx);
-      String log = get_formatted_Controller_number(cpluginID);
-      log += " : queue full";
-      addLog(LOG_LEVEL_DEBUG, log);
-    }
+    addLogFmt(LOG_LEVEL_DEBUG, F("C%03u : queue full"), getCPluginID_from_ControllerIndex(element.controller_idx));
 #endif // ifndef BUILD_NO_DEBUG
     return false;
   }
@@ -171,10 +199,12 @@ struct ControllerDelayHandlerStruct {
   // Get the next element.
   // Remove front element when max_retries is reached.
   T* getNext() {
+    loadFromSpillFile();
+
     if (sendQueue.empty()) { return nullptr; }
 
     if (attempt > max_retries) {
-      sendQueue.pop_front();
+      popFront();
       attempt = 0;
     }
 
@@ -184,7 +214,7 @@ struct ControllerDelayHandlerStruct {
         if (timePassedSince(sendQueue.front()._timestamp) < static_cast<long>(expire_timeout)) {
           done = true;
         } else {
-          sendQueue.pop_front();
+          popFront();
           attempt = 0;
         }
       }
@@ -201,7 +231,7 @@ struct ControllerDelayHandlerStruct {
     if (sendQueue.empty()) { return 0; }
 
     if (remove_from_queue) {
-      sendQueue.pop_front();
+      popFront();
       attempt = 0;
       lastSend = millis();
     } else {
@@ -210,8 +240,49 @@ struct ControllerDelayHandlerStruct {
     return getNextScheduleTime();
   }
 
-  unsigned long getNextScheduleTime() const {
+  // Collect the elements to be sent in a single batch, starting at the element returned by getNext().
+  // Only the first element is returned when sending in batches is not enabled.
+  // The batch is limited in number of elements and total size.
+  void getBatch(std::vector<const T *>& batch) const {
+    batch.clear();
+    size_t totalSize = 0;
+
+    for (auto it = sendQueue.begin(); it != sendQueue.end(); ++it) {
+      const size_t size = it->getSize();
+
+      if (!batch.empty()) {
+        if (!send_batch ||
+            (batch.size() >= CONTROLLER_QUEUE_BATCH_MAX_COUNT) ||
+            ((totalSize + size) > CONTROLLER_QUEUE_BATCH_MAX_BYTES)) {
+          return;
+        }
+      }
+      totalSize += size;
+      batch.push_back(&(*it));
+    }
+  }
+
+  // Mark the first nrProcessed elements as processed and return time to schedule for next process.
+  // Return 0 when nothing to process.
+  // When nrProcessed is 0, sending failed and the batch will be retried.
+  unsigned long markProcessedBatch(size_t nrProcessed) {
     if (sendQueue.empty()) { return 0; }
+
+    if (nrProcessed == 0) {
+      ++attempt;
+    } else {
+      while (nrProcessed > 0 && !sendQueue.empty()) {
+        popFront();
+        --nrProcessed;
+      }
+      attempt  = 0;
+      lastSend = millis();
+    }
+    return getNextScheduleTime();
+  }
+
+  unsigned long getNextScheduleTime() const {
+    if (sendQueue.empty() && spillFile.empty()) { return 0; }
     unsigned long nextTime = lastSend + minTimeBetweenMessages;
 
     if (timePassedSince(nextTime) > 0) {
@@ -236,10 +307,66 @@ struct ControllerDelayHandlerStruct {
     for (auto it = sendQueue.begin(); it != sendQueue.end(); ++it) {
       totalSize += it->getSize();
     }
+    totalSize += fingerprints.getMemorySize();
     return totalSize;
   }
 
+  // Move elements from the spill file to the queue in memory, as long as there is room.
+  void loadFromSpillFile() {
+    if (spillFile.empty()) { return; }
+    ControllerQueueRecord record;
+
+    while (!spillFile.empty() &&
+           (sendQueue.size() < max_queue_depth) &&
+           (ESP.getFreeHeap() > 5000) &&
+           spillFile.read(record)) {
+      T element;
+
+      // N.B. Most elements use millis() as timestamp, which is set when constructed.
+      //      So restored elements are considered new and will not expire immediately.
+      if (element.deserialize(record)) {
+        pushBack(std::move(element));
+      }
+    }
+  }
+
+  // All elements must be added and removed using pushBack() and popFront(),
+  // to keep the fingerprints in sync with the queue.
+  void pushBack(T&& element) {
+    pushBack(std::move(element), deduplicate ? element.getFingerprint() : 0);
+  }
+
+  void pushBack(T&& element, uint32_t fingerprint) {
+    if (deduplicate) {
+      fingerprints.add(fingerprint);
+    }
+    sendQueue.push_back(std::move(element));
+  }
+
+  void popFront() {
+    if (sendQueue.empty()) { return; }
+
+    if (deduplicate) {
+      fingerprints.remove(sendQueue.front().getFingerprint());
+    }
+    sendQueue.pop_front();
+  }
+
+  void rebuildFingerprints() {
+    fingerprints.clear();
+
+    if (deduplicate) {
+      for (auto it = sendQueue.begin(); it != sendQueue.end(); ++it) {
+        fingerprints.add(it->getFingerprint());
+      }
+    }
+  }
+
   std::list<T>  sendQueue;
+  ControllerQueueSpillFile spillFile;
+
+  // Fingerprints of the queued elements, only kept when 'deduplicate' is set.
+  QueueFingerprintSet fingerprints;
   mutable UnitLastMessageCount_map unitLastMessageCount;
   unsigned long lastSend;
   unsigned int  minTimeBetweenMessages;
@@ -250,6 +377,8 @@ struct ControllerDelayHandlerStruct {
   bool          delete_oldest;
   bool          must_check_reply;
   bool          deduplicate;
+  bool          send_batch;
+  bool          spill_to_file;
 };
 
 
@@ -286,6 +415,39 @@ struct ControllerDelayHandlerStruct {
   bool init_c##NNN####M##_delay_queue(controllerIndex_t ControllerIndex);                                              \
   void exit_c##NNN####M##_delay_queue();                                                                               \
 
+// Same as DEFINE_Cxxx_DELAY_QUEUE_MACRO, for controllers which can send multiple queue elements in a single request.
+// The controller must also implement 'do_process_cNNN_delay_queue_batch', which is called with a batch
+// collected by ControllerDelayHandlerStruct::getBatch().
+// Its return value is the number of elements (from the start of the batch) which can be marked 'Processed'.
+#define DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH(NNN, M)                                                                    \
+  DEFINE_Cxxx_DELAY_QUEUE_MACRO(NNN, M)                                                                                \
+  size_t do_process_c##NNN####M##_delay_queue_batch(int controller_number,                                             \
+                                                   const std::vector<const C##NNN####M##_queue_element *>& elements,   \
+                                                   ControllerSettingsStruct & ControllerSettings);                     \
+
+#define DEFINE_Cxxx_DELAY_QUEUE_MACRO_INIT_EXIT_CPP(NNN, M)                                                            \
+  bool init_c##NNN####M##_delay_queue(controllerIndex_t ControllerIndex) {                                             \
+    if (C##NNN####M##_DelayHandler == nullptr) {                                                                       \
+      C##NNN####M##_DelayHandler = new (std::nothrow) (C##NNN####M##_DelayHandler_t);                                  \
+    }                                                                                                                  \
+    if (C##NNN####M##_DelayHandler == nullptr) { return false; }                                                       \
+    MakeControllerSettings(ControllerSettings);                                                                        \
+    if (!AllocatedControllerSettings()) {                                                                              \
+      return false;                                                                                                    \
+    }                                                                                                                  \
+    LoadControllerSettings(ControllerIndex, ControllerSettings);                                                       \
+    C##NNN####M##_DelayHandler->configureControllerSettings(ControllerSettings);                                       \
+    C##NNN####M##_DelayHandler->spillFile.init(ControllerIndex);                                                       \
+    Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler->getNextScheduleTime()); \
+    return true;                                                                                                       \
+  }                                                                                                                    \
+  void exit_c##NNN####M##_delay_queue() {                                                                              \
+    if (C##NNN####M##_DelayHandler != nullptr) {                                                                       \
+      delete C##NNN####M##_DelayHandler;                                                                               \
+      C##NNN####M##_DelayHandler = nullptr;                                                                            \
+    }                                                                                                                  \
+  }                                                                                                                    \
+
 #define DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(NNN, M)                                                                      \
   C##NNN####M##_DelayHandler_t *C##NNN####M##_DelayHandler = nullptr;                                                  \
   void process_c##NNN####M##_delay_queue() {                                                                           \
@@ -308,25 +470,34 @@ struct ControllerDelayHandlerStruct {
     }                                                                                                                  \
     Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler->getNextScheduleTime());         \
   }                                                                                                                    \
-  bool init_c##NNN####M##_delay_queue(controllerIndex_t ControllerIndex) {                                             \
-    if (C##NNN####M##_DelayHandler == nullptr) {                                                                       \
-      C##NNN####M##_DelayHandler = new (std::nothrow) (C##NNN####M##_DelayHandler_t);                                  \
-    }                                                                                                                  \
-    if (C##NNN####M##_DelayHandler == nullptr) { return false; }                                                       \
+  DEFINE_Cxxx_DELAY_QUEUE_MACRO_INIT_EXIT_CPP(NNN, M)                                                                  \
+
+// Same as DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP, to be used with DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH
+#define DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH_CPP(NNN, M)                                                                \
+  C##NNN####M##_DelayHandler_t *C##NNN####M##_DelayHandler = nullptr;                                                  \
+  void process_c##NNN####M##_delay_queue() {                                                                           \
+    if (C##NNN####M##_DelayHandler == nullptr) return;                                                                 \
+    C##NNN####M##_queue_element *element(C##NNN####M##_DelayHandler->getNext());                                       \
+    if (element == nullptr) return;                                                                                       \
     MakeControllerSettings(ControllerSettings);                                                                        \
+    bool ready = true;                                                                                                 \
     if (!AllocatedControllerSettings()) {                                                                              \
-      return false;                                                                                                    \
+      ready = false;                                                                                                   \
+    } else {                                                                                                           \
+      LoadControllerSettings(element->controller_idx, ControllerSettings);                                             \
+      C##NNN####M##_DelayHandler->configureControllerSettings(ControllerSettings);                                     \
+      if (!C##NNN####M##_DelayHandler->readyToProcess(*element)) { ready = false; }                                    \
     }                                                                                                                  \
-    LoadControllerSettings(ControllerIndex, ControllerSettings);                                                       \
-    C##NNN####M##_DelayHandler->configureControllerSettings(ControllerSettings);                                       \
-    return true;                                                                                                       \
-  }                                                                                                                    \
-  void exit_c##NNN####M##_delay_queue() {                                                                              \
-    if (C##NNN####M##_DelayHandler != nullptr) {                                                                       \
-      delete C##NNN####M##_DelayHandler;                                                                               \
-      C##NNN####M##_DelayHandler = nullptr;                                                                            \
+    if (ready) {                                                                                                       \
+      START_TIMER;                                                                                                     \
+      std::vector<const C##NNN####M##_queue_element *> batch;                                                          \
+      C##NNN####M##_DelayHandler->getBatch(batch);                                                                     \
+      C##NNN####M##_DelayHandler->markProcessedBatch(do_process_c##NNN####M##_delay_queue_batch(M, batch, ControllerSettings)); \
+      STOP_TIMER(C##NNN####M##_DELAY_QUEUE);                                                                           \
     }                                                                                                                  \
+    Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler->getNextScheduleTime());         \
   }                                                                                                                    \
+  DEFINE_Cxxx_DELAY_QUEUE_MACRO_INIT_EXIT_CPP(NNN, M)                                                                  \
 
 
 
@@ -0,0 +1,466 @@
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+
+#include "../ESPEasyCore/ESPEasy_Log.h"
+#include "../Helpers/CRC_functions.h"
+#include "../Helpers/ESPEasy_Storage.h"
+#include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Numerical.h"
+
+#include <algorithm>
+
+
+/*********************************************************************************************\
+* ControllerQueueRecord
+\*********************************************************************************************/
+void ControllerQueueRecord::clear()
+{
+  data.clear();
+  readPos = 0;
+}
+
+void ControllerQueueRecord::writeByte(uint8_t value)
+{
+  data.push_back(value);
+}
+
+void ControllerQueueRecord::writeUint32(uint32_t value)
+{
+  for (int i = 0; i < 4; ++i) {
+    data.push_back(value & 0xFF);
+    value >>= 8;
+  }
+}
+
+void ControllerQueueRecord::writeFloat(float value)
+{
+  uint32_t tmp;
+
+  memcpy(&tmp, &value, sizeof(tmp));
+  writeUint32(tmp);
+}
+
+void ControllerQueueRecord::writeString(const String& value)
+{
+  const size_t length = std::min(value.length(), static_cast<unsigned int>(0xFFFF));
+  const char  *str    = value.c_str();
+
+  data.reserve(data.size() + length + 2);
+  data.push_back(length & 0xFF);
+  data.push_back(length >> 8);
+
+  for (size_t i = 0; i < length; ++i) {
+    data.push_back(static_cast<uint8_t>(str[i]));
+  }
+}
+
+bool ControllerQueueRecord::readByte(uint8_t& value)
+{
+  if (readPos >= data.size()) { return false; }
+  value = data[readPos++];
+  return true;
+}
+
+bool ControllerQueueRecord::readUint32(uint32_t& value)
+{
+  if ((readPos + 4) > data.size()) { return false; }
+  value = 0;
+
+  for (int i = 3; i >= 0; --i) {
+    value <<= 8;
+    value  |= data[readPos + i];
+  }
+  readPos += 4;
+  return true;
+}
+
+bool ControllerQueueRecord::readFloat(float& value)
+{
+  uint32_t tmp;
+
+  if (!readUint32(tmp)) { return false; }
+  memcpy(&value, &tmp, sizeof(value));
+  return true;
+}
+
+bool ControllerQueueRecord::readString(String& value)
+{
+  if ((readPos + 2) > data.size()) { return false; }
+  const size_t length = data[readPos] | (data[readPos + 1] << 8);
+
+  if ((readPos + 2 + length) > data.size()) { return false; }
+  readPos += 2;
+
+  value = String();
+
+  if (!value.reserve(length)) { return false; }
+
+  for (size_t i = 0; i < length; ++i) {
+    value += static_cast<char>(data[readPos++]);
+  }
+  return true;
+}
+
+/*********************************************************************************************\
+* ControllerQueueSpillFile
+\*********************************************************************************************/
+std::vector<ControllerQueueSpillFile *> ControllerQueueSpillFile::_instances;
+
+ControllerQueueSpillFile::ControllerQueueSpillFile()
+{
+  _instances.push_back(this);
+}
+
+ControllerQueueSpillFile::~ControllerQueueSpillFile()
+{
+  close();
+  _instances.erase(std::remove(_instances.begin(), _instances.end(), this), _instances.end());
+}
+
+void ControllerQueueSpillFile::init(controllerIndex_t controller_idx)
+{
+  if ((controller_idx == _controller_idx) &&
+      (_files.empty() || fileExists(getFileName(_files.back().fileNr)))) {
+    // Already initialized, the stored records are already counted.
+    // Unless the files were removed meanwhile by removeFiles().
+    return;
+  }
+  close();
+  _files.clear();
+  _count          = 0;
+  _readPos        = 0;
+  _controller_idx = controller_idx;
+
+  if (!validControllerIndex(controller_idx)) { return; }
+
+  // Collect the file numbers of files left from before a reboot.
+  std::vector<uint16_t> fileNrs = getFileNrs(controller_idx);
+
+  for (auto it = fileNrs.begin(); it != fileNrs.end(); ++it) {
+    const String   fileName = getFileName(*it);
+    const uint16_t records  = countRecords(fileName);
+
+    if (records == 0) {
+      deleteFile_noFlush(fileName);
+    } else {
+      _files.push_back({ *it, records });
+      _count += records;
+    }
+  }
+
+  if ((_count > 0) && loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("Queue: Controller ");
+    log += controller_idx + 1;
+    log += F(" restored ");
+    log += _count;
+    log += F(" spilled messages from ");
+    log += _files.size();
+    log += F(" files");
+    addLog(LOG_LEVEL_INFO, log);
+  }
+}
+
+void ControllerQueueSpillFile::removeFiles(controllerIndex_t controller_idx)
+{
+  if (!validControllerIndex(controller_idx)) { return; }
+  std::vector<uint16_t> fileNrs = getFileNrs(controller_idx);
+
+  for (auto it = fileNrs.begin(); it != fileNrs.end(); ++it) {
+    deleteFile_noFlush(getFileName(controller_idx, *it));
+  }
+
+  if (!fileNrs.empty() && loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("Queue: Controller ");
+    log += controller_idx + 1;
+    log += F(" removed ");
+    log += fileNrs.size();
+    log += F(" spill files");
+    addLog(LOG_LEVEL_INFO, log);
+  }
+}
+
+std::vector<uint16_t> ControllerQueueSpillFile::getFileNrs(controllerIndex_t controller_idx)
+{
+  String prefix = F("cq");
+
+  prefix += controller_idx + 1;
+  prefix += '_';
+  std::vector<uint16_t> fileNrs;
+
+  auto addFileNr = [&](String fileName) {
+                     if (fileName.startsWith(F("/"))) {
+                       fileName = fileName.substring(1);
+                     }
+
+                     if (fileName.startsWith(prefix) && fileName.endsWith(F(".bin"))) {
+                       int fileNr = 0;
+
+                       if (validIntFromString(fileName.substring(prefix.length(), fileName.length() - 4), fileNr) &&
+                           (fileNr >= 0) && (fileNr <= 0xFFFF)) {
+                         fileNrs.push_back(fileNr);
+                       }
+                     }
+                   };
+#ifdef ESP8266
+  fs::Dir dir = ESPEASY_FS.openDir("");
+
+  while (dir.next()) {
+    addFileNr(dir.fileName());
+  }
+#endif // ifdef ESP8266
+#ifdef ESP32
+  File root = ESPEASY_FS.open(F("/"));
+  File file = root.openNextFile();
+
+  while (file) {
+    if (!file.isDirectory()) {
+      addFileNr(file.name());
+    }
+    file = root.openNextFile();
+  }
+#endif // ifdef ESP32
+
+  std::sort(fileNrs.begin(), fileNrs.end());
+  return fileNrs;
+}
+
+bool ControllerQueueSpillFile::write(const ControllerQueueRecord& record, bool delete_oldest)
+{
+  const size_t length = record.data.size();
+
+  if (!validControllerIndex(_controller_idx) || (length == 0) || (length > 0xFFFF)) {
+    return false;
+  }
+  const size_t recordSize = length + 6;
+
+  if (!openWriteFile(recordSize)) {
+    if (!delete_oldest || _files.empty()) {
+      return false;
+    }
+
+    // Make room by dropping the oldest stored records.
+    removeOldestFile();
+
+    if (!openWriteFile(recordSize)) {
+      return false;
+    }
+  }
+  const uint8_t  header[2] = { static_cast<uint8_t>(length & 0xFF), static_cast<uint8_t>(length >> 8) };
+  const uint32_t crc       = calc_CRC32(&record.data[0], length);
+  uint8_t footer[4];
+
+  for (int i = 0; i < 4; ++i) {
+    footer[i] = (crc >> (8 * i)) & 0xFF;
+  }
+  size_t written = _fw.write(header, sizeof(header));
+
+  written += _fw.write(&record.data[0], length);
+  written += _fw.write(footer, sizeof(footer));
+
+  if (written != recordSize) {
+    // A partially written record will not pass the checksum check.
+    // Do not append to this file anymore, as all records after it cannot be read.
+    closeWriteFile();
+    addLog(LOG_LEVEL_ERROR, F("Queue: Error writing spill file"));
+    return false;
+  }
+  ++_files.back().records;
+  ++_count;
+
+  if (_unflushedBytes == 0) {
+    _unflushedSince = millis();
+  }
+  _unflushedBytes += recordSize;
+
+  if (_unflushedBytes >= CONTROLLER_QUEUE_SPILL_FLUSH_SIZE) {
+    flush();
+  }
+  return true;
+}
+
+bool ControllerQueueSpillFile::read(ControllerQueueRecord& record)
+{
+  while (!_files.empty()) {
+    FileInfo& info = _files.front();
+
+    if (info.records == 0) {
+      if (_fw && (_files.size() == 1)) {
+        // New file, nothing written yet.
+        return false;
+      }
+      removeOldestFile();
+    } else {
+      if (!_fr) {
+        if (_fw && (_files.size() == 1)) {
+          // Do not read a file which is still open for writing, the next write will start a new file.
+          closeWriteFile();
+        }
+        _fr = tryOpenFile(getFileName(info.fileNr), "r");
+
+        if (_fr && !_fr.seek(_readPos)) {
+          _fr.close();
+        }
+      }
+
+      if (_fr && readRecord(_fr, record)) {
+        _readPos = _fr.position();
+        --info.records;
+        --_count;
+
+        if (info.records == 0) {
+          removeOldestFile();
+        }
+        return true;
+      }
+
+      // File cannot be read or contains a corrupt record, skip the rest of it.
+      removeOldestFile();
+    }
+  }
+  return false;
+}
+
+void ControllerQueueSpillFile::clear()
+{
+  while (!_files.empty()) {
+    removeOldestFile();
+  }
+  _count = 0;
+}
+
+void ControllerQueueSpillFile::flush()
+{
+  if (_fw && (_unflushedBytes > 0)) {
+    _fw.flush();
+  }
+  _unflushedBytes = 0;
+}
+
+void ControllerQueueSpillFile::flushAll()
+{
+  for (auto it = _instances.begin(); it != _instances.end(); ++it) {
+    (*it)->flush();
+  }
+}
+
+void ControllerQueueSpillFile::flushAllWhenDue()
+{
+  for (auto it = _instances.begin(); it != _instances.end(); ++it) {
+    if (((*it)->_unflushedBytes > 0) &&
+        (timePassedSince((*it)->_unflushedSince) >= CONTROLLER_QUEUE_SPILL_FLUSH_INTERVAL)) {
+      (*it)->flush();
+    }
+  }
+}
+
+String ControllerQueueSpillFile::getFileName(uint16_t fileNr) const
+{
+  return getFileName(_controller_idx, fileNr);
+}
+
+String ControllerQueueSpillFile::getFileName(controllerIndex_t controller_idx, uint16_t fileNr)
+{
+  String fileName;
+
+  fileName.reserve(16);
+  fileName += F("cq");
+  fileName += controller_idx + 1;
+  fileName += '_';
+  fileName += fileNr;
+  fileName += F(".bin");
+  return fileName;
+}
+
+uint16_t ControllerQueueSpillFile::countRecords(const String& fileName) const
+{
+  fs::File f = tryOpenFile(fileName, "r");
+
+  if (!f) { return 0; }
+  ControllerQueueRecord record;
+  uint16_t records = 0;
+
+  while (records < 0xFFFF && readRecord(f, record)) {
+    ++records;
+  }
+  f.close();
+  return records;
+}
+
+bool ControllerQueueSpillFile::readRecord(fs::File& file, ControllerQueueRecord& record)
+{
+  uint8_t header[2];
+
+  if (file.read(header, sizeof(header)) != sizeof(header)) { return false; }
+  const size_t length = header[0] | (header[1] << 8);
+
+  if ((length == 0) || (static_cast<int>(length + 4) > file.available())) { return false; }
+  record.clear();
+  record.data.resize(length);
+
+  if (file.read(&record.data[0], length) != length) { return false; }
+  uint8_t footer[4];
+
+  if (file.read(footer, sizeof(footer)) != sizeof(footer)) { return false; }
+  uint32_t crc = 0;
+
+  for (int i = 3; i >= 0; --i) {
+    crc <<= 8;
+    crc  |= footer[i];
+  }
+  return crc == calc_CRC32(&record.data[0], length);
+}
+
+bool ControllerQueueSpillFile::openWriteFile(size_t recordSize)
+{
+  if (_fw && ((_fw.size() + recordSize) > CONTROLLER_QUEUE_SPILL_FILE_MAX_SIZE)) {
+    closeWriteFile();
+  }
+
+  if (_fw) { return true; }
+
+  // Always start a new file, records are never appended to a file which was closed.
+  if ((_files.size() >= CONTROLLER_QUEUE_SPILL_MAX_FILES) ||
+      (SpiffsFreeSpace() < (CONTROLLER_QUEUE_SPILL_FILE_MAX_SIZE + SpiffsBlocksize()))) {
+    return false;
+  }
+  const uint16_t fileNr = _files.empty() ? 1 : _files.back().fileNr + 1;
+
+  _fw = tryOpenFile(getFileName(fileNr), "w");
+
+  if (!_fw) { return false; }
+  _files.push_back({ fileNr, 0 });
+  return true;
+}
+
+void ControllerQueueSpillFile::removeOldestFile()
+{
+  if (_files.empty()) { return; }
+
+  if (_fr) {
+    _fr.close();
+  }
+
+  if (_fw && (_files.size() == 1)) {
+    closeWriteFile();
+  }
+  _count  -= _files.front().records;
+  _readPos = 0;
+  deleteFile_noFlush(getFileName(_files.front().fileNr));
+  _files.erase(_files.begin());
+}
+
+void ControllerQueueSpillFile::closeWriteFile()
+{
+  // Closing the file also flushes it.
+  if (_fw) {
+    _fw.close();
+  }
+  _unflushedBytes = 0;
+}
+
+void ControllerQueueSpillFile::close()
+{
+  if (_fr) {
+    _fr.close();
+  }
+  closeWriteFile();
+}
@@ -0,0 +1,159 @@
+#ifndef CONTROLLERQUEUE_CONTROLLER_QUEUE_SPILL_FILE_H
+#define CONTROLLERQUEUE_CONTROLLER_QUEUE_SPILL_FILE_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../Globals/CPlugins.h"
+
+#include <FS.h>
+#include <vector>
+
+// Spilled queue elements are stored in a number of files per controller.
+// Elements are appended to the newest file and read from the oldest file.
+// A file is deleted as soon as all its elements are read.
+#ifndef CONTROLLER_QUEUE_SPILL_FILE_MAX_SIZE
+  # define CONTROLLER_QUEUE_SPILL_FILE_MAX_SIZE  4096
+#endif // ifndef CONTROLLER_QUEUE_SPILL_FILE_MAX_SIZE
+#ifndef CONTROLLER_QUEUE_SPILL_MAX_FILES
+  # define CONTROLLER_QUEUE_SPILL_MAX_FILES      16
+#endif // ifndef CONTROLLER_QUEUE_SPILL_MAX_FILES
+
+// Written records are flushed to flash once this many bytes are written since the last flush,
+// or when the oldest unflushed record is older than CONTROLLER_QUEUE_SPILL_FLUSH_INTERVAL msec.
+#ifndef CONTROLLER_QUEUE_SPILL_FLUSH_SIZE
+  # define CONTROLLER_QUEUE_SPILL_FLUSH_SIZE     512
+#endif // ifndef CONTROLLER_QUEUE_SPILL_FLUSH_SIZE
+#ifndef CONTROLLER_QUEUE_SPILL_FLUSH_INTERVAL
+  # define CONTROLLER_QUEUE_SPILL_FLUSH_INTERVAL 10000
+#endif // ifndef CONTROLLER_QUEUE_SPILL_FLUSH_INTERVAL
+
+
+/*********************************************************************************************\
+* ControllerQueueRecord
+* Queue element serialized to a byte buffer, to be stored in a ControllerQueueSpillFile.
+* Numbers are stored little endian, strings with a 16 bit length prefix.
+\*********************************************************************************************/
+struct ControllerQueueRecord {
+  void clear();
+
+  void writeByte(uint8_t value);
+  void writeUint32(uint32_t value);
+  void writeFloat(float value);
+  void writeString(const String& value);
+
+  // The read functions return false when reading past the end of the record.
+  bool readByte(uint8_t& value);
+  bool readUint32(uint32_t& value);
+  bool readFloat(float& value);
+  bool readString(String& value);
+
+  std::vector<uint8_t>data;
+  size_t readPos = 0;
+};
+
+
+/*********************************************************************************************\
+* ControllerQueueSpillFile
+* Persistent overflow of a controller delay queue.
+* Records are appended to files named "cq<controller nr>_<file nr>.bin", each record stored as:
+*   [uint16 length][payload][uint32 CRC32 of payload]
+* The read position is only kept in RAM, so after a reboot the oldest file is read from the start.
+* Thus elements may be sent again after a reboot, but they will not get lost.
+* Writes are not flushed per record, see CONTROLLER_QUEUE_SPILL_FLUSH_SIZE.
+* Records not yet flushed may be lost on a crash, a torn record fails the CRC check when read.
+\*********************************************************************************************/
+struct ControllerQueueSpillFile {
+  ControllerQueueSpillFile();
+
+  ~ControllerQueueSpillFile();
+
+  // Instances are kept in a list to flush them all, so they cannot be copied.
+  ControllerQueueSpillFile(const ControllerQueueSpillFile&)            = delete;
+  ControllerQueueSpillFile& operator=(const ControllerQueueSpillFile&) = delete;
+
+  // Look for files left from before a reboot and count the stored records.
+  // Does nothing when already initialized for this controller.
+  void     init(controllerIndex_t controller_idx);
+
+  // Append a record.
+  // When the maximum number of files is reached, the oldest file is removed if delete_oldest is set.
+  bool     write(const ControllerQueueRecord& record,
+                 bool                         delete_oldest);
+
+  // Read the oldest record and remove it from the spill file.
+  // Returns false when no (valid) record could be read.
+  bool     read(ControllerQueueRecord& record);
+
+  // Remove all stored records.
+  void     clear();
+
+  // Flush written records to flash.
+  void     flush();
+
+  // Flush the written records of all spill files, e.g. before a reboot.
+  static void flushAll();
+
+  // Flush the spill files with records written more than CONTROLLER_QUEUE_SPILL_FLUSH_INTERVAL msec ago.
+  static void flushAllWhenDue();
+
+  // Remove the files of a controller, e.g. when its protocol changed.
+  // The stored records must not be sent anymore, so not even to a new controller in the same slot.
+  static void removeFiles(controllerIndex_t controller_idx);
+
+  bool     empty() const {
+    return _count == 0;
+  }
+
+  // Number of stored records
+  uint32_t size() const {
+    return _count;
+  }
+
+  // Number of files in use
+  size_t   nrFiles() const {
+    return _files.size();
+  }
+
+private:
+
+  struct FileInfo {
+    uint16_t fileNr;
+    uint16_t records;
+  };
+
+  String   getFileName(uint16_t fileNr) const;
+
+  static String getFileName(controllerIndex_t controller_idx,
+                            uint16_t          fileNr);
+
+  // Sorted file numbers of the existing files of a controller.
+  static std::vector<uint16_t>getFileNrs(controllerIndex_t controller_idx);
+
+  // Return the number of valid records, counted from the start of the file.
+  uint16_t countRecords(const String& fileName) const;
+
+  static bool readRecord(fs::File& file, ControllerQueueRecord& record);
+
+  bool     openWriteFile(size_t recordSize);
+
+  void     removeOldestFile();
+
+  void     closeWriteFile();
+
+  void     close();
+
+  // Files with stored records, oldest first. The last one is used for writing.
+  std::vector<FileInfo>_files;
+  fs::File _fw;
+  fs::File _fr;
+  uint32_t _count                   = 0;
+  uint32_t _readPos                 = 0;
+  uint32_t _unflushedSince          = 0; // Moment the first record was written after the last flush
+  uint32_t _unflushedBytes          = 0;
+  controllerIndex_t _controller_idx = INVALID_CONTROLLER_INDEX;
+
+  static std::vector<ControllerQueueSpillFile *>_instances;
+};
+
+
+#endif // CONTROLLERQUEUE_CONTROLLER_QUEUE_SPILL_FILE_H
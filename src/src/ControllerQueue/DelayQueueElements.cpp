@@ -3,6 +3,7 @@
 #include "../DataStructs/ControllerSettingsStruct.h"
 #include "../DataStructs/TimingStats.h"
 #include "../Globals/ESPEasy_Scheduler.h"
+#include "../Globals/Protocol.h"
 #include "../Helpers/PeriodicalActions.h"
 
 #ifdef USES_MQTT
@@ -14,6 +15,13 @@ bool init_mqtt_delay_queue(controllerIndex_t ControllerIndex, String& pubname, b
     return false;
   }
   LoadControllerSettings(ControllerIndex, ControllerSettings);
+  return init_mqtt_delay_queue(ControllerIndex, ControllerSettings, pubname, retainFlag);
+}
+
+bool init_mqtt_delay_queue(controllerIndex_t               ControllerIndex,
+                           const ControllerSettingsStruct& ControllerSettings,
+                           String                        & pubname,
+                           bool                          & retainFlag) {
   if (MQTTDelayHandler == nullptr) {
     MQTTDelayHandler = new (std::nothrow) ControllerDelayHandlerStruct<MQTT_queue_element>;
   }
@@ -21,6 +29,7 @@ bool init_mqtt_delay_queue(controllerIndex_t ControllerIndex, String& pubname, b
     return false;
   }
   MQTTDelayHandler->configureControllerSettings(ControllerSettings);
+  MQTTDelayHandler->spillFile.init(ControllerIndex);
   pubname = ControllerSettings.Publish;
   retainFlag = ControllerSettings.mqtt_retainFlag();
   Scheduler.setIntervalTimerOverride(ESPEasy_Scheduler::IntervalTimer_e::TIMER_MQTT, 10); // Make sure the MQTT is being processed as soon as possible.
@@ -55,7 +64,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  3)
 #endif // ifdef USES_C003
 
 #ifdef USES_C004
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  4)
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH_CPP(00,  4)
 #endif // ifdef USES_C004
 
 #ifdef USES_C007
@@ -86,7 +95,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  9)
 \*********************************************************************************************/
 #ifdef USES_C010
 # define C010_queue_element queue_element_single_value_base
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP( 0, 10)
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH_CPP( 0, 10)
 #endif // ifdef USES_C010
 
 
@@ -95,7 +104,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP( 0, 10)
 * C011_queue_element for queueing requests for 011: Generic HTTP Advanced
 \*********************************************************************************************/
 #ifdef USES_C011
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP( 0, 11)
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH_CPP( 0, 11)
 #endif // ifdef USES_C011
 
 
@@ -187,3 +196,72 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(0, 18)
 
 // When extending this, search for EXTEND_CONTROLLER_IDS 
 // in the code to find all places that need to be updated too.
+
+
+template<class T>
+bool getDelayQueueDepth(const ControllerDelayHandlerStruct<T> *handler, size_t& ramDepth, size_t& fileDepth) {
+  if (handler == nullptr) {
+    return false;
+  }
+  ramDepth  = handler->sendQueue.size();
+  fileDepth = handler->spillFile.size();
+  return true;
+}
+
+bool getControllerQueueDepth(controllerIndex_t ControllerIndex, size_t& ramDepth, size_t& fileDepth) {
+  ramDepth  = 0;
+  fileDepth = 0;
+  const protocolIndex_t ProtocolIndex = getProtocolIndex_from_ControllerIndex(ControllerIndex);
+
+  if (ProtocolIndex == INVALID_PROTOCOL_INDEX) {
+    return false;
+  }
+  #ifdef USES_MQTT
+  if (Protocol[ProtocolIndex].usesMQTT) {
+    return getDelayQueueDepth(MQTTDelayHandler, ramDepth, fileDepth);
+  }
+  #endif // ifdef USES_MQTT
+
+  switch (getCPluginID_from_ControllerIndex(ControllerIndex)) {
+  #ifdef USES_C001
+    case 1: return getDelayQueueDepth(C001_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C001
+  #ifdef USES_C003
+    case 3: return getDelayQueueDepth(C003_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C003
+  #ifdef USES_C004
+    case 4: return getDelayQueueDepth(C004_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C004
+  #ifdef USES_C007
+    case 7: return getDelayQueueDepth(C007_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C007
+  #ifdef USES_C008
+    case 8: return getDelayQueueDepth(C008_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C008
+  #ifdef USES_C009
+    case 9: return getDelayQueueDepth(C009_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C009
+  #ifdef USES_C010
+    case 10: return getDelayQueueDepth(C010_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C010
+  #ifdef USES_C011
+    case 11: return getDelayQueueDepth(C011_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C011
+  #ifdef USES_C012
+    case 12: return getDelayQueueDepth(C012_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C012
+  #ifdef USES_C015
+    case 15: return getDelayQueueDepth(C015_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C015
+  #ifdef USES_C016
+    case 16: return getDelayQueueDepth(C016_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C016
+  #ifdef USES_C017
+    case 17: return getDelayQueueDepth(C017_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C017
+  #ifdef USES_C018
+    case 18: return getDelayQueueDepth(C018_DelayHandler, ramDepth, fileDepth);
+  #endif // ifdef USES_C018
+  }
+  return false;
+}
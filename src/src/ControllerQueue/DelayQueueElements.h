@@ -31,6 +31,12 @@
 extern ControllerDelayHandlerStruct<MQTT_queue_element> *MQTTDelayHandler;
 
 bool init_mqtt_delay_queue(controllerIndex_t ControllerIndex, String& pubname, bool& retainFlag);
+
+// Same, using controller settings already loaded by the caller.
+bool init_mqtt_delay_queue(controllerIndex_t               ControllerIndex,
+                           const ControllerSettingsStruct& ControllerSettings,
+                           String                        & pubname,
+                           bool                          & retainFlag);
 void exit_mqtt_delay_queue();
 #endif // USES_MQTT
 
@@ -56,7 +62,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO(00,  3)
 #ifdef USES_C004
 # include "../ControllerQueue/queue_element_formatted_uservar.h"
 # define C004_queue_element queue_element_formatted_uservar
-DEFINE_Cxxx_DELAY_QUEUE_MACRO(00,  4)
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH(00,  4)
 #endif // ifdef USES_C004
 
 #ifdef USES_C007
@@ -91,7 +97,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO(00,  9)
 #ifdef USES_C010
 #include "../ControllerQueue/queue_element_single_value_base.h"
 # define C010_queue_element queue_element_single_value_base
-DEFINE_Cxxx_DELAY_QUEUE_MACRO( 0, 10)
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH( 0, 10)
 #endif // ifdef USES_C010
 
 
@@ -101,7 +107,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO( 0, 10)
 \*********************************************************************************************/
 #ifdef USES_C011
 # include "../ControllerQueue/C011_queue_element.h"
-DEFINE_Cxxx_DELAY_QUEUE_MACRO( 0, 11)
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_BATCH( 0, 11)
 #endif // ifdef USES_C011
 
 
@@ -200,4 +206,9 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO(0, 18)
 // in the code to find all places that need to be updated too.
 
 
+// Get the number of queued messages of a controller, kept in memory and stored in the spill file.
+// Returns false when the controller does not have an active delay queue.
+bool getControllerQueueDepth(controllerIndex_t ControllerIndex, size_t& ramDepth, size_t& fileDepth);
+
+
 #endif // ifndef DELAY_QUEUE_ELEMENTS_H
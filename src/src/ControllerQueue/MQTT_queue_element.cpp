@@ -42,3 +42,35 @@ void MQTT_queue_element::removeEmptyTopics() {
     _topic.replace(F("//"), F("/"));
   }
 }
+
+uint32_t MQTT_queue_element::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(_retained ? 1 : 0);
+  fingerprint.add(_topic);
+  fingerprint.add(_payload);
+
+  return fingerprint.get();
+}
+
+void MQTT_queue_element::serialize(ControllerQueueRecord& record) const {
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeByte(_retained ? 1 : 0);
+  record.writeString(_topic);
+  record.writeString(_payload);
+}
+
+bool MQTT_queue_element::deserialize(ControllerQueueRecord& record) {
+  uint8_t retained = 0;
+
+  if (!record.readByte(TaskIndex) ||
+      !record.readByte(controller_idx) ||
+      !record.readByte(retained)) {
+    return false;
+  }
+  _retained = retained != 0;
+  return record.readString(_topic) &&
+         record.readString(_payload);
+}
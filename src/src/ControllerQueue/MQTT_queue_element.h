@@ -2,6 +2,8 @@
 #define CONTROLLERQUEUE_MQTT_QUEUE_ELEMENT_H
 
 #include "../../ESPEasy_common.h"
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/QueueFingerprintSet.h"
 #include "../DataStructs/UnitMessageCount.h"
 #include "../Globals/CPlugins.h"
 
@@ -37,6 +39,14 @@ public:
   const UnitMessageCount_t* getUnitMessageCount() const { return &UnitMessageCount; }
   UnitMessageCount_t* getUnitMessageCount() { return &UnitMessageCount; }
 
+  // Hash of the content compared by isDuplicate(), used for a fast duplicate check.
+  uint32_t getFingerprint() const;
+
+  // Store and restore the element, when spilled to the file system.
+  void serialize(ControllerQueueRecord& record) const;
+
+  bool deserialize(ControllerQueueRecord& record);
+
   void removeEmptyTopics();
 
   String _topic;
@@ -0,0 +1,143 @@
+#include "../ControllerQueue/QueueFingerprintSet.h"
+
+// Start with room for 8 fingerprints, as the slots are never filled for more than half.
+#define QUEUE_FINGERPRINT_SET_MIN_SLOTS  16
+
+
+/*********************************************************************************************\
+* QueueFingerprint
+\*********************************************************************************************/
+void QueueFingerprint::add(const uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+}
+
+void QueueFingerprint::add(const String& str)
+{
+  add(reinterpret_cast<const uint8_t *>(str.c_str()), str.length());
+
+  // Add the length, to tell apart "ab","c" and "a","bc"
+  add(static_cast<uint32_t>(str.length()));
+}
+
+void QueueFingerprint::add(uint32_t value)
+{
+  for (int i = 0; i < 4; ++i) {
+    hash ^= value & 0xFF;
+    hash *= 16777619u;
+    value >>= 8;
+  }
+}
+
+void QueueFingerprint::addFloat(float value)
+{
+  // Make sure 0.0 and -0.0 get the same fingerprint, as they are considered equal.
+  if (value == 0.0f) {
+    value = 0.0f;
+  }
+  uint32_t tmp;
+
+  memcpy(&tmp, &value, sizeof(tmp));
+  add(tmp);
+}
+
+uint32_t QueueFingerprint::get() const
+{
+  return hash == 0 ? 1 : hash;
+}
+
+/*********************************************************************************************\
+* QueueFingerprintSet
+\*********************************************************************************************/
+void QueueFingerprintSet::clear()
+{
+  _slots.clear();
+  _slots.shrink_to_fit();
+  _used = 0;
+}
+
+void QueueFingerprintSet::add(uint32_t fingerprint)
+{
+  // Keep the load factor at most 50%, to keep the probe sequences short.
+  if (((_used + 1) * 2) > _slots.size()) {
+    resize(_slots.empty() ? QUEUE_FINGERPRINT_SET_MIN_SLOTS : _slots.size() * 2);
+  }
+  Slot& slot = _slots[find(fingerprint)];
+
+  if (slot.fingerprint == 0) {
+    slot.fingerprint = fingerprint;
+    ++_used;
+  }
+
+  if (slot.count < 0xFFFF) {
+    ++slot.count;
+  }
+}
+
+void QueueFingerprintSet::remove(uint32_t fingerprint)
+{
+  if (_used == 0) { return; }
+  size_t i = find(fingerprint);
+
+  if (_slots[i].fingerprint == 0) { return; }
+
+  if (--_slots[i].count > 0) { return; }
+
+  // Backward shift deletion, so no tombstones are needed.
+  const size_t mask = _slots.size() - 1;
+  size_t j          = i;
+
+  while (true) {
+    j = (j + 1) & mask;
+
+    if (_slots[j].fingerprint == 0) {
+      break;
+    }
+    const size_t home = _slots[j].fingerprint & mask;
+
+    // Move the entry when its home slot is not in the (cyclic) range (i, j]
+    const bool inRange = (i <= j) ? ((i < home) && (home <= j)) : ((i < home) || (home <= j));
+
+    if (!inRange) {
+      _slots[i] = _slots[j];
+      i         = j;
+    }
+  }
+  _slots[i] = Slot();
+  --_used;
+}
+
+bool QueueFingerprintSet::contains(uint32_t fingerprint) const
+{
+  if (_used == 0) { return false; }
+  return _slots[find(fingerprint)].fingerprint != 0;
+}
+
+size_t QueueFingerprintSet::find(uint32_t fingerprint) const
+{
+  // Number of slots is always a power of 2
+  const size_t mask = _slots.size() - 1;
+  size_t i          = fingerprint & mask;
+
+  while (_slots[i].fingerprint != 0 && _slots[i].fingerprint != fingerprint) {
+    i = (i + 1) & mask;
+  }
+  return i;
+}
+
+void QueueFingerprintSet::resize(size_t nrSlots)
+{
+  std::vector<Slot> old;
+
+  old.swap(_slots);
+  _slots.resize(nrSlots);
+
+  for (auto it = old.begin(); it != old.end(); ++it) {
+    if (it->fingerprint != 0) {
+      _slots[find(it->fingerprint)] = *it;
+    }
+  }
+}
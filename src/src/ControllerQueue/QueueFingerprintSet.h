@@ -0,0 +1,71 @@
+#ifndef CONTROLLERQUEUE_QUEUE_FINGERPRINT_SET_H
+#define CONTROLLERQUEUE_QUEUE_FINGERPRINT_SET_H
+
+#include "../../ESPEasy_common.h"
+
+#include <vector>
+
+
+/*********************************************************************************************\
+* QueueFingerprint
+* Incremental FNV-1a hash over the content of a queue element.
+* Elements considered duplicates by their isDuplicate() function must have the same fingerprint.
+\*********************************************************************************************/
+struct QueueFingerprint {
+  void     add(const uint8_t *data,
+               size_t         length);
+  void     add(const String& str);
+  void     add(uint32_t value);
+  void     addFloat(float value);
+
+  // Never returns 0, which is used to mark empty slots in QueueFingerprintSet
+  uint32_t get() const;
+
+  uint32_t hash = 2166136261u;
+};
+
+
+/*********************************************************************************************\
+* QueueFingerprintSet
+* Open addressing hash set (linear probing) with the fingerprints of all queued elements.
+* Used to check in constant time whether an element may already be present in the queue.
+* A fingerprint may be added multiple times, it is kept until removed as often as it was added.
+\*********************************************************************************************/
+class QueueFingerprintSet {
+public:
+
+  void   clear();
+
+  void   add(uint32_t fingerprint);
+
+  void   remove(uint32_t fingerprint);
+
+  bool   contains(uint32_t fingerprint) const;
+
+  // Number of unique fingerprints
+  size_t size() const {
+    return _used;
+  }
+
+  size_t getMemorySize() const {
+    return _slots.capacity() * sizeof(Slot);
+  }
+
+private:
+
+  struct Slot {
+    uint32_t fingerprint = 0;
+    uint16_t count       = 0;
+  };
+
+  // Return the index of the slot with the fingerprint, or of the empty slot where it should be inserted.
+  size_t find(uint32_t fingerprint) const;
+
+  void   resize(size_t nrSlots);
+
+  std::vector<Slot>_slots;
+  size_t _used = 0;
+};
+
+
+#endif // CONTROLLERQUEUE_QUEUE_FINGERPRINT_SET_H
@@ -16,3 +16,25 @@ bool simple_queue_element_string_only::isDuplicate(const simple_queue_element_st
   }
   return true;
 }
+
+uint32_t simple_queue_element_string_only::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(txt);
+
+  return fingerprint.get();
+}
+
+void simple_queue_element_string_only::serialize(ControllerQueueRecord& record) const {
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeString(txt);
+}
+
+bool simple_queue_element_string_only::deserialize(ControllerQueueRecord& record) {
+  return record.readByte(TaskIndex) &&
+         record.readByte(controller_idx) &&
+         record.readString(txt);
+}
@@ -56,3 +56,52 @@ bool queue_element_formatted_uservar::isDuplicate(const queue_element_formatted_
   }
   return true;
 }
+
+uint32_t queue_element_formatted_uservar::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(static_cast<uint8_t>(sensorType));
+  fingerprint.add(valueCount);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    fingerprint.add(txt[i]);
+  }
+
+  return fingerprint.get();
+}
+
+void queue_element_formatted_uservar::serialize(ControllerQueueRecord& record) const {
+  record.writeUint32(idx);
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeByte(static_cast<uint8_t>(sensorType));
+  record.writeByte(valueCount);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    record.writeString(txt[i]);
+  }
+}
+
+bool queue_element_formatted_uservar::deserialize(ControllerQueueRecord& record) {
+  uint32_t tmp_idx        = 0;
+  uint8_t  tmp_sensorType = 0;
+
+  if (!record.readUint32(tmp_idx) ||
+      !record.readByte(TaskIndex) ||
+      !record.readByte(controller_idx) ||
+      !record.readByte(tmp_sensorType) ||
+      !record.readByte(valueCount)) {
+    return false;
+  }
+  idx        = tmp_idx;
+  sensorType = static_cast<Sensor_VType>(tmp_sensorType);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    if (!record.readString(txt[i])) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -48,3 +48,50 @@ bool queue_element_single_value_base::isDuplicate(const queue_element_single_val
   }
   return true;
 }
+
+uint32_t queue_element_single_value_base::getFingerprint() const {
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(controller_idx);
+  fingerprint.add(TaskIndex);
+  fingerprint.add(valueCount);
+  fingerprint.add(idx);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    fingerprint.add(txt[i]);
+  }
+
+  return fingerprint.get();
+}
+
+void queue_element_single_value_base::serialize(ControllerQueueRecord& record) const {
+  record.writeUint32(idx);
+  record.writeByte(TaskIndex);
+  record.writeByte(controller_idx);
+  record.writeByte(valuesSent);
+  record.writeByte(valueCount);
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    record.writeString(txt[i]);
+  }
+}
+
+bool queue_element_single_value_base::deserialize(ControllerQueueRecord& record) {
+  uint32_t tmp_idx = 0;
+
+  if (!record.readUint32(tmp_idx) ||
+      !record.readByte(TaskIndex) ||
+      !record.readByte(controller_idx) ||
+      !record.readByte(valuesSent) ||
+      !record.readByte(valueCount)) {
+    return false;
+  }
+  idx = tmp_idx;
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    if (!record.readString(txt[i])) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -98,6 +98,31 @@
 #endif
 
 
+#ifndef EXTRA_TASK_SETTINGS_CACHE_SIZE
+  #ifdef ESP32
+    #define EXTRA_TASK_SETTINGS_CACHE_SIZE   8 // Max. number of tasks with ExtraTaskSettings kept in memory
+  #else
+    #define EXTRA_TASK_SETTINGS_CACHE_SIZE   4 // Max. number of tasks with ExtraTaskSettings kept in memory
+  #endif
+#endif
+#ifndef EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP
+  #define EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP 12000 // Only use free heap above this for the ExtraTaskSettings cache
+#endif
+#ifndef PARSED_TEMPLATE_CACHE_SIZE
+  #ifdef ESP32
+    #define PARSED_TEMPLATE_CACHE_SIZE      48 // Max. number of parsed templates kept in memory (display lines, controller templates)
+  #else
+    #define PARSED_TEMPLATE_CACHE_SIZE      24 // Max. number of parsed templates kept in memory (display lines, controller templates)
+  #endif
+#endif
+#ifndef PARSED_TEMPLATE_CACHE_IDLE_TIMEOUT
+  #define PARSED_TEMPLATE_CACHE_IDLE_TIMEOUT 300000 // A full cache only replaces parsed templates not used for this many msec
+#endif
+#ifndef PARSED_TEMPLATE_CACHE_MIN_FREE_HEAP
+  #define PARSED_TEMPLATE_CACHE_MIN_FREE_HEAP 12000 // Do not keep parsed templates in memory when free heap is below this
+#endif
+
+
 // ***********************************************************************
 // * Limits regarding Rules
 // ***********************************************************************
@@ -124,6 +149,23 @@
 #ifndef RULES_IF_MAX_NESTING_LEVEL
   #define RULES_IF_MAX_NESTING_LEVEL          4
 #endif
+#ifndef RULES_INDEX_MIN_FREE_HEAP
+  #define RULES_INDEX_MIN_FREE_HEAP        8192 // Do not keep the rules index in memory when free heap is below this
+#endif
+#ifndef EVENT_QUEUE_BUFFER_SIZE
+  #ifdef ESP32
+    #define EVENT_QUEUE_BUFFER_SIZE        4096 // Max. total size in bytes of all queued events
+  #else
+    #define EVENT_QUEUE_BUFFER_SIZE        1536 // Max. total size in bytes of all queued events
+  #endif
+#endif
+#ifndef RULES_CALCULATE_CACHE_SIZE
+  #ifdef ESP32
+    #define RULES_CALCULATE_CACHE_SIZE       32 // Number of compiled rules expressions with variables to keep
+  #else
+    #define RULES_CALCULATE_CACHE_SIZE       16 // Number of compiled rules expressions with variables to keep
+  #endif
+#endif
 
 
 // ***********************************************************************
@@ -143,9 +185,47 @@
 #ifndef MAX_FLASHWRITES_PER_DAY
   #define MAX_FLASHWRITES_PER_DAY           100 // per 24 hour window
 #endif
+#ifndef SETTINGS_SAVE_BLOCK_SIZE
+  #define SETTINGS_SAVE_BLOCK_SIZE          256 // Settings files are compared and written in blocks aligned to this size
+#endif
+#ifndef SETTINGS_WRITE_BUFFER_SIZE
+  #ifdef ESP32
+    #define SETTINGS_WRITE_BUFFER_SIZE     6144 // Max. number of bytes of task settings kept in memory before writing
+  #else
+    #define SETTINGS_WRITE_BUFFER_SIZE     3072 // Max. number of bytes of task settings kept in memory before writing
+  #endif
+#endif
+#ifndef SETTINGS_WRITE_BUFFER_MIN_FREE_HEAP
+  #define SETTINGS_WRITE_BUFFER_MIN_FREE_HEAP 10000 // Write task settings immediately when free heap is below this
+#endif
+#ifndef SETTINGS_WRITE_BEHIND_TIMEOUT
+  #define SETTINGS_WRITE_BEHIND_TIMEOUT     250 // msec. to wait for more task settings to be saved before writing
+#endif
+#ifndef SETTINGS_WRITE_BEHIND_RETRY_INTERVAL
+  #define SETTINGS_WRITE_BEHIND_RETRY_INTERVAL 10000 // msec. to wait before trying again when writing task settings failed
+#endif
 #ifndef UDP_PACKETSIZE_MAX
   #define UDP_PACKETSIZE_MAX               256 // Currently only needed for C013_Receive
 #endif
+#ifndef UDP_RECEIVE_MAX_PACKETS
+  #define UDP_RECEIVE_MAX_PACKETS            8 // Max. number of UDP packets handled per checkUDP() call
+#endif
+#ifndef UDP_RECEIVE_MAX_DURATION_USEC
+  #define UDP_RECEIVE_MAX_DURATION_USEC   5000 // Stop handling UDP packets in checkUDP() after this duration
+#endif
+#ifndef WEBSERVER_EVENTS_MAX_CLIENTS
+  #ifdef ESP32
+    #define WEBSERVER_EVENTS_MAX_CLIENTS     4 // Max. number of concurrent /events (Server-Sent Events) clients
+  #else
+    #define WEBSERVER_EVENTS_MAX_CLIENTS     2 // Max. number of concurrent /events (Server-Sent Events) clients
+  #endif
+#endif
+#ifndef WEBSERVER_EVENTS_BUFFER_SIZE
+  #define WEBSERVER_EVENTS_BUFFER_SIZE    1024 // Max. number of bytes of events waiting to be sent per /events client
+#endif
+#ifndef WEBSERVER_EVENTS_KEEPALIVE
+  #define WEBSERVER_EVENTS_KEEPALIVE     15000 // msec. of inactivity before sending a comment to detect closed /events connections
+#endif
 #ifndef TIMER_GRATUITOUS_ARP_MAX
   #define TIMER_GRATUITOUS_ARP_MAX           5000
 #endif
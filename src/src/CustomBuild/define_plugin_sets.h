@@ -51,6 +51,12 @@ To create/register a plugin, you have to :
     #ifndef WEBSERVER_INCLUDE_JS
         #define WEBSERVER_INCLUDE_JS
     #endif
+    #ifndef WEBSERVER_EMBED_GZIP
+        #define WEBSERVER_EMBED_GZIP
+    #endif
+    #ifndef WEBSERVER_EVENTS
+        #define WEBSERVER_EVENTS
+    #endif
     #ifndef WEBSERVER_LOG
         #define WEBSERVER_LOG
     #endif
@@ -377,6 +383,12 @@ To create/register a plugin, you have to :
         #ifdef WEBSERVER_INCLUDE_JS
             #undef WEBSERVER_INCLUDE_JS
         #endif
+        #ifdef WEBSERVER_EMBED_GZIP
+            #undef WEBSERVER_EMBED_GZIP
+        #endif
+        #ifdef WEBSERVER_EVENTS
+            #undef WEBSERVER_EVENTS
+        #endif
         #ifdef WEBSERVER_LOG
             #undef WEBSERVER_LOG
         #endif
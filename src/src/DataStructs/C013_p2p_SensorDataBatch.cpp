@@ -0,0 +1,210 @@
+#include "../DataStructs/C013_p2p_SensorDataBatch.h"
+
+
+/*********************************************************************************************\
+* C013_SensorDataBatchEncoder
+\*********************************************************************************************/
+void C013_SensorDataBatchEncoder::update(taskIndex_t taskIndex, const float *values, byte valueCount)
+{
+  if ((taskIndex >= TASKS_MAX) || (values == nullptr)) {
+    return;
+  }
+  TaskState& task = _tasks[taskIndex];
+
+  if (valueCount > VARS_PER_TASK) {
+    valueCount = VARS_PER_TASK;
+  }
+
+  if (!task.known || (task.valueCount != valueCount)) {
+    // Receiver does not yet know the state of this task.
+    task.fullState = true;
+  }
+
+  for (byte i = 0; i < valueCount; ++i) {
+    // Compare the bits, to also detect a change from or to NaN
+    if (memcmp(&task.values[i], &values[i], sizeof(float)) != 0) {
+      task.values[i]    = values[i];
+      task.changedMask |= (1 << i);
+    }
+  }
+  task.valueCount = valueCount;
+  task.known      = true;
+  task.pending    = true;
+  task.updated    = true;
+}
+
+void C013_SensorDataBatchEncoder::remove(taskIndex_t taskIndex)
+{
+  if (taskIndex < TASKS_MAX) {
+    _tasks[taskIndex] = TaskState();
+  }
+}
+
+void C013_SensorDataBatchEncoder::requestFullState()
+{
+  for (taskIndex_t i = 0; i < TASKS_MAX; ++i) {
+    if (_tasks[i].known) {
+      _tasks[i].fullState = true;
+      _tasks[i].pending   = true;
+    }
+  }
+}
+
+bool C013_SensorDataBatchEncoder::hasPending() const
+{
+  for (taskIndex_t i = 0; i < TASKS_MAX; ++i) {
+    if (_tasks[i].pending) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t C013_SensorDataBatchEncoder::encodeFrame(byte sourceUnit, byte destUnit, byte *frame)
+{
+  size_t  pos       = C013_BATCH_HEADER_SIZE;
+  uint8_t nrRecords = 0;
+
+  for (taskIndex_t i = 0; i < TASKS_MAX; ++i) {
+    TaskState& task = _tasks[i];
+
+    if (!task.pending) {
+      continue;
+    }
+    // When no value changed, the record without values still marks the task update.
+    const uint8_t mask = task.fullState ? ((1 << task.valueCount) - 1) : task.changedMask;
+
+    if ((pos + C013_BATCH_RECORD_SIZE_MAX) > C013_BATCH_FRAME_SIZE_MAX) {
+      break;
+    }
+
+    if (task.updated) {
+      ++task.sequence;
+    }
+    frame[pos++] = i;
+    frame[pos++] = task.sequence;
+    frame[pos++] = mask | (task.valueCount << 4) | (task.fullState ? C013_BATCH_FLAG_FULL_STATE : 0);
+
+    for (byte x = 0; x < task.valueCount; ++x) {
+      if (mask & (1 << x)) {
+        // Same byte order as the float members of C013_SensorDataStruct
+        memcpy(&frame[pos], &task.values[x], sizeof(float));
+        pos += sizeof(float);
+      }
+    }
+    task.changedMask = 0;
+    task.fullState   = false;
+    task.pending     = false;
+    task.updated     = false;
+    ++nrRecords;
+  }
+
+  if (nrRecords == 0) {
+    return 0;
+  }
+  frame[0] = 255;
+  frame[1] = C013_BATCH_FRAME_ID;
+  frame[2] = sourceUnit;
+  frame[3] = destUnit;
+  frame[4] = nrRecords;
+  return pos;
+}
+
+/*********************************************************************************************\
+* C013_SensorDataBatchDecoder
+\*********************************************************************************************/
+bool C013_SensorDataBatchDecoder::init(const byte *frame, size_t size)
+{
+  _remaining = 0;
+
+  if ((frame == nullptr) || (size < C013_BATCH_HEADER_SIZE) ||
+      (frame[0] != 255) || (frame[1] != C013_BATCH_FRAME_ID)) {
+    return false;
+  }
+  _frame      = frame;
+  _size       = size;
+  _pos        = C013_BATCH_HEADER_SIZE;
+  _sourceUnit = frame[2];
+  _destUnit   = frame[3];
+  _remaining  = frame[4];
+  return true;
+}
+
+bool C013_SensorDataBatchDecoder::next(C013_SensorDataBatchRecord& record)
+{
+  if ((_remaining == 0) || ((_pos + 3) > _size)) {
+    _remaining = 0;
+    return false;
+  }
+  record.taskIndex = _frame[_pos++];
+  record.sequence  = _frame[_pos++];
+  const uint8_t flags = _frame[_pos++];
+
+  record.valueMask  = flags & ((1 << VARS_PER_TASK) - 1);
+  record.valueCount = (flags >> 4) & 0x07;
+  record.fullState  = (flags & C013_BATCH_FLAG_FULL_STATE) != 0;
+
+  if (record.valueCount > VARS_PER_TASK) {
+    _remaining = 0;
+    return false;
+  }
+
+  for (byte x = 0; x < VARS_PER_TASK; ++x) {
+    if (record.valueMask & (1 << x)) {
+      if ((_pos + sizeof(float)) > _size) {
+        _remaining = 0;
+        return false;
+      }
+      memcpy(&record.values[x], &_frame[_pos], sizeof(float));
+      _pos += sizeof(float);
+    }
+  }
+  --_remaining;
+  return true;
+}
+
+/*********************************************************************************************\
+* C013_SensorDataSequence
+\*********************************************************************************************/
+bool C013_SensorDataSequence::accept(taskIndex_t taskIndex, byte sourceUnit, uint8_t sequence, bool fullState, bool& newUpdate)
+{
+  newUpdate = false;
+
+  if (taskIndex >= TASKS_MAX) {
+    return false;
+  }
+  newUpdate = true;
+
+  if (_sourceUnit[taskIndex] != sourceUnit) {
+    // Sequence numbers of another unit are not related.
+    reset(taskIndex);
+  }
+
+  if (_sourceUnit[taskIndex] != 0) {
+    const int8_t diff = static_cast<int8_t>(sequence - _sequence[taskIndex]);
+
+    if (fullState) {
+      // Same sequence: the full state was resent without a new update.
+      // Older sequence: sender restarted its sequence numbers, e.g. after a reboot.
+      newUpdate = diff != 0;
+    } else if (diff <= 0) {
+      // Duplicate or older update
+      newUpdate = false;
+      return false;
+    }
+
+    if (diff > 0) {
+      _nrMissed += diff - 1;
+    }
+  }
+  _sequence[taskIndex]   = sequence;
+  _sourceUnit[taskIndex] = sourceUnit;
+  return true;
+}
+
+void C013_SensorDataSequence::reset(taskIndex_t taskIndex)
+{
+  if (taskIndex < TASKS_MAX) {
+    _sourceUnit[taskIndex] = 0;
+  }
+}
@@ -0,0 +1,153 @@
+#ifndef DATASTRUCTS_C013_P2P_SENSORDATABATCH_H
+#define DATASTRUCTS_C013_P2P_SENSORDATABATCH_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../CustomBuild/ESPEasyLimits.h"
+#include "../DataTypes/TaskIndex.h"
+
+/*********************************************************************************************\
+* Batched sensor data frames for the ESPEasy p2p controller (C013)
+*
+* Instead of one C013_SensorDataStruct per task per node, the updates of several tasks are
+* combined in a single frame. Per task only the values changed since the last update are sent.
+* A task update without changed values is still sent as a record without values, as the receiver
+* generates a rule event for each task update.
+* Every task update has a sequence number, so a receiver can ignore duplicate or old updates.
+* Periodically the full state of all tasks is sent, to correct values missed by lost frames.
+* Such a record keeps the sequence number of the last update of the task when the task was not
+* updated meanwhile, so the receiver can tell it apart from a new update.
+*
+* Only sent to nodes reporting a build >= C013_BATCH_MIN_BUILD in their sysinfo message,
+* other nodes still receive C013_SensorDataStruct.
+*
+* Frame (little endian):
+*   uint8  header         255
+*   uint8  ID             C013_BATCH_FRAME_ID
+*   uint8  sourceUnit
+*   uint8  destUnit
+*   uint8  nrRecords
+*   records:
+*     uint8  task index   Source task index, also used as destination task index
+*     uint8  sequence     Incremented for each update of the task
+*     uint8  flags        bits 0..3: values present, bits 4..6: value count, bit 7: full state
+*     float  values[]     Only the values present
+\*********************************************************************************************/
+
+#define C013_BATCH_MIN_BUILD        20115
+#define C013_BATCH_FRAME_ID         7 // 6 is reserved for data format version 1
+#define C013_BATCH_HEADER_SIZE      5
+
+// checkUDP() only accepts packets smaller than UDP_PACKETSIZE_MAX
+#define C013_BATCH_FRAME_SIZE_MAX   (UDP_PACKETSIZE_MAX - 1)
+#define C013_BATCH_RECORD_SIZE_MAX  (3 + (VARS_PER_TASK * sizeof(float)))
+#define C013_BATCH_FLAG_FULL_STATE  0x80
+
+
+struct C013_SensorDataBatchRecord {
+  float       values[VARS_PER_TASK] = { 0 };
+  taskIndex_t taskIndex             = INVALID_TASK_INDEX;
+  uint8_t     sequence              = 0;
+  uint8_t     valueMask             = 0; // Bit set for each value present
+  byte        valueCount            = 0;
+  bool        fullState             = false;
+};
+
+
+class C013_SensorDataBatchEncoder {
+public:
+
+  // Store the current values of a task, to be sent with the next frame.
+  void   update(taskIndex_t  taskIndex,
+                const float *values,
+                byte         valueCount);
+
+  // Forget a task, e.g. when its settings changed.
+  void   remove(taskIndex_t taskIndex);
+
+  // Send all values of all known tasks with the next frame.
+  void   requestFullState();
+
+  bool   hasPending() const;
+
+  // Encode pending task updates into frame (at least C013_BATCH_FRAME_SIZE_MAX bytes).
+  // Return the frame size, or 0 when nothing is pending.
+  // When not all updates fit in a single frame, hasPending() remains true.
+  size_t encodeFrame(byte  sourceUnit,
+                     byte  destUnit,
+                     byte *frame);
+
+private:
+
+  struct TaskState {
+    float   values[VARS_PER_TASK] = { 0 };
+    uint8_t changedMask           = 0;
+    uint8_t sequence              = 0;
+    byte    valueCount            = 0;
+    bool    known                 = false;
+    bool    pending               = false;
+    bool    updated               = false; // Task sent new values, not only a full state request
+    bool    fullState             = false;
+  };
+
+  TaskState _tasks[TASKS_MAX];
+};
+
+
+class C013_SensorDataBatchDecoder {
+public:
+
+  // Return false when the frame is not a valid batch frame.
+  bool init(const byte *frame,
+            size_t      size);
+
+  // Return false when all records are read, or the frame is truncated.
+  bool next(C013_SensorDataBatchRecord& record);
+
+  byte sourceUnit() const { return _sourceUnit; }
+
+  byte destUnit() const { return _destUnit; }
+
+private:
+
+  const byte *_frame      = nullptr;
+  size_t      _size       = 0;
+  size_t      _pos        = 0;
+  uint8_t     _remaining  = 0;
+  byte        _sourceUnit = 0;
+  byte        _destUnit   = 0;
+};
+
+
+/*********************************************************************************************\
+* Sequence numbers of received task updates, per local task.
+* The sequence numbers of a task are restarted when it receives updates from another unit.
+\*********************************************************************************************/
+class C013_SensorDataSequence {
+public:
+
+  // Return false when the update is a duplicate or older than the last accepted update.
+  // A full state update is always accepted, 'newUpdate' is set to false when it is a resend
+  // of the last accepted update. Then no rule event should be generated.
+  bool     accept(taskIndex_t taskIndex,
+                  byte        sourceUnit,
+                  uint8_t     sequence,
+                  bool        fullState,
+                  bool      & newUpdate);
+
+  // Forget the last sequence number, e.g. when the task is disabled.
+  void     reset(taskIndex_t taskIndex);
+
+  // Number of updates missed, detected by gaps in the sequence numbers
+  uint32_t getNrMissed() const { return _nrMissed; }
+
+private:
+
+  uint8_t  _sequence[TASKS_MAX]   = { 0 };
+
+  // Unit which sent the last accepted update, 0 when unknown.
+  byte     _sourceUnit[TASKS_MAX] = { 0 };
+  uint32_t _nrMissed              = 0;
+};
+
+#endif // DATASTRUCTS_C013_P2P_SENSORDATABATCH_H
@@ -0,0 +1,144 @@
+#include "../DataStructs/CBOR_Writer.h"
+
+#define CBOR_MAJOR_UINT   0
+#define CBOR_MAJOR_TEXT   3
+#define CBOR_MAJOR_ARRAY  4
+#define CBOR_MAJOR_MAP    5
+
+#define CBOR_FLOAT16      0xF9
+#define CBOR_FLOAT32      0xFA
+#define CBOR_INDEFINITE   0x1F
+#define CBOR_BREAK        0xFF
+
+
+CBOR_Writer::CBOR_Writer(uint8_t *buffer, size_t size) : _buffer(buffer), _size(size) {}
+
+void CBOR_Writer::addUint(uint32_t value)
+{
+  addHeader(CBOR_MAJOR_UINT, value);
+}
+
+// Return true when the float can be represented exactly as half precision float.
+static bool toFloat16(uint32_t bits, uint16_t& half)
+{
+  const uint16_t sign     = (bits >> 16) & 0x8000;
+  const int      exponent = static_cast<int>((bits >> 23) & 0xFF) - 127;
+  const uint32_t mantissa = bits & 0x7FFFFF;
+
+  if (exponent == 128) {
+    // Infinity or NaN
+    half = sign | 0x7C00 | (mantissa != 0 ? 0x0200 : 0);
+    return true;
+  }
+
+  if ((exponent == -127) && (mantissa == 0)) {
+    half = sign;
+    return true;
+  }
+
+  if ((exponent >= -14) && (exponent <= 15)) {
+    if ((mantissa & 0x1FFF) != 0) {
+      return false;
+    }
+    half = sign | ((exponent + 15) << 10) | (mantissa >> 13);
+    return true;
+  }
+
+  if ((exponent >= -24) && (exponent < -14)) {
+    // Subnormal half precision float
+    const uint32_t full  = 0x800000 | mantissa;
+    const int      shift = -1 - exponent;
+
+    if ((full & ((1u << shift) - 1)) != 0) {
+      return false;
+    }
+    half = sign | (full >> shift);
+    return true;
+  }
+  return false;
+}
+
+void CBOR_Writer::addFloat(float value)
+{
+  uint32_t bits;
+  uint16_t half;
+
+  memcpy(&bits, &value, sizeof(bits));
+
+  // Use the shortest encoding which keeps the exact value, e.g. 21.5 or 1.0
+  if (toFloat16(bits, half)) {
+    addByte(CBOR_FLOAT16);
+    addByte(half >> 8);
+    addByte(half);
+    return;
+  }
+  addByte(CBOR_FLOAT32);
+
+  // Network byte order
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    addByte(bits >> shift);
+  }
+}
+
+void CBOR_Writer::addText(const char *text)
+{
+  const size_t length = strlen(text);
+
+  addHeader(CBOR_MAJOR_TEXT, length);
+
+  for (size_t i = 0; i < length; ++i) {
+    addByte(text[i]);
+  }
+}
+
+void CBOR_Writer::startArray(size_t count)
+{
+  addHeader(CBOR_MAJOR_ARRAY, count);
+}
+
+void CBOR_Writer::startMap(size_t count)
+{
+  addHeader(CBOR_MAJOR_MAP, count);
+}
+
+void CBOR_Writer::startIndefiniteArray()
+{
+  addByte((CBOR_MAJOR_ARRAY << 5) | CBOR_INDEFINITE);
+}
+
+void CBOR_Writer::endIndefinite()
+{
+  addByte(CBOR_BREAK);
+}
+
+void CBOR_Writer::addHeader(uint8_t majorType, uint32_t value)
+{
+  const uint8_t major = majorType << 5;
+
+  // Use the shortest encoding of the value
+  if (value < 24) {
+    addByte(major | value);
+  } else if (value <= 0xFF) {
+    addByte(major | 24);
+    addByte(value);
+  } else if (value <= 0xFFFF) {
+    addByte(major | 25);
+    addByte(value >> 8);
+    addByte(value);
+  } else {
+    addByte(major | 26);
+
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      addByte(value >> shift);
+    }
+  }
+}
+
+void CBOR_Writer::addByte(uint8_t value)
+{
+  if (_pos >= _size) {
+    _overflow = true;
+    return;
+  }
+  _buffer[_pos++] = value;
+}
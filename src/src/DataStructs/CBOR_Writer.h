@@ -0,0 +1,55 @@
+#ifndef DATASTRUCTS_CBOR_WRITER_H
+#define DATASTRUCTS_CBOR_WRITER_H
+
+#include "../../ESPEasy_common.h"
+
+/*********************************************************************************************\
+* Minimal CBOR (RFC 8949) encoder writing into a fixed size buffer.
+*
+* Only the types needed for compact binary web responses are supported:
+* unsigned integers, text strings, 32 bit floats, arrays and maps.
+* When the buffer is too small, the output is truncated and overflow() returns true.
+\*********************************************************************************************/
+class CBOR_Writer {
+public:
+
+  CBOR_Writer(uint8_t *buffer,
+              size_t   size);
+
+  void   addUint(uint32_t value);
+
+  // Stored as half precision float when this does not change the value, otherwise as 32 bit float.
+  void   addFloat(float value);
+
+  void   addText(const char *text);
+
+  // Array or map of known number of elements (map: number of key/value pairs)
+  void   startArray(size_t count);
+  void   startMap(size_t count);
+
+  // Array of unknown length, must be closed with endIndefinite()
+  void   startIndefiniteArray();
+  void   endIndefinite();
+
+  size_t size() const {
+    return _pos;
+  }
+
+  bool overflow() const {
+    return _overflow;
+  }
+
+private:
+
+  void addHeader(uint8_t  majorType,
+                 uint32_t value);
+
+  void addByte(uint8_t value);
+
+  uint8_t *_buffer;
+  size_t   _size;
+  size_t   _pos      = 0;
+  bool     _overflow = false;
+};
+
+#endif // DATASTRUCTS_CBOR_WRITER_H
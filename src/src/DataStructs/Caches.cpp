@@ -3,6 +3,7 @@
 #include "../Globals/Device.h"
 #include "../Globals/Settings.h"
 #include "../Globals/WiFi_AP_Candidates.h"
+#include "../Helpers/Rules_calculate.h"
 
 #include <ESPeasySerial.h>
 
@@ -10,13 +11,18 @@
 void Caches::clearAllCaches()
 {
   fileExistsMap.clear();
+  fileETagMap.clear();
+  extraTaskSettings.clear();
   updateTaskCaches();
   WiFi_AP_Candidates.clearCache();
+  clearRulesCalculateCache();
 }
 
 void Caches::updateTaskCaches() {
   taskIndexName.clear();
   taskIndexValueName.clear();
+  taskValueJSONKeys.clear();
+  parsedTemplates.clear();
   updateActiveTaskUseSerial0();
 }
 
@@ -2,12 +2,19 @@
 #define DATASTRUCTS_CACHES_H
 
 #include <map>
+#include <vector>
 #include "../../ESPEasy_common.h"
+#include "../DataStructs/ExtraTaskSettingsCache.h"
+#include "../DataStructs/ParsedTemplateStruct.h"
 #include "../Globals/Plugins.h"
 
 typedef std::map<String, taskIndex_t>TaskIndexNameMap;
 typedef std::map<String, byte>       TaskIndexValueNameMap;
 typedef std::map<String, bool>       FilePresenceMap;
+typedef std::map<String, uint32_t>   FileETagMap;
+
+// Task value names formatted as JSON object keys, like: "Temperature":
+typedef std::map<taskIndex_t, std::vector<String> >TaskValueJSONKeyMap;
 
 struct Caches {
   void clearAllCaches();
@@ -16,10 +23,14 @@ struct Caches {
 
   void updateActiveTaskUseSerial0();
 
-  TaskIndexNameMap      taskIndexName;
-  TaskIndexValueNameMap taskIndexValueName;
-  FilePresenceMap       fileExistsMap;
-  bool                  activeTaskUseSerial0 = false;
+  TaskIndexNameMap       taskIndexName;
+  TaskIndexValueNameMap  taskIndexValueName;
+  FilePresenceMap        fileExistsMap;
+  FileETagMap            fileETagMap; // Content hash of files served by the web server
+  TaskValueJSONKeyMap    taskValueJSONKeys;
+  ExtraTaskSettingsCache extraTaskSettings;
+  ParsedTemplateCache    parsedTemplates;
+  bool                   activeTaskUseSerial0 = false;
 };
 
 
@@ -0,0 +1,259 @@
+#include "../DataStructs/ControllerCacheBlock.h"
+
+#include "../Helpers/CRC_functions.h"
+
+#include <math.h>
+
+
+namespace {
+const uint32_t quantize_factors[CONTROLLER_CACHE_MAX_DECIMALS + 1] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+void writeUint16(uint8_t *buffer, uint16_t value) {
+  buffer[0] = value & 0xFF;
+  buffer[1] = value >> 8;
+}
+
+void writeUint32(uint8_t *buffer, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    buffer[i] = value & 0xFF;
+    value   >>= 8;
+  }
+}
+
+uint16_t readUint16(const uint8_t *buffer) {
+  return buffer[0] | (buffer[1] << 8);
+}
+
+uint32_t readUint32(const uint8_t *buffer) {
+  uint32_t value = 0;
+
+  for (int i = 3; i >= 0; --i) {
+    value = (value << 8) | buffer[i];
+  }
+  return value;
+}
+
+size_t writeVarint(uint8_t *buffer, uint32_t value) {
+  size_t pos = 0;
+
+  while (value >= 0x80) {
+    buffer[pos++] = (value & 0x7F) | 0x80;
+    value       >>= 7;
+  }
+  buffer[pos++] = value;
+  return pos;
+}
+
+bool readVarint(const uint8_t *buffer, size_t size, size_t& pos, uint32_t& value) {
+  value = 0;
+
+  for (int shift = 0; shift < 35; shift += 7) {
+    if (pos >= size) { return false; }
+    const uint8_t b = buffer[pos++];
+    value |= static_cast<uint32_t>(b & 0x7F) << shift;
+
+    if ((b & 0x80) == 0) { return true; }
+  }
+  return false;
+}
+
+uint32_t zigzagEncode(int32_t value) {
+  return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t zigzagDecode(uint32_t value) {
+  return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+
+// CRC16 over the header, without the checksum field itself
+uint16_t headerChecksum(const uint8_t *buffer) {
+  char tmp[CONTROLLER_CACHE_BLOCK_HEADER_SIZE - 2];
+
+  memcpy(tmp,     buffer,     6);
+  memcpy(tmp + 6, buffer + 8, CONTROLLER_CACHE_BLOCK_HEADER_SIZE - 8);
+  return calc_CRC16(tmp, sizeof(tmp));
+}
+
+// Return true when all values can be stored as integer with the given number of decimals.
+bool quantize(const ControllerCacheSample& sample, uint32_t factor, int32_t quantized[]) {
+  for (byte i = 0; i < sample.valueCount; ++i) {
+    const double scaled = static_cast<double>(sample.values[i]) * factor;
+
+    if (!isfinite(scaled) || (fabs(scaled) >= 2147483647.0)) {
+      return false;
+    }
+    quantized[i] = static_cast<int32_t>(lround(scaled));
+  }
+  return true;
+}
+} // namespace
+
+
+/*********************************************************************************************\
+* ControllerCacheBlockHeader
+\*********************************************************************************************/
+void ControllerCacheBlockHeader::init(uint32_t timestamp)
+{
+  nrRecords     = 0;
+  payloadSize   = 0;
+  baseTimestamp = timestamp;
+  lastTimestamp = timestamp;
+}
+
+bool ControllerCacheBlockHeader::read(const uint8_t *buffer, size_t size)
+{
+  if (!isControllerCacheBlock(buffer, size)) {
+    return false;
+  }
+  nrRecords     = buffer[3];
+  payloadSize   = readUint16(buffer + 4);
+  baseTimestamp = readUint32(buffer + 8);
+  lastTimestamp = readUint32(buffer + 12);
+  return true;
+}
+
+void ControllerCacheBlockHeader::write(uint8_t *buffer) const
+{
+  writeUint16(buffer, CONTROLLER_CACHE_BLOCK_MAGIC);
+  buffer[2] = CONTROLLER_CACHE_BLOCK_VERSION;
+  buffer[3] = nrRecords;
+  writeUint16(buffer + 4, payloadSize);
+  writeUint32(buffer + 8,  baseTimestamp);
+  writeUint32(buffer + 12, lastTimestamp);
+  writeUint16(buffer + 6, headerChecksum(buffer));
+}
+
+size_t ControllerCacheBlockHeader::encode(const ControllerCacheSample& sample, uint8_t *buffer) const
+{
+  const byte valueCount = sample.valueCount > VARS_PER_TASK ? VARS_PER_TASK : sample.valueCount;
+  size_t     pos        = writeVarint(buffer, zigzagEncode(static_cast<int32_t>(sample.timestamp - lastTimestamp)));
+
+  buffer[pos++] = sample.TaskIndex;
+  buffer[pos++] = sample.controller_idx;
+  buffer[pos++] = static_cast<uint8_t>(sample.sensorType);
+
+  int32_t quantized[VARS_PER_TASK];
+  uint8_t decimals     = 0;
+  bool    useQuantized = false;
+
+  if (sample.decimals >= 0) {
+    decimals     = sample.decimals > CONTROLLER_CACHE_MAX_DECIMALS ? CONTROLLER_CACHE_MAX_DECIMALS : sample.decimals;
+    useQuantized = quantize(sample, quantize_factors[decimals], quantized);
+  }
+
+  buffer[pos++] = valueCount | (useQuantized ? (0x08 | (decimals << 4)) : 0);
+
+  for (byte i = 0; i < valueCount; ++i) {
+    if (useQuantized) {
+      pos += writeVarint(buffer + pos, zigzagEncode(quantized[i]));
+    } else {
+      uint32_t tmp;
+      memcpy(&tmp, &sample.values[i], sizeof(tmp));
+      writeUint32(buffer + pos, tmp);
+      pos += 4;
+    }
+  }
+  return pos;
+}
+
+void ControllerCacheBlockHeader::addRecord(const ControllerCacheSample& sample, size_t recordSize)
+{
+  ++nrRecords;
+  payloadSize  += recordSize;
+  lastTimestamp = sample.timestamp;
+}
+
+/*********************************************************************************************\
+* ControllerCacheBlockDecoder
+\*********************************************************************************************/
+void ControllerCacheBlockDecoder::init(const ControllerCacheBlockHeader& header, const uint8_t *payload)
+{
+  _payload   = payload;
+  _size      = header.payloadSize;
+  _pos       = 0;
+  _remaining = header.nrRecords;
+  _timestamp = header.baseTimestamp;
+}
+
+bool ControllerCacheBlockDecoder::next(ControllerCacheSample& sample)
+{
+  if ((_remaining == 0) || (_payload == nullptr)) {
+    return false;
+  }
+  uint32_t delta;
+
+  if (!readVarint(_payload, _size, _pos, delta) || ((_pos + 4) > _size)) {
+    _remaining = 0;
+    return false;
+  }
+  _timestamp           += zigzagDecode(delta);
+  sample.timestamp      = _timestamp;
+  sample.TaskIndex      = _payload[_pos++];
+  sample.controller_idx = _payload[_pos++];
+  sample.sensorType     = static_cast<Sensor_VType>(_payload[_pos++]);
+
+  const uint8_t flags = _payload[_pos++];
+
+  sample.valueCount = flags & 0x07;
+  sample.decimals   = (flags & 0x08) ? (flags >> 4) : -1;
+
+  if ((sample.valueCount > VARS_PER_TASK) || (sample.decimals > CONTROLLER_CACHE_MAX_DECIMALS)) {
+    _remaining = 0;
+    return false;
+  }
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    sample.values[i] = 0.0f;
+
+    if (i >= sample.valueCount) {
+      continue;
+    }
+
+    if (sample.decimals >= 0) {
+      uint32_t tmp;
+
+      if (!readVarint(_payload, _size, _pos, tmp)) {
+        _remaining = 0;
+        return false;
+      }
+      sample.values[i] = static_cast<double>(zigzagDecode(tmp)) / quantize_factors[sample.decimals];
+    } else {
+      if ((_pos + 4) > _size) {
+        _remaining = 0;
+        return false;
+      }
+      const uint32_t tmp = readUint32(_payload + _pos);
+      memcpy(&sample.values[i], &tmp, sizeof(tmp));
+      _pos += 4;
+    }
+  }
+  --_remaining;
+  return true;
+}
+
+/*********************************************************************************************\
+* Helper functions
+\*********************************************************************************************/
+bool decodeLegacyControllerCacheSample(const uint8_t *data, ControllerCacheSample& sample)
+{
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    const uint32_t tmp = readUint32(data + (4 * i));
+    memcpy(&sample.values[i], &tmp, sizeof(tmp));
+  }
+  sample.timestamp      = readUint32(data + 16);
+  sample.TaskIndex      = data[20];
+  sample.controller_idx = data[21];
+  sample.sensorType     = static_cast<Sensor_VType>(data[22]);
+  sample.valueCount     = data[23];
+  sample.decimals       = -1;
+
+  return sample.TaskIndex < TASKS_MAX && sample.valueCount <= VARS_PER_TASK;
+}
+
+bool isControllerCacheBlock(const uint8_t *data, size_t size)
+{
+  return size >= CONTROLLER_CACHE_BLOCK_HEADER_SIZE &&
+         readUint16(data) == CONTROLLER_CACHE_BLOCK_MAGIC &&
+         data[2] == CONTROLLER_CACHE_BLOCK_VERSION &&
+         readUint16(data + 6) == headerChecksum(data);
+}
@@ -0,0 +1,120 @@
+#ifndef DATASTRUCTS_CONTROLLERCACHEBLOCK_H
+#define DATASTRUCTS_CONTROLLERCACHEBLOCK_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../CustomBuild/ESPEasyLimits.h"
+#include "../DataStructs/DeviceStruct.h"
+#include "../DataTypes/ControllerIndex.h"
+#include "../DataTypes/TaskIndex.h"
+
+/*********************************************************************************************\
+* Compact storage format of the cache controller (C016)
+*
+* Samples are stored in blocks. A block is collected in RTC memory and written to a cache file
+* as a whole when the RTC buffer is full.
+* Each block starts with a header, followed by the encoded samples:
+*
+* Header (16 bytes, little endian):
+*   uint16 magic          CONTROLLER_CACHE_BLOCK_MAGIC
+*   uint8  version        CONTROLLER_CACHE_BLOCK_VERSION
+*   uint8  nrRecords      Number of samples in the block
+*   uint16 payloadSize    Number of bytes of the encoded samples following the header
+*   uint16 checksum       CRC16 of the other header bytes
+*   uint32 baseTimestamp  Unix timestamp of the first sample
+*   uint32 lastTimestamp  Unix timestamp of the last sample
+*
+* Sample:
+*   varint  timestamp     Zigzag encoded difference with the previous sample (or baseTimestamp)
+*   uint8   task index
+*   uint8   controller index
+*   uint8   sensor type
+*   uint8   flags         bits 0..2: value count, bit 3: quantized, bits 4..7: decimals
+*   values                quantized: zigzag varint of value * 10^decimals
+*                         else:      float (4 bytes)
+*
+* Files written before this format was introduced contain fixed size (24 byte) samples without header.
+* A file never contains both formats.
+\*********************************************************************************************/
+
+#define CONTROLLER_CACHE_BLOCK_MAGIC        0xC016
+#define CONTROLLER_CACHE_BLOCK_VERSION      1
+#define CONTROLLER_CACHE_BLOCK_HEADER_SIZE  16
+#define CONTROLLER_CACHE_MAX_RECORD_SIZE    (5 + 4 + (VARS_PER_TASK * 5))
+#define CONTROLLER_CACHE_LEGACY_RECORD_SIZE 24
+
+// Maximum number of decimals used to quantize values
+#define CONTROLLER_CACHE_MAX_DECIMALS       6
+
+
+struct ControllerCacheSample {
+  float             values[VARS_PER_TASK] = { 0 };
+  uint32_t          timestamp             = 0; // Unix timestamp
+  taskIndex_t       TaskIndex             = INVALID_TASK_INDEX;
+  controllerIndex_t controller_idx        = INVALID_CONTROLLER_INDEX;
+  Sensor_VType      sensorType            = Sensor_VType::SENSOR_TYPE_NONE;
+  byte              valueCount            = 0;
+
+  // Number of decimals to round the values to when stored, or -1 to store the values as float.
+  int8_t            decimals = -1;
+};
+
+
+struct ControllerCacheBlockHeader {
+  // Start a new block
+  void     init(uint32_t timestamp);
+
+  // Read the header from the start of the buffer.
+  // Return false when it is not a valid header.
+  bool     read(const uint8_t *buffer,
+                size_t         size);
+
+  // Write the header (CONTROLLER_CACHE_BLOCK_HEADER_SIZE bytes) to the buffer.
+  void     write(uint8_t *buffer) const;
+
+  // Encode a sample to be appended to this block.
+  // Return the number of bytes written to buffer (at most CONTROLLER_CACHE_MAX_RECORD_SIZE)
+  size_t   encode(const ControllerCacheSample& sample,
+                  uint8_t                     *buffer) const;
+
+  // Update the header after the encoded sample was appended to the block.
+  void     addRecord(const ControllerCacheSample& sample,
+                     size_t                       recordSize);
+
+  uint8_t  nrRecords     = 0;
+  uint16_t payloadSize   = 0;
+  uint32_t baseTimestamp = 0;
+  uint32_t lastTimestamp = 0;
+};
+
+
+/*********************************************************************************************\
+* ControllerCacheBlockDecoder
+* Decode the samples in the payload of a block.
+\*********************************************************************************************/
+struct ControllerCacheBlockDecoder {
+  void init(const ControllerCacheBlockHeader& header,
+            const uint8_t                    *payload);
+
+  // Return false when all samples are read, or the payload is corrupt.
+  bool next(ControllerCacheSample& sample);
+
+private:
+
+  const uint8_t *_payload    = nullptr;
+  size_t         _size       = 0;
+  size_t         _pos        = 0;
+  uint8_t        _remaining  = 0;
+  uint32_t       _timestamp  = 0;
+};
+
+// Decode a sample stored in the format used before blocks were introduced.
+// Return false when the sample does not look valid.
+bool decodeLegacyControllerCacheSample(const uint8_t         *data,
+                                       ControllerCacheSample& sample);
+
+// Check whether the data starts with a valid block header.
+bool isControllerCacheBlock(const uint8_t *data,
+                            size_t         size);
+
+#endif // DATASTRUCTS_CONTROLLERCACHEBLOCK_H
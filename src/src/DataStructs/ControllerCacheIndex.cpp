@@ -0,0 +1,45 @@
+#include "../DataStructs/ControllerCacheIndex.h"
+
+#include <algorithm>
+
+
+ControllerCacheFileIndex::ControllerCacheFileIndex(uint16_t fileNumber) : fileNr(fileNumber) {}
+
+void ControllerCacheFileIndex::addBlock(uint16_t offset, uint32_t firstTs, uint32_t lastTs, uint8_t interval)
+{
+  if (nrBlocks == 0) {
+    firstTimestamp = firstTs;
+  }
+
+  if ((interval == 0) || ((nrBlocks % interval) == 0)) {
+    entries.push_back({ firstTs, offset });
+  }
+  lastTimestamp = lastTs;
+  ++nrBlocks;
+}
+
+bool ControllerCacheFileIndex::empty() const
+{
+  return nrBlocks == 0;
+}
+
+bool ControllerCacheFileIndex::overlaps(uint32_t from, uint32_t to) const
+{
+  return !empty() && lastTimestamp >= from && firstTimestamp <= to;
+}
+
+uint16_t ControllerCacheFileIndex::findOffset(uint32_t timestamp) const
+{
+  // The first entry starting at or after timestamp may be preceded by samples at the same timestamp,
+  // so start at the entry before it.
+  auto it = std::lower_bound(entries.begin(), entries.end(), timestamp,
+                             [](const Entry& entry, uint32_t ts) {
+    return entry.timestamp < ts;
+  });
+
+  if (it == entries.begin()) {
+    return 0;
+  }
+  --it;
+  return it->offset;
+}
@@ -0,0 +1,57 @@
+#ifndef DATASTRUCTS_CONTROLLERCACHEINDEX_H
+#define DATASTRUCTS_CONTROLLERCACHEINDEX_H
+
+#include "../../ESPEasy_common.h"
+
+#include <vector>
+
+/*********************************************************************************************\
+* Sparse time index of a cache file of the cache controller (C016)
+*
+* For each cache file the first and last timestamp are kept, together with the offset and
+* first timestamp of every CONTROLLER_CACHE_INDEX_INTERVAL blocks.
+* This allows to skip files and seek in a file to read only the samples of a time range.
+*
+* The index is kept in RAM only and is built from the block headers when first needed.
+* Samples are assumed to be stored in chronological order.
+\*********************************************************************************************/
+
+// Store the offset of every N-th block (~2 kB of data)
+#define CONTROLLER_CACHE_INDEX_INTERVAL         8
+
+// Files without block headers store fixed size samples, store the offset of every N-th sample.
+#define CONTROLLER_CACHE_INDEX_LEGACY_INTERVAL  80
+
+
+struct ControllerCacheFileIndex {
+  struct Entry {
+    uint32_t timestamp; // Timestamp of the first sample at offset
+    uint16_t offset;    // Cache files are smaller than 64 kB
+  };
+
+  explicit ControllerCacheFileIndex(uint16_t fileNumber);
+
+  // Update the index for a block (or legacy sample) appended to the file at offset.
+  // Only every 'interval' blocks an entry is stored.
+  void     addBlock(uint16_t offset,
+                    uint32_t firstTs,
+                    uint32_t lastTs,
+                    uint8_t  interval = CONTROLLER_CACHE_INDEX_INTERVAL);
+
+  bool     empty() const;
+
+  // Return true when the file may contain samples in the range [from, to]
+  bool     overlaps(uint32_t from,
+                    uint32_t to) const;
+
+  // Return the offset in the file where to start reading to find the first sample at or after timestamp.
+  uint16_t findOffset(uint32_t timestamp) const;
+
+  std::vector<Entry> entries;
+  uint32_t           firstTimestamp = 0;
+  uint32_t           lastTimestamp  = 0;
+  uint16_t           fileNr;
+  uint16_t           nrBlocks = 0;
+};
+
+#endif // DATASTRUCTS_CONTROLLERCACHEINDEX_H
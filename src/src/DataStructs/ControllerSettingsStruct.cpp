@@ -276,3 +276,43 @@ void ControllerSettingsStruct::deduplicate(bool value)
 {
   bitWrite(VariousFlags, 10, value);
 }
+
+bool ControllerSettingsStruct::sendBatch() const
+{
+  return bitRead(VariousFlags, 11);
+}
+
+void ControllerSettingsStruct::sendBatch(bool value)
+{
+  bitWrite(VariousFlags, 11, value);
+}
+
+bool ControllerSettingsStruct::spillToFile() const
+{
+  return bitRead(VariousFlags, 12);
+}
+
+void ControllerSettingsStruct::spillToFile(bool value)
+{
+  bitWrite(VariousFlags, 12, value);
+}
+
+bool ControllerSettingsStruct::sendJSON() const
+{
+  return bitRead(VariousFlags, 13);
+}
+
+void ControllerSettingsStruct::sendJSON(bool value)
+{
+  bitWrite(VariousFlags, 13, value);
+}
+
+bool ControllerSettingsStruct::cacheQuantize() const
+{
+  return bitRead(VariousFlags, 14);
+}
+
+void ControllerSettingsStruct::cacheQuantize(bool value)
+{
+  bitWrite(VariousFlags, 14, value);
+}
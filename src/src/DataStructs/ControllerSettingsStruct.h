@@ -71,6 +71,8 @@ struct ControllerSettingsStruct
     CONTROLLER_FULL_QUEUE_ACTION,
     CONTROLLER_ALLOW_EXPIRE,
     CONTROLLER_DEDUPLICATE,
+    CONTROLLER_SEND_BATCH,
+    CONTROLLER_SPILL_TO_FILE,
     CONTROLLER_CHECK_REPLY,
     CONTROLLER_CLIENT_ID,
     CONTROLLER_UNIQUE_CLIENT_ID_RECONNECT,
@@ -86,6 +88,8 @@ struct ControllerSettingsStruct
     CONTROLLER_TIMEOUT,
     CONTROLLER_SAMPLE_SET_INITIATOR,
     CONTROLLER_SEND_BINARY,
+    CONTROLLER_SEND_JSON,
+    CONTROLLER_CACHE_QUANTIZE,
 
     // Keep this as last, is used to loop over all parameters
     CONTROLLER_ENABLED
@@ -142,6 +146,18 @@ struct ControllerSettingsStruct
   bool      deduplicate() const;
   void      deduplicate(bool value);
 
+  bool      sendBatch() const;
+  void      sendBatch(bool value);
+
+  bool      spillToFile() const;
+  void      spillToFile(bool value);
+
+  bool      sendJSON() const;
+  void      sendJSON(bool value);
+
+  bool      cacheQuantize() const;
+  void      cacheQuantize(bool value);
+
   boolean      UseDNS;
   byte         IP[4];
   unsigned int Port;
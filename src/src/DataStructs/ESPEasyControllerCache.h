@@ -3,16 +3,18 @@
 
 #include <Arduino.h>
 
+#include "../DataStructs/ControllerCacheBlock.h"
 #include "../DataStructs/RTC_cache_handler_struct.h"
 
+#include <vector>
+
 struct ControllerCache_struct {
   ControllerCache_struct();
 
   ~ControllerCache_struct();
 
   // Write a single sample set to the buffer
-  bool write(uint8_t     *data,
-             unsigned int size);
+  bool write(const ControllerCacheSample& sample);
 
   // Read a single sample set, either from file or buffer.
   // May delete a file if it is all read and not written to.
@@ -33,18 +35,38 @@ struct ControllerCache_struct {
 
   void   resetpeek();
 
-  // Read data without marking it as being read.
-  bool   peek(uint8_t     *data,
-              unsigned int size);
+  // Read the next sample without marking it as being read.
+  bool   peek(ControllerCacheSample& sample);
 
   String getPeekCacheFileName(bool& islast);
 
+  // Start reading the samples with a timestamp in the range [from, to], optionally of a single task.
+  // Uses the time index of the cache files to skip data outside the range.
+  // Also includes the samples not yet flushed to a file.
+  bool   startQuery(uint32_t    from,
+                    uint32_t    to,
+                    taskIndex_t taskIndex = INVALID_TASK_INDEX);
+
+  // Read the next sample of the query started by startQuery()
+  // Return false when all samples in the range are read.
+  bool   nextQuery(ControllerCacheSample& sample);
+
   int readFileNr = 0;
   int readPos    = 0;
 
 private:
 
   RTC_cache_handler_struct *_RTC_cache_handler = nullptr;
+
+  // Block currently being read by peek()
+  std::vector<uint8_t>        _peekBlock;
+  ControllerCacheBlockDecoder _peekDecoder;
+
+  uint32_t    _queryFrom      = 0;
+  uint32_t    _queryTo        = 0;
+  taskIndex_t _queryTaskIndex = INVALID_TASK_INDEX;
+  bool        _queryFiles     = false; // Samples are read from the cache files
+  bool        _queryBuffer    = false; // Samples in the RTC buffer are not yet read
 };
 
 
@@ -11,11 +11,42 @@ ControllerCache_struct::~ControllerCache_struct() {
 }
 
 // Write a single sample set to the buffer
-bool ControllerCache_struct::write(uint8_t *data, unsigned int size) {
+bool ControllerCache_struct::write(const ControllerCacheSample& sample) {
   if (_RTC_cache_handler == nullptr) {
     return false;
   }
-  return _RTC_cache_handler->write(data, size);
+  ControllerCacheBlockHeader header;
+
+  if (!header.read(_RTC_cache_handler->getData(), _RTC_cache_handler->getWritePos())) {
+    if (_RTC_cache_handler->getWritePos() > 0) {
+      // Buffer contains data in another format, which must be written as-is.
+      _RTC_cache_handler->flush();
+    }
+    header.init(sample.timestamp);
+  }
+  // Header followed by the record, so a new block can be stored at once.
+  uint8_t  data[CONTROLLER_CACHE_BLOCK_HEADER_SIZE + CONTROLLER_CACHE_MAX_RECORD_SIZE];
+  uint8_t *record     = &data[CONTROLLER_CACHE_BLOCK_HEADER_SIZE];
+  size_t   recordSize = header.encode(sample, record);
+
+  if ((header.nrRecords == 0xFF) || (_RTC_cache_handler->getFreeSpace() < recordSize)) {
+    // Block is full, start a new block.
+    if (!_RTC_cache_handler->flush()) {
+      return false;
+    }
+    header.init(sample.timestamp);
+    recordSize = header.encode(sample, record);
+  }
+  header.addRecord(sample, recordSize);
+  header.write(data);
+
+  if (_RTC_cache_handler->getWritePos() == 0) {
+    // New block, store the header and the first record in a single save.
+    return _RTC_cache_handler->write(nullptr, 0, data, CONTROLLER_CACHE_BLOCK_HEADER_SIZE + recordSize);
+  }
+
+  // Append the record and update the header at the start of the block.
+  return _RTC_cache_handler->write(data, CONTROLLER_CACHE_BLOCK_HEADER_SIZE, record, recordSize);
 }
 
 // Read a single sample set, either from file or buffer.
@@ -53,17 +84,51 @@ bool ControllerCache_struct::deleteOldestCacheBlock() {
 }
 
 void ControllerCache_struct::resetpeek() {
+  _peekDecoder = ControllerCacheBlockDecoder();
+  _peekBlock.clear();
+  _peekBlock.shrink_to_fit();
+
   if (_RTC_cache_handler != nullptr) {
     _RTC_cache_handler->resetpeek();
   }
 }
 
-// Read data without marking it as being read.
-bool ControllerCache_struct::peek(uint8_t *data, unsigned int size) {
+// Read the next sample without marking it as being read.
+bool ControllerCache_struct::peek(ControllerCacheSample& sample) {
   if (_RTC_cache_handler == nullptr) {
     return false;
   }
-  return _RTC_cache_handler->peek(data, size);
+
+  while (true) {
+    if (_peekDecoder.next(sample)) {
+      return true;
+    }
+    uint8_t data[CONTROLLER_CACHE_LEGACY_RECORD_SIZE];
+
+    if (!_RTC_cache_handler->peek(data, CONTROLLER_CACHE_BLOCK_HEADER_SIZE)) {
+      return false;
+    }
+    ControllerCacheBlockHeader header;
+
+    if (header.read(data, CONTROLLER_CACHE_BLOCK_HEADER_SIZE)) {
+      // Read the block, it is always stored in a single file.
+      _peekBlock.resize(header.payloadSize);
+
+      if ((header.payloadSize > 0) &&
+          _RTC_cache_handler->peek(&_peekBlock[0], header.payloadSize, false)) {
+        _peekDecoder.init(header, &_peekBlock[0]);
+      }
+    } else {
+      // File written before the compact format was introduced, with fixed size samples.
+      if (_RTC_cache_handler->peek(data + CONTROLLER_CACHE_BLOCK_HEADER_SIZE,
+                                   CONTROLLER_CACHE_LEGACY_RECORD_SIZE - CONTROLLER_CACHE_BLOCK_HEADER_SIZE,
+                                   false) &&
+          decodeLegacyControllerCacheSample(data, sample)) {
+        return true;
+      }
+    }
+  }
+  return false;
 }
 
 String ControllerCache_struct::getPeekCacheFileName(bool& islast) {
@@ -72,3 +137,57 @@ String ControllerCache_struct::getPeekCacheFileName(bool& islast) {
   }
   return _RTC_cache_handler->getPeekCacheFileName(islast);
 }
+
+bool ControllerCache_struct::startQuery(uint32_t from, uint32_t to, taskIndex_t taskIndex) {
+  if (_RTC_cache_handler == nullptr) {
+    return false;
+  }
+  resetpeek();
+  _queryFrom      = from;
+  _queryTo        = to;
+  _queryTaskIndex = taskIndex;
+  _queryFiles     = _RTC_cache_handler->seekPeek(from, to);
+  _queryBuffer    = true;
+  return true;
+}
+
+bool ControllerCache_struct::nextQuery(ControllerCacheSample& sample) {
+  if (_RTC_cache_handler == nullptr) {
+    return false;
+  }
+
+  while (true) {
+    if (_queryFiles) {
+      _queryFiles = peek(sample);
+    }
+
+    if (!_queryFiles && !_peekDecoder.next(sample)) {
+      if (!_queryBuffer) {
+        return false;
+      }
+
+      // All files read, continue with the block in the RTC buffer
+      _queryBuffer = false;
+      ControllerCacheBlockHeader header;
+
+      if (header.read(_RTC_cache_handler->getData(), _RTC_cache_handler->getWritePos())) {
+        _peekDecoder.init(header, _RTC_cache_handler->getData() + CONTROLLER_CACHE_BLOCK_HEADER_SIZE);
+      }
+      continue;
+    }
+
+    if (sample.timestamp > _queryTo) {
+      // Samples are stored in chronological order
+      _queryFiles  = false;
+      _queryBuffer = false;
+      _peekDecoder = ControllerCacheBlockDecoder();
+      return false;
+    }
+
+    if ((sample.timestamp >= _queryFrom) &&
+        ((_queryTaskIndex == INVALID_TASK_INDEX) || (sample.TaskIndex == _queryTaskIndex))) {
+      return true;
+    }
+  }
+  return false;
+}
@@ -1,38 +1,216 @@
 #include "EventQueue.h"
 
+#include "../ESPEasyCore/ESPEasy_Log.h"
+
+#define EVENT_QUEUE_HEADER_SIZE   2
+#define EVENT_QUEUE_WRAP_MARKER   0x7FFF // Next entry is at the start of the buffer
+#define EVENT_QUEUE_REMOVED_FLAG  0x8000 // Entry was replaced by a newer one
+#define EVENT_QUEUE_LENGTH_MASK   0x7FFF
+
 EventQueueStruct::EventQueueStruct() {}
 
 void EventQueueStruct::add(const String& event)
 {
-  _eventQueue.push_back(event);
+  append(event.c_str(), event.length(), false);
 }
 
-void EventQueueStruct::add(const __FlashStringHelper * event)
+void EventQueueStruct::add(const __FlashStringHelper *event)
 {
-  _eventQueue.push_back(event);
+  PGM_P p = reinterpret_cast<PGM_P>(event);
+
+  append(p, strlen_P(p), true);
 }
 
 void EventQueueStruct::addMove(String&& event)
 {
-  _eventQueue.emplace_back(std::move(event));
+  append(event.c_str(), event.length(), false);
+  event = String();
+}
+
+void EventQueueStruct::addTaskValueEvent(const String& event, bool coalesce)
+{
+  if (append(event.c_str(), event.length(), false) && coalesce) {
+    const int valueStart = event.indexOf('=');
+
+    if (valueStart > 0) {
+      // Compare including the '=', so "Task#Val" does not match "Task#Value"
+      removeMatching(event.c_str(), valueStart + 1);
+    }
+  }
 }
 
 bool EventQueueStruct::getNext(String& event)
 {
-  if (_eventQueue.empty()) {
-    return false;
+  while (_nrEntries > 0) {
+    _head = getEntryPos(_head);
+    const uint16_t header = readHeader(_head);
+    const size_t   length = header & EVENT_QUEUE_LENGTH_MASK;
+    const size_t   start  = _head + EVENT_QUEUE_HEADER_SIZE;
+
+    _head += EVENT_QUEUE_HEADER_SIZE + length + 1;
+    --_nrEntries;
+
+    if ((header & EVENT_QUEUE_REMOVED_FLAG) == 0) {
+      --_nrEvents;
+      event = reinterpret_cast<const char *>(&_buffer[start]);
+
+      if (_nrEntries == 0) {
+        // Start at the beginning, to reduce the need to wrap around
+        clear();
+      }
+      return true;
+    }
   }
-  event = std::move(_eventQueue.front());
-  _eventQueue.pop_front();
-  return true;
+  clear();
+  return false;
 }
 
 void EventQueueStruct::clear()
 {
-  _eventQueue.clear();
+  _head      = 0;
+  _tail      = 0;
+  _nrEntries = 0;
+  _nrEvents  = 0;
 }
 
 bool EventQueueStruct::isEmpty() const
 {
-  return _eventQueue.empty();
-}
\ No newline at end of file
+  return _nrEvents == 0;
+}
+
+size_t EventQueueStruct::getNrEvents() const
+{
+  return _nrEvents;
+}
+
+size_t EventQueueStruct::getBytesUsed() const
+{
+  if (_nrEntries == 0) {
+    return 0;
+  }
+
+  if (_tail > _head) {
+    return _tail - _head;
+  }
+  return EVENT_QUEUE_BUFFER_SIZE - _head + _tail;
+}
+
+size_t EventQueueStruct::getHighWaterMark() const
+{
+  return _highWaterMark;
+}
+
+size_t EventQueueStruct::getCapacity() const
+{
+  return EVENT_QUEUE_BUFFER_SIZE;
+}
+
+uint32_t EventQueueStruct::getDropped() const
+{
+  return _dropped;
+}
+
+uint32_t EventQueueStruct::getCoalesced() const
+{
+  return _coalesced;
+}
+
+bool EventQueueStruct::append(const char *event, size_t length, bool progmem)
+{
+  const size_t needed = EVENT_QUEUE_HEADER_SIZE + length + 1;
+  size_t pos          = _tail;
+
+  if ((length >= EVENT_QUEUE_WRAP_MARKER) || (needed > EVENT_QUEUE_BUFFER_SIZE)) {
+    pos = EVENT_QUEUE_BUFFER_SIZE; // Will never fit
+  } else if ((_nrEntries == 0) || (_tail > _head)) {
+    // Free space is at the end and before _head
+    if ((EVENT_QUEUE_BUFFER_SIZE - _tail) < needed) {
+      if ((_nrEntries == 0) || (_head >= needed)) {
+        if ((EVENT_QUEUE_BUFFER_SIZE - _tail) >= EVENT_QUEUE_HEADER_SIZE) {
+          writeHeader(_tail, EVENT_QUEUE_WRAP_MARKER);
+        }
+        pos = 0;
+
+        if (_nrEntries == 0) {
+          _head = 0;
+        }
+      } else {
+        pos = EVENT_QUEUE_BUFFER_SIZE;
+      }
+    }
+  } else if ((_head - _tail) < needed) {
+    // Free space is between _tail and _head
+    pos = EVENT_QUEUE_BUFFER_SIZE;
+  }
+
+  if (pos >= EVENT_QUEUE_BUFFER_SIZE) {
+    ++_dropped;
+
+    if (progmem) {
+      addLogFmt(LOG_LEVEL_ERROR, F("EVENT: Queue full, dropped: %s"), reinterpret_cast<const __FlashStringHelper *>(event));
+    } else {
+      addLogFmt(LOG_LEVEL_ERROR, F("EVENT: Queue full, dropped: %s"), event);
+    }
+    return false;
+  }
+
+  writeHeader(pos, length);
+
+  if (progmem) {
+    memcpy_P(&_buffer[pos + EVENT_QUEUE_HEADER_SIZE], event, length);
+  } else {
+    memcpy(&_buffer[pos + EVENT_QUEUE_HEADER_SIZE], event, length);
+  }
+  _buffer[pos + EVENT_QUEUE_HEADER_SIZE + length] = 0;
+  _tail                                           = pos + needed;
+  ++_nrEntries;
+  ++_nrEvents;
+
+  const size_t used = getBytesUsed();
+
+  if (used > _highWaterMark) {
+    _highWaterMark = used;
+  }
+  return true;
+}
+
+void EventQueueStruct::removeMatching(const char *key, size_t keyLength)
+{
+  size_t pos = _head;
+
+  // Skip the last entry, as that's the event just added.
+  for (size_t i = 0; (i + 1) < _nrEntries; ++i) {
+    pos = getEntryPos(pos);
+    const uint16_t header = readHeader(pos);
+    const size_t   length = header & EVENT_QUEUE_LENGTH_MASK;
+
+    if (((header & EVENT_QUEUE_REMOVED_FLAG) == 0) &&
+        (length >= keyLength) &&
+        (memcmp(&_buffer[pos + EVENT_QUEUE_HEADER_SIZE], key, keyLength) == 0)) {
+      writeHeader(pos, header | EVENT_QUEUE_REMOVED_FLAG);
+      --_nrEvents;
+      ++_coalesced;
+    }
+    pos += EVENT_QUEUE_HEADER_SIZE + length + 1;
+  }
+}
+
+size_t EventQueueStruct::getEntryPos(size_t pos) const
+{
+  if (((EVENT_QUEUE_BUFFER_SIZE - pos) < EVENT_QUEUE_HEADER_SIZE) ||
+      (readHeader(pos) == EVENT_QUEUE_WRAP_MARKER)) {
+    return 0;
+  }
+  return pos;
+}
+
+uint16_t EventQueueStruct::readHeader(size_t pos) const
+{
+  return _buffer[pos] | (_buffer[pos + 1] << 8);
+}
+
+void EventQueueStruct::writeHeader(size_t pos, uint16_t header)
+{
+  _buffer[pos]     = header & 0xFF;
+  _buffer[pos + 1] = header >> 8;
+}
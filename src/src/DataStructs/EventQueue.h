@@ -2,30 +2,83 @@
 #define DATASTRUCTS_EVENTQUEUE_H
 
 
-#include <list>
 #include "../../ESPEasy_common.h"
 
+#include "../CustomBuild/ESPEasyLimits.h"
 #include "../Globals/Plugins.h"
 
 
+/*********************************************************************************************\
+* EventQueueStruct
+* Ring buffer of events, stored in a fixed size buffer.
+* Adding an event does not allocate memory. When the buffer is full, new events are dropped.
+\*********************************************************************************************/
 struct EventQueueStruct {
   EventQueueStruct();
 
-  void add(const String& event);
+  void   add(const String& event);
 
-  void add(const __FlashStringHelper * event);
+  void   add(const __FlashStringHelper *event);
 
-  void addMove(String&& event);
+  void   addMove(String&& event);
 
-  bool getNext(String& event);
+  // Add a task value event like "Taskname#Valuename=123.4"
+  // When coalescing is enabled, a still queued event for the same task value will be replaced.
+  void   addTaskValueEvent(const String& event,
+                           bool          coalesce);
 
-  void clear();
+  bool   getNext(String& event);
 
-  bool isEmpty() const;
+  void   clear();
+
+  bool   isEmpty() const;
+
+  // Statistics
+  size_t   getNrEvents() const;
+
+  size_t   getBytesUsed() const;
+
+  size_t   getHighWaterMark() const;
+
+  size_t   getCapacity() const;
+
+  uint32_t getDropped() const;
+
+  uint32_t getCoalesced() const;
 
 private:
 
-  std::list<String>_eventQueue;
+  // Store the event in the buffer.
+  // Return false when there is no room for it.
+  bool   append(const char *event,
+                size_t      length,
+                bool        progmem);
+
+  // Remove the queued events starting with the given key, except for the last added one.
+  void   removeMatching(const char *key,
+                        size_t      keyLength);
+
+  // Get the position of the next entry, taking the wrap around into account.
+  size_t getEntryPos(size_t pos) const;
+
+  uint16_t readHeader(size_t pos) const;
+
+  void     writeHeader(size_t   pos,
+                       uint16_t header);
+
+  // Each entry: 2 byte header (length, flags), event, '\0'
+  uint8_t _buffer[EVENT_QUEUE_BUFFER_SIZE];
+
+  size_t _head = 0; // Position of the oldest entry
+  size_t _tail = 0; // Position to write the next entry
+
+  // Number of entries in the buffer, including removed (coalesced) entries
+  size_t _nrEntries = 0;
+  size_t _nrEvents  = 0;
+
+  size_t   _highWaterMark = 0;
+  uint32_t _dropped       = 0;
+  uint32_t _coalesced     = 0;
 };
 
 
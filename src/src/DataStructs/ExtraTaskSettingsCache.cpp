@@ -0,0 +1,110 @@
+#include "../DataStructs/ExtraTaskSettingsCache.h"
+
+#include "../Globals/Plugins.h"
+#include "../Helpers/Memory.h"
+
+
+bool ExtraTaskSettingsCache::get(taskIndex_t TaskIndex, ExtraTaskSettingsStruct& settings)
+{
+  const int slot = findSlot(TaskIndex);
+
+  if (slot < 0) {
+    return false;
+  }
+  memcpy(&settings, &_slots[slot], sizeof(ExtraTaskSettingsStruct));
+  _lastUsed[slot] = ++_useCounter;
+  return true;
+}
+
+void ExtraTaskSettingsCache::add(const ExtraTaskSettingsStruct& settings)
+{
+  if (!validTaskIndex(settings.TaskIndex)) {
+    return;
+  }
+  int slot = findSlot(settings.TaskIndex);
+
+  if (slot < 0) {
+    if (_slots.empty()) {
+      // Only use the heap which is left above the minimum free heap.
+      const int freeMem = FreeMem();
+      int nrSlots       = 0;
+
+      if (freeMem > EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP) {
+        nrSlots = (freeMem - EXTRA_TASK_SETTINGS_CACHE_MIN_FREE_HEAP) /
+                  (sizeof(ExtraTaskSettingsStruct) + sizeof(uint32_t));
+      }
+
+      if (nrSlots > EXTRA_TASK_SETTINGS_CACHE_SIZE) {
+        nrSlots = EXTRA_TASK_SETTINGS_CACHE_SIZE;
+      }
+      _maxSlots = nrSlots;
+
+      if (_maxSlots == 0) {
+        return;
+      }
+      _slots.reserve(_maxSlots);
+      _lastUsed.reserve(_maxSlots);
+    }
+
+    if (_slots.size() < _maxSlots) {
+      _slots.emplace_back();
+      _lastUsed.push_back(0);
+      slot = _slots.size() - 1;
+    } else {
+      // Evict the least recently used slot
+      slot = 0;
+
+      for (size_t i = 1; i < _lastUsed.size(); ++i) {
+        if (_lastUsed[i] < _lastUsed[slot]) {
+          slot = i;
+        }
+      }
+    }
+  }
+  memcpy(&_slots[slot], &settings, sizeof(ExtraTaskSettingsStruct));
+  _lastUsed[slot] = ++_useCounter;
+}
+
+void ExtraTaskSettingsCache::invalidate(taskIndex_t TaskIndex)
+{
+  const int slot = findSlot(TaskIndex);
+
+  if (slot >= 0) {
+    _slots[slot].clear();
+    _lastUsed[slot] = 0;
+  }
+}
+
+void ExtraTaskSettingsCache::clear()
+{
+  // Swap with empty vectors to actually free the memory.
+  std::vector<ExtraTaskSettingsStruct>().swap(_slots);
+  std::vector<uint32_t>().swap(_lastUsed);
+  _useCounter = 0;
+  _maxSlots   = 0;
+}
+
+size_t ExtraTaskSettingsCache::getNrSlots() const
+{
+  return _slots.size();
+}
+
+size_t ExtraTaskSettingsCache::getMemoryUsage() const
+{
+  return _slots.capacity() * sizeof(ExtraTaskSettingsStruct) +
+         _lastUsed.capacity() * sizeof(uint32_t);
+}
+
+int ExtraTaskSettingsCache::findSlot(taskIndex_t TaskIndex) const
+{
+  if (!validTaskIndex(TaskIndex)) {
+    return -1;
+  }
+
+  for (size_t i = 0; i < _slots.size(); ++i) {
+    if (_slots[i].TaskIndex == TaskIndex) {
+      return i;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,54 @@
+#ifndef DATASTRUCTS_EXTRATASKSETTINGSCACHE_H
+#define DATASTRUCTS_EXTRATASKSETTINGSCACHE_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataStructs/ExtraTaskSettingsStruct.h"
+#include "../DataTypes/TaskIndex.h"
+
+#include <vector>
+
+
+/*********************************************************************************************\
+* ExtraTaskSettingsCache
+* Keeps the last used ExtraTaskSettings of a few tasks in memory, as they were after loading
+* and patching them in LoadTaskSettings().
+* Switching between tasks then no longer needs to read the settings file.
+* The number of slots is limited by EXTRA_TASK_SETTINGS_CACHE_SIZE and by the free heap
+* at the moment the first slot is needed.
+\*********************************************************************************************/
+struct ExtraTaskSettingsCache {
+  // Copy the cached settings of the task into 'settings'.
+  // Returns false when the task is not cached.
+  bool   get(taskIndex_t              TaskIndex,
+             ExtraTaskSettingsStruct& settings);
+
+  // Store a copy of the settings, replacing the least recently used slot when full.
+  void   add(const ExtraTaskSettingsStruct& settings);
+
+  // Remove the task from the cache, e.g. when its settings have been saved.
+  void   invalidate(taskIndex_t TaskIndex);
+
+  // Remove all cached settings and free the allocated slots.
+  void   clear();
+
+  size_t getNrSlots() const;
+
+  size_t getMemoryUsage() const;
+
+private:
+
+  int findSlot(taskIndex_t TaskIndex) const;
+
+  std::vector<ExtraTaskSettingsStruct>_slots;
+
+  // Value of _useCounter when the slot was last used, for LRU eviction.
+  std::vector<uint32_t>_lastUsed;
+
+  uint32_t _useCounter = 0;
+
+  // Max. number of slots, determined when the first slot is allocated.
+  uint8_t _maxSlots = 0;
+};
+
+#endif // DATASTRUCTS_EXTRATASKSETTINGSCACHE_H
@@ -0,0 +1,236 @@
+#include "../DataStructs/LogArgs.h"
+
+#include "../Helpers/Convert.h"
+
+#define LOG_ARG_INT           'i'
+#define LOG_ARG_UINT          'u'
+#define LOG_ARG_CHAR          'c'
+#define LOG_ARG_FLOAT         'f'
+#define LOG_ARG_STRING        's' // Followed by the length and the characters
+#define LOG_ARG_FLASH_STRING  'F'
+#define LOG_ARG_STRING_REF    'S' // Followed by the pointer and the length (16 bit)
+
+
+LogArgs::LogArgs(const uint8_t *data, uint8_t size)
+{
+  if (size > LOG_ARGS_SIZE) {
+    size = LOG_ARGS_SIZE;
+  }
+  memcpy(_data, data, size);
+  _size = size;
+}
+
+void LogArgs::add(char value)
+{
+  addValue(LOG_ARG_CHAR, &value, sizeof(value));
+}
+
+void LogArgs::add(float value)
+{
+  addValue(LOG_ARG_FLOAT, &value, sizeof(value));
+}
+
+void LogArgs::add(const char *value)
+{
+  if (value == nullptr) {
+    value = "";
+  }
+
+  // Must use PROGMEM aware functions here, like for log lines.
+  addString(value, strlen_P(value));
+}
+
+void LogArgs::add(const String& value)
+{
+  addString(value.c_str(), value.length());
+}
+
+void LogArgs::add(const __FlashStringHelper *value)
+{
+  addValue(LOG_ARG_FLASH_STRING, &value, sizeof(value));
+}
+
+void LogArgs::addInt(int32_t value)
+{
+  addValue(LOG_ARG_INT, &value, sizeof(value));
+}
+
+void LogArgs::addUInt(uint32_t value)
+{
+  addValue(LOG_ARG_UINT, &value, sizeof(value));
+}
+
+void LogArgs::addString(const char *value, size_t length)
+{
+  if (_referToStrings) {
+    uint8_t reference[sizeof(value) + sizeof(uint16_t)];
+    const uint16_t refLength = length > 0xFFFF ? 0xFFFF : length;
+
+    memcpy(reference,                 &value,     sizeof(value));
+    memcpy(reference + sizeof(value), &refLength, sizeof(refLength));
+    addValue(LOG_ARG_STRING_REF, reference, sizeof(reference));
+    return;
+  }
+
+  if ((_size + 2u) > LOG_ARGS_SIZE) {
+    _truncated = true;
+    return;
+  }
+
+  if (length > (LOG_ARGS_SIZE - _size - 2u)) {
+    length     = LOG_ARGS_SIZE - _size - 2u;
+    _truncated = true;
+  }
+  _data[_size++] = LOG_ARG_STRING;
+  _data[_size++] = length;
+  memcpy_P(&_data[_size], value, length);
+  _size += length;
+}
+
+bool LogArgs::addValue(char type, const void *value, size_t length)
+{
+  if ((_size + 1u + length) > LOG_ARGS_SIZE) {
+    _truncated = true;
+    return false;
+  }
+  _data[_size++] = type;
+  memcpy(&_data[_size], value, length);
+  _size += length;
+  return true;
+}
+
+void LogArgs::format(const __FlashStringHelper *format, String& dest) const
+{
+  PGM_P  p   = reinterpret_cast<PGM_P>(format);
+  size_t pos = 0;
+
+  // Collect the plain text in parts, to not extend the String per character.
+  char   text[32];
+  size_t textLength = 0;
+
+  dest.reserve(dest.length() + strlen_P(p) + _size);
+
+  while (true) {
+    char c = pgm_read_byte(p++);
+
+    if ((c == '%') && (pgm_read_byte(p) != '%')) {
+      text[textLength] = '\0';
+      dest            += text;
+      textLength       = 0;
+
+      uint8_t decimals = 2;
+      uint8_t width    = 0;
+      c = pgm_read_byte(p++);
+
+      if ((c == '0') && isdigit(pgm_read_byte(p))) {
+        width = pgm_read_byte(p++) - '0';
+        c     = pgm_read_byte(p++);
+      } else if ((c == '.') && isdigit(pgm_read_byte(p))) {
+        decimals = pgm_read_byte(p++) - '0';
+        c        = pgm_read_byte(p++);
+      }
+
+      if (c == '\0') {
+        return;
+      }
+      pos = formatArg(pos, width, decimals, dest);
+      continue;
+    }
+
+    if (c == '%') {
+      // "%%"
+      ++p;
+    }
+
+    if ((c == '\0') || (textLength == (sizeof(text) - 1))) {
+      text[textLength] = '\0';
+      dest            += text;
+      textLength       = 0;
+
+      if (c == '\0') {
+        return;
+      }
+    }
+    text[textLength++] = c;
+  }
+}
+
+size_t LogArgs::formatArg(size_t pos, uint8_t width, uint8_t decimals, String& dest) const
+{
+  if (pos >= _size) {
+    // Missing argument
+    return pos;
+  }
+  const char type = _data[pos++];
+
+  switch (type) {
+    case LOG_ARG_INT:
+    case LOG_ARG_UINT:
+    {
+      uint32_t value;
+      memcpy(&value, &_data[pos], sizeof(value));
+      char text[12];
+
+      if ((type == LOG_ARG_INT) && (static_cast<int32_t>(value) < 0)) {
+        dest += '-';
+        value = 0u - value;
+      }
+      ultoa(value, text, 10);
+
+      for (size_t length = strlen(text); length < width; ++length) {
+        dest += '0';
+      }
+      dest += text;
+      return pos + sizeof(value);
+    }
+    case LOG_ARG_CHAR:
+      dest += static_cast<char>(_data[pos]);
+      return pos + 1;
+    case LOG_ARG_FLOAT:
+    {
+      float value;
+      memcpy(&value, &_data[pos], sizeof(value));
+      dest += toString(value, decimals);
+      return pos + sizeof(value);
+    }
+    case LOG_ARG_STRING:
+    {
+      const uint8_t length = _data[pos++];
+      char text[LOG_ARGS_SIZE];
+
+      memcpy(text, &_data[pos], length);
+      text[length] = '\0';
+      dest        += text;
+      return pos + length;
+    }
+    case LOG_ARG_FLASH_STRING:
+    {
+      const __FlashStringHelper *value;
+      memcpy(&value, &_data[pos], sizeof(value));
+      dest += value;
+      return pos + sizeof(value);
+    }
+    case LOG_ARG_STRING_REF:
+    {
+      const char *value;
+      uint16_t    length;
+      memcpy(&value,  &_data[pos],                 sizeof(value));
+      memcpy(&length, &_data[pos + sizeof(value)], sizeof(length));
+
+      // May be a string in flash, so copy it in parts.
+      char text[33];
+
+      for (uint16_t offset = 0; offset < length;) {
+        const uint16_t part = std::min<uint16_t>(length - offset, sizeof(text) - 1);
+        memcpy_P(text, value + offset, part);
+        text[part] = '\0';
+        dest      += text;
+        offset    += part;
+      }
+      return pos + sizeof(value) + sizeof(length);
+    }
+  }
+
+  // Unknown type, the rest can not be interpreted.
+  return _size;
+}
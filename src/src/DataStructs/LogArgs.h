@@ -0,0 +1,95 @@
+#ifndef DATASTRUCTS_LOGARGS_H
+#define DATASTRUCTS_LOGARGS_H
+
+#include "../../ESPEasy_common.h"
+
+#include <type_traits>
+
+/*********************************************************************************************\
+* Arguments of a log line in binary form
+*
+* A log line is described by a format string in flash and these arguments. The text is only
+* formatted by the log destination which actually uses it. For example the web log stores the
+* arguments as-is and only formats the line when it is fetched.
+*
+* Each '%' in the format string, followed by a type character, is replaced by the next argument.
+* The argument is formatted according to its own type, the type character is only for readability.
+* An integer can be padded with zeros like "%03u" and the number of decimals of a float can be
+* set like "%.3f" (default 2). Use "%%" for a '%'.
+* Integer values are stored as 32 bit. Strings are copied as far as they fit, flash strings (F())
+* are stored as a pointer. So the text formatted from stored arguments may be incomplete, see
+* truncated().
+* Arguments referring to the strings instead of copying them are not truncated, but only valid as
+* long as the strings passed to add() exist. These must not be stored.
+\*********************************************************************************************/
+#define LOG_ARGS_SIZE  100
+
+class LogArgs {
+public:
+
+  LogArgs() = default;
+
+  // Arguments referring to the strings passed to add(), instead of storing a copy.
+  explicit LogArgs(bool referToStrings) : _referToStrings(referToStrings) {}
+
+  // Use arguments stored earlier, as returned by data() and size().
+  LogArgs(const uint8_t *data, uint8_t size);
+
+  template<typename T, typename ... Rest>
+  void addAll(const T& value, const Rest& ... rest) {
+    add(value);
+    addAll(rest ...);
+  }
+
+  void addAll() {}
+
+  template<typename T>
+  typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+  add(T value) {
+    addInt(value);
+  }
+
+  template<typename T>
+  typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+  add(T value) {
+    addUInt(value);
+  }
+
+  void           add(char value);
+  void           add(float value);
+  void           add(double value) { add(static_cast<float>(value)); }
+  void           add(const char *value);
+  void           add(const String& value);
+  void           add(const __FlashStringHelper *value);
+
+  // Append the line formatted from 'format' and these arguments to 'dest'.
+  void           format(const __FlashStringHelper *format,
+                        String                   & dest) const;
+
+  // An argument did not (completely) fit, so the formatted text is not complete.
+  bool           truncated() const { return _truncated; }
+
+  const uint8_t* data() const { return _data; }
+
+  uint8_t        size() const { return _size; }
+
+private:
+
+  void addInt(int32_t value);
+  void addUInt(uint32_t value);
+  void addString(const char *value, size_t length);
+
+  // Store the type and value, return false when it does not fit.
+  bool addValue(char type, const void *value, size_t length);
+
+  // Append the argument at 'pos' to 'dest', return the position of the next argument.
+  size_t formatArg(size_t pos, uint8_t width, uint8_t decimals, String& dest) const;
+
+  uint8_t _data[LOG_ARGS_SIZE];
+  uint8_t _size           = 0;
+  bool    _referToStrings = false;
+  bool    _truncated      = false;
+};
+
+
+#endif // DATASTRUCTS_LOGARGS_H
@@ -1,99 +1,212 @@
 #include "../DataStructs/LogStruct.h"
 
 #include "../Helpers/ESPEasy_time_calc.h"
-#include "../Helpers/StringConverter.h"
 
+// Line in the data buffer: timestamp (4 bytes), log level (1), length (1), text (not zero terminated)
+// or format string pointer and arguments. Lines start at a multiple of 4 bytes.
+#define LOG_LINE_HEADER_SIZE  6
 
+// Set in the log level when the line consists of a format string and arguments.
+#define LOG_LINE_FORMAT_FLAG  0x80
 
-void LogStruct::add(const byte loglevel, const char *line) {
-  write_idx = (write_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
+/*********************************************************************************************\
+ * Atomic operations on the positions and sequence numbers.
+ * Used by addRecord(), so they must be in IRAM too when not inlined.
+\*********************************************************************************************/
+#ifdef ESP8266
+
+// No atomic instructions, but single core: it is enough to not be interrupted for a few instructions.
+static uint32_t ICACHE_RAM_ATTR log_fetch_add(volatile uint32_t& value, uint32_t add) {
+  const uint32_t savedPS = xt_rsil(15);
+  const uint32_t result  = value;
+
+  value = result + add;
+  xt_wsr_ps(savedPS);
+  return result;
+}
 
-  if (write_idx == read_idx) {
-    // Buffer full, move read_idx to overwrite oldest entry.
-    read_idx = (read_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
+static bool ICACHE_RAM_ATTR log_compare_exchange(volatile uint32_t& value, uint32_t& expected, uint32_t desired) {
+  const uint32_t savedPS = xt_rsil(15);
+  const uint32_t current = value;
+  const bool     success = current == expected;
+
+  if (success) {
+    value = desired;
   }
-  timeStamp[write_idx] = millis();
-  log_level[write_idx] = loglevel;
+  xt_wsr_ps(savedPS);
+  expected = current;
+  return success;
+}
+
+#else // ifdef ESP8266
 
+static uint32_t ICACHE_RAM_ATTR log_fetch_add(volatile uint32_t& value, uint32_t add) {
+  return __atomic_fetch_add(&value, add, __ATOMIC_ACQ_REL);
+}
+
+static bool ICACHE_RAM_ATTR log_compare_exchange(volatile uint32_t& value, uint32_t& expected, uint32_t desired) {
+  return __atomic_compare_exchange_n(&value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+#endif // ifdef ESP8266
+
+static uint32_t ICACHE_RAM_ATTR log_load(const volatile uint32_t& value) {
+  return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+}
+
+static void ICACHE_RAM_ATTR log_store(volatile uint32_t& value, uint32_t newValue) {
+  __atomic_store_n(&value, newValue, __ATOMIC_RELEASE);
+}
+
+
+void LogStruct::add(const byte loglevel, const char *line) {
   // Must use PROGMEM aware functions here to process line
+  // Copied to RAM first, as addRecord() may not read from flash.
+  char buffer[LOG_STRUCT_MESSAGE_SIZE];
   unsigned int linelength = strlen_P(line);
 
   if (linelength > LOG_STRUCT_MESSAGE_SIZE - 1) {
     linelength = LOG_STRUCT_MESSAGE_SIZE - 1;
   }
-  Message[write_idx] = "";
-  if (!Message[write_idx].reserve(linelength)) {
-    return;
-  }
-
-  const char* c = line;
-  for (unsigned i = 0; i < linelength; ++i) {
-    Message[write_idx] += static_cast<char>(pgm_read_byte(c++));
-  }
+  memcpy_P(buffer, line, linelength);
+  addRecord(millis(), loglevel, buffer, linelength);
 }
 
-// Read the next item and append it to the given string.
-// Returns whether new lines are available.
-bool LogStruct::get(String& output, const String& lineEnd) {
-  lastReadTimeStamp = millis();
+void LogStruct::add(const byte loglevel, const __FlashStringHelper *format, const LogArgs& args) {
+  static_assert((sizeof(format) + LOG_ARGS_SIZE) < LOG_STRUCT_MESSAGE_SIZE, "Log arguments do not fit in a log line");
+  addRecord(millis(), loglevel | LOG_LINE_FORMAT_FLAG, &format, sizeof(format), args.data(), args.size());
+}
 
-  if (!isEmpty()) {
-    read_idx = (read_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
-    output  += formatLine(read_idx, lineEnd);
+void ICACHE_RAM_ATTR LogStruct::addFromISR(const byte loglevel, const char *line, uint8_t length, uint32_t timestamp) {
+  if (length > LOG_STRUCT_MESSAGE_SIZE - 1) {
+    length = LOG_STRUCT_MESSAGE_SIZE - 1;
   }
-  return !isEmpty();
+  addRecord(timestamp, loglevel & ~LOG_LINE_FORMAT_FLAG, line, length);
 }
 
-bool LogStruct::getNext(bool& logLinesAvailable, unsigned long& timestamp, String& message, byte& loglevel) {
+bool LogStruct::getNext(uint32_t& sequence, unsigned long& timestamp, String& message, byte& loglevel) {
   lastReadTimeStamp = millis();
-  logLinesAvailable = false;
+  const uint32_t next = log_load(nextSequence);
+  uint32_t current    = sequence + 1;
 
-  if (isEmpty()) {
-    return false;
+  if (sequence >= next) {
+    // Cursor of before a reboot, start again.
+    current = 1;
   }
-  read_idx  = (read_idx + 1) % LOG_STRUCT_MESSAGE_LINES;
-  timestamp = timeStamp[read_idx];
-  message = Message[read_idx];
-  loglevel = log_level[read_idx];
-  if (!isEmpty()) { 
-    logLinesAvailable = true;
+
+  if ((next - current) > LOG_STRUCT_MESSAGE_LINES) {
+    // Skip lines which are overwritten for sure.
+    current = next - LOG_STRUCT_MESSAGE_LINES;
   }
-  return true;
+
+  for (; current != next; ++current) {
+    switch (read(current, timestamp, message, loglevel)) {
+      case ReadResult::Ok:
+        sequence = current;
+        return true;
+      case ReadResult::Pending:
+        // Keep the order of the lines, try again later.
+        return false;
+      case ReadResult::Overwritten:
+        break;
+    }
+  }
+  return false;
+}
+
+void ICACHE_RAM_ATTR LogStruct::addRecord(uint32_t timestamp, byte loglevel, const void *payload, uint8_t length, const void *payload2, uint8_t length2) {
+  const uint32_t size     = (LOG_LINE_HEADER_SIZE + length + length2 + 3) & ~3u;
+  const uint32_t sequence = log_fetch_add(nextSequence, 1);
+  Record       & record   = records[sequence & (LOG_STRUCT_MESSAGE_LINES - 1)];
+
+  // Mark the record as being written, before its position is changed.
+  log_store(record.sequence, 0);
+
+  // Reserve space. A line is never split over the end of the buffer, to keep reading simple.
+  uint32_t position = log_load(writePosition);
+  uint32_t start;
+
+  do {
+    start = position;
+    const uint32_t offset = position & (LOG_BUFFER_SIZE - 1);
+
+    if ((offset + size) > LOG_BUFFER_SIZE) {
+      start += LOG_BUFFER_SIZE - offset;
+    }
+  } while (!log_compare_exchange(writePosition, position, start + size));
+
+  byte *dest = &data[start & (LOG_BUFFER_SIZE - 1)];
+
+  memcpy(dest, &timestamp, sizeof(timestamp));
+  dest[4] = loglevel;
+  dest[5] = length + length2;
+  memcpy(dest + LOG_LINE_HEADER_SIZE, payload, length);
+  memcpy(dest + LOG_LINE_HEADER_SIZE + length, payload2, length2);
+
+  record.position = start;
+  log_store(record.sequence, sequence);
 }
 
-bool LogStruct::isEmpty() {
-  return write_idx == read_idx;
+uint32_t LogStruct::getLastSequence() const {
+  return log_load(nextSequence) - 1;
 }
 
 bool LogStruct::logActiveRead() {
-  clearExpiredEntries();
   return timePassedSince(lastReadTimeStamp) < LOG_BUFFER_EXPIRE;
 }
 
-String LogStruct::formatLine(int index, const String& lineEnd) {
-  String output;
+LogStruct::ReadResult LogStruct::read(uint32_t sequence, unsigned long& timestamp, String& message, byte& loglevel) const {
+  const Record& record = records[sequence & (LOG_STRUCT_MESSAGE_LINES - 1)];
 
-  output += timeStamp[index];
-  output += " : ";
-  output += Message[index];
-  output += lineEnd;
-  return output;
-}
+  if (log_load(record.sequence) != sequence) {
+    // Either the line is still being written, or the record is already used for a newer line.
+    if ((log_load(nextSequence) - sequence) > LOG_STRUCT_MESSAGE_LINES) {
+      return ReadResult::Overwritten;
+    }
+    return ReadResult::Pending;
+  }
+  const uint32_t position = record.position;
+  const uint32_t offset   = position & (LOG_BUFFER_SIZE - 1);
+  const byte    *src      = &data[offset];
+  uint32_t       stamp;
+  byte           line[LOG_STRUCT_MESSAGE_SIZE];
+  byte           linelength = src[5];
+  const byte     level      = src[4];
+
+  memcpy(&stamp, src, sizeof(stamp));
+
+  // Stay within the buffer, in case the line is overwritten while reading.
+  if (linelength > LOG_STRUCT_MESSAGE_SIZE - 1) {
+    linelength = LOG_STRUCT_MESSAGE_SIZE - 1;
+  }
+
+  if ((offset + LOG_LINE_HEADER_SIZE + linelength) > LOG_BUFFER_SIZE) {
+    linelength = LOG_BUFFER_SIZE - offset - LOG_LINE_HEADER_SIZE;
+  }
+  memcpy(line, src + LOG_LINE_HEADER_SIZE, linelength);
+  line[linelength] = '\0';
+
+  // Only use the copy when no writer has reused the record or the space of the line meanwhile.
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
 
-void LogStruct::clearExpiredEntries() {
-  if (isEmpty()) {
-    return;
+  if ((log_load(record.sequence) != sequence) ||
+      ((log_load(writePosition) - position) > LOG_BUFFER_SIZE)) {
+    return ReadResult::Overwritten;
   }
+  timestamp = stamp;
+  loglevel  = level & ~LOG_LINE_FORMAT_FLAG;
+
+  if (level & LOG_LINE_FORMAT_FLAG) {
+    const __FlashStringHelper *format;
 
-  if (timePassedSince(lastReadTimeStamp) > LOG_BUFFER_EXPIRE) {
-    // Clear the entire log.
-    // If web log is the only log active, it will not be checked again until it is read.
-    for (read_idx = 0; read_idx < LOG_STRUCT_MESSAGE_LINES; ++read_idx) {
-      Message[read_idx]   = String(); // Free also the reserved memory.
-      timeStamp[read_idx] = 0;
-      log_level[read_idx] = 0;
+    if (linelength < sizeof(format)) {
+      return ReadResult::Overwritten;
     }
-    read_idx  = 0;
-    write_idx = 0;
+    memcpy(&format, line, sizeof(format));
+    message = "";
+    LogArgs(line + sizeof(format), linelength - sizeof(format)).format(format, message);
+  } else {
+    message = reinterpret_cast<const char *>(line);
   }
+  return ReadResult::Ok;
 }
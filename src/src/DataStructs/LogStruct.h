@@ -5,50 +5,89 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../DataStructs/LogArgs.h"
+
 /*********************************************************************************************\
  * LogStruct
+ *
+ * Log lines are stored as variable length records in a single preallocated byte ring.
+ * Each line gets a sequence number (starting at 1, incremented per line), so a reader can keep
+ * a cursor and fetch only the lines it has not yet seen.
+ * When the buffer is full, the oldest lines are overwritten.
+ *
+ * add() does not allocate memory and never waits for another writer or reader, so concurrent
+ * writers (e.g. tasks on both cores of an ESP32) do not need a lock. Sequence number and buffer
+ * space are reserved with atomic operations. A reader copies a line and then checks it was not
+ * overwritten meanwhile.
+ * add() may be given text in flash and reads the time itself, so it must not be called from an ISR.
+ * addFromISR() is placed in IRAM and only reads RAM; the caller supplies the timestamp.
+ *
+ * A line can also be stored as a format string and its arguments (see LogArgs), the text of
+ * such a line is only formatted when it is read.
 \*********************************************************************************************/
 #define LOG_STRUCT_MESSAGE_SIZE 128
 #ifdef ESP32
-  #define LOG_STRUCT_MESSAGE_LINES 30
-  #define LOG_BUFFER_EXPIRE         30000  // Time after which a buffered log item is considered expired.
+  #define LOG_BUFFER_SIZE          4096   // Bytes of log text, must be a power of 2
+  #define LOG_STRUCT_MESSAGE_LINES 64     // Max. number of lines kept, must be a power of 2
+  #define LOG_BUFFER_EXPIRE         30000  // Time after which the web log is considered inactive when not read.
 #else
   #if defined(PLUGIN_BUILD_TESTING) || defined(PLUGIN_BUILD_DEV)
-    #define LOG_STRUCT_MESSAGE_LINES 10
+    #define LOG_BUFFER_SIZE          1024
+    #define LOG_STRUCT_MESSAGE_LINES 16
   #else
-    #define LOG_STRUCT_MESSAGE_LINES 15
+    #define LOG_BUFFER_SIZE          2048
+    #define LOG_STRUCT_MESSAGE_LINES 32
   #endif
-  #define LOG_BUFFER_EXPIRE         5000  // Time after which a buffered log item is considered expired.
+  #define LOG_BUFFER_EXPIRE         5000  // Time after which the web log is considered inactive when not read.
 #endif
 
 struct LogStruct {
-    
+
     void add(const byte loglevel, const char *line);
 
-    // Read the next item and append it to the given string.
-    // Returns whether new lines are available.
-    bool get(String& output, const String& lineEnd);
+    void add(const byte loglevel, const __FlashStringHelper *format, const LogArgs& args);
+
+    // Add a line from an ISR. 'line' must be in RAM, 'length' is its length without the
+    // terminating zero and 'timestamp' the millis() value to show, e.g. kept by the ISR itself.
+    void addFromISR(const byte loglevel, const char *line, uint8_t length, uint32_t timestamp);
 
-    bool getNext(bool& logLinesAvailable, unsigned long& timestamp, String& message, byte& loglevel);
+    // Read the first line with a sequence number after 'sequence' (0 = oldest line available).
+    // On success 'sequence' is set to the sequence number of the line read.
+    // When 'sequence' is newer than the last line (e.g. after a reboot), reading starts at the oldest line.
+    // Returns false when no newer line is available.
+    bool getNext(uint32_t& sequence, unsigned long& timestamp, String& message, byte& loglevel);
 
-    bool isEmpty();
+    // Sequence number of the last line added, 0 when nothing was logged.
+    uint32_t getLastSequence() const;
 
     bool logActiveRead();
 
   private:
-    String formatLine(int index, const String& lineEnd);
+    enum class ReadResult : uint8_t {
+      Ok,
+      Pending,    // Not yet completely written
+      Overwritten // No longer in the buffer
+    };
+
+    struct Record {
+      volatile uint32_t sequence;  // 0 = being written
+      volatile uint32_t position;  // Start of the line in the stream of all bytes written to data
+    };
+
+    // Store a line, consisting of the text or of the format string and the arguments.
+    // Placed in IRAM, the payload must be in RAM.
+    void addRecord(uint32_t timestamp, byte loglevel, const void *payload, uint8_t length, const void *payload2 = nullptr, uint8_t length2 = 0);
 
-    void clearExpiredEntries();
+    ReadResult read(uint32_t sequence, unsigned long& timestamp, String& message, byte& loglevel) const;
 
-    String Message[LOG_STRUCT_MESSAGE_LINES];
-    unsigned long timeStamp[LOG_STRUCT_MESSAGE_LINES] = {0};
-    int write_idx = 0;
-    int read_idx = 0;
+    byte data[LOG_BUFFER_SIZE] = {0};
+    Record records[LOG_STRUCT_MESSAGE_LINES] = {};
+    volatile uint32_t writePosition = 0;
+    volatile uint32_t nextSequence = 1;
     unsigned long lastReadTimeStamp = 0;
-    byte log_level[LOG_STRUCT_MESSAGE_LINES] = {0};
 
 };
 
 
 
-#endif // DATASTRUCTS_LOGSTRUCT_H
\ No newline at end of file
+#endif // DATASTRUCTS_LOGSTRUCT_H
@@ -0,0 +1,171 @@
+#include "../DataStructs/MQTT_TopicTrie.h"
+
+
+namespace {
+// Return the end of the topic, without a single trailing '/'
+const char* topicEnd(const char *topic) {
+  const char *end = topic + strlen(topic);
+
+  if ((end != topic) && (*(end - 1) == '/')) {
+    --end;
+  }
+  return end;
+}
+
+// Return the end of the level starting at 'level'
+const char* levelEnd(const char *level, const char *end) {
+  const char *slash = static_cast<const char *>(memchr(level, '/', end - level));
+
+  return slash == nullptr ? end : slash;
+}
+
+bool isWildcard(const String& level, char wildcard) {
+  return level.length() == 1 && level[0] == wildcard;
+}
+
+bool levelEquals(const String& level, const char *begin, const char *end) {
+  const size_t length = end - begin;
+
+  return level.length() == length && strncmp(level.c_str(), begin, length) == 0;
+}
+} // namespace
+
+
+void MQTT_TopicTrie::clear()
+{
+  _root = Node();
+}
+
+bool MQTT_TopicTrie::empty() const
+{
+  return _root.isEmpty();
+}
+
+void MQTT_TopicTrie::add(const String& subscription, taskIndex_t taskIndex, byte valueIndex)
+{
+  String tmpSub(subscription);
+
+  tmpSub.trim();
+  const char *topic = tmpSub.c_str();
+
+  if (*topic == '/') { ++topic; }
+  const char *end = topicEnd(topic);
+
+  if (topic == end) { return; }
+
+  Node *node = &_root;
+
+  while (topic != nullptr) {
+    const char *level_end = levelEnd(topic, end);
+    Node *child           = nullptr;
+
+    for (auto it = node->children.begin(); it != node->children.end() && child == nullptr; ++it) {
+      if (levelEquals(it->level, topic, level_end)) {
+        child = &(*it);
+      }
+    }
+
+    if (child == nullptr) {
+      node->children.emplace_back();
+      child = &node->children.back();
+
+      if (!child->level.reserve(level_end - topic)) { return; }
+
+      for (const char *c = topic; c != level_end; ++c) {
+        child->level += *c;
+      }
+    }
+    node  = child;
+    topic = (level_end == end) ? nullptr : level_end + 1;
+  }
+
+  for (auto it = node->subscribers.begin(); it != node->subscribers.end(); ++it) {
+    if ((it->taskIndex == taskIndex) && (it->valueIndex == valueIndex)) {
+      return;
+    }
+  }
+  node->subscribers.push_back({ taskIndex, valueIndex });
+}
+
+void MQTT_TopicTrie::remove(taskIndex_t taskIndex)
+{
+  remove(_root, taskIndex);
+}
+
+void MQTT_TopicTrie::remove(Node& node, taskIndex_t taskIndex)
+{
+  for (auto it = node.subscribers.begin(); it != node.subscribers.end();) {
+    if (it->taskIndex == taskIndex) {
+      it = node.subscribers.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  for (auto it = node.children.begin(); it != node.children.end();) {
+    remove(*it, taskIndex);
+
+    // Remove branches which no longer lead to a subscriber
+    if (it->isEmpty()) {
+      it = node.children.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void MQTT_TopicTrie::match(const char *topic, std::vector<Subscriber>& subscribers) const
+{
+  if ((topic == nullptr) || empty()) { return; }
+
+  if (*topic == '/') { ++topic; }
+  match(_root, topic, topicEnd(topic), &subscribers);
+}
+
+bool MQTT_TopicTrie::matches(const char *topic) const
+{
+  if ((topic == nullptr) || empty()) { return false; }
+
+  if (*topic == '/') { ++topic; }
+  return match(_root, topic, topicEnd(topic), nullptr);
+}
+
+bool MQTT_TopicTrie::match(const Node& node, const char *topic, const char *end, std::vector<Subscriber> *subscribers)
+{
+  bool found = false;
+
+  if (topic == nullptr) {
+    // All levels of the topic matched, '#' also matches the parent level.
+    found = addSubscribers(node, subscribers);
+
+    for (auto it = node.children.begin(); it != node.children.end(); ++it) {
+      if (isWildcard(it->level, '#')) {
+        found |= addSubscribers(*it, subscribers);
+      }
+    }
+    return found;
+  }
+  const char *level_end = levelEnd(topic, end);
+  const char *next      = (level_end == end) ? nullptr : level_end + 1;
+
+  for (auto it = node.children.begin(); it != node.children.end(); ++it) {
+    if (found && (subscribers == nullptr)) {
+      return true;
+    }
+
+    if (isWildcard(it->level, '#')) {
+      found |= addSubscribers(*it, subscribers);
+    } else if (isWildcard(it->level, '+') || levelEquals(it->level, topic, level_end)) {
+      found |= match(*it, next, end, subscribers);
+    }
+  }
+  return found;
+}
+
+bool MQTT_TopicTrie::addSubscribers(const Node& node, std::vector<Subscriber> *subscribers)
+{
+  if (subscribers != nullptr) {
+    subscribers->insert(subscribers->end(), node.subscribers.begin(), node.subscribers.end());
+  }
+  return !node.subscribers.empty();
+}
@@ -0,0 +1,74 @@
+#ifndef DATASTRUCTS_MQTT_TOPICTRIE_H
+#define DATASTRUCTS_MQTT_TOPICTRIE_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+
+#include <vector>
+
+
+/*********************************************************************************************\
+* MQTT_TopicTrie
+* Subscriptions of task values, stored per topic level.
+* Supports the MQTT wildcards '+' (single level) and '#' (all remaining levels).
+* A topic is matched against all subscriptions at once, by walking the levels of the topic only once.
+*
+* Like P037 did before, leading and trailing '/' are ignored in both topics and subscriptions.
+\*********************************************************************************************/
+class MQTT_TopicTrie {
+public:
+
+  struct Subscriber {
+    taskIndex_t taskIndex;
+    byte        valueIndex;
+  };
+
+  void clear();
+
+  bool empty() const;
+
+  void add(const String& subscription,
+           taskIndex_t   taskIndex,
+           byte          valueIndex);
+
+  // Remove all subscriptions of a task
+  void remove(taskIndex_t taskIndex);
+
+  // Append all subscribers with a subscription matching the topic
+  void match(const char              *topic,
+             std::vector<Subscriber>& subscribers) const;
+
+  // Check whether any subscription matches the topic
+  bool matches(const char *topic) const;
+
+private:
+
+  struct Node {
+    String                  level;
+    std::vector<Subscriber> subscribers;
+    std::vector<Node>       children;
+
+    bool isEmpty() const {
+      return subscribers.empty() && children.empty();
+    }
+  };
+
+  static void remove(Node      & node,
+                     taskIndex_t taskIndex);
+
+  // Walk the trie for the levels of the topic in [topic, end).
+  // topic is nullptr when all levels are matched.
+  // When subscribers is nullptr, stop at the first match.
+  static bool match(const Node              & node,
+                    const char               *topic,
+                    const char               *end,
+                    std::vector<Subscriber> *subscribers);
+
+  static bool addSubscribers(const Node              & node,
+                             std::vector<Subscriber> *subscribers);
+
+  Node _root;
+};
+
+#endif // DATASTRUCTS_MQTT_TOPICTRIE_H
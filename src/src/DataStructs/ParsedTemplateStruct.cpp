@@ -0,0 +1,150 @@
+#include "../DataStructs/ParsedTemplateStruct.h"
+
+#include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Memory.h"
+
+
+size_t ParsedTemplateStruct::getMemoryUsage() const
+{
+  size_t res = sizeof(ParsedTemplateStruct) + source.length();
+
+  res += segments.capacity() * sizeof(ParsedTemplateSegment);
+
+  for (auto it = segments.begin(); it != segments.end(); ++it) {
+    res += it->text.length();
+  }
+  return res;
+}
+
+ParsedTemplateStruct * ParsedTemplateCache::get(uint32_t owner, const String& tmpString, bool useURLencode)
+{
+  if (_inUse != 0) {
+    return nullptr;
+  }
+
+  if (_invalidated) {
+    clear();
+  }
+  const int index = find(owner);
+
+  if (index < 0) {
+    return nullptr;
+  }
+  Entry& entry = _entries[index];
+
+  if ((entry.parsed.useURLencode != useURLencode) || !entry.parsed.source.equals(tmpString)) {
+    return nullptr;
+  }
+  entry.lastUsed = millis();
+  return &entry.parsed;
+}
+
+ParsedTemplateStruct * ParsedTemplateCache::create(uint32_t owner)
+{
+  if (_inUse != 0) {
+    return nullptr;
+  }
+
+  if (_invalidated) {
+    clear();
+  }
+  int index = find(owner);
+
+  if (index < 0) {
+    if (_entries.size() < PARSED_TEMPLATE_CACHE_SIZE) {
+      if (FreeMem() < PARSED_TEMPLATE_CACHE_MIN_FREE_HEAP) {
+        return nullptr;
+      }
+      _entries.emplace_back();
+      index = _entries.size() - 1;
+    } else {
+      // Replace the least recently used template, unless it is still in use.
+      index = 0;
+
+      for (size_t i = 1; i < _entries.size(); ++i) {
+        if (timeDiff(_entries[i].lastUsed, _entries[index].lastUsed) > 0) {
+          index = i;
+        }
+      }
+
+      if (timePassedSince(_entries[index].lastUsed) < PARSED_TEMPLATE_CACHE_IDLE_TIMEOUT) {
+        return nullptr;
+      }
+    }
+  }
+  Entry& entry = _entries[index];
+
+  entry.owner    = owner;
+  entry.lastUsed = millis();
+  entry.parsed   = ParsedTemplateStruct();
+  return &entry.parsed;
+}
+
+void ParsedTemplateCache::erase(uint32_t owner)
+{
+  if (_inUse != 0) {
+    return;
+  }
+  const int index = find(owner);
+
+  if (index >= 0) {
+    _entries.erase(_entries.begin() + index);
+  }
+}
+
+void ParsedTemplateCache::beginUse()
+{
+  ++_inUse;
+}
+
+void ParsedTemplateCache::endUse()
+{
+  if (_inUse > 0) {
+    --_inUse;
+  }
+}
+
+void ParsedTemplateCache::clear()
+{
+  if (_inUse != 0) {
+    _invalidated = true;
+    return;
+  }
+  _entries.clear();
+  _invalidated = false;
+}
+
+size_t ParsedTemplateCache::size() const
+{
+  return _entries.size();
+}
+
+size_t ParsedTemplateCache::getMemoryUsage() const
+{
+  size_t res = 0;
+
+  for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+    res += sizeof(Entry) - sizeof(ParsedTemplateStruct) + it->parsed.getMemoryUsage();
+  }
+  return res;
+}
+
+uint32_t ParsedTemplateCache::controllerOwner(controllerIndex_t controllerIndex, taskIndex_t taskIndex, uint8_t templateNr)
+{
+  return (1ul << 24) | (static_cast<uint32_t>(templateNr) << 16) | (static_cast<uint32_t>(controllerIndex) << 8) | taskIndex;
+}
+
+uint32_t ParsedTemplateCache::taskOwner(taskIndex_t taskIndex, uint8_t lineNr)
+{
+  return (2ul << 24) | (static_cast<uint32_t>(taskIndex) << 8) | lineNr;
+}
+
+int ParsedTemplateCache::find(uint32_t owner) const
+{
+  for (size_t i = 0; i < _entries.size(); ++i) {
+    if (_entries[i].owner == owner) {
+      return i;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,123 @@
+#ifndef DATASTRUCTS_PARSEDTEMPLATESTRUCT_H
+#define DATASTRUCTS_PARSEDTEMPLATESTRUCT_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/ControllerIndex.h"
+#include "../DataTypes/TaskIndex.h"
+
+#include <vector>
+
+
+/*********************************************************************************************\
+* ParsedTemplateSegment
+* Part of a template, as split by parseTemplate_compile()
+\*********************************************************************************************/
+struct ParsedTemplateSegment {
+  enum class Type : uint8_t {
+    Literal,        // text: literal text
+    SystemVariable, // index: SystemVariables::Enum
+    SystemVariable_dynamic, // text: system variable with arguments, e.g. "%sunrise-1h%"
+    CustomVariable, // index: variable nr, e.g. "%v1%"
+    TaskValue,      // taskIndex, valueNr; text: format
+    Variable,       // index: variable nr, e.g. "[var#1]"; text: format
+    IntVariable,    // index: variable nr, e.g. "[int#1]"; text: format
+    Marker          // text: "[...#...]" which must be looked up for every use, e.g. "[plugin#gpio#pinstate#1]"
+  };
+
+  String      text;
+  uint16_t    index     = 0;
+  taskIndex_t taskIndex = INVALID_TASK_INDEX;
+  uint8_t     valueNr   = 0;
+  Type        type      = Type::Literal;
+};
+
+
+/*********************************************************************************************\
+* ParsedTemplateStruct
+* A template split into segments, so it can be rendered without searching for markers.
+\*********************************************************************************************/
+struct ParsedTemplateStruct {
+  size_t getMemoryUsage() const;
+
+  // The template as it was parsed, to detect changes.
+  String                            source;
+  std::vector<ParsedTemplateSegment>segments;
+
+  // Length of the last result, used to allocate the result at once.
+  uint16_t lastLength   = 0;
+  bool     useURLencode = false;
+
+  // Set when the literal text contains '%' or '{', which may start "%c_...%" conversions or
+  // "{...}" string commands, so the result must be processed like parseTemplate() does.
+  bool     literalHasMarkup = false;
+
+  // Set when the template could be split into segments.
+  bool     compiled     = false;
+};
+
+
+/*********************************************************************************************\
+* ParsedTemplateCache
+* Parsed templates which are used repeatedly by the same owner, e.g. display lines of a task
+* or controller publish templates.
+* The cache is cleared when settings or task names may have changed.
+* When more owners are in use than fit in the cache, the templates of the extra owners are
+* not cached, as replacing templates which are still in use would mean parsing on every use.
+\*********************************************************************************************/
+struct ParsedTemplateCache {
+  // Get the parsed template of the owner.
+  // Returns nullptr when not present, or when it was parsed from another template.
+  ParsedTemplateStruct* get(uint32_t      owner,
+                            const String& tmpString,
+                            bool          useURLencode);
+
+  // Get an empty template for the owner to parse a template in.
+  // When the cache is full, the least recently used template is replaced if it was not used
+  // for PARSED_TEMPLATE_CACHE_IDLE_TIMEOUT msec.
+  // Returns nullptr when the cache is full with templates in use, or when there is not enough memory.
+  ParsedTemplateStruct* create(uint32_t owner);
+
+  // Remove the template of the owner, e.g. when it could not be parsed.
+  void                  erase(uint32_t owner);
+
+  // Mark a template as being rendered.
+  // Rendering may call plugins, which may parse templates themselves.
+  // While in use, get() and create() return nullptr and clear() is postponed.
+  void                  beginUse();
+  void                  endUse();
+
+  void                  clear();
+
+  size_t                size() const;
+
+  size_t                getMemoryUsage() const;
+
+  // Owner ID for a template of a controller, used to send values of the given task.
+  // templateNr keeps several templates used for the same controller and task apart,
+  // e.g. the URI, header and body of C011.
+  static uint32_t       controllerOwner(controllerIndex_t controllerIndex,
+                                        taskIndex_t       taskIndex,
+                                        uint8_t           templateNr = 0);
+
+  // Owner ID for a template stored in a task, e.g. a display line.
+  static uint32_t       taskOwner(taskIndex_t taskIndex,
+                                  uint8_t     lineNr);
+
+private:
+
+  struct Entry {
+    ParsedTemplateStruct parsed;
+    uint32_t             owner    = 0;
+    unsigned long        lastUsed = 0; // millis() of last use
+  };
+
+  int find(uint32_t owner) const;
+
+  std::vector<Entry>_entries;
+  uint8_t  _inUse       = 0;
+  bool     _invalidated = false;
+};
+
+
+#endif // DATASTRUCTS_PARSEDTEMPLATESTRUCT_H
@@ -4,7 +4,8 @@ ProtocolStruct::ProtocolStruct() :
     defaultPort(0), Number(0), usesMQTT(false), usesAccount(false), usesPassword(false),
     usesTemplate(false), usesID(false), Custom(false), usesHost(true), usesPort(true),
     usesQueue(true), usesCheckReply(true), usesTimeout(true), usesSampleSets(false), 
-    usesExtCreds(false), needsNetwork(true), allowsExpire(true) {}
+    usesExtCreds(false), needsNetwork(true), allowsExpire(true),
+    supportsBatch(false) {}
 
 bool ProtocolStruct::useCredentials() const {
   return usesAccount || usesPassword;
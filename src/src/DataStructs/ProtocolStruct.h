@@ -32,6 +32,7 @@ struct ProtocolStruct
   bool     usesExtCreds   : 1;
   bool     needsNetwork   : 1;
   bool     allowsExpire   : 1;
+  bool     supportsBatch  : 1; // When set, the controller can send multiple queued messages in a single request
 };
 
 typedef std::vector<ProtocolStruct> ProtocolVector;
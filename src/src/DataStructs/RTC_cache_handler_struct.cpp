@@ -1,6 +1,7 @@
 #include "RTC_cache_handler_struct.h"
 
 #include "../../ESPEasy_common.h"
+#include "../DataStructs/ControllerCacheBlock.h"
 #include "../DataStructs/RTCStruct.h"
 #include "../Helpers/CRC_functions.h"
 #include "../Helpers/ESPEasy_Storage.h"
@@ -59,13 +60,14 @@ void RTC_cache_handler_struct::resetpeek() {
   peekreadpos = 0;
 }
 
-bool RTC_cache_handler_struct::peek(uint8_t *data, unsigned int size) {
+bool RTC_cache_handler_struct::peek(uint8_t *data, unsigned int size, bool allowNextFile) {
   int retries = 2;
 
   while (retries > 0) {
     --retries;
 
     if (!fp) {
+      if (!allowNextFile) { return false; }
       int tmppos;
       String fname;
 
@@ -83,12 +85,42 @@ bool RTC_cache_handler_struct::peek(uint8_t *data, unsigned int size) {
 
     if (!fp) { return false; }
 
-    if (fp.read(data, size)) {
+    if (fp.read(data, size) == size) {
       return true;
     }
     fp.close();
+
+    if (!allowNextFile) { return false; }
   }
-  return true;
+  return false;
+}
+
+bool RTC_cache_handler_struct::seekPeek(uint32_t from, uint32_t to) {
+  resetpeek();
+  int    tmppos;
+  String fname = getReadCacheFileName(tmppos);
+
+  if (fname.isEmpty()) { return false; }
+  pruneFileIndex();
+
+  for (int fileNr = getCacheFileCountFromFilename(fname); fileNr > 0 && fileNr <= RTC_cache.writeFileNr; ++fileNr) {
+    const ControllerCacheFileIndex *index = getFileIndex(fileNr);
+
+    if ((index == nullptr) || index->empty() || (index->lastTimestamp < from)) {
+      continue;
+    }
+
+    if (!index->overlaps(from, to)) {
+      // All following files are newer
+      return false;
+    }
+    fp = tryOpenFile(createCacheFilename(fileNr), "r");
+
+    if (!fp) { return false; }
+    peekfilenr = fileNr;
+    return fp.seek(index->findOffset(from));
+  }
+  return false;
 }
 
 // Write a single sample set to the buffer
@@ -131,14 +163,49 @@ bool RTC_cache_handler_struct::write(uint8_t *data, unsigned int size) {
   return saveRTCcache(startOffset, nrBytes);
 }
 
+bool RTC_cache_handler_struct::write(const uint8_t *header, unsigned int headerSize, const uint8_t *data, unsigned int size) {
+  if ((headerSize > RTC_CACHE_DATA_SIZE) || (getFreeSpace() < size) || ((RTC_cache.writePos + size) < headerSize)) {
+    return false;
+  }
+
+  for (unsigned int i = 0; i < size; ++i) {
+    RTC_cache_data[RTC_cache.writePos] = data[i];
+    ++RTC_cache.writePos;
+  }
+
+  for (unsigned int i = 0; i < headerSize; ++i) {
+    RTC_cache_data[i] = header[i];
+  }
+
+  // Store the buffer up to the new write position, padded to a multiple of 4 bytes.
+  int nrBytes = RTC_cache.writePos;
+
+  if (nrBytes % 4 != 0) {
+    nrBytes -= nrBytes % 4;
+    nrBytes += 4;
+  }
+
+  if (nrBytes > RTC_CACHE_DATA_SIZE) {
+    nrBytes = RTC_CACHE_DATA_SIZE;
+  }
+  return saveRTCcache(0, nrBytes);
+}
+
+unsigned int RTC_cache_handler_struct::getWritePos() const {
+  return RTC_cache.writePos;
+}
+
+const uint8_t * RTC_cache_handler_struct::getData() const {
+  return &RTC_cache_data[0];
+}
+
 // Mark all content as being processed and empty buffer.
 bool RTC_cache_handler_struct::flush() {
-  if (prepareFileForWrite()) {
+  if (prepareFileForWrite(isControllerCacheBlock(&RTC_cache_data[0], RTC_cache.writePos))) {
     if (RTC_cache.writePos > 0) {
-      #ifdef RTC_STRUCT_DEBUG
-      size_t filesize    = fw.size();
-      #endif
-      int    bytesWriten = fw.write(&RTC_cache_data[0], RTC_cache.writePos);
+      const bool compact  = isControllerCacheBlock(&RTC_cache_data[0], RTC_cache.writePos);
+      size_t filesize     = fw.size();
+      int    bytesWriten  = fw.write(&RTC_cache_data[0], RTC_cache.writePos);
 
       delay(0);
       fw.flush();
@@ -165,6 +232,7 @@ bool RTC_cache_handler_struct::flush() {
         }
         return false;
       }
+      updateFileIndex(filesize, compact);
       initRTCcache_data();
       clearRTCcacheData();
       saveRTCcache();
@@ -369,7 +437,22 @@ bool RTC_cache_handler_struct::updateRTC_filenameCounters() {
   return false;
 }
 
-bool RTC_cache_handler_struct::prepareFileForWrite() {
+bool RTC_cache_handler_struct::matchesFileFormat(const String& fname, bool compact) {
+  fs::File f = tryOpenFile(fname, "r");
+
+  if (!f) { return true; }
+  bool match = true;
+
+  if (f.size() > 0) {
+    uint8_t header[CONTROLLER_CACHE_BLOCK_HEADER_SIZE];
+    const size_t read = f.read(header, sizeof(header));
+    match = isControllerCacheBlock(header, read) == compact;
+  }
+  f.close();
+  return match;
+}
+
+bool RTC_cache_handler_struct::prepareFileForWrite(bool compact) {
   //    if (storageLocation != CACHE_STORAGE_SPIFFS) {
   //      return false;
   //    }
@@ -381,6 +464,11 @@ bool RTC_cache_handler_struct::prepareFileForWrite() {
   }
   unsigned int retries = 3;
 
+  if (fw && (fwCompact != compact)) {
+    fw.close();
+  }
+  fwCompact = compact;
+
   while (retries > 0) {
     --retries;
 
@@ -401,7 +489,14 @@ bool RTC_cache_handler_struct::prepareFileForWrite() {
       }
 
       String fname = createCacheFilename(RTC_cache.writeFileNr);
-      fw = tryOpenFile(fname, "a+");
+
+      if (!matchesFileFormat(fname, compact)) {
+        // Do not mix data formats in a single file, as it cannot be read anymore.
+        ++RTC_cache.writeFileNr;
+        fname = createCacheFilename(RTC_cache.writeFileNr);
+      }
+      fw       = tryOpenFile(fname, "a+");
+      fwFileNr = RTC_cache.writeFileNr;
 
       if (!fw) {
           #ifdef RTC_STRUCT_DEBUG
@@ -431,6 +526,98 @@ bool RTC_cache_handler_struct::prepareFileForWrite() {
   return false;
 }
 
+// Read the timestamp of a sample in a file with fixed size samples.
+static bool readLegacyTimestamp(fs::File& f, size_t sampleNr, uint32_t& timestamp) {
+  uint8_t data[CONTROLLER_CACHE_LEGACY_RECORD_SIZE];
+
+  if (!f.seek(sampleNr * CONTROLLER_CACHE_LEGACY_RECORD_SIZE) || (f.read(data, sizeof(data)) != sizeof(data))) {
+    return false;
+  }
+  ControllerCacheSample sample;
+
+  decodeLegacyControllerCacheSample(data, sample);
+  timestamp = sample.timestamp;
+  return true;
+}
+
+const ControllerCacheFileIndex * RTC_cache_handler_struct::getFileIndex(uint16_t fileNr) {
+  for (auto it = fileIndex.begin(); it != fileIndex.end(); ++it) {
+    if (it->fileNr == fileNr) {
+      return &(*it);
+    }
+  }
+  ControllerCacheFileIndex index(fileNr);
+
+  if (!buildFileIndex(index)) {
+    return nullptr;
+  }
+  fileIndex.push_back(std::move(index));
+  return &fileIndex.back();
+}
+
+bool RTC_cache_handler_struct::buildFileIndex(ControllerCacheFileIndex& index) {
+  fs::File f = tryOpenFile(createCacheFilename(index.fileNr), "r");
+
+  if (!f) { return false; }
+  const size_t filesize = f.size();
+  uint8_t header[CONTROLLER_CACHE_BLOCK_HEADER_SIZE];
+
+  if ((f.read(header, sizeof(header)) == sizeof(header)) && isControllerCacheBlock(header, sizeof(header))) {
+    // Only read the block headers, skip the samples.
+    size_t offset = 0;
+    ControllerCacheBlockHeader blockHeader;
+
+    while ((offset + sizeof(header)) <= filesize &&
+           f.seek(offset) &&
+           (f.read(header, sizeof(header)) == sizeof(header)) &&
+           blockHeader.read(header, sizeof(header))) {
+      index.addBlock(offset, blockHeader.baseTimestamp, blockHeader.lastTimestamp);
+      offset += sizeof(header) + blockHeader.payloadSize;
+    }
+  } else {
+    // Fixed size samples, only index every N-th sample.
+    const size_t nrSamples = filesize / CONTROLLER_CACHE_LEGACY_RECORD_SIZE;
+    uint32_t     timestamp = 0;
+
+    for (size_t i = 0; i < nrSamples; i += CONTROLLER_CACHE_INDEX_LEGACY_INTERVAL) {
+      if (!readLegacyTimestamp(f, i, timestamp)) { break; }
+      index.addBlock(i * CONTROLLER_CACHE_LEGACY_RECORD_SIZE, timestamp, timestamp, 1);
+    }
+
+    if ((nrSamples > 0) && readLegacyTimestamp(f, nrSamples - 1, timestamp)) {
+      index.lastTimestamp = timestamp;
+    }
+  }
+  f.close();
+  return true;
+}
+
+void RTC_cache_handler_struct::updateFileIndex(size_t offset, bool compact) {
+  for (auto it = fileIndex.begin(); it != fileIndex.end(); ++it) {
+    if (it->fileNr == fwFileNr) {
+      ControllerCacheBlockHeader header;
+
+      if (compact && header.read(&RTC_cache_data[0], RTC_cache.writePos)) {
+        it->addBlock(offset, header.baseTimestamp, header.lastTimestamp);
+      } else {
+        // Will be built again when needed.
+        fileIndex.erase(it);
+      }
+      return;
+    }
+  }
+}
+
+void RTC_cache_handler_struct::pruneFileIndex() {
+  for (auto it = fileIndex.begin(); it != fileIndex.end();) {
+    if ((it->fileNr < RTC_cache.readFileNr) || (it->fileNr > RTC_cache.writeFileNr)) {
+      it = fileIndex.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 #ifdef RTC_STRUCT_DEBUG
 void RTC_cache_handler_struct::rtc_debug_log(const String& description, size_t nrBytes) {
   if (loglevelActiveFor(LOG_LEVEL_INFO)) {
@@ -5,8 +5,10 @@
 #include "RTCCacheStruct.h"
 
 #include "../../ESPEasy_common.h"
+#include "../DataStructs/ControllerCacheIndex.h"
 
 #include <FS.h>
+#include <vector>
 
 
 // Locations where to store the cached data
@@ -36,13 +38,36 @@ struct RTC_cache_handler_struct
 
   void         resetpeek();
 
+  // Read from the cache files, starting at the oldest file.
+  // When allowNextFile is false, the data must be read from the current file.
   bool         peek(uint8_t     *data,
-                    unsigned int size);
+                    unsigned int size,
+                    bool         allowNextFile = true);
+
+  // Position the peek read position at the first file containing samples in the range [from, to],
+  // near the first sample at or after 'from'.
+  // Return false when no file contains samples in this range.
+  bool         seekPeek(uint32_t from,
+                        uint32_t to);
 
   // Write a single sample set to the buffer
   bool write(uint8_t     *data,
              unsigned int size);
 
+  // Append data to the buffer and replace the start of the buffer with a header describing the buffer content.
+  // Both are stored in the RTC memory at once.
+  // Returns false if there is not enough free space, the buffer must be flushed first.
+  bool write(const uint8_t *header,
+             unsigned int   headerSize,
+             const uint8_t *data,
+             unsigned int   size);
+
+  // Number of bytes in the buffer, not yet flushed
+  unsigned int getWritePos() const;
+
+  // Pointer to the start of the buffer
+  const uint8_t* getData() const;
+
   // Mark all content as being processed and empty buffer.
   bool flush();
 
@@ -74,7 +99,25 @@ private:
   // Return true if any cache file found
   bool     updateRTC_filenameCounters();
 
-  bool     prepareFileForWrite();
+  // When compact is set, the file must contain data in the compact (block) format, see ControllerCacheBlock.h
+  bool     prepareFileForWrite(bool compact);
+
+  // Check whether the data in an existing file has the same format
+  bool     matchesFileFormat(const String& fname,
+                             bool          compact);
+
+  // Return the time index of a cache file, build it when not present yet.
+  // Return nullptr when the file does not exist.
+  const ControllerCacheFileIndex* getFileIndex(uint16_t fileNr);
+
+  bool     buildFileIndex(ControllerCacheFileIndex& index);
+
+  // Update the index of the file being written with the flushed buffer, written at offset.
+  void     updateFileIndex(size_t offset,
+                           bool   compact);
+
+  // Remove the index of files which no longer exist.
+  void     pruneFileIndex();
 
 #ifdef RTC_STRUCT_DEBUG
   void     rtc_debug_log(const String& description,
@@ -90,9 +133,13 @@ private:
   File                fp;
   size_t              peekfilenr  = 0;
   size_t              peekreadpos = 0;
+  uint16_t            fwFileNr    = 0; // File number of fw
+
+  std::vector<ControllerCacheFileIndex> fileIndex;
 
   byte storageLocation = CACHE_STORAGE_SPIFFS;
   bool writeerror      = false;
+  bool fwCompact       = false;
 };
 
 #endif // ifndef DATASTRUCTS_RTC_CACHE_HANDLER_STRUCT_H
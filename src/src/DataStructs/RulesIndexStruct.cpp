@@ -0,0 +1,443 @@
+#include "../DataStructs/RulesIndexStruct.h"
+
+#include "../ESPEasyCore/ESPEasyRules.h"
+#include "../ESPEasyCore/ESPEasy_Log.h"
+#include "../Globals/Plugins_other.h"
+#include "../Helpers/ESPEasy_Storage.h"
+#include "../Helpers/Memory.h"
+#include "../Helpers/Rules_calculate.h"
+
+#include <algorithm>
+
+
+RulesEventKey::RulesEventKey(const String& str)
+{
+  const char *c   = str.c_str();
+  const int   len = str.length();
+  int start       = 0;
+
+  while (start < len && isspace(c[start])) {
+    ++start;
+  }
+  int end = start;
+
+  // The event name ends at the first compare or value separator.
+  while (end < len && c[end] != '=' && c[end] != '<' && c[end] != '>' && c[end] != '!') {
+    ++end;
+  }
+
+  while (end > start && isspace(c[end - 1])) {
+    --end;
+  }
+
+  if (end == start) {
+    invalid = true;
+    return;
+  }
+
+  // FNV-1a hash on lower case characters
+  hash = 2166136261u;
+
+  for (int i = start; i < end; ++i) {
+    hash ^= static_cast<uint8_t>(tolower(c[i]));
+    hash *= 16777619u;
+  }
+}
+
+
+bool RulesFileIndexStruct::load(const String& fileName)
+{
+  clear();
+
+  fs::File f = tryOpenFile(fileName, "r");
+
+  if (!f) {
+    return false;
+  }
+
+  String line;
+  bool   firstNonSpaceRead = false;
+  bool   commentFound      = false;
+  bool   inBlock           = false;
+  bool   success           = true;
+
+  std::vector<byte> buf;
+  buf.resize(RULES_BUFFER_SIZE);
+
+  // Stored text will never be larger than the file, so try to allocate it at once.
+  _text.reserve(f.size());
+
+  while (success && f.available()) {
+    const int len = f.read(&buf[0], RULES_BUFFER_SIZE);
+
+    for (int x = 0; success && x < len; x++) {
+      if (rules_append_character(line, static_cast<char>(buf[x]), firstNonSpaceRead, commentFound)) {
+        success = addLine(line, inBlock);
+
+        // Prepare for new line
+        line              = EMPTY_STRING;
+        firstNonSpaceRead = false;
+        commentFound      = false;
+      }
+    }
+  }
+  f.close();
+
+  // N.B. A last line without line end is not processed by the rules engine either.
+  if (!success) {
+    clear();
+    return false;
+  }
+  lines.shrink_to_fit();
+  blocks.shrink_to_fit();
+  buildIndex();
+  return true;
+}
+
+void RulesFileIndexStruct::clear()
+{
+  _text = EMPTY_STRING;
+  lines.clear();
+  blocks.clear();
+  _index.clear();
+  _alwaysCheck.clear();
+}
+
+// Check whether a (part of a) rules line must be parsed before it can be used.
+static bool hasRulesMarkup(const char *text, RulesLineType type)
+{
+  if ((parseTemplate_CallBack_ptr != nullptr) || (substitute_eventvalue_CallBack_ptr != nullptr)) {
+    return true;
+  }
+
+  if (strpbrk(text, "%{") != nullptr) {
+    return true;
+  }
+  const char *bracket = strchr(text, '[');
+
+  if ((bracket == nullptr) ||
+      ((type != RulesLineType::If) && (type != RulesLineType::ElseIf)) ||
+      (strchr(text, ':') != nullptr)) {
+    return bracket != nullptr;
+  }
+
+  // [VAR#n] and [INT#n] in a condition are read by Calculate() itself, so the compiled
+  // expression can be kept (see RulesCalculateExpressionCache).
+  // Not when comparing times, as a number filled in is then also seen as a time in hours.
+  for (; bracket != nullptr; bracket = strchr(bracket + 1, '[')) {
+    RPNOpcode opcode;
+    uint16_t  index;
+
+    if (RulesCalculate_t::matchVariable(bracket, false, opcode, index) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Same classification of a line as done in processMatchedRule(), on the line before it is parsed.
+static RulesLineType getRulesLineType(const String& line, int& argPos)
+{
+  String lcLine = line;
+
+  lcLine.toLowerCase();
+  argPos = 0;
+
+  if (lcLine.equals(F("endon"))) {
+    return RulesLineType::EndOn;
+  }
+  int split = lcLine.indexOf(F("elseif "));
+
+  if (split != -1) {
+    argPos = split + 7;
+    return RulesLineType::ElseIf;
+  }
+  split = lcLine.indexOf(F("if "));
+
+  if (split != -1) {
+    argPos = split + 3;
+    return RulesLineType::If;
+  }
+
+  if (lcLine.equals(F("else"))) {
+    return RulesLineType::Else;
+  }
+
+  if (lcLine.equals(F("endif"))) {
+    return RulesLineType::EndIf;
+  }
+  return RulesLineType::Action;
+}
+
+bool RulesFileIndexStruct::addLine(String& line, bool& inBlock)
+{
+  line.trim();
+  check_rules_line_user_errors(line);
+
+  if (line.isEmpty() || line.startsWith(F("//"))) {
+    return true;
+  }
+  const bool lineStartsWith_on = line.substring(0, 3).equalsIgnoreCase(F("on "));
+
+  if (!inBlock && !lineStartsWith_on) {
+    // Not part of any "on ... do" block, so will never be executed.
+    return true;
+  }
+  rules_strip_trailing_comments(line);
+
+  uint16_t offset = 0;
+
+  if (!addText(line, offset)) {
+    return false;
+  }
+
+  if (inBlock) {
+    blocks.back().nrLines++;
+    addCompiledLine(line, offset);
+
+    if (lines.back().type == RulesLineType::EndOn) {
+      inBlock = false;
+    }
+    return true;
+  }
+
+  RulesBlockStruct block;
+  block.firstLine = lines.size();
+  block.nrLines   = 1;
+
+  // Trigger may change when parsing the line, so then it must be evaluated for every event.
+  block.dynamicTrigger = parseTemplate_CallBack_ptr != nullptr ||
+                         line.indexOf('%') != -1 ||
+                         line.indexOf('[') != -1 ||
+                         line.indexOf('{') != -1;
+
+  RulesLineStruct onLine;
+  onLine.arg       = offset;
+  onLine.type      = RulesLineType::On;
+  onLine.hasMarkup = block.dynamicTrigger;
+  lines.push_back(onLine);
+
+  // Same split in trigger and action as done in parseCompleteNonCommentLine()
+  String lcLine = line.substring(3);
+  lcLine.toLowerCase();
+  const int split = lcLine.indexOf(F(" do"));
+  bool singleLine = false;
+
+  if (split != -1) {
+    block.trigger = lcLine.substring(0, split);
+    block.trigger.trim();
+    int actionPos = split + 7;
+
+    while (actionPos < static_cast<int>(line.length()) && line[actionPos] == ' ') {
+      ++actionPos;
+    }
+
+    if (actionPos < static_cast<int>(line.length())) {
+      // Single line "on ... do action", store the action as a separate line.
+      singleLine = true;
+      block.nrLines++;
+      addCompiledLine(line.substring(actionPos), offset + actionPos);
+    }
+  }
+  blocks.push_back(block);
+  inBlock = !singleLine;
+  return true;
+}
+
+bool RulesFileIndexStruct::addText(const String& line, uint16_t& offset)
+{
+  const size_t textLength = _text.length();
+
+  if ((textLength + line.length() + 1) > 0xFFFF) {
+    return false;
+  }
+
+  if (!_text.reserve(textLength + line.length() + 1)) {
+    return false;
+  }
+  offset = textLength;
+  _text += line;
+  _text += '\0';
+  return true;
+}
+
+void RulesFileIndexStruct::addCompiledLine(const String& line, uint16_t offset)
+{
+  RulesLineStruct compiled;
+  int argPos = 0;
+
+  compiled.type = getRulesLineType(line, argPos);
+
+  while (argPos < static_cast<int>(line.length()) && line[argPos] == ' ') {
+    ++argPos;
+  }
+  compiled.arg       = offset + argPos;
+  compiled.hasMarkup = hasRulesMarkup(line.c_str() + argPos, compiled.type);
+  lines.push_back(compiled);
+}
+
+const char * RulesFileIndexStruct::getText(const RulesLineStruct& line) const
+{
+  // Every line is terminated with a '\0'
+  return _text.c_str() + line.arg;
+}
+
+void RulesFileIndexStruct::buildIndex()
+{
+  _index.clear();
+  _alwaysCheck.clear();
+
+  for (uint16_t i = 0; i < blocks.size(); ++i) {
+    const RulesEventKey key(blocks[i].trigger);
+
+    if (blocks[i].dynamicTrigger || key.invalid || blocks[i].trigger.equals(F("*"))) {
+      _alwaysCheck.push_back(i);
+    } else {
+      _index.push_back({ key.hash, i });
+    }
+  }
+  std::sort(_index.begin(), _index.end(),
+            [](const IndexEntry& a, const IndexEntry& b) {
+    return a.hash < b.hash || (a.hash == b.hash && a.block < b.block);
+  });
+  _index.shrink_to_fit();
+  _alwaysCheck.shrink_to_fit();
+}
+
+uint16_t RulesFileIndexStruct::nextCandidateBlock(const RulesEventKey& key, uint16_t fromBlock) const
+{
+  const uint16_t nrBlocks = blocks.size();
+
+  if (key.invalid || (fromBlock >= nrBlocks)) {
+    return fromBlock < nrBlocks ? fromBlock : nrBlocks;
+  }
+  uint16_t res = nrBlocks;
+
+  {
+    auto it = std::lower_bound(_alwaysCheck.begin(), _alwaysCheck.end(), fromBlock);
+
+    if (it != _alwaysCheck.end()) {
+      res = *it;
+    }
+  }
+  {
+    const IndexEntry entry { key.hash, fromBlock };
+    auto it = std::lower_bound(_index.begin(), _index.end(), entry,
+                               [](const IndexEntry& a, const IndexEntry& b) {
+      return a.hash < b.hash || (a.hash == b.hash && a.block < b.block);
+    });
+
+    if ((it != _index.end()) && (it->hash == key.hash) && (it->block < res)) {
+      res = it->block;
+    }
+  }
+  return res;
+}
+
+bool RulesFileIndexStruct::canSkipBlock(const RulesBlockStruct& block, const String& event) const
+{
+  if (block.dynamicTrigger || block.trigger.equals(F("*"))) {
+    return false;
+  }
+  return !ruleMatch(event, block.trigger);
+}
+
+size_t RulesFileIndexStruct::getMemoryUsage() const
+{
+  size_t res = _text.length() + lines.capacity() * sizeof(RulesLineStruct);
+
+  res += _index.capacity() * sizeof(IndexEntry);
+  res += _alwaysCheck.capacity() * sizeof(uint16_t);
+
+  for (auto it = blocks.begin(); it != blocks.end(); ++it) {
+    res += sizeof(RulesBlockStruct) + it->trigger.length();
+  }
+  return res;
+}
+
+RulesFileIndexStruct * RulesIndexStruct::getFileIndex(const String& fileName)
+{
+  if (_invalidated) {
+    if (_inUse != 0) {
+      // Cannot free the indexes now, as they are still being used.
+      return nullptr;
+    }
+    clear();
+  }
+  auto it = _files.find(fileName);
+
+  if (it != _files.end()) {
+    return &(it->second);
+  }
+
+  if (FreeMem() < RULES_INDEX_MIN_FREE_HEAP) {
+    return nullptr;
+  }
+
+  RulesFileIndexStruct& fileIndex = _files[fileName];
+
+  if (!fileIndex.load(fileName)) {
+    _files.erase(fileName);
+    return nullptr;
+  }
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("Rules: Indexed ");
+    log += fileName;
+    log += F(" blocks: ");
+    log += fileIndex.blocks.size();
+    log += F(" size: ");
+    log += fileIndex.getMemoryUsage();
+    addLog(LOG_LEVEL_INFO, log);
+  }
+  return &fileIndex;
+}
+
+void RulesIndexStruct::invalidate()
+{
+  if (_inUse == 0) {
+    clear();
+  } else {
+    _invalidated = true;
+  }
+}
+
+void RulesIndexStruct::beginUse()
+{
+  ++_inUse;
+}
+
+void RulesIndexStruct::endUse()
+{
+  if (_inUse > 0) {
+    --_inUse;
+  }
+}
+
+void RulesIndexStruct::clear()
+{
+  _files.clear();
+  _invalidated = false;
+}
+
+size_t RulesIndexStruct::getMemoryUsage() const
+{
+  size_t res = 0;
+
+  for (auto it = _files.begin(); it != _files.end(); ++it) {
+    res += it->first.length() + it->second.getMemoryUsage();
+  }
+  return res;
+}
+
+size_t RulesIndexStruct::size() const
+{
+  return _files.size();
+}
+
+bool RulesIndexStruct::isRulesFileName(const String& fileName)
+{
+  const int offset = fileName.startsWith(F("/")) ? 1 : 0;
+
+  return fileName.substring(offset, offset + 5).equalsIgnoreCase(F("rules"));
+}
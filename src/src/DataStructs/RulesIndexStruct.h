@@ -0,0 +1,182 @@
+#ifndef DATASTRUCTS_RULESINDEXSTRUCT_H
+#define DATASTRUCTS_RULESINDEXSTRUCT_H
+
+#include "../../ESPEasy_common.h"
+
+#include <map>
+#include <vector>
+
+
+/*********************************************************************************************\
+* RulesLineType
+* Kind of line in a compiled "On ... Do" block, determined when the rules file is loaded.
+\*********************************************************************************************/
+enum class RulesLineType : uint8_t {
+  On,     // The "on ... do" line starting a block
+  If,
+  ElseIf,
+  Else,
+  EndIf,
+  EndOn,
+  Action  // Any other line, executed as command
+};
+
+
+/*********************************************************************************************\
+* RulesLineStruct
+* A single compiled line of a rules block.
+\*********************************************************************************************/
+struct RulesLineStruct {
+  // Offset in the stored text of the argument of the line:
+  // - "on" line     : the complete line
+  // - "if"/"elseif" : the condition
+  // - Action        : the command
+  // The argument runs until the end of the line.
+  uint16_t arg = 0;
+
+  RulesLineType type = RulesLineType::Action;
+
+  // The argument contains markup, so %eventvalue% and parseTemplate() must be applied on each run.
+  // Not set for a condition of which the only markup is [VAR#n] or [INT#n], as Calculate() reads those.
+  bool hasMarkup = false;
+};
+
+
+/*********************************************************************************************\
+* RulesBlockStruct
+* A single "On ... Do" block of an indexed rules file.
+\*********************************************************************************************/
+struct RulesBlockStruct {
+  // Event trigger (lower case), as written between "on" and "do"
+  String trigger;
+
+  // Index of the "on" line in the compiled lines
+  uint16_t firstLine = 0;
+
+  // Number of compiled lines in this block, including the "on" and "endon" line.
+  // The action of a single line "on ... do action" is stored as separate line.
+  uint16_t nrLines = 0;
+
+  // The "on" line contains markup which must be parsed for each event,
+  // so the trigger cannot be matched without running the "on" line.
+  bool dynamicTrigger = false;
+};
+
+
+/*********************************************************************************************\
+* RulesEventKey
+* Hash of the event name part of an event or trigger, e.g. "bme#temp" for "BME#Temp>20"
+* An event can only match a trigger with the same event name, so this is used to look up
+* the blocks which may match an event.
+\*********************************************************************************************/
+struct RulesEventKey {
+  explicit RulesEventKey(const String& str);
+
+  uint32_t hash = 0;
+
+  // Set when no event name could be determined (e.g. literal events starting with '!')
+  // Such events must be checked against all blocks.
+  bool invalid = false;
+};
+
+
+/*********************************************************************************************\
+* RulesFileIndexStruct
+* Index of the "On ... Do" blocks of a rules file, so an event only needs to be checked against
+* the blocks with a matching trigger.
+* The blocks are compiled when loading the file: each line is classified (if, elseif, else,
+* endif, endon or action) and refers to its condition or command in the stored text.
+* So running a block does not need to split or copy lines, only arguments with markup are
+* parsed each time the block is run.
+* All lines are kept in a single String, each terminated by a '\0', to keep heap fragmentation
+* low and to allow using an argument without copying it.
+\*********************************************************************************************/
+struct RulesFileIndexStruct {
+  // Read the rules file and index its blocks.
+  // Return false when the file could not be read or does not fit in memory.
+  bool   load(const String& fileName);
+
+  void   clear();
+
+  // Get the argument of a compiled line, see RulesLineStruct.
+  const char* getText(const RulesLineStruct& line) const;
+
+  // Get the index of the first block starting at fromBlock which may match the event.
+  // Returns blocks.size() when there is none.
+  uint16_t nextCandidateBlock(const RulesEventKey& key,
+                              uint16_t             fromBlock) const;
+
+  // Check whether the block can be skipped for this event without parsing it.
+  bool   canSkipBlock(const RulesBlockStruct& block,
+                      const String          & event) const;
+
+  size_t getMemoryUsage() const;
+
+  std::vector<RulesBlockStruct>blocks;
+
+  std::vector<RulesLineStruct>lines;
+
+private:
+
+  bool addLine(String& line,
+               bool  & inBlock);
+
+  bool addText(const String& line,
+               uint16_t    & offset);
+
+  void addCompiledLine(const String& line,
+                       uint16_t      offset);
+
+  void buildIndex();
+
+  struct IndexEntry {
+    uint32_t hash;
+    uint16_t block;
+  };
+
+  String _text;
+
+  // Blocks sorted on event name hash and then block index.
+  std::vector<IndexEntry>_index;
+
+  // Blocks which cannot be indexed, e.g. "on * do" or dynamic triggers.
+  std::vector<uint16_t>_alwaysCheck;
+};
+
+
+/*********************************************************************************************\
+* RulesIndexStruct
+* Cache of rules file indexes, by file name.
+* Rules files are only read from the file system when (re)building the index.
+\*********************************************************************************************/
+struct RulesIndexStruct {
+  // Get the index of the rules file, build it when needed.
+  // Returns nullptr when the index cannot be used, the caller must then process the file itself.
+  RulesFileIndexStruct* getFileIndex(const String& fileName);
+
+  // Mark all indexes outdated, e.g. when a rules file was saved.
+  void                  invalidate();
+
+  // Mark the indexes as being used, to prevent them from being freed while in use.
+  // Needed as rules may trigger (nested) events which are processed immediately.
+  void                  beginUse();
+  void                  endUse();
+
+  void                  clear();
+
+  size_t                getMemoryUsage() const;
+
+  size_t                size() const;
+
+  // Check to see if the file name refers to a rules file (rulesN.txt or one in the rules/ folder)
+  static bool           isRulesFileName(const String& fileName);
+
+private:
+
+  std::map<String, RulesFileIndexStruct>_files;
+  uint8_t _inUse      = 0;
+  bool    _invalidated = false;
+};
+
+
+#endif // DATASTRUCTS_RULESINDEXSTRUCT_H
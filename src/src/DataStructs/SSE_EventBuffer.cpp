@@ -0,0 +1,52 @@
+#include "../DataStructs/SSE_EventBuffer.h"
+
+
+SSE_EventBuffer::SSE_EventBuffer(size_t capacity)
+{
+  _buffer.resize(capacity);
+}
+
+bool SSE_EventBuffer::add(const String& event)
+{
+  const size_t length = event.length();
+
+  if ((length == 0) || ((_size + length) > _buffer.size())) {
+    ++_nrDropped;
+    return false;
+  }
+  const size_t capacity = _buffer.size();
+  const size_t tail     = (_head + _size) % capacity;
+  const char  *data     = event.c_str();
+
+  // Copy in at most 2 parts, when wrapping around the end of the buffer.
+  const size_t first = std::min(length, capacity - tail);
+
+  memcpy(&_buffer[tail], data, first);
+
+  if (first < length) {
+    memcpy(&_buffer[0], data + first, length - first);
+  }
+  _size += length;
+  return true;
+}
+
+const uint8_t * SSE_EventBuffer::peek(size_t& length) const
+{
+  if (_size == 0) {
+    length = 0;
+    return nullptr;
+  }
+  length = std::min(_size, _buffer.size() - _head);
+  return &_buffer[_head];
+}
+
+void SSE_EventBuffer::consume(size_t length)
+{
+  if (length >= _size) {
+    _head = 0;
+    _size = 0;
+    return;
+  }
+  _head  = (_head + length) % _buffer.size();
+  _size -= length;
+}
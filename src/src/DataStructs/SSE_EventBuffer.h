@@ -0,0 +1,78 @@
+#ifndef DATASTRUCTS_SSE_EVENTBUFFER_H
+#define DATASTRUCTS_SSE_EVENTBUFFER_H
+
+#include "../../ESPEasy_common.h"
+
+#include <vector>
+
+/*********************************************************************************************\
+* Bounded outbound buffer of a Server-Sent Events (SSE) client
+*
+* Events are only added as a whole, so a slow client never receives a partial event.
+* When an event does not fit, it is dropped and counted, so the client can be told to
+* resynchronize once the buffer has drained.
+\*********************************************************************************************/
+class SSE_EventBuffer {
+public:
+
+  explicit SSE_EventBuffer(size_t capacity);
+
+  // Return false when the event does not fit, the event is then dropped.
+  bool     add(const String& event);
+
+  bool     empty() const { return _size == 0; }
+
+  size_t   size() const { return _size; }
+
+  // Return the first contiguous block of pending data.
+  const uint8_t* peek(size_t& length) const;
+
+  // Remove length bytes from the start of the buffer.
+  void     consume(size_t length);
+
+  // Number of events dropped since the last call to clearDropped()
+  uint32_t getNrDropped() const { return _nrDropped; }
+
+  void     clearDropped() { _nrDropped = 0; }
+
+private:
+
+  std::vector<uint8_t> _buffer;
+  size_t               _head      = 0;
+  size_t               _size      = 0;
+  uint32_t             _nrDropped = 0;
+};
+
+
+// Write as much pending data as the client accepts without blocking.
+// Templated on the client class, so it can be tested on the host with a fake client.
+// Return the number of bytes written.
+template<typename Client>
+size_t writeBufferedEvents(Client& client, SSE_EventBuffer& buffer)
+{
+  size_t written = 0;
+
+  while (!buffer.empty()) {
+    const int window = client.availableForWrite();
+
+    if (window <= 0) {
+      break;
+    }
+    size_t         length = 0;
+    const uint8_t *data   = buffer.peek(length);
+
+    if (length > static_cast<size_t>(window)) {
+      length = window;
+    }
+    const size_t sent = client.write(data, length);
+
+    if (sent == 0) {
+      break;
+    }
+    buffer.consume(sent);
+    written += sent;
+  }
+  return written;
+}
+
+#endif // DATASTRUCTS_SSE_EVENTBUFFER_H
@@ -118,6 +118,10 @@ class SettingsStruct_tmpl
   bool DoNotStartAP() const;
   void DoNotStartAP(bool value);
 
+  // Replace a still queued task value event by the new value, instead of adding another event for the same task value.
+  bool CoalesceTaskValueEvents() const;
+  void CoalesceTaskValueEvents(bool value);
+
   void validate();
 
   bool networkSettingsEmpty() const;
@@ -0,0 +1,127 @@
+#include "../DataStructs/SettingsWriteBufferStruct.h"
+
+#include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Memory.h"
+
+
+bool SettingsWriteBufferStruct::add(const String& fname, int offset, const byte *memAddress, int datasize)
+{
+  if ((offset < 0) || (datasize <= 0)) {
+    return false;
+  }
+
+  if (!isEmpty() && !fileName.equals(fname)) {
+    return false;
+  }
+
+  if ((nrBytes + datasize) > SETTINGS_WRITE_BUFFER_SIZE) {
+    return false;
+  }
+
+  if (FreeMem() < static_cast<unsigned long>(SETTINGS_WRITE_BUFFER_MIN_FREE_HEAP + datasize)) {
+    return false;
+  }
+
+  // Determine the ranges to merge with the new data.
+  int    start = offset;
+  int    end   = offset + datasize;
+  size_t first = 0;
+
+  while (first < ranges.size() &&
+         (ranges[first].offset + static_cast<int>(ranges[first].data.size())) < start) {
+    ++first;
+  }
+  size_t last = first;
+
+  while (last < ranges.size() && ranges[last].offset <= end) {
+    const int rangeEnd = ranges[last].offset + ranges[last].data.size();
+
+    if (ranges[last].offset < start) { start = ranges[last].offset; }
+
+    if (rangeEnd > end) { end = rangeEnd; }
+    ++last;
+  }
+
+  Range merged;
+  merged.offset = start;
+  merged.data.resize(end - start);
+
+  size_t mergedBytes = 0;
+
+  for (size_t i = first; i < last; ++i) {
+    memcpy(&merged.data[ranges[i].offset - start], &ranges[i].data[0], ranges[i].data.size());
+    mergedBytes += ranges[i].data.size();
+  }
+
+  // New data is written last, so it replaces the pending data
+  memcpy(&merged.data[offset - start], memAddress, datasize);
+
+  if (isEmpty()) {
+    fileName    = fname;
+    _firstAdded = millis();
+    _timeout    = SETTINGS_WRITE_BEHIND_TIMEOUT;
+  }
+  nrBytes = nrBytes - mergedBytes + merged.data.size();
+  ++nrSaves;
+
+  ranges.erase(ranges.begin() + first, ranges.begin() + last);
+  ranges.insert(ranges.begin() + first, std::move(merged));
+  return true;
+}
+
+void SettingsWriteBufferStruct::overlay(const String& fname, int offset, byte *memAddress, int datasize) const
+{
+  if (!isPending(fname)) {
+    return;
+  }
+  const int end = offset + datasize;
+
+  for (auto it = ranges.begin(); it != ranges.end(); ++it) {
+    const int rangeEnd = it->offset + it->data.size();
+
+    if ((it->offset < end) && (rangeEnd > offset)) {
+      const int copyStart = it->offset > offset ? it->offset : offset;
+      const int copyEnd   = rangeEnd < end ? rangeEnd : end;
+      memcpy(memAddress + (copyStart - offset), &(it->data[copyStart - it->offset]), copyEnd - copyStart);
+    }
+  }
+}
+
+bool SettingsWriteBufferStruct::isPending(const String& fname) const
+{
+  return !isEmpty() && fileName.equals(fname);
+}
+
+bool SettingsWriteBufferStruct::isEmpty() const
+{
+  return ranges.empty();
+}
+
+bool SettingsWriteBufferStruct::timeoutReached() const
+{
+  return !isEmpty() && timePassedSince(_firstAdded) >= static_cast<long>(_timeout);
+}
+
+void SettingsWriteBufferStruct::retryLater()
+{
+  _firstAdded = millis();
+  _timeout    = SETTINGS_WRITE_BEHIND_RETRY_INTERVAL;
+}
+
+void SettingsWriteBufferStruct::clear()
+{
+  fileName = String();
+  ranges.clear();
+  nrBytes = 0;
+  nrSaves = 0;
+}
+
+void SettingsWriteBufferStruct::swap(SettingsWriteBufferStruct& other)
+{
+  std::swap(fileName,    other.fileName);
+  std::swap(ranges,      other.ranges);
+  std::swap(nrBytes,     other.nrBytes);
+  std::swap(nrSaves,     other.nrSaves);
+  std::swap(_firstAdded, other._firstAdded);
+  std::swap(_timeout,    other._timeout);
+}
@@ -0,0 +1,69 @@
+#ifndef DATASTRUCTS_SETTINGSWRITEBUFFERSTRUCT_H
+#define DATASTRUCTS_SETTINGSWRITEBUFFERSTRUCT_H
+
+#include "../../ESPEasy_common.h"
+
+#include <vector>
+
+
+/*********************************************************************************************\
+* SettingsWriteBufferStruct
+* Collects writes to a single settings file, so several saves made shortly after each other
+* (e.g. custom task settings, task settings and settings when saving a device page)
+* can be written to the file in one go.
+* Writes to overlapping or adjacent parts of the file are merged.
+\*********************************************************************************************/
+struct SettingsWriteBufferStruct {
+  struct Range {
+    int                 offset = 0;
+    std::vector<uint8_t>data;
+  };
+
+  // Add data to be written to the file at the given offset.
+  // Returns false when the data cannot be added, e.g. when data for another file is pending
+  // or the buffer is full. The caller must then flush the buffer or write the data itself.
+  bool   add(const String& fname,
+             int           offset,
+             const byte   *memAddress,
+             int           datasize);
+
+  // Copy pending data overlapping with the given part of the file into memAddress.
+  // Used to read data which has not yet been written.
+  void   overlay(const String& fname,
+                 int           offset,
+                 byte         *memAddress,
+                 int           datasize) const;
+
+  bool   isPending(const String& fname) const;
+
+  bool   isEmpty() const;
+
+  // Data has been pending longer than SETTINGS_WRITE_BEHIND_TIMEOUT,
+  // or SETTINGS_WRITE_BEHIND_RETRY_INTERVAL after retryLater()
+  bool   timeoutReached() const;
+
+  // Writing the data failed, so keep it and try again after SETTINGS_WRITE_BEHIND_RETRY_INTERVAL.
+  void   retryLater();
+
+  void   clear();
+
+  void   swap(SettingsWriteBufferStruct& other);
+
+  String              fileName;
+
+  // Sorted on offset, never overlapping or adjacent
+  std::vector<Range>  ranges;
+
+  size_t              nrBytes = 0;
+
+  // Number of saves combined in this buffer
+  uint16_t            nrSaves = 0;
+
+private:
+
+  unsigned long _firstAdded = 0;
+  unsigned long _timeout    = SETTINGS_WRITE_BEHIND_TIMEOUT;
+};
+
+
+#endif // DATASTRUCTS_SETTINGSWRITEBUFFERSTRUCT_H
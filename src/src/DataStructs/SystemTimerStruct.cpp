@@ -60,3 +60,48 @@ void systemTimerStruct::setRemainder(int timeLeft) {
 int systemTimerStruct::getLoopCount() const {
   return Par5;
 }
+
+
+systemTimerStruct * systemTimerMap::get(unsigned long mixedTimerId) {
+  uint16_t pos;
+
+  if (!_index.find(mixedTimerId, pos)) {
+    return nullptr;
+  }
+  return &_timers[pos];
+}
+
+void systemTimerMap::set(unsigned long mixedTimerId, const systemTimerStruct& timer) {
+  uint16_t pos;
+
+  if (_index.find(mixedTimerId, pos)) {
+    _timers[pos] = timer;
+    return;
+  }
+
+  if (!_free.empty()) {
+    pos = _free.back();
+    _free.pop_back();
+    _timers[pos] = timer;
+  } else {
+    if (_timers.size() >= 0xFFFF) {
+      return;
+    }
+    pos = _timers.size();
+    _timers.push_back(timer);
+  }
+  _index.set(mixedTimerId, pos);
+}
+
+void systemTimerMap::erase(unsigned long mixedTimerId) {
+  uint16_t pos;
+
+  if (_index.find(mixedTimerId, pos)) {
+    _index.erase(mixedTimerId);
+    _free.push_back(pos);
+  }
+}
+
+size_t systemTimerMap::size() const {
+  return _index.size();
+}
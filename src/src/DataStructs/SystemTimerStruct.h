@@ -2,7 +2,8 @@
 #define DATASTRUCTS_SYSTEMTIMERSTRUCT_H
 
 #include "../../ESPEasy_common.h"
-#include <map>
+#include <vector>
+#include "../DataStructs/timer_id_index.h"
 #include "../Globals/Plugins.h"
 
 /*********************************************************************************************\
@@ -45,4 +46,34 @@ struct systemTimerStruct
 };
 
 
+/*********************************************************************************************\
+* systemTimerMap
+* Map mixed timer ID to system timer struct.
+* Timers are stored in a pool which is reused, so setting a timer does not allocate memory
+* unless more timers are active than ever before.
+\*********************************************************************************************/
+struct systemTimerMap
+{
+  // Return nullptr when no timer is set for this ID.
+  // N.B. The pointer is only valid until the next call to set()
+  systemTimerStruct* get(unsigned long mixedTimerId);
+
+  void               set(unsigned long            mixedTimerId,
+                         const systemTimerStruct& timer);
+
+  void               erase(unsigned long mixedTimerId);
+
+  size_t             size() const;
+
+private:
+
+  std::vector<systemTimerStruct>_timers;
+
+  // Unused positions in _timers
+  std::vector<uint16_t>_free;
+
+  timer_id_index _index;
+};
+
+
 #endif // DATASTRUCTS_SYSTEMTIMERSTRUCT_H
@@ -0,0 +1,31 @@
+#include "../DataStructs/TaskValueTracker.h"
+
+
+void TaskValueTracker::markUpdated(taskIndex_t taskIndex, uint32_t timestamp, byte valueCount)
+{
+  if (taskIndex >= TASKS_MAX) {
+    return;
+  }
+  ++_lastSequence;
+  _sequence[taskIndex]   = _lastSequence;
+  _timestamp[taskIndex]  = timestamp;
+  _valueCount[taskIndex] = valueCount > VARS_PER_TASK ? VARS_PER_TASK : valueCount;
+}
+
+uint32_t TaskValueTracker::getSequence(taskIndex_t taskIndex) const
+{
+  return taskIndex < TASKS_MAX ? _sequence[taskIndex] : 0;
+}
+
+uint32_t TaskValueTracker::getTimestamp(taskIndex_t taskIndex) const
+{
+  return taskIndex < TASKS_MAX ? _timestamp[taskIndex] : 0;
+}
+
+byte TaskValueTracker::getValueCount(taskIndex_t taskIndex) const
+{
+  if (getSequence(taskIndex) == 0) {
+    return TASK_VALUE_COUNT_UNKNOWN;
+  }
+  return _valueCount[taskIndex];
+}
@@ -0,0 +1,45 @@
+#ifndef DATASTRUCTS_TASKVALUETRACKER_H
+#define DATASTRUCTS_TASKVALUETRACKER_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../CustomBuild/ESPEasyLimits.h"
+#include "../DataTypes/TaskIndex.h"
+
+/*********************************************************************************************\
+* Keep track of when the values of each task were last updated.
+*
+* Every update gets a sequence number, incremented for each update of any task.
+* A client can remember the last sequence number it has seen and only request tasks
+* updated after that.
+\*********************************************************************************************/
+#define TASK_VALUE_COUNT_UNKNOWN  255
+
+struct TaskValueTracker {
+  // Called when new values of a task are sent.
+  void     markUpdated(taskIndex_t taskIndex,
+                       uint32_t    timestamp,
+                       byte        valueCount);
+
+  // Sequence number of the last update of any task.
+  uint32_t getSequence() const {
+    return _lastSequence;
+  }
+
+  // Sequence number of the last update of the task, 0 when not updated since boot.
+  uint32_t getSequence(taskIndex_t taskIndex) const;
+
+  uint32_t getTimestamp(taskIndex_t taskIndex) const;
+
+  // Value count at the last update, TASK_VALUE_COUNT_UNKNOWN when not updated since boot.
+  byte     getValueCount(taskIndex_t taskIndex) const;
+
+private:
+
+  uint32_t _sequence[TASKS_MAX]   = { 0 };
+  uint32_t _timestamp[TASKS_MAX]  = { 0 };
+  byte     _valueCount[TASKS_MAX] = { 0 };
+  uint32_t _lastSequence          = 0;
+};
+
+#endif // DATASTRUCTS_TASKVALUETRACKER_H
@@ -218,6 +218,7 @@ String getMiscStatsName(int stat) {
     case WIFI_ISCONNECTED_STATS:  return F("WiFi.isConnected()");
     case WIFI_NOTCONNECTED_STATS: return F("WiFi.isConnected() (fail)");
     case LOAD_TASK_SETTINGS:      return F("LoadTaskSettings()");
+    case LOAD_TASK_SETTINGS_CACHED: return F("LoadTaskSettings() cached");
     case TRY_OPEN_FILE:           return F("TryOpenFile()");
     case FS_GC_SUCCESS:           return F("ESPEASY_FS GC success");
     case FS_GC_FAIL:              return F("ESPEASY_FS GC fail");
@@ -228,6 +229,7 @@ String getMiscStatsName(int stat) {
     case HANDLE_SCHEDULER_IDLE:   return F("handle_schedule() idle");
     case HANDLE_SCHEDULER_TASK:   return F("handle_schedule() task");
     case PARSE_TEMPLATE_PADDED:   return F("parseTemplate_padded()");
+    case PARSE_TEMPLATE_CACHED:   return F("parseTemplate_cached()");
     case PARSE_SYSVAR:            return F("parseSystemVariables()");
     case PARSE_SYSVAR_NOCHANGE:   return F("parseSystemVariables() No change");
     case HANDLE_SERVING_WEBPAGE:  return F("handle webpage");
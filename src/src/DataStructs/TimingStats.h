@@ -83,6 +83,8 @@
 # define HANDLE_SERVING_WEBPAGE  62
 # define WIFI_SCAN_ASYNC         63
 # define WIFI_SCAN_SYNC          64
+# define LOAD_TASK_SETTINGS_CACHED 65
+# define PARSE_TEMPLATE_CACHED   66
 
 
 class TimingStats {
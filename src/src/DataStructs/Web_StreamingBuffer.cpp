@@ -12,63 +12,70 @@
 
 
 
+// Initial chunk size, the actual size is adapted to the free memory and TCP send window.
 #define CHUNKED_BUFFER_SIZE          400
+#define CHUNKED_BUFFER_SIZE_MIN      256
+
+// Keep a chunk, including the chunked encoding overhead, within a single TCP segment.
+#define CHUNKED_BUFFER_SIZE_MAX      1400
 
 Web_StreamingBuffer::Web_StreamingBuffer(void) : lowMemorySkip(false),
   initialRam(0), beforeTXRam(0), duringTXRam(0), finalRam(0), maxCoreUsage(0),
-  maxServerUsage(0), sentBytes(0), flashStringCalls(0), flashStringData(0)
+  maxServerUsage(0), sentBytes(0), flashStringCalls(0), flashStringData(0),
+  timeToLastByte(0), chunkSize(CHUNKED_BUFFER_SIZE), streamStart(0)
 {
   buf.reserve(CHUNKED_BUFFER_SIZE + 50);
   buf.clear();
 }
 
-/*
-Web_StreamingBuffer Web_StreamingBuffer::operator=(String& a)                 {
-  flush(); return addString(a);
-}
-
-Web_StreamingBuffer Web_StreamingBuffer::operator=(const String& a)           {
-  flush(); return addString(a);
-}
-*/
-
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(char a)                   {
-  if (CHUNKED_BUFFER_SIZE > (this->buf.length() + 1)) {
-    this->buf += a;
-    return *this;
-  }
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(char a)                   {
+  if (lowMemorySkip) { return *this; }
+  buf += a;
+  checkFull();
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(long unsigned int a)     {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(long unsigned int a)     {
+  if (lowMemorySkip) { return *this; }
+  buf += a;
+  checkFull();
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(float a)                  {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(float a)                  {
+  if (lowMemorySkip) { return *this; }
+  buf += a;
+  checkFull();
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(int a)                    {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(int a)                    {
+  if (lowMemorySkip) { return *this; }
+  buf += a;
+  checkFull();
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(uint32_t a)               {
-  return addString(String(a));
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(uint32_t a)               {
+  if (lowMemorySkip) { return *this; }
+  buf += a;
+  checkFull();
+  return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(const String& a)          {
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(const String& a)          {
   return addString(a);
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(PGM_P str) {
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(PGM_P str) {
   return addFlashString(str);
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::operator+=(const __FlashStringHelper* str) {
+Web_StreamingBuffer& Web_StreamingBuffer::operator+=(const __FlashStringHelper* str) {
   return addFlashString((PGM_P)str);
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::addFlashString(PGM_P str) {
+Web_StreamingBuffer& Web_StreamingBuffer::addFlashString(PGM_P str) {
   ++flashStringCalls;
 
   if (!str) { return *this; // return if the pointer is void
@@ -80,54 +87,42 @@ Web_StreamingBuffer Web_StreamingBuffer::addFlashString(PGM_P str) {
   if (length == 0) { return *this; }
   flashStringData += length;
 
-  // FIXME TD-er: Not sure what happens, but streaming large flash chunks does cause allocation issues.
-  const bool stream_P = ESP.getFreeHeap() > 5000 && length < CHUNKED_BUFFER_SIZE;
-
-  if (stream_P && ((this->buf.length() + length) > CHUNKED_BUFFER_SIZE)) {
-    // Do not copy to the internal buffer, but stream immediately.
+  if ((this->buf.length() + length) > chunkSize) {
     flush();
-    web_server.sendContent_P(str);
+  }
+
+  if (length < chunkSize) {
+    this->buf += (const __FlashStringHelper *)str;
+    checkFull();
   } else {
-    // Copy to internal buffer and send in chunks
-    unsigned int pos          = 0;
-    int flush_step = CHUNKED_BUFFER_SIZE - this->buf.length();
-
-    if (flush_step < 1) { flush_step = 0; }
-
-    while (pos < length) {
-      if (flush_step == 0) {
-        sendContentBlocking(this->buf);
-        flush_step = CHUNKED_BUFFER_SIZE;
-      }
-      this->buf += (char)pgm_read_byte(&str[pos]);
-      ++pos;
-      --flush_step;
+    // Stream straight from PROGMEM, in chunks to keep the memory used for sending low.
+    unsigned int pos = 0;
+
+    while (pos < length && !lowMemorySkip) {
+      const unsigned int chunkLength = std::min(length - pos, chunkSize);
+      sendContentDirect_P(str + pos, chunkLength);
+      pos += chunkLength;
     }
-    checkFull();
   }
   return *this;
 }
 
-Web_StreamingBuffer Web_StreamingBuffer::addString(const String& a) {
+Web_StreamingBuffer& Web_StreamingBuffer::addString(const String& a) {
   if (lowMemorySkip) { return *this; }
-  int flush_step = CHUNKED_BUFFER_SIZE - this->buf.length();
-
-  if (flush_step < 1) { flush_step = 0; }
-  int pos          = 0;
-  const int length = a.length();
-
-  while (pos < length) {
-    if (flush_step == 0) {
-      if (this->buf.length() > 0) {
-        sendContentBlocking(this->buf);
-      }
-      flush_step = CHUNKED_BUFFER_SIZE;
-    }
-    this->buf += a[pos];
-    ++pos;
-    --flush_step;
+  const unsigned int length = a.length();
+
+  if (length == 0) { return *this; }
+
+  if ((this->buf.length() + length) > chunkSize) {
+    flush();
+  }
+
+  if (length < chunkSize) {
+    this->buf += a;
+    checkFull();
+  } else {
+    sendContentDirect(a);
   }
-  checkFull();
   return *this;
 }
 
@@ -144,7 +139,7 @@ void Web_StreamingBuffer::flush() {
 void Web_StreamingBuffer::checkFull() {
   if (lowMemorySkip) { this->buf.clear(); }
 
-  if (this->buf.length() >= CHUNKED_BUFFER_SIZE) {
+  if (this->buf.length() >= chunkSize) {
     trackTotalMem();
     sendContentBlocking(this->buf);
   }
@@ -163,13 +158,16 @@ void Web_StreamingBuffer::startJsonStream() {
 }
 
 void Web_StreamingBuffer::startStream(bool json, const String& origin) {
-  maxCoreUsage = maxServerUsage = 0;
-  initialRam   = ESP.getFreeHeap();
-  beforeTXRam  = initialRam;
-  sentBytes    = 0;
+  maxCoreUsage   = maxServerUsage = 0;
+  initialRam     = ESP.getFreeHeap();
+  beforeTXRam    = initialRam;
+  sentBytes      = 0;
+  timeToLastByte = 0;
+  streamStart    = millis();
   buf.clear();
-  buf.reserve(CHUNKED_BUFFER_SIZE);
-  
+  updateChunkSize();
+  buf.reserve(chunkSize);
+
   if (beforeTXRam < 3000) {
     lowMemorySkip = true;
     web_server.send(200, "text/plain", "Low memory. Cannot display webpage :-(");
@@ -190,6 +188,25 @@ void Web_StreamingBuffer::trackTotalMem() {
   }
 }
 
+void Web_StreamingBuffer::updateChunkSize() {
+  // Larger chunks mean less overhead per chunk, but need more memory.
+  uint32_t newSize = ESP.getFreeHeap() / 16;
+
+  #ifdef ESP8266
+  // No need to buffer more than the TCP stack can accept without waiting for an ACK.
+  const int sendWindow = web_server.client().availableForWrite();
+
+  if ((sendWindow > 0) && (newSize > static_cast<uint32_t>(sendWindow))) {
+    newSize = sendWindow;
+  }
+  #endif // ifdef ESP8266
+
+  if (newSize < CHUNKED_BUFFER_SIZE_MIN) { newSize = CHUNKED_BUFFER_SIZE_MIN; }
+
+  if (newSize > CHUNKED_BUFFER_SIZE_MAX) { newSize = CHUNKED_BUFFER_SIZE_MAX; }
+  chunkSize = newSize;
+}
+
 void Web_StreamingBuffer::trackCoreMem() {
   duringTXRam = ESP.getFreeHeap();
 
@@ -209,17 +226,28 @@ void Web_StreamingBuffer::endStream() {
     #ifdef ESP32
     web_server.client().flush();
     #endif
-    finalRam = ESP.getFreeHeap();
-
-    /*
-        if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-        String log = String("Ram usage: Webserver only: ") + maxServerUsage +
-                    " including Core: " + maxCoreUsage +
-                    " flashStringCalls: " + flashStringCalls +
-                    " flashStringData: " + flashStringData;
-        addLog(LOG_LEVEL_DEBUG, log);
-        }
-      */
+    finalRam       = ESP.getFreeHeap();
+    timeToLastByte = timePassedSince(streamStart);
+
+    #ifndef BUILD_NO_DEBUG
+    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+      String log = F("WEB  : ");
+      log += web_server.uri();
+      log += F(" sent: ");
+      log += sentBytes;
+      log += F(" bytes in ");
+      log += timeToLastByte;
+      log += F(" ms, RAM usage: Webserver only: ");
+      log += maxServerUsage;
+      log += F(" including Core: ");
+      log += maxCoreUsage;
+      log += F(" flashStringCalls: ");
+      log += flashStringCalls;
+      log += F(" flashStringData: ");
+      log += flashStringData;
+      addLog(LOG_LEVEL_DEBUG, log);
+    }
+    #endif // ifndef BUILD_NO_DEBUG
   } else {
     addLog(LOG_LEVEL_ERROR, String("Webpage skipped: low memory: ") + finalRam);
     lowMemorySkip = false;
@@ -263,8 +291,9 @@ void Web_StreamingBuffer::sendContentBlocking(String& data) {
   web_server.sendContent(data);
 
   data.clear();
+  updateChunkSize();
   const uint32_t beginWait = millis();
-  while ((!data.reserve(CHUNKED_BUFFER_SIZE) || (ESP.getFreeHeap() < 4000 /*freeBeforeSend*/ )) &&
+  while ((!data.reserve(chunkSize) || (ESP.getFreeHeap() < 4000 /*freeBeforeSend*/ )) &&
          !timeOutReached(beginWait + timeout)) {
     if (ESP.getFreeHeap() < duringTXRam) {
       duringTXRam = ESP.getFreeHeap();
@@ -282,6 +311,39 @@ void Web_StreamingBuffer::sendContentBlocking(String& data) {
   delay(0);
 }
 
+void Web_StreamingBuffer::sendContentDirect(const String& data) {
+  const uint32_t length = data.length();
+
+  trackTotalMem();
+#if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
+  web_server.sendContent(formatToHex(length) + "\r\n");
+  web_server.sendContent(data);
+  web_server.sendContent("\r\n");
+#else // if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
+  web_server.sendContent(data);
+#endif // if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
+  afterContentSent(length);
+}
+
+void Web_StreamingBuffer::sendContentDirect_P(PGM_P data, size_t length) {
+  trackTotalMem();
+#if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
+  web_server.sendContent(formatToHex(length) + "\r\n");
+  web_server.sendContent_P(data, length);
+  web_server.sendContent("\r\n");
+#else // if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
+  web_server.sendContent_P(data, length);
+#endif // if defined(ESP8266) && defined(ARDUINO_ESP8266_RELEASE_2_3_0)
+  afterContentSent(length);
+}
+
+void Web_StreamingBuffer::afterContentSent(size_t length) {
+  trackCoreMem();
+  sentBytes += length;
+  updateChunkSize();
+  delay(0);
+}
+
 void Web_StreamingBuffer::sendHeaderBlocking(bool json, const String& origin) {
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("sendHeaderBlocking"));
@@ -27,28 +27,34 @@ public:
   uint32_t flashStringCalls;
   uint32_t flashStringData;
 
+  // Time in msec from start of the stream until the last byte was sent.
+  uint32_t timeToLastByte;
+
 private:
 
   String buf;
 
+  // Buffer size at which the buffer is sent, adapted to the free memory and TCP send window.
+  unsigned int chunkSize;
+
+  unsigned long streamStart;
+
 public:
 
   Web_StreamingBuffer(void);
 
-//  Web_StreamingBuffer operator=(String& a);
-//  Web_StreamingBuffer operator=(const String& a);
-  Web_StreamingBuffer operator+=(char a);
-  Web_StreamingBuffer operator+=(long unsigned int a);
-  Web_StreamingBuffer operator+=(float a);
-  Web_StreamingBuffer operator+=(int a);
-  Web_StreamingBuffer operator+=(uint32_t a);
-  Web_StreamingBuffer operator+=(const String& a);
-  Web_StreamingBuffer operator+=(PGM_P str);
-  Web_StreamingBuffer operator+=(const __FlashStringHelper* str);
-
-//private:
-  Web_StreamingBuffer addFlashString(PGM_P str);
-  Web_StreamingBuffer addString(const String& a);
+  Web_StreamingBuffer& operator+=(char a);
+  Web_StreamingBuffer& operator+=(long unsigned int a);
+  Web_StreamingBuffer& operator+=(float a);
+  Web_StreamingBuffer& operator+=(int a);
+  Web_StreamingBuffer& operator+=(uint32_t a);
+  Web_StreamingBuffer& operator+=(const String& a);
+  Web_StreamingBuffer& operator+=(PGM_P str);
+  Web_StreamingBuffer& operator+=(const __FlashStringHelper* str);
+
+  // Strings which do not fit in the buffer are sent directly, without copying.
+  Web_StreamingBuffer& addFlashString(PGM_P str);
+  Web_StreamingBuffer& addString(const String& a);
 
 public:
   void flush();
@@ -67,6 +73,8 @@ private:
 
   void trackTotalMem();
 
+  void updateChunkSize();
+
 public:
 
   void trackCoreMem();
@@ -76,6 +84,13 @@ public:
 private: 
 
   void sendContentBlocking(String& data);
+
+  // Send data which is not part of the buffer, the buffer must be flushed first.
+  void sendContentDirect(const String& data);
+  void sendContentDirect_P(PGM_P        data,
+                           size_t       length);
+
+  void afterContentSent(size_t length);
   void sendHeaderBlocking(bool          json,
                           const String& origin = "");
 
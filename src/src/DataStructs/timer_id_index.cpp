@@ -0,0 +1,134 @@
+#include "timer_id_index.h"
+
+
+bool timer_id_index::find(unsigned long id, uint16_t& value) const {
+  const int pos = findPos(id);
+
+  if (pos < 0) {
+    return false;
+  }
+  value = _table[pos].value;
+  return true;
+}
+
+void timer_id_index::set(unsigned long id, uint16_t value) {
+  const int pos = findPos(id);
+
+  if (pos >= 0) {
+    _table[pos].value = value;
+    return;
+  }
+
+  // Keep the load factor below 50% to keep the probe sequences short.
+  if (((_count + 1) * 2) > _table.size()) {
+    rehash(_table.empty() ? 16 : _table.size() * 2);
+  }
+  const size_t mask = _table.size() - 1;
+  size_t i          = bucket(id);
+
+  while (_table[i].used) {
+    i = (i + 1) & mask;
+  }
+  _table[i].id    = id;
+  _table[i].value = value;
+  _table[i].used  = true;
+  ++_count;
+}
+
+bool timer_id_index::erase(unsigned long id) {
+  int pos = findPos(id);
+
+  if (pos < 0) {
+    return false;
+  }
+
+  // Backward shift deletion, so no 'deleted' markers are needed.
+  const size_t mask = _table.size() - 1;
+  size_t i          = pos;
+  size_t j          = pos;
+
+  while (true) {
+    j = (j + 1) & mask;
+
+    if (!_table[j].used) {
+      break;
+    }
+    const size_t k = bucket(_table[j].id);
+
+    // Entry at j can stay when its bucket lies cyclically in (i, j]
+    const bool canStay = (i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j));
+
+    if (!canStay) {
+      _table[i] = _table[j];
+      i         = j;
+    }
+  }
+  _table[i].used = false;
+  --_count;
+  return true;
+}
+
+void timer_id_index::clear() {
+  _table.clear();
+  _count = 0;
+}
+
+void timer_id_index::reserve(size_t nrElements) {
+  size_t tableSize = 16;
+
+  while (tableSize < (nrElements * 2)) {
+    tableSize *= 2;
+  }
+
+  if (tableSize > _table.size()) {
+    rehash(tableSize);
+  }
+}
+
+size_t timer_id_index::size() const {
+  return _count;
+}
+
+size_t timer_id_index::getMemoryUsage() const {
+  return _table.capacity() * sizeof(Entry);
+}
+
+size_t timer_id_index::bucket(unsigned long id) const {
+  // Mix the bits, as the timer type is stored in the upper bits of a mixed ID.
+  uint32_t h = id;
+
+  h ^= h >> 16;
+  h *= 0x45d9f3bu;
+  h ^= h >> 16;
+  return h & (_table.size() - 1);
+}
+
+int timer_id_index::findPos(unsigned long id) const {
+  if (_count == 0) {
+    return -1;
+  }
+  const size_t mask = _table.size() - 1;
+  size_t i          = bucket(id);
+
+  while (_table[i].used) {
+    if (_table[i].id == id) {
+      return i;
+    }
+    i = (i + 1) & mask;
+  }
+  return -1;
+}
+
+void timer_id_index::rehash(size_t tableSize) {
+  std::vector<Entry> old;
+
+  old.swap(_table);
+  _table.resize(tableSize, Entry { 0, 0, false });
+  _count = 0;
+
+  for (auto it = old.begin(); it != old.end(); ++it) {
+    if (it->used) {
+      set(it->id, it->value);
+    }
+  }
+}
@@ -0,0 +1,54 @@
+#ifndef DATASTRUCTS_TIMER_ID_INDEX_H
+#define DATASTRUCTS_TIMER_ID_INDEX_H
+
+#include <Arduino.h>
+#include <vector>
+
+
+/*********************************************************************************************\
+* Index to look up a timer ID, used by the Scheduler
+* Open addressing hash table, mapping a (mixed) timer ID to a 16 bit value (e.g. a position).
+* Entries are stored in a single vector, so adding an ID does not allocate memory,
+* unless the table needs to grow.
+\*********************************************************************************************/
+struct timer_id_index {
+  // Return false when the id is not present
+  bool   find(unsigned long id,
+              uint16_t    & value) const;
+
+  // Add the id, or update its value when already present
+  void   set(unsigned long id,
+             uint16_t      value);
+
+  // Return false when the id was not present
+  bool   erase(unsigned long id);
+
+  void   clear();
+
+  void   reserve(size_t nrElements);
+
+  size_t size() const;
+
+  size_t getMemoryUsage() const;
+
+private:
+
+  struct Entry {
+    unsigned long id;
+    uint16_t      value;
+    bool          used;
+  };
+
+  size_t bucket(unsigned long id) const;
+
+  // Return the position of the id in the table, or -1 when not present
+  int    findPos(unsigned long id) const;
+
+  void   rehash(size_t tableSize);
+
+  std::vector<Entry>_table;
+  size_t _count = 0;
+};
+
+
+#endif // DATASTRUCTS_TIMER_ID_INDEX_H
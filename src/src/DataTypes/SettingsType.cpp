@@ -200,6 +200,18 @@ SettingsType::SettingsFileEnum SettingsType::getSettingsFile(Enum settingsType)
   return SettingsFileEnum::FILE_UNKNOWN_type;
 }
 
+bool SettingsType::useWriteBehind(Enum settingsType)
+{
+  switch (settingsType) {
+    case Enum::TaskSettings_Type:
+    case Enum::CustomTaskSettings_Type:
+      return true;
+    default:
+      break;
+  }
+  return false;
+}
+
 String SettingsType::getSettingsFileName(Enum settingsType) {
   return getSettingsFileName(getSettingsFile(settingsType));
 }
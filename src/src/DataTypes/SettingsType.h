@@ -47,6 +47,9 @@ public:
 #endif // ifndef BUILD_MINIMAL_OTA
 
   static SettingsFileEnum getSettingsFile(Enum settingsType);
+
+  // Saves of these settings may be kept in memory for a short while to combine them with other saves.
+  static bool             useWriteBehind(Enum settingsType);
   static String           getSettingsFileName(Enum settingsType);
   static String           getSettingsFileName(SettingsType::SettingsFileEnum file_type);
   static size_t           getInitFileSize(SettingsType::SettingsFileEnum file_type);
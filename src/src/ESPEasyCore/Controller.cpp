@@ -19,9 +19,11 @@
 #include "../Globals/Device.h"
 #include "../Globals/ESPEasyWiFiEvent.h"
 #include "../Globals/ESPEasy_Scheduler.h"
+#include "../Globals/ESPEasy_time.h"
 #include "../Globals/MQTT.h"
 #include "../Globals/Plugins.h"
 #include "../Globals/Protocol.h"
+#include "../Globals/RuntimeData.h"
 
 #include "../Helpers/_CPlugin_Helper.h"
 #include "../Helpers/Misc.h"
@@ -29,6 +31,7 @@
 #include "../Helpers/PeriodicalActions.h"
 #include "../Helpers/PortStatus.h"
 #include "../Helpers/Rules_calculate.h"
+#include "../WebServer/ServerSentEvents.h"
 
 
 #define PLUGIN_ID_MQTT_IMPORT         37
@@ -44,6 +47,12 @@ void sendData(struct EventStruct *event)
   #endif // ifndef BUILD_NO_RAM_TRACKER
   LoadTaskSettings(event->TaskIndex);
 
+  taskValueTracker.markUpdated(event->TaskIndex, node_time.getUnixTime(), getValueCountForTask(event->TaskIndex));
+
+  #ifdef WEBSERVER_EVENTS
+  events_sendTaskValues(event);
+  #endif // ifdef WEBSERVER_EVENTS
+
   if (Settings.UseRules) {
     createRuleEvents(event);
   }
@@ -72,9 +81,7 @@ void sendData(struct EventStruct *event)
 #ifndef BUILD_NO_DEBUG
       else {
         if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-          String log = F("Invalid value detected for controller ");
-          log += getCPluginNameFromProtocolIndex(ProtocolIndex);
-          addLog(LOG_LEVEL_DEBUG, log);
+          addLogFmt(LOG_LEVEL_DEBUG, F("Invalid value detected for controller %s"), getCPluginNameFromProtocolIndex(ProtocolIndex));
         }
       }
 #endif // ifndef BUILD_NO_DEBUG
@@ -137,20 +144,17 @@ void incoming_mqtt_callback(char *c_topic, byte *b_payload, unsigned int length)
     CPlugin::Function::CPLUGIN_PROTOCOL_RECV,
     c_topic, b_payload, length);
 
+#ifdef USES_P037
   deviceIndex_t DeviceIndex = getDeviceIndex(PLUGIN_ID_MQTT_IMPORT); // Check if P037_MQTTimport is present in the build
 
-  if (validDeviceIndex(DeviceIndex)) {
-    //  Here we loop over all tasks and call each 037 plugin with function PLUGIN_MQTT_IMPORT
-    for (taskIndex_t taskIndex = 0; taskIndex < TASKS_MAX; taskIndex++)
-    {
-      if (Settings.TaskDeviceEnabled[taskIndex] && (Settings.TaskDeviceNumber[taskIndex] == PLUGIN_ID_MQTT_IMPORT))
-      {
-        Scheduler.schedule_mqtt_plugin_import_event_timer(
-          DeviceIndex, taskIndex, PLUGIN_MQTT_IMPORT,
-          c_topic, b_payload, length);
-      }
-    }
+  // Only schedule the message when it matches a subscription of any MQTT import task.
+  // A single event is scheduled, which is handled for all subscribed task values at once.
+  if (validDeviceIndex(DeviceIndex) && P037_MQTTImport_subscriptions.matches(c_topic)) {
+    Scheduler.schedule_mqtt_plugin_import_event_timer(
+      DeviceIndex, INVALID_TASK_INDEX, PLUGIN_MQTT_IMPORT,
+      c_topic, b_payload, length);
   }
+#endif // ifdef USES_P037
 }
 
 /*********************************************************************************************\
@@ -482,10 +486,10 @@ bool MQTT_queueFull(controllerIndex_t controller_idx) {
 
   dummy_element.controller_idx = controller_idx;
 
-  if (MQTTDelayHandler->queueFull(dummy_element)) {
+  if (!MQTTDelayHandler->canAdd(dummy_element)) {
     // The queue is full, try to make some room first.
     processMQTTdelayQueue();
-    return MQTTDelayHandler->queueFull(dummy_element);
+    return !MQTTDelayHandler->canAdd(dummy_element);
   }
   return false;
 }
@@ -554,7 +558,10 @@ void MQTTStatus(struct EventStruct *event, const String& status)
     pubname.replace(F("/#"), F("/status"));
 
     parseSingleControllerVariable(pubname, event, 0, false);
-    parseControllerVariables(pubname, event, false);
+
+    // Not the same template as used to publish the task values, so keep it apart.
+    const uint8_t templateNr = 1;
+    parseControllerVariables(pubname, event, false, templateNr);
 
 
     if (!pubname.endsWith(F("/status"))) {
@@ -629,12 +636,13 @@ void SensorSendTask(taskIndex_t TaskIndex)
         {
           if (ExtraTaskSettings.TaskDeviceFormula[varNr][0] != 0)
           {
-            String formula = ExtraTaskSettings.TaskDeviceFormula[varNr];
-            formula.replace(F("%pvalue%"), String(preValue[varNr]));
-            formula.replace(F("%value%"),  String(UserVar[TempEvent.BaseVarIndex + varNr]));
             double result = 0;
 
-            if (!isError(Calculate(formula, result))) {
+            if (!isError(CalculateFormula(TaskIndex, varNr,
+                                          ExtraTaskSettings.TaskDeviceFormula[varNr],
+                                          UserVar[TempEvent.BaseVarIndex + varNr],
+                                          preValue[varNr],
+                                          result))) {
               UserVar[TempEvent.BaseVarIndex + varNr] = result;
             }
           }
@@ -10,6 +10,7 @@
 #include "../Globals/ExtraTaskSettings.h"
 #include "../Globals/Plugins.h"
 #include "../Globals/Plugins_other.h"
+#include "../Globals/RulesIndex.h"
 #include "../Globals/Settings.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/ESPEasy_time_calc.h"
@@ -59,6 +60,9 @@ String FileNameToEvent(const String& fileName) {
 }
 
 void checkRuleSets() {
+  // Rules files may have been changed, so make sure they will be indexed again.
+  rulesIndex.invalidate();
+
   for (byte x = 0; x < RULESETS_MAX; x++) {
 #if defined(ESP8266)
     String fileName = F("rules");
@@ -121,16 +125,27 @@ void rulesProcessing(const String& event) {
   unsigned long timer = millis();
 #endif // ifndef BUILD_NO_DEBUG
 
-  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-    String log = F("EVENT: ");
-    log += event;
-    addLog(LOG_LEVEL_INFO, log);
-  }
+  addLogFmt(LOG_LEVEL_INFO, F("EVENT: %s"), event);
+
+  rulesProcessingActiveFiles(event, true);
 
+#ifndef BUILD_NO_DEBUG
+
+  addLogFmt(LOG_LEVEL_DEBUG, F("EVENT: %s Processing time:%d milliSeconds"), event, timePassedSince(timer));
+#endif // ifndef BUILD_NO_DEBUG
+  STOP_TIMER(RULES_PROCESSING);
+  backgroundtasks();
+}
+
+void rulesProcessingActiveFiles(const String& event, bool useRulesIndex) {
   if (Settings.OldRulesEngine()) {
     for (byte x = 0; x < RULESETS_MAX; x++) {
       if (activeRuleSets[x]) {
-        rulesProcessingFile(getRulesFileName(x), event);
+        if (useRulesIndex) {
+          rulesProcessingIndexed(getRulesFileName(x), event);
+        } else {
+          rulesProcessingFile(getRulesFileName(x), event);
+        }
       }
     }
   } else {
@@ -139,31 +154,19 @@ void rulesProcessing(const String& event) {
 
     // if exists processed the rule file
     if (fileExists(fileName)) {
-      rulesProcessingFile(fileName, event);
+      if (useRulesIndex) {
+        rulesProcessingIndexed(fileName, event);
+      } else {
+        rulesProcessingFile(fileName, event);
+      }
     }
 # ifndef BUILD_NO_DEBUG
     else {
-      addLog(LOG_LEVEL_DEBUG, String(F("EVENT: ")) + event +
-             F(" is ingnored. File ") + fileName +
-             F(" not found."));
+      addLogFmt(LOG_LEVEL_DEBUG, F("EVENT: %s is ingnored. File %s not found."), event, fileName);
     }
 # endif    // ifndef BUILD_NO_DEBUG
     #endif // WEBSERVER_NEW_RULES
   }
-
-#ifndef BUILD_NO_DEBUG
-
-  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-    String log = F("EVENT: ");
-    log += event;
-    log += F(" Processing time:");
-    log += timePassedSince(timer);
-    log += F(" milliSeconds");
-    addLog(LOG_LEVEL_DEBUG, log);
-  }
-#endif // ifndef BUILD_NO_DEBUG
-  STOP_TIMER(RULES_PROCESSING);
-  backgroundtasks();
 }
 
 /********************************************************************************************\
@@ -220,89 +223,315 @@ String rulesProcessingFile(const String& fileName, const String& event) {
     int len = f.read(&buf[0], RULES_BUFFER_SIZE);
 
     for (int x = 0; x < len; x++) {
-      int data = buf[x];
+      if (rules_append_character(line, static_cast<char>(buf[x]), firstNonSpaceRead, commentFound)) {
+        // Line end, parse rule
+        line.trim();
+        check_rules_line_user_errors(line);
+        const size_t lineLength = line.length();
+
+        if (lineLength > longestLineSize) {
+          longestLineSize = lineLength;
+        }
 
-      switch (static_cast<char>(data))
-      {
-        case '\n':
-        {
-          // Line end, parse rule
-          line.trim();
-          check_rules_line_user_errors(line);
-          const size_t lineLength = line.length();
-
-          if (lineLength > longestLineSize) {
-            longestLineSize = lineLength;
+        if ((lineLength > 0) && !line.startsWith(F("//"))) {
+          // Parse the line and extract the action (if there is any)
+          String action;
+          parseCompleteNonCommentLine(line, event, action, match, codeBlock,
+                                      isCommand, condition, ifBranche, ifBlock,
+                                      fakeIfBlock);
+
+          if (match) // rule matched for one action or a block of actions
+          {
+            processMatchedRule(action, event, match, codeBlock,
+                               isCommand, condition, ifBranche, ifBlock, fakeIfBlock);
           }
 
-          if ((lineLength > 0) && !line.startsWith(F("//"))) {
-            // Parse the line and extract the action (if there is any)
-            String action;
-            parseCompleteNonCommentLine(line, event, action, match, codeBlock,
-                                        isCommand, condition, ifBranche, ifBlock,
-                                        fakeIfBlock);
-
-            if (match) // rule matched for one action or a block of actions
-            {
-              processMatchedRule(action, event, match, codeBlock,
-                                 isCommand, condition, ifBranche, ifBlock, fakeIfBlock);
+          backgroundtasks();
+        }
+
+        // Prepare for new line
+        line = EMPTY_STRING;
+        line.reserve(longestLineSize);
+        firstNonSpaceRead = false;
+        commentFound      = false;
+      }
+    }
+  }
+
+  if (f) {
+    f.close();
+  }
+
+  nestingLevel--;
+  #ifndef BUILD_NO_RAM_TRACKER
+  checkRAM(F("rulesProcessingFile2"));
+  #endif // ifndef BUILD_NO_RAM_TRACKER
+  return EMPTY_STRING;
+}
+
+/********************************************************************************************\
+   Get the argument of a compiled rules line, with %eventvalue% and other markup replaced
+ \*********************************************************************************************/
+static void getCompiledRulesText(const RulesFileIndexStruct& fileIndex,
+                                 const RulesLineStruct     & line,
+                                 const String              & event,
+                                 String                    & text)
+{
+  text = fileIndex.getText(line);
+
+  if (line.hasMarkup) {
+    substitute_eventvalue(text, event);
+    text = parseTemplate(text);
+  }
+}
+
+static bool compiledRulesConditionMatch(const RulesFileIndexStruct& fileIndex,
+                                        const RulesLineStruct     & line,
+                                        const String              & event,
+                                        byte                        ifBlock)
+{
+  String check;
+
+  getCompiledRulesText(fileIndex, line, event, check);
+  check.toLowerCase();
+  check.trim();
+  const bool res = conditionMatchExtended(check);
+
+#ifndef BUILD_NO_DEBUG
+  addLogFmt(LOG_LEVEL_DEBUG, F("Lev.%u: [%s %s]=%s"),
+            ifBlock,
+            line.type == RulesLineType::ElseIf ? F("elseif") : F("if"),
+            check,
+            boolToString(res));
+#endif // ifndef BUILD_NO_DEBUG
+  return res;
+}
+
+/********************************************************************************************\
+   Run the compiled lines of a matching rules block
+   Same logic as processMatchedRule(), but on lines classified when loading the rules file.
+   So only conditions which are evaluated and actions which are executed need to be parsed.
+ \*********************************************************************************************/
+static void processCompiledRulesBlock(const RulesFileIndexStruct& fileIndex,
+                                      uint16_t                    lineNr,
+                                      uint16_t                    endLine,
+                                      const String              & event,
+                                      bool                        condition[],
+                                      bool                        ifBranche[])
+{
+  byte ifBlock     = 0;
+  byte fakeIfBlock = 0;
+
+  for (; lineNr < endLine; ++lineNr) {
+    const RulesLineStruct& line = fileIndex.lines[lineNr];
+
+    if (line.type == RulesLineType::EndOn) {
+      break;
+    }
+
+    bool isCommand = true;
+
+    if (fakeIfBlock) {
+      isCommand = false;
+    }
+    else if (ifBlock) {
+      if (condition[ifBlock - 1] != ifBranche[ifBlock - 1]) {
+        isCommand = false;
+      }
+    }
+
+    switch (line.type) {
+      case RulesLineType::ElseIf:
+
+        if (ifBlock && !fakeIfBlock) {
+          if (ifBranche[ifBlock - 1]) {
+            if (condition[ifBlock - 1]) {
+              ifBranche[ifBlock - 1] = false;
+            } else {
+              condition[ifBlock - 1] = compiledRulesConditionMatch(fileIndex, line, event, ifBlock);
             }
+          }
+        }
+        break;
+      case RulesLineType::If:
 
-            backgroundtasks();
+        if (ifBlock < RULES_IF_MAX_NESTING_LEVEL) {
+          if (isCommand) {
+            ifBlock++;
+            condition[ifBlock - 1] = compiledRulesConditionMatch(fileIndex, line, event, ifBlock);
+            ifBranche[ifBlock - 1] = true;
+          } else {
+            fakeIfBlock++;
           }
+        } else {
+          fakeIfBlock++;
+          addLogFmt(LOG_LEVEL_ERROR, F("Lev.%u: Error: IF Nesting level exceeded!"), ifBlock);
+        }
+        break;
+      case RulesLineType::Else:
 
-          // Prepare for new line
-          line = EMPTY_STRING;
-          line.reserve(longestLineSize);
-          firstNonSpaceRead = false;
-          commentFound      = false;
-          break;
+        if (ifBlock && !fakeIfBlock) {
+          ifBranche[ifBlock - 1] = false;
+#ifndef BUILD_NO_DEBUG
+          addLogFmt(LOG_LEVEL_DEBUG, F("Lev.%u: [else]=%s"), ifBlock, boolToString(condition[ifBlock - 1] == ifBranche[ifBlock - 1]));
+#endif // ifndef BUILD_NO_DEBUG
         }
-        case '\r': // Just skip this character
-          break;
-        case '\t': // tab
-        case ' ':  // space
-        {
-          // Strip leading spaces.
-          if (firstNonSpaceRead) {
-            line += ' ';
-          }
-          break;
+        break;
+      case RulesLineType::EndIf:
+
+        if (fakeIfBlock) {
+          fakeIfBlock--;
         }
-        case '/':
-        {
-          if (!commentFound) {
-            line += '/';
-
-            if (line.endsWith(F("//"))) {
-              // consider the rest of the line a comment
-              commentFound = true;
-            }
-          }
-          break;
+        else if (ifBlock) {
+          ifBlock--;
         }
-        default: // Any other character
-        {
-          firstNonSpaceRead = true;
+        break;
+      default:
 
-          if (!commentFound) {
-            line += char(data);
+        if (isCommand) {
+          if (line.hasMarkup) {
+            String action;
+            getCompiledRulesText(fileIndex, line, event, action);
+            addLogFmt(LOG_LEVEL_INFO, F("ACT  : %s"), action);
+            ExecuteCommand_all(EventValueSource::Enum::VALUE_SOURCE_RULES, action.c_str());
+          } else {
+            // Nothing to parse, so the command can be used as stored.
+            const char *action = fileIndex.getText(line);
+            addLogFmt(LOG_LEVEL_INFO, F("ACT  : %s"), action);
+            ExecuteCommand_all(EventValueSource::Enum::VALUE_SOURCE_RULES, action);
           }
-          break;
+          delay(0);
         }
-      }
+        break;
     }
+    backgroundtasks();
   }
+}
 
-  if (f) {
-    f.close();
+/********************************************************************************************\
+   Rules processing using the index of the rules file
+ \*********************************************************************************************/
+void rulesProcessingIndexed(const String& fileName, const String& event) {
+  RulesFileIndexStruct *fileIndex = rulesIndex.getFileIndex(fileName);
+
+  if (fileIndex == nullptr) {
+    // Could not index the rules (e.g. low on memory), so parse the file itself.
+    rulesProcessingFile(fileName, event);
+    return;
+  }
+
+  // Only the blocks with a trigger on the same event name need to be checked.
+  const RulesEventKey key(event);
+  const uint16_t nrBlocks = fileIndex->blocks.size();
+  uint16_t blockNr        = fileIndex->nextCandidateBlock(key, 0);
+
+  if (blockNr >= nrBlocks) {
+    return;
+  }
+  #ifndef BUILD_NO_RAM_TRACKER
+  checkRAM(F("rulesProcessingIndexed"));
+  #endif // ifndef BUILD_NO_RAM_TRACKER
+
+  static byte nestingLevel = 0;
+
+  if (nestingLevel >= RULES_MAX_NESTING_LEVEL) {
+    addLog(LOG_LEVEL_ERROR, F("EVENT: Error: Nesting level exceeded!"));
+    return;
+  }
+  nestingLevel++;
+  rulesIndex.beginUse();
+
+  bool condition[RULES_IF_MAX_NESTING_LEVEL];
+  bool ifBranche[RULES_IF_MAX_NESTING_LEVEL];
+
+  for (; blockNr < nrBlocks; blockNr = fileIndex->nextCandidateBlock(key, blockNr + 1)) {
+    const RulesBlockStruct& block = fileIndex->blocks[blockNr];
+
+    if (fileIndex->canSkipBlock(block, event)) {
+      continue;
+    }
+
+    if (block.dynamicTrigger) {
+      // The trigger depends on markup, so the "on" line must be parsed to see if it matches.
+      bool   match       = false;
+      bool   codeBlock   = false;
+      bool   isCommand   = false;
+      byte   ifBlock     = 0;
+      byte   fakeIfBlock = 0;
+      String line(fileIndex->getText(fileIndex->lines[block.firstLine]));
+      String action;
+      parseCompleteNonCommentLine(line, event, action, match, codeBlock,
+                                  isCommand, condition, ifBranche, ifBlock,
+                                  fakeIfBlock);
+
+      if (match && !codeBlock) {
+        // Single line "on ... do action", the action was split from the parsed line.
+        processMatchedRule(action, event, match, codeBlock,
+                           isCommand, condition, ifBranche, ifBlock, fakeIfBlock);
+      }
+      backgroundtasks();
+
+      if (!match || !codeBlock) {
+        continue;
+      }
+    }
+
+    // Run the lines following the "on" line.
+    processCompiledRulesBlock(*fileIndex, block.firstLine + 1, block.firstLine + block.nrLines,
+                              event, condition, ifBranche);
   }
 
+  rulesIndex.endUse();
   nestingLevel--;
   #ifndef BUILD_NO_RAM_TRACKER
-  checkRAM(F("rulesProcessingFile2"));
+  checkRAM(F("rulesProcessingIndexed2"));
   #endif // ifndef BUILD_NO_RAM_TRACKER
-  return EMPTY_STRING;
+}
+
+/********************************************************************************************\
+   Read rules line character by character
+   Return true when the end of the line was read.
+ \*********************************************************************************************/
+bool rules_append_character(String& line, char c, bool& firstNonSpaceRead, bool& commentFound)
+{
+  switch (c)
+  {
+    case '\n':
+      return true;
+    case '\r': // Just skip this character
+      break;
+    case '\t': // tab
+    case ' ':  // space
+    {
+      // Strip leading spaces.
+      if (firstNonSpaceRead) {
+        line += ' ';
+      }
+      break;
+    }
+    case '/':
+    {
+      if (!commentFound) {
+        line += '/';
+
+        if (line.endsWith(F("//"))) {
+          // consider the rest of the line a comment
+          commentFound = true;
+        }
+      }
+      break;
+    }
+    default: // Any other character
+    {
+      firstNonSpaceRead = true;
+
+      if (!commentFound) {
+        line += c;
+      }
+      break;
+    }
+  }
+  return false;
 }
 
 /********************************************************************************************\
@@ -789,15 +1018,11 @@ void parseCompleteNonCommentLine(String& line, const String& event,
 
 #ifndef BUILD_NO_DEBUG
 
-  if (loglevelActiveFor(LOG_LEVEL_DEBUG_DEV)) {
-    String log = F("RuleDebug: ");
-    log += codeBlock ? 0 : 1;
-    log += match ? 0 : 1;
-    log += isCommand ? 0 : 1;
-    log += ": ";
-    log += line;
-    addLog(LOG_LEVEL_DEBUG_DEV, log);
-  }
+  addLogFmt(LOG_LEVEL_DEBUG_DEV, F("RuleDebug: %d%d%d: %s"),
+            codeBlock ? 0 : 1,
+            match ? 0 : 1,
+            isCommand ? 0 : 1,
+            line);
 #endif // ifndef BUILD_NO_DEBUG
 }
 
@@ -835,15 +1060,7 @@ void processMatchedRule(String& action, const String& event,
           condition[ifBlock - 1] = conditionMatchExtended(check);
 #ifndef BUILD_NO_DEBUG
 
-          if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-            String log  = F("Lev.");
-            log += String(ifBlock);
-            log += F(": [elseif ");
-            log += check;
-            log += F("]=");
-            log += boolToString(condition[ifBlock - 1]);
-            addLog(LOG_LEVEL_DEBUG, log);
-          }
+          addLogFmt(LOG_LEVEL_DEBUG, F("Lev.%u: [elseif %s]=%s"), ifBlock, check, boolToString(condition[ifBlock - 1]));
 #endif // ifndef BUILD_NO_DEBUG
         }
       }
@@ -862,15 +1079,7 @@ void processMatchedRule(String& action, const String& event,
           ifBranche[ifBlock - 1] = true;
 #ifndef BUILD_NO_DEBUG
 
-          if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-            String log  = F("Lev.");
-            log += String(ifBlock);
-            log += F(": [if ");
-            log += check;
-            log += F("]=");
-            log += boolToString(condition[ifBlock - 1]);
-            addLog(LOG_LEVEL_DEBUG, log);
-          }
+          addLogFmt(LOG_LEVEL_DEBUG, F("Lev.%u: [if %s]=%s"), ifBlock, check, boolToString(condition[ifBlock - 1]));
 #endif // ifndef BUILD_NO_DEBUG
         } else {
           fakeIfBlock++;
@@ -897,13 +1106,7 @@ void processMatchedRule(String& action, const String& event,
     isCommand              = false;
 #ifndef BUILD_NO_DEBUG
 
-    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-      String log  = F("Lev.");
-      log += String(ifBlock);
-      log += F(": [else]=");
-      log += boolToString(condition[ifBlock - 1] == ifBranche[ifBlock - 1]);
-      addLog(LOG_LEVEL_DEBUG, log);
-    }
+    addLogFmt(LOG_LEVEL_DEBUG, F("Lev.%u: [else]=%s"), ifBlock, boolToString(condition[ifBlock - 1] == ifBranche[ifBlock - 1]));
 #endif // ifndef BUILD_NO_DEBUG
   }
 
@@ -923,11 +1126,7 @@ void processMatchedRule(String& action, const String& event,
   if (isCommand) {
     substitute_eventvalue(action, event);
 
-    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-      String actionlog = F("ACT  : ");
-      actionlog += action;
-      addLog(LOG_LEVEL_INFO, actionlog);
-    }
+    addLogFmt(LOG_LEVEL_INFO, F("ACT  : %s"), action);
 
     ExecuteCommand_all(EventValueSource::Enum::VALUE_SOURCE_RULES, action.c_str());
     delay(0);
@@ -1460,7 +1659,7 @@ void createRuleEvents(struct EventStruct *event) {
       eventString += event->String2.substring(event->String2.length() - 10);
     }
     eventString += '`';
-    eventQueue.addMove(std::move(eventString));    
+    eventQueue.addTaskValueEvent(eventString, Settings.CoalesceTaskValueEvents());
   } else if (Settings.CombineTaskValues_SingleEvent(event->TaskIndex)) {
     String eventString;
     eventString.reserve(128); // Enough for most use cases, prevent lots of memory allocations.
@@ -1473,17 +1672,19 @@ void createRuleEvents(struct EventStruct *event) {
       }
       eventString += formatUserVarNoCheck(event, varNr);
     }
-    eventQueue.addMove(std::move(eventString));
+    eventQueue.addTaskValueEvent(eventString, Settings.CoalesceTaskValueEvents());
   } else {
+    // Event is copied into the event queue, so the same string can be used for all values.
+    String eventString;
+    eventString.reserve(64); // Enough for most use cases, prevent lots of memory allocations.
+
     for (byte varNr = 0; varNr < valueCount; varNr++) {
-      String eventString;
-      eventString.reserve(64); // Enough for most use cases, prevent lots of memory allocations.
       eventString  = getTaskDeviceName(event->TaskIndex);
       eventString += F("#");
       eventString += ExtraTaskSettings.TaskDeviceValueNames[varNr];
       eventString += F("=");
       eventString += formatUserVarNoCheck(event, varNr);
-      eventQueue.addMove(std::move(eventString));
+      eventQueue.addTaskValueEvent(eventString, Settings.CoalesceTaskValueEvents());
     }
   }
 }
@@ -29,12 +29,34 @@ bool   processNextEvent();
  \*********************************************************************************************/
 void   rulesProcessing(const String& event);
 
+/********************************************************************************************\
+   Process the event for all active rules files.
+   Either use the index of the rules files, or parse the rules files themselves.
+ \*********************************************************************************************/
+void   rulesProcessingActiveFiles(const String& event,
+                                  bool          useRulesIndex);
+
 /********************************************************************************************\
    Rules processing
  \*********************************************************************************************/
 String rulesProcessingFile(const String& fileName,
                            const String& event);
 
+/********************************************************************************************\
+   Rules processing using the index of the rules file
+ \*********************************************************************************************/
+void   rulesProcessingIndexed(const String& fileName,
+                              const String& event);
+
+/********************************************************************************************\
+   Read rules line character by character
+   Return true when the end of the line was read.
+ \*********************************************************************************************/
+bool rules_append_character(String& line,
+                            char    c,
+                            bool  & firstNonSpaceRead,
+                            bool  & commentFound);
+
 
 /********************************************************************************************\
    Strip comment from the line.
@@ -200,20 +200,25 @@ void addToLog(byte loglevel, const String& string)
   }
 }
 
+static void addLogPrefixToSerialBuffer(byte logLevel)
+{
+  addToSerialBuffer(String(millis()));
+  addToSerialBuffer(F(" : "));
+  {
+    String loglevelDisplayString = getLogLevelDisplayString(logLevel);
+    while (loglevelDisplayString.length() < 6) {
+      loglevelDisplayString += ' ';
+    }
+    addToSerialBuffer(loglevelDisplayString);
+  }
+  addToSerialBuffer(F(" : "));
+}
+
 void addToLog(byte logLevel, const char *line)
 {
   // Please note all functions called from here handling line must be PROGMEM aware.
   if (loglevelActiveFor(LOG_TO_SERIAL, logLevel)) {
-    addToSerialBuffer(String(millis()));
-    addToSerialBuffer(F(" : "));
-    {
-      String loglevelDisplayString = getLogLevelDisplayString(logLevel);
-      while (loglevelDisplayString.length() < 6) {
-        loglevelDisplayString += ' ';
-      }
-      addToSerialBuffer(loglevelDisplayString);
-    }
-    addToSerialBuffer(F(" : "));
+    addLogPrefixToSerialBuffer(logLevel);
     addToSerialBuffer(line);
     addNewlineToSerialBuffer();
   }
@@ -245,3 +250,43 @@ void addToLog(byte logLevel, const char *line)
   }
 #endif
 }
+
+void addToLog(byte logLevel, const __FlashStringHelper *format, const LogArgs& args, const LogArgs& fullArgs)
+{
+  // The web log keeps the arguments, only the other destinations need the text right away.
+  if (loglevelActiveFor(LOG_TO_WEBLOG, logLevel)) {
+    Logging.add(logLevel, format, args);
+  }
+  const bool toSerial = loglevelActiveFor(LOG_TO_SERIAL, logLevel);
+  const bool toSyslog = loglevelActiveFor(LOG_TO_SYSLOG, logLevel);
+  bool toSD           = false;
+#ifdef FEATURE_SD
+  toSD = loglevelActiveFor(LOG_TO_SDCARD, logLevel);
+#endif
+
+  if (!toSerial && !toSyslog && !toSD) {
+    return;
+  }
+  String line;
+  fullArgs.format(format, line);
+
+  if (toSerial) {
+    addLogPrefixToSerialBuffer(logLevel);
+    addToSerialBuffer(line);
+    addNewlineToSerialBuffer();
+  }
+
+  if (toSyslog) {
+    syslog(logLevel, line.c_str());
+  }
+
+#ifdef FEATURE_SD
+  if (toSD) {
+    File logFile = SD.open("log.dat", FILE_WRITE);
+    if (logFile) {
+      logFile.println(line);
+    }
+    logFile.close();
+  }
+#endif
+}
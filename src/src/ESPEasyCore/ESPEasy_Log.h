@@ -4,6 +4,8 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../DataStructs/LogArgs.h"
+
 #define LOG_LEVEL_NONE                      0
 #define LOG_LEVEL_ERROR                     1
 #define LOG_LEVEL_INFO                      2
@@ -60,5 +62,34 @@ void addToLog(byte loglevel, const String& string);
 
 void addToLog(byte logLevel, const char *line);
 
+// The web log stores 'args', the other destinations format the text from 'fullArgs' right away.
+void addToLog(byte                       logLevel,
+              const __FlashStringHelper *format,
+              const LogArgs            & args,
+              const LogArgs            & fullArgs);
+
+// Log a line of which the text is only formatted by the log destinations using it (see LogArgs).
+// Meant for often called code, to not build a String only to log it.
+// 'format' must be a flash string, e.g. addLogFmt(LOG_LEVEL_INFO, F("EVENT: %s"), event);
+// N.B. The arguments are also evaluated when the log level is not active, so only pass values at hand.
+// Strings which do not fit in LogArgs are truncated in the web log, the other destinations get the complete text.
+template<typename ... Args>
+void addLogFmt(byte logLevel, const __FlashStringHelper *format, const Args& ... args)
+{
+  if (loglevelActiveFor(logLevel)) {
+    LogArgs logArgs;
+    logArgs.addAll(args ...);
+
+    if (logArgs.truncated()) {
+      const bool referToStrings = true;
+      LogArgs    fullArgs(referToStrings);
+      fullArgs.addAll(args ...);
+      addToLog(logLevel, format, logArgs, fullArgs);
+    } else {
+      addToLog(logLevel, format, logArgs, logArgs);
+    }
+  }
+}
+
 
 #endif 
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "../Globals/Settings.h"
 #include "../Helpers/Network.h"
 #include "../Helpers/Networking.h"
+#include "../WebServer/ServerSentEvents.h"
 
 
 /*********************************************************************************************\
@@ -60,6 +61,9 @@ void backgroundtasks()
 
     if (webserverRunning) {
       web_server.handleClient();
+      #ifdef WEBSERVER_EVENTS
+      events_loop();
+      #endif // ifdef WEBSERVER_EVENTS
     }
 
     if (networkConnected) {
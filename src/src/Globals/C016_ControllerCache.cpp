@@ -3,8 +3,6 @@
 #ifdef USES_C016
 
 
-#include "../ControllerQueue/C016_queue_element.h"
-
 ControllerCache_struct ControllerCache;
 
 bool C016_startCSVdump() {
@@ -31,18 +29,26 @@ bool C016_getCSVline(
   float& val3,
   float& val4)
 {
-  C016_queue_element element;
-  bool result = ControllerCache.peek((uint8_t*)&element, sizeof(element));
-  timestamp = element._timestamp;
-  controller_idx = element.controller_idx;
-  TaskIndex = element.TaskIndex;
-  sensorType = element.sensorType;
-  valueCount = element.valueCount;
-  val1 = element.values[0];
-  val2 = element.values[1];
-  val3 = element.values[2];
-  val4 = element.values[3];
+  ControllerCacheSample sample;
+  bool result = ControllerCache.peek(sample);
+  timestamp = sample.timestamp;
+  controller_idx = sample.controller_idx;
+  TaskIndex = sample.TaskIndex;
+  sensorType = sample.sensorType;
+  valueCount = sample.valueCount;
+  val1 = sample.values[0];
+  val2 = sample.values[1];
+  val3 = sample.values[2];
+  val4 = sample.values[3];
   return result;
 }
 
+bool C016_startQuery(uint32_t from, uint32_t to, taskIndex_t taskIndex) {
+  return ControllerCache.startQuery(from, to, taskIndex);
+}
+
+bool C016_getNextSample(ControllerCacheSample& sample) {
+  return ControllerCache.nextQuery(sample);
+}
+
 #endif
\ No newline at end of file
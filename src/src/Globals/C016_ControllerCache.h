@@ -31,6 +31,11 @@ bool C016_getCSVline(
   float& val3,
   float& val4);
 
+// Start reading the samples with a timestamp in [from, to], optionally of a single task.
+bool C016_startQuery(uint32_t from, uint32_t to, taskIndex_t taskIndex);
+
+bool C016_getNextSample(ControllerCacheSample& sample);
+
 #endif
 
 #endif
\ No newline at end of file
@@ -3,8 +3,6 @@
 
 #include "../DataStructs/EventQueue.h"
 
-#include <list>
-
 extern EventQueueStruct eventQueue;
 
 #endif // GLOBALS_EVENTQUEUE_H
\ No newline at end of file
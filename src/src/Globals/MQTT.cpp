@@ -15,4 +15,6 @@ int  mqtt_reconnect_count               = 0;
 
 // mqtt import status
 bool P037_MQTTImport_connected = false;
+
+MQTT_TopicTrie P037_MQTTImport_subscriptions;
 #endif // ifdef USES_P037
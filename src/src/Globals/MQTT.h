@@ -19,9 +19,13 @@ extern int  mqtt_reconnect_count;
 #endif // USES_MQTT
 
 #ifdef USES_P037
+# include "../DataStructs/MQTT_TopicTrie.h"
 
 // mqtt import status
 extern bool P037_MQTTImport_connected;
+
+// Subscriptions of all MQTT import tasks
+extern MQTT_TopicTrie P037_MQTTImport_subscriptions;
 #endif // ifdef USES_P037
 
 
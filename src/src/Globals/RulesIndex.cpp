@@ -0,0 +1,4 @@
+#include "../Globals/RulesIndex.h"
+
+
+RulesIndexStruct rulesIndex;
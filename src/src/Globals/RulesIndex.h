@@ -0,0 +1,8 @@
+#ifndef GLOBALS_RULESINDEX_H
+#define GLOBALS_RULESINDEX_H
+
+#include "../DataStructs/RulesIndexStruct.h"
+
+extern RulesIndexStruct rulesIndex;
+
+#endif // GLOBALS_RULESINDEX_H
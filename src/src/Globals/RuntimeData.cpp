@@ -7,6 +7,8 @@ std::map<uint32_t, double> customFloatVar;
 
 UserVarStruct UserVar;
 
+TaskValueTracker taskValueTracker;
+
 
 double getCustomFloatVar(uint32_t index) {
   auto it = customFloatVar.find(index);
@@ -3,6 +3,7 @@
 
 #include "../CustomBuild/ESPEasyLimits.h"
 
+#include "../DataStructs/TaskValueTracker.h"
 #include "../DataStructs/UserVarStruct.h"
 
 #include <map>
@@ -34,6 +35,9 @@ bool getNextCustomFloatVar(uint32_t& index, double& value);
 
 extern UserVarStruct UserVar;
 
+// Sequence number and time of the last update of the task values.
+extern TaskValueTracker taskValueTracker;
+
 
 
 #endif // GLOBALS_RUNTIMEDATA_H
\ No newline at end of file
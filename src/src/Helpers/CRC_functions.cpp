@@ -29,9 +29,7 @@ int calc_CRC16(const char *ptr, int count)
   return crc;
 }
 
-uint32_t calc_CRC32(const uint8_t *data, size_t length) {
-  uint32_t crc = 0xffffffff;
-
+uint32_t calc_CRC32(const uint8_t *data, size_t length, uint32_t crc) {
   while (length--) {
     uint8_t c = *data++;
 
@@ -8,8 +8,10 @@ int      calc_CRC16(const String& text);
 int      calc_CRC16(const char *ptr,
                     int         count);
 
+// Continue a CRC computation over multiple blocks by passing the result of the previous block as crc.
 uint32_t calc_CRC32(const uint8_t *data,
-                    size_t         length);
+                    size_t         length,
+                    uint32_t       crc = 0xffffffff);
 
 
 #endif // ifndef HELPERS_CRC_FUNCTIONS_H
@@ -93,7 +93,7 @@ float minutesToDay(int minutes) {
 String minutesToDayHour(int minutes) {
   int  days  = minutes / 1440;
   int  hours = (minutes % 1440) / 60;
-  char TimeString[8] = {0}; // 5 digits plus the null char minimum
+  char TimeString[16] = {0}; // Room for any value of minutes plus the null char
 
   sprintf_P(TimeString, PSTR("%d%c%02d%c"), days, 'd', hours, 'h');
   return TimeString;
@@ -19,6 +19,7 @@
 
 #include "../Helpers/_CPlugin_Helper.h"
 #include "../Helpers/ESPEasyRTC.h"
+#include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Hardware.h"
 #include "../Helpers/Misc.h"
 
@@ -63,6 +64,7 @@ void ResetFactory()
   saveToRTC();
 
   // always format on factory reset, in case of corrupt FS
+  discardPendingSettingsWrites();
   ESPEASY_FS.end();
   serialPrintln(F("RESET: formatting..."));
   ESPEASY_FS.format();
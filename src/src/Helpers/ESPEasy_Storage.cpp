@@ -4,6 +4,7 @@
 
 #include "../CustomBuild/StorageLayout.h"
 
+#include "../DataStructs/SettingsWriteBufferStruct.h"
 #include "../DataStructs/TimingStats.h"
 
 #include "../ESPEasyCore/ESPEasy_Log.h"
@@ -21,6 +22,7 @@
 #include "../Globals/Plugins.h"
 #include "../Globals/RTC.h"
 #include "../Globals/ResetFactoryDefaultPref.h"
+#include "../Globals/RulesIndex.h"
 #include "../Globals/SecuritySettings.h"
 #include "../Globals/Settings.h"
 
@@ -81,13 +83,18 @@ void flashCount()
   saveToRTC();
 }
 
+bool flashWriteRateExceeded()
+{
+  return RTC.flashDayCounter > MAX_FLASHWRITES_PER_DAY;
+}
+
 String flashGuard()
 {
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("flashGuard"));
   #endif
 
-  if (RTC.flashDayCounter > MAX_FLASHWRITES_PER_DAY)
+  if (flashWriteRateExceeded())
   {
     String log = F("FS   : Daily flash write rate exceeded! (powercycle to reset this)");
     addLog(LOG_LEVEL_ERROR, log);
@@ -126,7 +133,18 @@ bool fileExists(const String& fname) {
   return res;
 }
 
-fs::File tryOpenFile(const String& fname, const String& mode) {
+/********************************************************************************************\
+   Write-behind buffer for task settings
+ \*********************************************************************************************/
+static SettingsWriteBufferStruct pendingSettingsWrites;
+
+// Error of the last attempt to write the pending data.
+// Returned to the next saves, until the data has been written.
+static String pendingSettingsWriteError;
+
+// Open a file without writing pending settings first.
+// Only to be used when pending settings are taken into account.
+fs::File openFile_noFlush(const String& fname, const String& mode) {
   START_TIMER;
   fs::File f;
   if (fname.isEmpty() || fname.equals(F("/"))) {
@@ -141,15 +159,38 @@ fs::File tryOpenFile(const String& fname, const String& mode) {
     }
     Cache.fileExistsMap.clear();
   }
+
+  if (!mode.startsWith(F("r"))) {
+    // File content may change, so its ETag is no longer valid.
+    Cache.fileETagMap.erase(patch_fname(fname));
+  }
+
+  if (!mode.startsWith(F("r")) && RulesIndexStruct::isRulesFileName(fname)) {
+    // Rules file will be changed, so the rules index is no longer valid.
+    rulesIndex.invalidate();
+  }
   f = ESPEASY_FS.open(patch_fname(fname), mode.c_str());
   STOP_TIMER(TRY_OPEN_FILE);
   return f;
 }
 
+fs::File tryOpenFile(const String& fname, const String& mode) {
+  if (pendingSettingsWrites.isPending(patch_fname(fname))) {
+    flushPendingSettingsWrites();
+  }
+  return openFile_noFlush(fname, mode);
+}
+
 bool tryRenameFile(const String& fname_old, const String& fname_new) {
+  flushPendingSettingsWrites();
   Cache.fileExistsMap.clear();
   if (fileExists(fname_old) && !fileExists(fname_new)) {
     clearAllCaches();
+
+    if (RulesIndexStruct::isRulesFileName(fname_old) ||
+        RulesIndexStruct::isRulesFileName(fname_new)) {
+      rulesIndex.invalidate();
+    }
     return ESPEASY_FS.rename(patch_fname(fname_old), patch_fname(fname_new));
   }
   return false;
@@ -158,9 +199,18 @@ bool tryRenameFile(const String& fname_old, const String& fname_new) {
 bool tryDeleteFile(const String& fname) {
   if (fname.length() > 0)
   {
+    flushPendingSettingsWrites();
+    if (pendingSettingsWrites.isPending(patch_fname(fname))) {
+      // Writing failed, but there is no file left to write to.
+      discardPendingSettingsWrites();
+    }
     bool res = ESPEASY_FS.remove(patch_fname(fname));
     clearAllCaches();
 
+    if (RulesIndexStruct::isRulesFileName(fname)) {
+      rulesIndex.invalidate();
+    }
+
     // A call to GarbageCollection() will at most erase a single block. (e.g. 8k block size)
     // A deleted file may have covered more than a single block, so try to clear multiple blocks.
     uint8_t retries = 3;
@@ -173,6 +223,16 @@ bool tryDeleteFile(const String& fname) {
   return false;
 }
 
+bool deleteFile_noFlush(const String& fname) {
+  if (fname.length() == 0) {
+    return false;
+  }
+  const String patched_fname = patch_fname(fname);
+
+  Cache.fileExistsMap.erase(patched_fname);
+  return ESPEASY_FS.remove(patched_fname);
+}
+
 /********************************************************************************************\
    Fix stuff to clear out differences between releases
  \*********************************************************************************************/
@@ -442,6 +502,7 @@ String SaveSecuritySettings() {
 
 void afterloadSettings() {
   ExtraTaskSettings.clear(); // make sure these will not contain old settings.
+  Cache.extraTaskSettings.clear();
   ResetFactoryDefaultPreference_struct pref(Settings.ResetFactoryDefaultPreference);
   DeviceModel model = pref.getDeviceModel();
 
@@ -728,7 +789,8 @@ String SaveStringArray(SettingsType::Enum settingsType, int index, const String
 
     // Buffer is filled, now write to flash
     // As we write in parts, only count as single write.
-    if (RTC.flashDayCounter > 0) {
+    // Write-behind settings are written in a single flush, which is counted once.
+    if ((RTC.flashDayCounter > 0) && !SettingsType::useWriteBehind(settingsType)) {
       RTC.flashDayCounter--;
     }
     result   += SaveToFile(settingsType, index, &(buffer[0]), bufferSize, writePos);
@@ -764,6 +826,9 @@ String SaveTaskSettings(taskIndex_t TaskIndex)
                           (byte *)&ExtraTaskSettings,
                           sizeof(struct ExtraTaskSettingsStruct));
 
+  // Cached copy may differ from what has been saved, so let the next load read the file again.
+  Cache.extraTaskSettings.invalidate(TaskIndex);
+
   if (err.isEmpty()) {
     err = checkTaskSettings(TaskIndex);
   }
@@ -787,6 +852,10 @@ String LoadTaskSettings(taskIndex_t TaskIndex)
   #endif
 
   START_TIMER
+  if (Cache.extraTaskSettings.get(TaskIndex, ExtraTaskSettings)) {
+    STOP_TIMER(LOAD_TASK_SETTINGS_CACHED);
+    return String();
+  }
   ExtraTaskSettings.clear();
   const String result = LoadFromFile(SettingsType::Enum::TaskSettings_Type, TaskIndex, (byte *)&ExtraTaskSettings, sizeof(struct ExtraTaskSettingsStruct));
 
@@ -812,6 +881,9 @@ String LoadTaskSettings(taskIndex_t TaskIndex)
     PluginCall(PLUGIN_GET_DEVICEVALUENAMES, &TempEvent, tmp);
   }
   ExtraTaskSettings.validate();
+  if (result.isEmpty()) {
+    Cache.extraTaskSettings.add(ExtraTaskSettings);
+  }
   STOP_TIMER(LOAD_TASK_SETTINGS);
 
   return result;
@@ -1016,7 +1088,173 @@ String InitFile(SettingsType::SettingsFileEnum file_type)
  \*********************************************************************************************/
 String SaveToFile(const char *fname, int index, const byte *memAddress, int datasize)
 {
-  return doSaveToFile(fname, index, memAddress, datasize, "r+");
+  if (pendingSettingsWrites.isPending(patch_fname(String(fname)))) {
+    // Combine with the pending writes to the same file.
+    if (pendingSettingsWrites.add(patch_fname(String(fname)), index, memAddress, datasize)) {
+      return flushPendingSettingsWrites();
+    }
+  }
+  String err = flushPendingSettingsWrites();
+  err += doSaveToFile(fname, index, memAddress, datasize, "r+");
+  return err;
+}
+
+String SaveToFile_writeBehind(const String& fname, int index, const byte *memAddress, int datasize)
+{
+  if (index < 0) {
+    // Let doSaveToFile handle the error
+    return SaveToFile(fname.c_str(), index, memAddress, datasize);
+  }
+  if (flashWriteRateExceeded()) {
+    // Report it now, as the caller will not see errors of writing the data later.
+    return flashGuard();
+  }
+  const String patched_fname = patch_fname(fname);
+
+  // Task names may have changed, the other caches are cleared when the data is actually written.
+  updateTaskCaches();
+
+  if (pendingSettingsWrites.add(patched_fname, index, memAddress, datasize)) {
+    // Data is kept, but may still not be written because of an earlier error.
+    return pendingSettingsWriteError;
+  }
+
+  // Pending writes are for another file or the buffer is full.
+  String err = flushPendingSettingsWrites();
+
+  if (!pendingSettingsWrites.add(patched_fname, index, memAddress, datasize)) {
+    err += doSaveToFile(fname.c_str(), index, memAddress, datasize, "r+");
+  }
+  return err;
+}
+
+String flushPendingSettingsWrites()
+{
+  if (pendingSettingsWrites.isEmpty()) {
+    return String();
+  }
+
+  // Take the pending writes out of the buffer, so new saves (or file access) during writing
+  // will not use them.
+  SettingsWriteBufferStruct pending;
+  pending.swap(pendingSettingsWrites);
+
+  std::vector<SettingsFileRange> ranges;
+  ranges.reserve(pending.ranges.size());
+
+  for (auto it = pending.ranges.begin(); it != pending.ranges.end(); ++it) {
+    ranges.push_back({ it->offset, &(it->data[0]), static_cast<int>(it->data.size()) });
+  }
+
+  #ifndef BUILD_NO_DEBUG
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    String log = F("FILE : Write pending ");
+    log += pending.fileName;
+    log += F(" saves: ");
+    log += pending.nrSaves;
+    log += F(" ranges: ");
+    log += ranges.size();
+    log += F(" size: ");
+    log += pending.nrBytes;
+    addLog(LOG_LEVEL_DEBUG, log);
+  }
+  #endif
+  String err = doSaveToFile(pending.fileName.c_str(), &ranges[0], ranges.size(), "r+");
+
+  if (err.isEmpty()) {
+    pendingSettingsWriteError = String();
+    return err;
+  }
+
+  // Keep the data to try again later, so the saved settings are not lost.
+  // Nothing can be saved while writing, so the buffer is still empty.
+  if (pendingSettingsWrites.isEmpty()) {
+    pending.retryLater();
+    pending.swap(pendingSettingsWrites);
+  }
+  pendingSettingsWriteError = err;
+
+  String log = F("FILE : Write pending ");
+  log += pendingSettingsWrites.fileName;
+  log += F(" failed, retry in ");
+  log += SETTINGS_WRITE_BEHIND_RETRY_INTERVAL / 1000;
+  log += F(" sec.");
+  addLog(LOG_LEVEL_ERROR, log);
+  return err;
+}
+
+void discardPendingSettingsWrites()
+{
+  if (!pendingSettingsWrites.isEmpty()) {
+    String log = F("FILE : Discard pending ");
+    log += pendingSettingsWrites.fileName;
+    addLog(LOG_LEVEL_INFO, log);
+    pendingSettingsWrites.clear();
+  }
+  pendingSettingsWriteError = String();
+}
+
+void processPendingSettingsWrites()
+{
+  if (pendingSettingsWrites.timeoutReached()) {
+    flushPendingSettingsWrites();
+  }
+}
+
+// Write only the parts which differ from the data in the file.
+// The data is compared in blocks aligned to SETTINGS_SAVE_BLOCK_SIZE in the file.
+// Consecutive changed blocks are merged into a single seek and write.
+// The data is always in RAM (settings in memory or the write-behind buffer), so it is written
+// straight from there. Only the file content is read into the buffer to compare.
+bool writeChangedBlocks(fs::File& f, const SettingsFileRange& range, uint8_t *buffer, int& nrBytesWritten)
+{
+  int         pos       = range.offset;
+  int         remaining = range.datasize;
+  const byte *data      = range.memAddress;
+
+  // Start and length of the changed blocks not yet written.
+  int         changedPos    = pos;
+  const byte *changedData   = data;
+  int         changedLength = 0;
+
+  while (remaining > 0) {
+    int chunk = SETTINGS_SAVE_BLOCK_SIZE - (pos % SETTINGS_SAVE_BLOCK_SIZE);
+
+    if (chunk > remaining) {
+      chunk = remaining;
+    }
+
+    // Reading continues where the previous block ended, unless changed blocks were written in between.
+    if ((static_cast<int>(f.position()) != pos) && !f.seek(pos, fs::SeekSet)) {
+      return false;
+    }
+    const int  bytesRead = f.read(buffer, chunk);
+    const bool changed   = (bytesRead != chunk) || (memcmp(buffer, data, chunk) != 0);
+
+    if (changed) {
+      if (changedLength == 0) {
+        changedPos  = pos;
+        changedData = data;
+      }
+      changedLength += chunk;
+    }
+    pos       += chunk;
+    data      += chunk;
+    remaining -= chunk;
+
+    if ((changedLength > 0) && (!changed || (remaining == 0))) {
+      if (!f.seek(changedPos, fs::SeekSet) ||
+          (f.write(changedData, changedLength) != static_cast<size_t>(changedLength))) {
+        return false;
+      }
+      nrBytesWritten += changedLength;
+      changedLength   = 0;
+    }
+
+    // one block processed, do some background tasks
+    delay(0);
+  }
+  return true;
 }
 
 // See for mode description: https://github.com/esp8266/Arduino/blob/master/doc/filesystem.rst
@@ -1036,16 +1274,24 @@ String doSaveToFile(const char *fname, int index, const byte *memAddress, int da
 #endif // ifndef ESP32
 #endif
 
-  if (index < 0) {
-    #ifndef BUILD_NO_DEBUG
-    String log = F("SaveToFile: ");
-    log += fname;
-    log += F(" ERROR, invalid position in file");
-    #else
-    String log = F("Save error");
-    #endif
-    addLog(LOG_LEVEL_ERROR, log);
-    return log;
+  const SettingsFileRange range = { index, memAddress, datasize };
+  return doSaveToFile(fname, &range, 1, mode);
+}
+
+String doSaveToFile(const char *fname, const SettingsFileRange *ranges, size_t nrRanges, const char *mode)
+{
+  for (size_t i = 0; i < nrRanges; ++i) {
+    if (ranges[i].offset < 0) {
+      #ifndef BUILD_NO_DEBUG
+      String log = F("SaveToFile: ");
+      log += fname;
+      log += F(" ERROR, invalid position in file");
+      #else
+      String log = F("Save error");
+      #endif
+      addLog(LOG_LEVEL_ERROR, log);
+      return log;
+    }
   }
   START_TIMER;
   #ifndef BUILD_NO_RAM_TRACKER
@@ -1061,44 +1307,42 @@ String doSaveToFile(const char *fname, int index, const byte *memAddress, int da
   }
   #endif
   delay(1);
-  unsigned long timer = millis() + 50;
-  fs::File f          = tryOpenFile(fname, mode);
+  fs::File f = openFile_noFlush(fname, mode);
 
   if (f) {
-    clearAllCaches();
-    SPIFFS_CHECK(f,                          fname);
-    SPIFFS_CHECK(f.seek(index, fs::SeekSet), fname);
-    const byte *pointerToByteToSave = memAddress;
+    SPIFFS_CHECK(f, fname);
+    std::vector<uint8_t> buffer;
+    buffer.resize(SETTINGS_SAVE_BLOCK_SIZE);
 
-    for (int x = 0; x < datasize; x++)
-    {
-      // See https://github.com/esp8266/Arduino/commit/b1da9eda467cc935307d553692fdde2e670db258#r32622483
-      uint8_t byteToSave = *pointerToByteToSave;
-      SPIFFS_CHECK(f.write(&byteToSave, 1), fname);
-      pointerToByteToSave++;
-
-      if (x % 256 == 0) {
-        // one page written, do some background tasks
-        timer = millis() + 50;
-        delay(0);
-      }
+    int datasize       = 0;
+    int nrBytesWritten = 0;
 
-      if (timeOutReached(timer)) {
-        timer += 50;
-        delay(0);
-      }
+    for (size_t i = 0; i < nrRanges; ++i) {
+      datasize += ranges[i].datasize;
+      SPIFFS_CHECK(writeChangedBlocks(f, ranges[i], &buffer[0], nrBytesWritten), fname);
     }
     f.close();
+
+    if (nrBytesWritten > 0) {
+      // Only data which has actually changed may invalidate the caches.
+      clearAllCaches();
+    }
     #ifndef BUILD_NO_DEBUG
     if (loglevelActiveFor(LOG_LEVEL_INFO)) {
       String log;
-      log.reserve(48);
+      log.reserve(64);
       log += F("FILE : Saved ");
       log += fname;
       log += F(" offset: ");
-      log += index;
+      log += ranges[0].offset;
       log += F(" size: ");
       log += datasize;
+      if (nrRanges > 1) {
+        log += F(" ranges: ");
+        log += nrRanges;
+      }
+      log += F(" written: ");
+      log += nrBytesWritten;
       addLog(LOG_LEVEL_INFO, log);
     }
     #endif
@@ -1199,12 +1443,15 @@ String LoadFromFile(const char *fname, int offset, byte *memAddress, int datasiz
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("LoadFromFile"));
   #endif
-  fs::File f = tryOpenFile(fname, "r");
+  fs::File f = openFile_noFlush(fname, "r");
   SPIFFS_CHECK(f,                            fname);
   SPIFFS_CHECK(f.seek(offset, fs::SeekSet),  fname);
   SPIFFS_CHECK(f.read(memAddress, datasize), fname);
   f.close();
 
+  // Settings which have not yet been written must be read from the write buffer.
+  pendingSettingsWrites.overlay(patch_fname(String(fname)), offset, memAddress, datasize);
+
   STOP_TIMER(LOADFILE_STATS);
   delay(0);
 
@@ -1287,6 +1534,9 @@ String SaveToFile(SettingsType::Enum settingsType, int index, byte *memAddress,
   if (!fileExists(fname)) {
     InitFile(settingsType);
   }
+  if (SettingsType::useWriteBehind(settingsType)) {
+    return SaveToFile_writeBehind(fname, offset + posInBlock, memAddress, datasize);
+  }
   return SaveToFile(fname.c_str(), offset + posInBlock, memAddress, datasize);
 }
 
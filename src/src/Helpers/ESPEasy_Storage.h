@@ -21,6 +21,9 @@ String FileError(int line, const char *fname);
  \*********************************************************************************************/
 void flashCount();
 
+// Check the flash write counter, without counting a write.
+bool flashWriteRateExceeded();
+
 String flashGuard();
 
 String appendLineToFile(const String& fname, const String& line);
@@ -29,12 +32,19 @@ String appendToFile(const String& fname, const uint8_t *data, unsigned int size)
 
 bool fileExists(const String& fname);
 
+// Open a file, without writing pending settings saves to the file first.
+fs::File openFile_noFlush(const String& fname, const String& mode);
+
 fs::File tryOpenFile(const String& fname, const String& mode);
 
 bool tryRenameFile(const String& fname_old, const String& fname_new);
 
 bool tryDeleteFile(const String& fname);
 
+// Delete a file which is not a settings file and is not kept in any cache (e.g. a controller queue spill file),
+// without flushing pending settings writes, clearing the caches or running a garbage collection.
+bool deleteFile_noFlush(const String& fname);
+
 /********************************************************************************************\
    Fix stuff to clear out differences between releases
  \*********************************************************************************************/
@@ -184,9 +194,34 @@ String InitFile(SettingsType::SettingsFileEnum file_type);
  \*********************************************************************************************/
 String SaveToFile(const char *fname, int index, const byte *memAddress, int datasize);
 
+// Keep the data in memory for a short while, to combine it with other saves to the same file.
+// Loading from the file will include the pending data.
+String SaveToFile_writeBehind(const String& fname, int index, const byte *memAddress, int datasize);
+
+// Write all pending saves to the file system.
+// When writing fails, the data is kept to try again later and the error is returned by the next saves.
+String flushPendingSettingsWrites();
+
+// Drop pending saves, e.g. when the file system is formatted.
+void discardPendingSettingsWrites();
+
+// Write pending saves when they have been kept for SETTINGS_WRITE_BEHIND_TIMEOUT msec.
+void processPendingSettingsWrites();
+
+struct SettingsFileRange {
+  int         offset;
+  const byte *memAddress;
+  int         datasize;
+};
+
+// Only write the blocks of the range which differ from the file content.
+bool writeChangedBlocks(fs::File& f, const SettingsFileRange& range, uint8_t *buffer, int& nrBytesWritten);
+
 // See for mode description: https://github.com/esp8266/Arduino/blob/master/doc/filesystem.rst
 String doSaveToFile(const char *fname, int index, const byte *memAddress, int datasize, const char *mode);
 
+String doSaveToFile(const char *fname, const SettingsFileRange *ranges, size_t nrRanges, const char *mode);
+
 
 /********************************************************************************************\
    Clear a certain area in a file (set to 0)
@@ -84,9 +84,8 @@ void run_compiletime_checks() {
   check_size<ExtraTaskSettingsStruct,               472u>();
   check_size<EventStruct,                           96u>(); // Is not stored
 
-  // LogStruct is mainly dependent on the number of lines.
-  // Has to be round up to multiple of 4.
-  const unsigned int LogStructSize = ((12u + 17 * LOG_STRUCT_MESSAGE_LINES) + 3) & ~3;
+  // LogStruct is mainly dependent on the buffer size and the number of lines.
+  const unsigned int LogStructSize = 12u + LOG_BUFFER_SIZE + 8 * LOG_STRUCT_MESSAGE_LINES;
   check_size<LogStruct,                             LogStructSize>(); // Is not stored
   check_size<DeviceStruct,                          8u>(); // Is not stored
   check_size<ProtocolStruct,                        6u>();
@@ -398,7 +398,7 @@ String ESPEasy_time::getDateString(char delimiter) const
 
 String ESPEasy_time::getDateString(const struct tm& ts, char delimiter) {
   // time format example with ':' delimiter: 23:59:59 (HH:MM:SS)
-  char DateString[20]; // 19 digits plus the null char
+  char DateString[36]; // Room for any value of the tm fields plus the null char
   const int year = 1900 + ts.tm_year;
 
   sprintf_P(DateString, PSTR("%4d%c%02d%c%02d"), year, delimiter, ts.tm_mon + 1, delimiter, ts.tm_mday);
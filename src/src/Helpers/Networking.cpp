@@ -179,138 +179,117 @@ void updateUDPport()
    Check UDP messages (ESPEasy propiertary protocol)
 \*********************************************************************************************/
 boolean runningUPDCheck = false;
-void checkUDP()
+UDP_ReceiveStats udpReceiveStats;
+
+// Handle a single UDP packet, zero terminated in packetBuffer.
+static UDP_PacketType processUDPPacket(char *packetBuffer, int len)
 {
-  if (Settings.UDPPort == 0) {
-    return;
+  if (portUDP.remotePort() == 123)
+  {
+    // unexpected NTP reply, drop for now...
+    return UDP_PacketType::Dropped;
   }
 
-  if (runningUPDCheck) {
-    return;
+  if (reinterpret_cast<unsigned char&>(packetBuffer[0]) != 255)
+  {
+    addLog(LOG_LEVEL_DEBUG, packetBuffer);
+    ExecuteCommand_all(EventValueSource::Enum::VALUE_SOURCE_SYSTEM, packetBuffer);
+    return UDP_PacketType::Command;
   }
 
-  runningUPDCheck = true;
-
-  // UDP events
-  int packetSize = portUDP.parsePacket();
-
-  if (packetSize > 0 /*&& portUDP.remotePort() == Settings.UDPPort*/)
+  // binary data!
+  switch (packetBuffer[1])
   {
-    statusLED(true);
-
-    IPAddress remoteIP = portUDP.remoteIP();
-
-    if (portUDP.remotePort() == 123)
+    case 1: // sysinfo message
     {
-      // unexpected NTP reply, drop for now...
-      runningUPDCheck = false;
-      return;
-    }
-
-    // UDP_PACKETSIZE_MAX should be as small as possible but still enough to hold all
-    // data for PLUGIN_UDP_IN or CPLUGIN_UDP_IN calls
-    // This node may also receive other UDP packets which may be quite large
-    // and then crash due to memory allocation failures
-    if ((packetSize >= 2) && (packetSize < UDP_PACKETSIZE_MAX)) {
-      // Allocate buffer to process packet.
-      std::vector<char> packetBuffer;
-      packetBuffer.resize(packetSize + 1);
-
-      if (packetBuffer.size() >= static_cast<size_t>(packetSize)) {
-        memset(&packetBuffer[0], 0, packetSize + 1);
-        int len = portUDP.read(&packetBuffer[0], packetSize);
-
-        if (len >= 2) {
-          if (reinterpret_cast<unsigned char&>(packetBuffer[0]) != 255)
-          {
-            packetBuffer[len] = 0;
-            addLog(LOG_LEVEL_DEBUG, &packetBuffer[0]);
-            ExecuteCommand_all(EventValueSource::Enum::VALUE_SOURCE_SYSTEM, &packetBuffer[0]);
-          }
-          else
-          {
-            // binary data!
-            switch (packetBuffer[1])
-            {
-              case 1: // sysinfo message
-              {
-                if (len < 13) {
-                  break;
-                }
-                byte unit = packetBuffer[12];
+      if (len < 13) {
+        return UDP_PacketType::Dropped;
+      }
+      byte unit = packetBuffer[12];
 #ifndef BUILD_NO_DEBUG
-                byte mac[6];
-                byte ip[4];
+      byte mac[6];
+      byte ip[4];
 
-                for (byte x = 0; x < 6; x++) {
-                  mac[x] = packetBuffer[x + 2];
-                }
+      for (byte x = 0; x < 6; x++) {
+        mac[x] = packetBuffer[x + 2];
+      }
 
-                for (byte x = 0; x < 4; x++) {
-                  ip[x] = packetBuffer[x + 8];
-                }
+      for (byte x = 0; x < 4; x++) {
+        ip[x] = packetBuffer[x + 8];
+      }
 #endif // ifndef BUILD_NO_DEBUG
-                Nodes[unit].age = 0; // Create a new element when not present
-                NodesMap::iterator it = Nodes.find(unit);
-
-                if (it != Nodes.end()) {
-                  for (byte x = 0; x < 4; x++) {
-                    it->second.ip[x] = packetBuffer[x + 8];
-                  }
-                  it->second.age = 0; // reset 'age counter'
-
-                  if (len >= 41)      // extended packet size
-                  {
-                    it->second.build = makeWord(packetBuffer[14], packetBuffer[13]);
-                    char tmpNodeName[26] = { 0 };
-                    memcpy(&tmpNodeName[0], reinterpret_cast<byte *>(&packetBuffer[15]), 25);
-                    tmpNodeName[25]     = 0;
-                    it->second.nodeName = tmpNodeName;
-                    it->second.nodeName.trim();
-                    it->second.nodeType          = packetBuffer[40];
-                    it->second.webgui_portnumber = 80;
-
-                    if ((len >= 43) && (it->second.build >= 20107)) {
-                      it->second.webgui_portnumber = makeWord(packetBuffer[42], packetBuffer[41]);
-                    }
-                  }
-                }
+      Nodes[unit].age = 0; // Create a new element when not present
+      NodesMap::iterator it = Nodes.find(unit);
 
-#ifndef BUILD_NO_DEBUG
-
-                if (loglevelActiveFor(LOG_LEVEL_DEBUG_MORE)) {
-                  char macaddress[20];
-                  formatMAC(mac, macaddress);
-                  char log[80] = { 0 };
-                  sprintf_P(log, PSTR("UDP  : %s,%s,%u"), macaddress, formatIP(ip).c_str(), unit);
-                  addLog(LOG_LEVEL_DEBUG_MORE, log);
-                }
-#endif // ifndef BUILD_NO_DEBUG
-                break;
-              }
-
-              default:
-              {
-                struct EventStruct TempEvent;
-                TempEvent.Data = reinterpret_cast<byte *>(&packetBuffer[0]);
-                TempEvent.Par1 = remoteIP[3];
-                TempEvent.Par2 = len;
-                String dummy;
-                PluginCall(PLUGIN_UDP_IN, &TempEvent, dummy);
-                CPluginCall(CPlugin::Function::CPLUGIN_UDP_IN, &TempEvent);
-                break;
-              }
-            }
+      if (it != Nodes.end()) {
+        for (byte x = 0; x < 4; x++) {
+          it->second.ip[x] = packetBuffer[x + 8];
+        }
+        it->second.age = 0; // reset 'age counter'
+
+        if (len >= 41)      // extended packet size
+        {
+          it->second.build = makeWord(packetBuffer[14], packetBuffer[13]);
+          char tmpNodeName[26] = { 0 };
+          memcpy(&tmpNodeName[0], reinterpret_cast<byte *>(&packetBuffer[15]), 25);
+          tmpNodeName[25]     = 0;
+          it->second.nodeName = tmpNodeName;
+          it->second.nodeName.trim();
+          it->second.nodeType          = packetBuffer[40];
+          it->second.webgui_portnumber = 80;
+
+          if ((len >= 43) && (it->second.build >= 20107)) {
+            it->second.webgui_portnumber = makeWord(packetBuffer[42], packetBuffer[41]);
           }
         }
       }
+
+#ifndef BUILD_NO_DEBUG
+
+      if (loglevelActiveFor(LOG_LEVEL_DEBUG_MORE)) {
+        char macaddress[20];
+        formatMAC(mac, macaddress);
+        addLogFmt(LOG_LEVEL_DEBUG_MORE, F("UDP  : %s,%u.%u.%u.%u,%u"), macaddress, ip[0], ip[1], ip[2], ip[3], unit);
+      }
+#endif // ifndef BUILD_NO_DEBUG
+      return UDP_PacketType::Sysinfo;
     }
+
+    default:
+    {
+      struct EventStruct TempEvent;
+      TempEvent.Data = reinterpret_cast<byte *>(packetBuffer);
+      TempEvent.Par1 = portUDP.remoteIP()[3];
+      TempEvent.Par2 = len;
+      String dummy;
+      const bool handledByPlugin = PluginCall(PLUGIN_UDP_IN, &TempEvent, dummy);
+      CPluginCall(CPlugin::Function::CPLUGIN_UDP_IN, &TempEvent);
+      return handledByPlugin ? UDP_PacketType::Plugin : UDP_PacketType::CPlugin;
+    }
+  }
+}
+
+void checkUDP()
+{
+  if (Settings.UDPPort == 0) {
+    return;
+  }
+
+  if (runningUPDCheck) {
+    return;
   }
 
-  // Flush any remaining content of the packet.
-  while (portUDP.available()) {
-    // Do not call portUDP.flush() as that's meant to sending the packet (on ESP8266)
-    portUDP.read();
+  runningUPDCheck = true;
+
+  // UDP_PACKETSIZE_MAX should be as small as possible but still enough to hold all
+  // data for PLUGIN_UDP_IN or CPLUGIN_UDP_IN calls
+  // This node may also receive other UDP packets which may be quite large
+  // and then crash due to memory allocation failures, so use a static buffer.
+  // Handle all pending packets, within a budget, to not let them pile up in the network stack.
+  static char packetBuffer[UDP_PACKETSIZE_MAX];
+
+  if (readUDPPackets(portUDP, packetBuffer, sizeof(packetBuffer), udpReceiveStats, processUDPPacket) > 0) {
+    statusLED(true);
   }
   runningUPDCheck = false;
 }
@@ -402,11 +381,7 @@ void sendUDP(byte unit, const byte *data, byte size)
 
 #ifndef BUILD_NO_DEBUG
 
-  if (loglevelActiveFor(LOG_LEVEL_DEBUG_MORE)) {
-    String log = F("UDP  : Send UDP message to ");
-    log += unit;
-    addLog(LOG_LEVEL_DEBUG_MORE, log);
-  }
+  addLogFmt(LOG_LEVEL_DEBUG_MORE, F("UDP  : Send UDP message to %u"), unit);
 #endif // ifndef BUILD_NO_DEBUG
 
   statusLED(true);
@@ -3,6 +3,7 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../Helpers/UDP_PacketReader.h"
 
 #include <WiFiClient.h>
 #include <WiFiUdp.h>
@@ -23,6 +24,7 @@ void updateUDPport();
    Check UDP messages (ESPEasy propiertary protocol)
 \*********************************************************************************************/
 extern boolean runningUPDCheck;
+extern UDP_ReceiveStats udpReceiveStats;
 void checkUDP();
 
 /*********************************************************************************************\
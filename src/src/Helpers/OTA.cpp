@@ -5,6 +5,7 @@
 #include "../Globals/SecuritySettings.h"
 #include "../Globals/Services.h"
 #include "../Globals/Settings.h"
+#include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Misc.h"
 
 bool OTA_possible(uint32_t& maxSketchSize, bool& use2step) {
@@ -58,6 +59,7 @@ void ArduinoOTAInit()
   ArduinoOTA.onStart([]() {
     serialPrintln(F("OTA  : Start upload"));
     ArduinoOTAtriggered = true;
+    flushPendingSettingsWrites();
     ESPEASY_FS.end(); // important, otherwise it fails
   });
 
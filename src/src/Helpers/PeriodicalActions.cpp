@@ -4,6 +4,7 @@
 
 #include "../../ESPEasy-Globals.h"
 
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
 #include "../ControllerQueue/DelayQueueElements.h"
 #include "../ControllerQueue/MQTT_queue_element.h"
 #include "../DataStructs/TimingStats.h"
@@ -28,6 +29,7 @@
 #include "../Globals/Settings.h"
 #include "../Globals/Statistics.h"
 #include "../Helpers/ESPEasyRTC.h"
+#include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Hardware.h"
 #include "../Helpers/Memory.h"
 #include "../Helpers/Misc.h"
@@ -91,6 +93,7 @@ void run10TimesPerSecond() {
     STOP_TIMER(CPLUGIN_CALL_10PS);
   }
   processNextEvent();
+  processPendingSettingsWrites();
   
   #ifdef USES_C015
   if (NetworkConnected())
@@ -189,6 +192,9 @@ void runOncePerSecond()
   }
 
   checkResetFactoryPin();
+
+  // Spilled controller queue elements are not flushed per element, so do not keep them in the file buffer too long.
+  ControllerQueueSpillFile::flushAllWhenDue();
   STOP_TIMER(PLUGIN_CALL_1PS);
 }
 
@@ -315,11 +321,13 @@ void processMQTTdelayQueue() {
     MQTTDelayHandler->markProcessed(false);
 #ifndef BUILD_NO_DEBUG
 
-    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-      String log = F("MQTT : process MQTT queue not published, ");
-      log += MQTTDelayHandler->sendQueue.size();
-      log += F(" items left in queue");
-      addLog(LOG_LEVEL_DEBUG, log);
+    if (MQTTDelayHandler->spillFile.empty()) {
+      addLogFmt(LOG_LEVEL_DEBUG, F("MQTT : process MQTT queue not published, %u items left in queue"),
+                MQTTDelayHandler->sendQueue.size());
+    } else {
+      addLogFmt(LOG_LEVEL_DEBUG, F("MQTT : process MQTT queue not published, %u items left in queue, %u on file"),
+                MQTTDelayHandler->sendQueue.size(),
+                MQTTDelayHandler->spillFile.size());
     }
 #endif // ifndef BUILD_NO_DEBUG
   }
@@ -483,6 +491,8 @@ void prepareShutdown(ESPEasy_Scheduler::IntendedRebootReason_e reason)
   process_serialWriteBuffer();
   flushAndDisconnectAllClients();
   saveUserVarToRTC();
+  flushPendingSettingsWrites();
+  ControllerQueueSpillFile::flushAll();
   ESPEASY_FS.end();
   delay(100); // give the node time to flush all before reboot or sleep
   node_time.now();
@@ -4,6 +4,7 @@
 
 #include "../ESPEasyCore/ESPEasy_Log.h"
 #include "../Globals/RamTracker.h"
+#include "../Globals/RuntimeData.h"
 #include "../Helpers/ESPEasy_math.h"
 #include "../Helpers/Numerical.h"
 #include "../Helpers/StringConverter.h"
@@ -82,7 +83,7 @@ CalculateReturnCode RulesCalculate_t::push(double value)
 {
   if (sp != sp_max) // Full
   {
-    *(++sp) = value;
+    *(sp++) = value;
     return CalculateReturnCode::OK;
   }
   return CalculateReturnCode::ERROR_STACK_OVERFLOW;
@@ -90,8 +91,8 @@ CalculateReturnCode RulesCalculate_t::push(double value)
 
 double RulesCalculate_t::pop()
 {
-  if (sp != (globalstack - 1)) { // empty
-    return *(sp--);
+  if (sp != globalstack) { // empty
+    return *(--sp);
   }
   else {
     return 0.0f;
@@ -217,40 +218,67 @@ double RulesCalculate_t::apply_unary_operator(char op, double first)
    return linep;
    }
  */
-CalculateReturnCode RulesCalculate_t::RPNCalculate(char *token)
+CalculateReturnCode RulesCalculate_t::addToken(RulesCalculateProgram& program, char *token)
 {
-  CalculateReturnCode ret = CalculateReturnCode::OK;
-
   if (token[0] == 0) {
-    return ret; // Don't bother for an empty string
+    return CalculateReturnCode::OK; // Don't bother for an empty string
   }
+  RPNInstruction instruction;
+
+  instruction.op     = token[0];
+  instruction.negate = false;
+  instruction.index  = 0;
 
   if (is_operator(token[0]) && (token[1] == 0))
   {
-    double second = pop();
-    double first  = pop();
-
-    ret = push(apply_operator(token[0], first, second));
-
-    if (isError(ret)) { return ret; }
+    instruction.opcode = RPNOpcode::Operator;
   } else if (is_unary_operator(token[0]) && (token[1] == 0))
   {
-    double first = pop();
-
-    ret = push(apply_unary_operator(token[0], first));
-
-    if (isError(ret)) { return ret; }
+    instruction.opcode = RPNOpcode::UnaryOperator;
   } else {
-    // Fetch next if there is any
     double value = 0.0;
     validDoubleFromString(token, value);
 
-    ret = push(value); // If it is a value, push to the stack
+    instruction.opcode = RPNOpcode::Constant;
+    instruction.index  = program.constants.size();
+    program.constants.push_back(value);
+  }
+  program.code.push_back(instruction);
+  return CalculateReturnCode::OK;
+}
+
+size_t RulesCalculate_t::matchVariable(const char *input, bool taskValueVariables, RPNOpcode& opcode, uint16_t& index)
+{
+  index = 0;
+
+  if (taskValueVariables) {
+    if (strncmp_P(input, PSTR("%value%"), 7) == 0) {
+      opcode = RPNOpcode::Value;
+      return 7;
+    }
 
-    if (isError(ret)) { return ret; }
+    if (strncmp_P(input, PSTR("%pvalue%"), 8) == 0) {
+      opcode = RPNOpcode::PreviousValue;
+      return 8;
+    }
   }
 
-  return ret;
+  const bool isVar = strncasecmp_P(input, PSTR("[var#"), 5) == 0;
+
+  if (isVar || (strncasecmp_P(input, PSTR("[int#"), 5) == 0)) {
+    size_t length = 5;
+
+    while (isdigit(input[length])) {
+      index = index * 10 + (input[length] - '0');
+      ++length;
+    }
+
+    if ((length > 5) && (input[length] == ']')) {
+      opcode = isVar ? RPNOpcode::Variable : RPNOpcode::IntVariable;
+      return length + 1;
+    }
+  }
+  return 0;
 }
 
 // operators
@@ -298,12 +326,25 @@ unsigned int RulesCalculate_t::op_arg_count(const char c)
 }
 
 CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *result)
+{
+  // Reuse the same program, to not allocate memory for every calculation.
+  CalculateReturnCode error = compile(input, false, scratchProgram);
+
+  if (isError(error)) {
+    *result = 0;
+    return error;
+  }
+  return evaluate(scratchProgram, 0.0, 0.0, result);
+}
+
+CalculateReturnCode RulesCalculate_t::compile(const char *input, bool taskValueVariables, RulesCalculateProgram& program)
 {
   #define TOKEN_LENGTH 25
   #define OPERATOR_STACK_SIZE 32
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("Calculate"));
   #endif // ifndef BUILD_NO_RAM_TRACKER
+  program.clear();
   const char *strpos = input, *strend = input + strlen(input);
   char token[TOKEN_LENGTH];
   char c, oc, *TokenPos = token;
@@ -312,8 +353,6 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
   char sc;                         // used for record stack element
   CalculateReturnCode error = CalculateReturnCode::OK;
 
-  // *sp=0; // bug, it stops calculating after 50 times
-  sp = globalstack - 1;
   oc = c = 0;
 
   if (input[0] == '=') {
@@ -332,7 +371,40 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
     oc = c;
     c  = *strpos;
 
-    if (c != ' ')
+    RPNOpcode varOpcode;
+    uint16_t  varIndex     = 0;
+    size_t    varLength    = 0;
+
+    if ((c == '%') || (c == '[')) {
+      varLength = matchVariable(strpos, taskValueVariables, varOpcode, varIndex);
+    }
+
+    if (varLength != 0)
+    {
+      // A variable is an operand, just like a number.
+      // Only a '-' sign is allowed before it, e.g. "2*-%value%"
+      bool negate = false;
+
+      if (TokenPos != token) {
+        if (((TokenPos - token) == 1) && (token[0] == '-')) {
+          negate = true;
+        } else {
+          return CalculateReturnCode::ERROR_UNKNOWN_TOKEN;
+        }
+        TokenPos = token;
+      }
+      RPNInstruction instruction;
+      instruction.opcode = varOpcode;
+      instruction.op     = 0;
+      instruction.negate = negate;
+      instruction.index  = varIndex;
+      program.code.push_back(instruction);
+
+      // Continue as if a number was read, so a following '-' is seen as operator.
+      strpos += varLength - 1;
+      c       = '1';
+    }
+    else if (c != ' ')
     {
       // If the token is a number (identifier), then add it to the token queue.
       if (is_number(oc, c))
@@ -345,7 +417,7 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
       else if (is_operator(c) || is_unary_operator(c))
       {
         *(TokenPos) = 0; // Mark end of token string
-        error       = RPNCalculate(token);
+        error       = addToken(program, token);
         TokenPos    = token;
 
         if (isError(error)) { return error; }
@@ -370,7 +442,7 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
             *TokenPos = sc;
             ++TokenPos;
             *(TokenPos) = 0; // Mark end of token string
-            error       = RPNCalculate(token);
+            error       = addToken(program, token);
             TokenPos    = token;
 
             if (isError(error)) { return error; }
@@ -404,7 +476,7 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
         while (sl > 0)
         {
           *(TokenPos) = 0; // Mark end of token string
-          error       = RPNCalculate(token);
+          error       = addToken(program, token);
           TokenPos    = token;
 
           if (isError(error)) { return error; }
@@ -457,7 +529,7 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
     }
 
     *(TokenPos) = 0; // Mark end of token string
-    error       = RPNCalculate(token);
+    error       = addToken(program, token);
     TokenPos    = token;
 
     if (isError(error)) { return error; }
@@ -467,21 +539,92 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, double *res
   }
 
   *(TokenPos) = 0; // Mark end of token string
-  error       = RPNCalculate(token);
+  error       = addToken(program, token);
   TokenPos    = token;
 
   if (isError(error))
   {
-    *result = 0;
     return error;
   }
-  *result = *sp;
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("Calculate2"));
   #endif // ifndef BUILD_NO_RAM_TRACKER
   return CalculateReturnCode::OK;
 }
 
+CalculateReturnCode RulesCalculate_t::evaluate(const RulesCalculateProgram& program,
+                                               double                       value,
+                                               double                       prevValue,
+                                               double                      *result)
+{
+  CalculateReturnCode error = CalculateReturnCode::OK;
+
+  sp = globalstack;
+
+  for (auto it = program.code.begin(); it != program.code.end() && !isError(error); ++it) {
+    switch (it->opcode) {
+      case RPNOpcode::Constant:
+        error = push(program.constants[it->index]);
+        break;
+      case RPNOpcode::Value:
+        error = push(it->negate ? -value : value);
+        break;
+      case RPNOpcode::PreviousValue:
+        error = push(it->negate ? -prevValue : prevValue);
+        break;
+      case RPNOpcode::Variable:
+      {
+        const double var = getCustomFloatVar(it->index);
+        error = push(it->negate ? -var : var);
+        break;
+      }
+      case RPNOpcode::IntVariable:
+      {
+        // Same rounding as used for [INT#n] by parseTemplate()
+        const double var = round(getCustomFloatVar(it->index));
+        error = push(it->negate ? -var : var);
+        break;
+      }
+      case RPNOpcode::Operator:
+      {
+        const double second = pop();
+        const double first  = pop();
+        error = push(apply_operator(it->op, first, second));
+        break;
+      }
+      case RPNOpcode::UnaryOperator:
+        error = push(apply_unary_operator(it->op, pop()));
+        break;
+    }
+  }
+
+  if (isError(error)) {
+    *result = 0;
+    return error;
+  }
+
+  // An empty expression leaves nothing on the stack
+  *result = (sp == globalstack) ? 0.0 : *(sp - 1);
+  return CalculateReturnCode::OK;
+}
+
+void RulesCalculateProgram::clear()
+{
+  code.clear();
+  constants.clear();
+}
+
+void RulesCalculateProgram::shrink_to_fit()
+{
+  code.shrink_to_fit();
+  constants.shrink_to_fit();
+}
+
+size_t RulesCalculateProgram::getMemoryUsage() const
+{
+  return code.capacity() * sizeof(RPNInstruction) + constants.capacity() * sizeof(double);
+}
+
 void preProcessReplace(String& input, UnaryOperator op) {
   String find = toString(op);
 
@@ -641,49 +784,190 @@ int CalculateParam(const String& TmpStr) {
   return returnValue;
 }
 
+void logCalculateError(CalculateReturnCode returnCode, const String& input, double result)
+{
+  if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+    String log = F("Calculate: ");
+
+    switch (returnCode) {
+      case CalculateReturnCode::ERROR_STACK_OVERFLOW:
+        log += F("Stack Overflow");
+        break;
+      case CalculateReturnCode::ERROR_BAD_OPERATOR:
+        log += F("Bad Operator");
+        break;
+      case CalculateReturnCode::ERROR_PARENTHESES_MISMATCHED:
+        log += F("Parenthesis mismatch");
+        break;
+      case CalculateReturnCode::ERROR_UNKNOWN_TOKEN:
+        log += F("Unknown token");
+        break;
+      case CalculateReturnCode::ERROR_TOKEN_LENGTH_EXCEEDED:
+        log += String(F("Exceeded token length (")) + TOKEN_LENGTH + ')';
+        break;
+      case CalculateReturnCode::OK:
+        // Already handled, but need to have all cases here so the compiler can warn if we're missing one.
+        break;
+    }
+
+    #ifndef BUILD_NO_DEBUG
+    log += F(" input: ");
+    log += input;
+    log += F(" = ");
+
+    const bool trimTrailingZeros = true;
+    log += doubleToString(result, 6, trimTrailingZeros);
+    #endif // ifndef BUILD_NO_DEBUG
+
+    addLog(LOG_LEVEL_ERROR, log);
+  }
+}
+
 CalculateReturnCode Calculate(const String& input,
                               double      & result)
 {
-  CalculateReturnCode returnCode = RulesCalculate.doCalculate(
-    RulesCalculate_t::preProces(input).c_str(),
-    &result);
+  CalculateReturnCode returnCode;
+
+  if (input.indexOf('[') != -1) {
+    // May contain variables, which are read when evaluating the compiled expression.
+    returnCode = RulesCalculateExpressions.calculate(input, result);
+  } else {
+    returnCode = RulesCalculate.doCalculate(
+      RulesCalculate_t::preProces(input).c_str(),
+      &result);
+  }
 
   if (isError(returnCode)) {
-    if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
-      String log = F("Calculate: ");
-
-      switch (returnCode) {
-        case CalculateReturnCode::ERROR_STACK_OVERFLOW:
-          log += F("Stack Overflow");
-          break;
-        case CalculateReturnCode::ERROR_BAD_OPERATOR:
-          log += F("Bad Operator");
-          break;
-        case CalculateReturnCode::ERROR_PARENTHESES_MISMATCHED:
-          log += F("Parenthesis mismatch");
-          break;
-        case CalculateReturnCode::ERROR_UNKNOWN_TOKEN:
-          log += F("Unknown token");
-          break;
-        case CalculateReturnCode::ERROR_TOKEN_LENGTH_EXCEEDED:
-          log += String(F("Exceeded token length (")) + TOKEN_LENGTH + ')';
-          break;
-        case CalculateReturnCode::OK:
-          // Already handled, but need to have all cases here so the compiler can warn if we're missing one.
-          break;
-      }
+    logCalculateError(returnCode, input, result);
+  }
+  return returnCode;
+}
+
+CalculateReturnCode CalculateFormula(taskIndex_t taskIndex,
+                                     byte        varNr,
+                                     const char *formula,
+                                     double      value,
+                                     double      prevValue,
+                                     double    & result)
+{
+  const uint16_t key             = taskIndex * VARS_PER_TASK + varNr;
+  CalculateReturnCode returnCode = RulesCalculateFormulas.calculate(key, formula, value, prevValue, result);
+
+  if (isError(returnCode)) {
+    logCalculateError(returnCode, formula, result);
+  }
+  return returnCode;
+}
 
-      #ifndef BUILD_NO_DEBUG
-      log += F(" input: ");
-      log += input;
-      log += F(" = ");
+/********************************************************************************************\
+   Caches of compiled expressions
+ \*********************************************************************************************/
+RulesCalculateFormulaCache    RulesCalculateFormulas;
+RulesCalculateExpressionCache RulesCalculateExpressions;
 
-      const bool trimTrailingZeros = true;
-      log += doubleToString(result, 6, trimTrailingZeros);
-      #endif // ifndef BUILD_NO_DEBUG
+void clearRulesCalculateCache()
+{
+  RulesCalculateFormulas.clear();
+  RulesCalculateExpressions.clear();
+}
 
-      addLog(LOG_LEVEL_ERROR, log);
+CalculateReturnCode RulesCalculateFormulaCache::calculate(uint16_t    key,
+                                                          const char *formula,
+                                                          double      value,
+                                                          double      prevValue,
+                                                          double    & result)
+{
+  auto it = _formulas.find(key);
+
+  if ((it == _formulas.end()) || !it->second.formula.equals(formula)) {
+    Entry& entry = _formulas[key];
+    entry.formula = formula;
+    const CalculateReturnCode returnCode = RulesCalculate.compile(
+      RulesCalculate_t::preProces(entry.formula).c_str(),
+      true,
+      entry.program);
+
+    if (isError(returnCode)) {
+      _formulas.erase(key);
+      result = 0;
+      return returnCode;
     }
+    entry.program.shrink_to_fit();
+    it = _formulas.find(key);
   }
-  return returnCode;
+  return RulesCalculate.evaluate(it->second.program, value, prevValue, &result);
+}
+
+void RulesCalculateFormulaCache::clear()
+{
+  _formulas.clear();
+}
+
+size_t RulesCalculateFormulaCache::getMemoryUsage() const
+{
+  size_t res = 0;
+
+  for (auto it = _formulas.begin(); it != _formulas.end(); ++it) {
+    res += sizeof(Entry) + it->second.formula.length() + it->second.program.getMemoryUsage();
+  }
+  return res;
+}
+
+CalculateReturnCode RulesCalculateExpressionCache::calculate(const String& input,
+                                                             double      & result)
+{
+  ++_useCounter;
+
+  for (auto it = _expressions.begin(); it != _expressions.end(); ++it) {
+    if (it->expression.equals(input)) {
+      ++hits;
+      it->lastUsed = _useCounter;
+      return RulesCalculate.evaluate(it->program, 0.0, 0.0, &result);
+    }
+  }
+  ++misses;
+
+  // Replace the least recently used expression when the cache is full.
+  auto entry = _expressions.begin();
+
+  if (_expressions.size() < RULES_CALCULATE_CACHE_SIZE) {
+    _expressions.emplace_back();
+    entry = _expressions.end() - 1;
+  } else {
+    for (auto it = _expressions.begin(); it != _expressions.end(); ++it) {
+      if (it->lastUsed < entry->lastUsed) {
+        entry = it;
+      }
+    }
+  }
+
+  const CalculateReturnCode returnCode = RulesCalculate.compile(
+    RulesCalculate_t::preProces(input).c_str(),
+    false,
+    entry->program);
+
+  if (isError(returnCode)) {
+    _expressions.erase(entry);
+    result = 0;
+    return returnCode;
+  }
+  entry->program.shrink_to_fit();
+  entry->expression = input;
+  entry->lastUsed   = _useCounter;
+  return RulesCalculate.evaluate(entry->program, 0.0, 0.0, &result);
+}
+
+void RulesCalculateExpressionCache::clear()
+{
+  _expressions.clear();
+}
+
+size_t RulesCalculateExpressionCache::getMemoryUsage() const
+{
+  size_t res = 0;
+
+  for (auto it = _expressions.begin(); it != _expressions.end(); ++it) {
+    res += sizeof(Entry) + it->expression.length() + it->program.getMemoryUsage();
+  }
+  return res;
 }
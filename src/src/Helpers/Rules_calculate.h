@@ -4,6 +4,11 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../DataTypes/TaskIndex.h"
+
+#include <map>
+#include <vector>
+
 /********************************************************************************************\
    Calculate function for simple expressions
  \*********************************************************************************************/
@@ -54,12 +59,48 @@ void   preProcessReplace(String      & input,
 bool   angleDegree(UnaryOperator op);
 String toString(UnaryOperator op);
 
+/********************************************************************************************\
+   Compiled expression, stored in Reverse Polish Notation.
+   A compiled expression can be evaluated without parsing the expression text again.
+ \*********************************************************************************************/
+enum class RPNOpcode : uint8_t {
+  Constant,      // Push constants[index]
+  Value,         // Push the value (%value% in task formulas)
+  PreviousValue, // Push the previous value (%pvalue% in task formulas)
+  Variable,      // Push [VAR#index]
+  IntVariable,   // Push [INT#index], the variable rounded to an integer
+  Operator,      // Apply binary operator op
+  UnaryOperator  // Apply unary operator op
+};
+
+struct RPNInstruction {
+  RPNOpcode opcode;
+  char      op;
+  bool      negate; // Push the negative value of a variable, e.g. "2*-%value%"
+  uint16_t  index;
+};
+
+struct RulesCalculateProgram {
+  void   clear();
+
+  // Release unused memory, for programs which are kept.
+  void   shrink_to_fit();
+
+  size_t getMemoryUsage() const;
+
+  std::vector<RPNInstruction>code;
+  std::vector<double>constants;
+};
+
 class RulesCalculate_t {
 private:
 
   double globalstack[STACK_SIZE];
-  double *sp     = globalstack - 1;
-  const double *sp_max = &globalstack[STACK_SIZE - 1];
+  double *sp     = globalstack; // First free position on the stack
+  const double *sp_max = &globalstack[STACK_SIZE];
+
+  // Used by doCalculate()
+  RulesCalculateProgram scratchProgram;
 
   // Check if it matches part of a number (identifier)
   // @param oc  Previous character
@@ -84,7 +125,8 @@ private:
 
   //  char              * next_token(char *linep);
 
-  CalculateReturnCode RPNCalculate(char *token);
+  CalculateReturnCode addToken(RulesCalculateProgram& program,
+                               char                  *token);
 
   // operators
   // precedence   operators         associativity
@@ -104,6 +146,24 @@ public:
   CalculateReturnCode doCalculate(const char *input,
                                   double     *result);
 
+  // Convert an expression into RPN instructions.
+  // When taskValueVariables is set, %value% and %pvalue% are accepted as variables.
+  CalculateReturnCode compile(const char            *input,
+                              bool                   taskValueVariables,
+                              RulesCalculateProgram& program);
+
+  CalculateReturnCode evaluate(const RulesCalculateProgram& program,
+                               double                       value,
+                               double                       prevValue,
+                               double                      *result);
+
+  // Check for a variable at the start of input.
+  // Return the length of the variable, or 0 when there is none.
+  static size_t matchVariable(const char *input,
+                              bool        taskValueVariables,
+                              RPNOpcode & opcode,
+                              uint16_t  & index);
+
   // Try to replace multi byte operators with single character ones.
   // For example log, sin, cos, tan.
   static String preProces(const String& input);
@@ -111,6 +171,73 @@ public:
 
 extern RulesCalculate_t RulesCalculate;
 
+
+/********************************************************************************************\
+   Cache of compiled task formulas, indexed by task and value number.
+   The formula text is kept to detect changes in the task settings.
+ \*********************************************************************************************/
+class RulesCalculateFormulaCache {
+public:
+
+  CalculateReturnCode calculate(uint16_t    key,
+                                const char *formula,
+                                double      value,
+                                double      prevValue,
+                                double    & result);
+
+  void   clear();
+
+  size_t getMemoryUsage() const;
+
+private:
+
+  struct Entry {
+    String                formula;
+    RulesCalculateProgram program;
+  };
+
+  std::map<uint16_t, Entry>_formulas;
+};
+
+
+/********************************************************************************************\
+   Least Recently Used cache of compiled rules expressions, indexed by expression text.
+   Only expressions with variables ([VAR#n], [INT#n]) are kept. The variables are read when
+   the expression is evaluated, so the same compiled expression is used for every value.
+   Expressions where all values are already filled in are not kept, as those differ almost
+   every time.
+ \*********************************************************************************************/
+class RulesCalculateExpressionCache {
+public:
+
+  CalculateReturnCode calculate(const String& input,
+                                double      & result);
+
+  void   clear();
+
+  size_t getMemoryUsage() const;
+
+  uint32_t hits   = 0;
+  uint32_t misses = 0;
+
+private:
+
+  struct Entry {
+    String                expression;
+    RulesCalculateProgram program;
+    uint32_t              lastUsed = 0;
+  };
+
+  std::vector<Entry>_expressions;
+  uint32_t _useCounter = 0;
+};
+
+extern RulesCalculateFormulaCache    RulesCalculateFormulas;
+extern RulesCalculateExpressionCache RulesCalculateExpressions;
+
+// Clear all compiled expressions, e.g. when settings are saved.
+void clearRulesCalculateCache();
+
 /*******************************************************************************************
 * Helper functions to actually interact with the rules calculation functions.
 * *****************************************************************************************/
@@ -120,5 +247,14 @@ int                 CalculateParam(const String& TmpStr);
 CalculateReturnCode Calculate(const String& input,
                               double      & result);
 
+// Compute the formula of a task value.
+// %value% and %pvalue% in the formula are replaced by value and prevValue.
+CalculateReturnCode CalculateFormula(taskIndex_t taskIndex,
+                                     byte        varNr,
+                                     const char *formula,
+                                     double      value,
+                                     double      prevValue,
+                                     double    & result);
+
 
 #endif // ifndef HELPERS_RULES_CALCULATE_H
@@ -586,7 +586,7 @@ void ESPEasy_Scheduler::setPluginTaskTimer(unsigned long msecFromNow, taskIndex_
   timer_data.Par3            = Par3;
   timer_data.Par4            = Par4;
   timer_data.Par5            = Par5;
-  systemTimers[mixedTimerId] = timer_data;
+  systemTimers.set(mixedTimerId, timer_data);
   setNewTimerAt(mixedTimerId, millis() + msecFromNow);
 }
 
@@ -594,18 +594,18 @@ void ESPEasy_Scheduler::process_plugin_task_timer(unsigned long id) {
   START_TIMER;
 
   const unsigned long mixedTimerId = getMixedId(PLUGIN_TASK_TIMER, id);
-  auto it                          = systemTimers.find(mixedTimerId);
+  systemTimerStruct  *systemTimer  = systemTimers.get(mixedTimerId);
 
-  if (it == systemTimers.end()) { return; }
+  if (systemTimer == nullptr) { return; }
 
-  const deviceIndex_t deviceIndex = getDeviceIndex_from_TaskIndex(it->second.TaskIndex);
+  const deviceIndex_t deviceIndex = getDeviceIndex_from_TaskIndex(systemTimer->TaskIndex);
 
-  struct EventStruct TempEvent(it->second.TaskIndex);
-  TempEvent.Par1         = it->second.Par1;
-  TempEvent.Par2         = it->second.Par2;
-  TempEvent.Par3         = it->second.Par3;
-  TempEvent.Par4         = it->second.Par4;
-  TempEvent.Par5         = it->second.Par5;
+  struct EventStruct TempEvent(systemTimer->TaskIndex);
+  TempEvent.Par1         = systemTimer->Par1;
+  TempEvent.Par2         = systemTimer->Par2;
+  TempEvent.Par3         = systemTimer->Par3;
+  TempEvent.Par4         = systemTimer->Par4;
+  TempEvent.Par5         = systemTimer->Par5;
 
   // TD-er: Not sure if we have to keep original source for notifications.
   TempEvent.Source = EventValueSource::Enum::VALUE_SOURCE_SYSTEM;
@@ -615,7 +615,7 @@ void ESPEasy_Scheduler::process_plugin_task_timer(unsigned long id) {
      String log = F("proc_system_timer: Pluginid: ");
      log += deviceIndex;
      log += F(" taskIndex: ");
-     log += it->second.TaskIndex;
+     log += systemTimer->TaskIndex;
      log += F(" sysTimerID: ");
      log += id;
      addLog(LOG_LEVEL_INFO, log);
@@ -660,7 +660,7 @@ bool ESPEasy_Scheduler::setRulesTimer(unsigned long msecFromNow, unsigned int ti
   const unsigned long mixedTimerId = getMixedId(RULES_TIMER, createRulesTimerId(timerIndex));
   const systemTimerStruct timer_data(recurringCount, msecFromNow, timerIndex);
 
-  systemTimers[mixedTimerId] = timer_data;
+  systemTimers.set(mixedTimerId, timer_data);
   setNewTimerAt(mixedTimerId, millis() + msecFromNow);
   return true;
 }
@@ -668,11 +668,11 @@ bool ESPEasy_Scheduler::setRulesTimer(unsigned long msecFromNow, unsigned int ti
 void ESPEasy_Scheduler::process_rules_timer(unsigned long id, unsigned long lasttimer) {
   const unsigned long mixedTimerId = getMixedId(RULES_TIMER, id);
 
-  auto it = systemTimers.find(mixedTimerId);
+  systemTimerStruct *systemTimer = systemTimers.get(mixedTimerId);
 
-  if (it == systemTimers.end()) { return; }
+  if (systemTimer == nullptr) { return; }
 
-  if (it->second.isPaused()) {
+  if (systemTimer->isPaused()) {
     // Timer is paused.
     // Must keep this timer 'active' in the scheduler.
     // However it does not need to be looked at frequently as the resume function re-schedules it when needed.
@@ -682,16 +682,16 @@ void ESPEasy_Scheduler::process_rules_timer(unsigned long id, unsigned long last
   }
 
   // Create a deep copy of the timer data as we may delete it from the map before sending the event.
-  const int loopCount  = it->second.getLoopCount();
-  const int timerIndex = it->second.getTimerIndex();
+  const int loopCount  = systemTimer->getLoopCount();
+  const int timerIndex = systemTimer->getTimerIndex();
 
   // Reschedule before sending the event, as it may get rescheduled in handling the timer event.
-  if (it->second.isRecurring()) {
+  if (systemTimer->isRecurring()) {
     // Recurring timer
     unsigned long newTimer = lasttimer;
-    setNextTimeInterval(newTimer, it->second.getInterval());
+    setNextTimeInterval(newTimer, systemTimer->getInterval());
     setNewTimerAt(mixedTimerId, newTimer);
-    it->second.markNextRecurring();
+    systemTimer->markNextRecurring();
   } else {
     systemTimers.erase(mixedTimerId);
   }
@@ -713,9 +713,9 @@ void ESPEasy_Scheduler::process_rules_timer(unsigned long id, unsigned long last
 bool ESPEasy_Scheduler::pause_rules_timer(unsigned long timerIndex) {
   if (!checkRulesTimerIndex(timerIndex)) { return false; }
   const unsigned long mixedTimerId = getMixedId(RULES_TIMER, createRulesTimerId(timerIndex));
-  auto it                          = systemTimers.find(mixedTimerId);
+  systemTimerStruct  *systemTimer  = systemTimers.get(mixedTimerId);
 
-  if (it == systemTimers.end()) {
+  if (systemTimer == nullptr) {
     addLog(LOG_LEVEL_INFO, F("TIMER: no timer set"));
     return false;
   }
@@ -723,14 +723,14 @@ bool ESPEasy_Scheduler::pause_rules_timer(unsigned long timerIndex) {
   unsigned long timer;
 
   if (msecTimerHandler.getTimerForId(mixedTimerId, timer)) {
-    if (it->second.isPaused()) {
+    if (systemTimer->isPaused()) {
       addLog(LOG_LEVEL_INFO, F("TIMER: already paused"));
     } else {
       // Store remainder of interval
       const long timeLeft = timePassedSince(timer) * -1;
 
       if (timeLeft > 0) {
-        it->second.setRemainder(timeLeft);
+        systemTimer->setRemainder(timeLeft);
         return true;
       }
     }
@@ -741,17 +741,17 @@ bool ESPEasy_Scheduler::pause_rules_timer(unsigned long timerIndex) {
 bool ESPEasy_Scheduler::resume_rules_timer(unsigned long timerIndex) {
   if (!checkRulesTimerIndex(timerIndex)) { return false; }
   const unsigned long mixedTimerId = getMixedId(RULES_TIMER, createRulesTimerId(timerIndex));
-  auto it                          = systemTimers.find(mixedTimerId);
+  systemTimerStruct  *systemTimer  = systemTimers.get(mixedTimerId);
 
-  if (it == systemTimers.end()) { return false; }
+  if (systemTimer == nullptr) { return false; }
 
   unsigned long timer;
 
   if (msecTimerHandler.getTimerForId(mixedTimerId, timer)) {
-    if (it->second.isPaused()) {
+    if (systemTimer->isPaused()) {
       // Reschedule timer with remainder of interval
-      setNewTimerAt(mixedTimerId, millis() + it->second.getRemainder());
-      it->second.setRemainder(0);
+      setNewTimerAt(mixedTimerId, millis() + systemTimer->getRemainder());
+      systemTimer->setRemainder(0);
       return true;
     }
   }
@@ -785,16 +785,16 @@ void ESPEasy_Scheduler::setPluginTimer(unsigned long msecFromNow, pluginID_t plu
   timer_data.Par3            = Par3;
   timer_data.Par4            = Par4;
   timer_data.Par5            = Par5;
-  systemTimers[mixedTimerId] = timer_data;
+  systemTimers.set(mixedTimerId, timer_data);
   setNewTimerAt(mixedTimerId, millis() + msecFromNow);
 }
 
 void ESPEasy_Scheduler::process_plugin_timer(unsigned long id) {
   START_TIMER;
   const unsigned long mixedTimerId = getMixedId(PLUGIN_TIMER, id);
-  auto it                          = systemTimers.find(mixedTimerId);
+  systemTimerStruct  *systemTimer  = systemTimers.get(mixedTimerId);
 
-  if (it == systemTimers.end()) { return; }
+  if (systemTimer == nullptr) { return; }
 
   struct EventStruct TempEvent;
   // PLUGIN_TIMER does not address a task, so don't set TaskIndex
@@ -802,22 +802,22 @@ void ESPEasy_Scheduler::process_plugin_timer(unsigned long id) {
   // extract deviceID from timer id:
   const deviceIndex_t deviceIndex = ((1 << 8) - 1) & id;
 
-  TempEvent.Par1 = it->second.Par1;
-  TempEvent.Par2 = it->second.Par2;
-  TempEvent.Par3 = it->second.Par3;
-  TempEvent.Par4 = it->second.Par4;
-  TempEvent.Par5 = it->second.Par5;
+  TempEvent.Par1 = systemTimer->Par1;
+  TempEvent.Par2 = systemTimer->Par2;
+  TempEvent.Par3 = systemTimer->Par3;
+  TempEvent.Par4 = systemTimer->Par4;
+  TempEvent.Par5 = systemTimer->Par5;
 
   // TD-er: Not sure if we have to keep original source for notifications.
   TempEvent.Source = EventValueSource::Enum::VALUE_SOURCE_SYSTEM;
 
-  //  const deviceIndex_t deviceIndex = getDeviceIndex_from_TaskIndex(it->second.TaskIndex);
+  //  const deviceIndex_t deviceIndex = getDeviceIndex_from_TaskIndex(systemTimer->TaskIndex);
 
   /*
      String log = F("proc_system_timer: Pluginid: ");
      log += deviceIndex;
      log += F(" taskIndex: ");
-     log += it->second.TaskIndex;
+     log += systemTimer->TaskIndex;
      log += F(" sysTimerID: ");
      log += id;
      addLog(LOG_LEVEL_INFO, log);
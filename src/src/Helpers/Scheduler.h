@@ -293,7 +293,7 @@ private:
 
   // Map mixed timer ID to system timer struct.
   // N.B. Must use Mixed timer ID, similar to how it is handled in the scheduler.
-  std::map<unsigned long, systemTimerStruct>systemTimers;
+  systemTimerMap systemTimers;
 
   msecTimerHandlerStruct msecTimerHandler;
 
@@ -237,25 +237,34 @@ void addNewLine(String& line) {
    Format a value to the set number of decimals
 \*********************************************************************************************/
 String doFormatUserVar(struct EventStruct *event, byte rel_index, bool mustCheck, bool& isvalid) {
-  if (event == nullptr) return EMPTY_STRING;
+  String result;
+
+  doFormatUserVar(event, rel_index, mustCheck, isvalid, result);
+  return result;
+}
+
+void doFormatUserVar(struct EventStruct *event, byte rel_index, bool mustCheck, bool& isvalid, String& result) {
+  if (event == nullptr) return;
   isvalid = true;
 
   const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(event->TaskIndex);
 
   if (!validDeviceIndex(DeviceIndex)) {
     isvalid = false;
-    return F("0");
+    result += '0';
+    return;
   }
 
   {
     // First try to format using the plugin specific formatting.
-    String result;
+    String formatted;
     EventStruct tempEvent;
     tempEvent.deep_copy(event);
     tempEvent.idx = rel_index;
-    PluginCall(PLUGIN_FORMAT_USERVAR, &tempEvent, result);
-    if (result.length() > 0) {
-      return result;
+    PluginCall(PLUGIN_FORMAT_USERVAR, &tempEvent, formatted);
+    if (formatted.length() > 0) {
+      result += formatted;
+      return;
     }
   }
 
@@ -278,14 +287,16 @@ String doFormatUserVar(struct EventStruct *event, byte rel_index, bool mustCheck
       addLog(LOG_LEVEL_ERROR, log);
     }
     #endif // ifndef BUILD_NO_DEBUG
-    return EMPTY_STRING;
+    return;
   }
 
   switch (sensorType) {
     case Sensor_VType::SENSOR_TYPE_LONG:
-      return String(UserVar.getSensorTypeLong(event->TaskIndex));
+      result += UserVar.getSensorTypeLong(event->TaskIndex);
+      return;
     case Sensor_VType::SENSOR_TYPE_STRING:
-      return event->String2;
+      result += event->String2;
+      return;
 
     default:
       break;
@@ -315,9 +326,14 @@ String doFormatUserVar(struct EventStruct *event, byte rel_index, bool mustCheck
     nrDecimals = 0;
   }
 
-  String result = toString(f, nrDecimals);
-  result.trim();
-  return result;
+  // Same as toString(f, nrDecimals), without a temporary String
+  char buf[33];
+  const char *formatted = dtostrf(f, (nrDecimals + 2), nrDecimals, buf);
+
+  while (*formatted == ' ') {
+    ++formatted;
+  }
+  result += formatted;
 }
 
 String formatUserVarNoCheck(taskIndex_t TaskIndex, byte rel_index) {
@@ -409,34 +425,63 @@ String to_json_object_value(const __FlashStringHelper * object,
 
 String to_json_object_value(const String& object, const String& value) {
   String result;
-  bool   isBool = (Settings.JSONBoolWithoutQuotes() && ((value.equalsIgnoreCase(F("true")) || value.equalsIgnoreCase(F("false")))));
+  const bool quoted = to_json_value_mustQuote(value);
 
-  result.reserve(object.length() + value.length() + 6);
+  result.reserve(object.length() + to_json_value_length(value, quoted) + 3);
   wrap_String(object, F("\""), result);
   result += F(":");
+  to_json_value(value, quoted, result);
+  return result;
+}
 
+bool to_json_value_mustQuote(const String& value) {
   if (value.isEmpty()) {
     // Empty string
-    result += F("\"\"");
-    return result;
+    return true;
   }
-  if (!isBool && mustConsiderAsString(value)) {
-    // Is not a numerical value, or BIN/HEX notation, thus wrap with quotes
-    if ((value.indexOf('\n') != -1) || (value.indexOf('\r') != -1) || (value.indexOf('"') != -1)) {
-      // Must replace characters, so make a deepcopy
-      String tmpValue(value);
-      tmpValue.replace('\n', '^');
-      tmpValue.replace('\r', '^');
-      tmpValue.replace('"',  '\'');
-      wrap_String(tmpValue, F("\""), result);
-    } else {
-      wrap_String(value, F("\""), result);
+  const bool isBool = (Settings.JSONBoolWithoutQuotes() && ((value.equalsIgnoreCase(F("true")) || value.equalsIgnoreCase(F("false")))));
+
+  // Is not a numerical value, or BIN/HEX notation, thus wrap with quotes
+  return !isBool && mustConsiderAsString(value);
+}
+
+size_t to_json_value_length(const String& value, bool quoted) {
+  // Replaced characters do not change the length
+  return quoted ? value.length() + 2 : value.length();
+}
+
+void to_json_value(const String& value, bool quoted, String& result) {
+  if (!quoted) {
+    // It is a numerical
+    result += value;
+    return;
+  }
+  result += '"';
+
+  if ((value.indexOf('\n') != -1) || (value.indexOf('\r') != -1) || (value.indexOf('"') != -1)) {
+    // Must replace characters
+    const size_t length = value.length();
+
+    for (size_t i = 0; i < length; ++i) {
+      const char c = value[i];
+
+      switch (c) {
+        case '\n':
+        case '\r':
+          result += '^';
+          break;
+        case '"':
+          result += '\'';
+          break;
+        default:
+          result += c;
+          break;
+      }
     }
   } else {
-    // It is a numerical
     result += value;
   }
-  return result;
+  result += '"';
 }
 
 /*********************************************************************************************\
@@ -657,10 +702,16 @@ void htmlStrongEscape(String& html)
 // ********************************************************************************
 String URLEncode(const char *msg)
 {
-  const char *hex = "0123456789abcdef";
   String encodedMsg;
 
   encodedMsg.reserve(strlen(msg));
+  URLEncode(msg, encodedMsg);
+  return encodedMsg;
+}
+
+void URLEncode(const char *msg, String& encodedMsg)
+{
+  const char *hex = "0123456789abcdef";
 
   while (*msg != '\0') {
     if ((('a' <= *msg) && (*msg <= 'z'))
@@ -676,7 +727,6 @@ String URLEncode(const char *msg)
     }
     msg++;
   }
-  return encodedMsg;
 }
 
 void repl(const __FlashStringHelper * key,
@@ -791,8 +841,13 @@ void parseSpecialCharacters(String& s, bool useURLencode)
 /********************************************************************************************\
    replace other system variables like %sysname%, %systime%, %ip%
  \*********************************************************************************************/
-void parseControllerVariables(String& s, struct EventStruct *event, bool useURLencode) {
-  s = parseTemplate(s, useURLencode);
+void parseControllerVariables(String& s, struct EventStruct *event, bool useURLencode, uint8_t templateNr) {
+  if (validControllerIndex(event->ControllerIndex) && validTaskIndex(event->TaskIndex)) {
+    // Controller templates are parsed for every value sent, so keep the parsed template.
+    s = parseTemplate_cached(s, ParsedTemplateCache::controllerOwner(event->ControllerIndex, event->TaskIndex, templateNr), 0, useURLencode);
+  } else {
+    s = parseTemplate(s, useURLencode);
+  }
   parseEventVariables(s, event, useURLencode);
 }
 
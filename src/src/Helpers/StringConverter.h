@@ -95,6 +95,13 @@ String doFormatUserVar(struct EventStruct *event,
                        bool                mustCheck,
                        bool              & isvalid);
 
+// Append the formatted value to 'result'.
+void   doFormatUserVar(struct EventStruct *event,
+                       byte                rel_index,
+                       bool                mustCheck,
+                       bool              & isvalid,
+                       String            & result);
+
 String formatUserVarNoCheck(taskIndex_t TaskIndex,
                             byte        rel_index);
 
@@ -138,6 +145,20 @@ String to_json_object_value(const __FlashStringHelper * object,
 String to_json_object_value(const String& object,
                             const String& value);
 
+/*********************************************************************************************\
+   Format a value for use in JSON, appended to 'result'.
+   Values which are not numerical are quoted, with '\n' and '\r' replaced by '^' and '"' by '\''.
+   to_json_value_length() is the number of characters to_json_value() will append.
+\*********************************************************************************************/
+bool   to_json_value_mustQuote(const String& value);
+
+size_t to_json_value_length(const String& value,
+                            bool          quoted);
+
+void   to_json_value(const String& value,
+                     bool          quoted,
+                     String      & result);
+
 /*********************************************************************************************\
    Strip wrapping chars (e.g. quotes)
 \*********************************************************************************************/
@@ -207,6 +228,10 @@ void   htmlStrongEscape(String& html);
 
 String URLEncode(const char *msg);
 
+// Append the URL encoded msg to encodedMsg.
+void   URLEncode(const char *msg,
+                 String    & encodedMsg);
+
 void   repl(const __FlashStringHelper * key,
             const String& val,
             String      & s,
@@ -230,9 +255,12 @@ void parseSpecialCharacters(String& s,
 /********************************************************************************************\
    replace other system variables like %sysname%, %systime%, %ip%
  \*********************************************************************************************/
+// templateNr must differ for each template a controller parses for the same task,
+// as the parsed template is kept per controller, task and templateNr.
 void parseControllerVariables(String            & s,
                               struct EventStruct *event,
-                              bool             useURLencode);
+                              bool                useURLencode,
+                              uint8_t             templateNr = 0);
 
 void parseSingleControllerVariable(String            & s,
                                    struct EventStruct *event,
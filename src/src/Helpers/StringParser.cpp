@@ -20,6 +20,7 @@
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringGenerator_GPIO.h"
 #include "../Helpers/StringParser.h"
+#include "../Helpers/SystemVariables.h"
 
 #include <Arduino.h>
 
@@ -70,86 +71,7 @@ String parseTemplate_padded(String& tmpString, byte minimal_lineSize, bool useUR
     // First copy all upto the start of the [...#...] part to be replaced.
     newString += tmpString.substring(lastStartpos, startpos);
 
-    // deviceName is lower case, so we can compare literal string (no need for equalsIgnoreCase)
-    if (deviceName.equals(F("plugin")))
-    {
-      // Handle a plugin request.
-      // For example: "[Plugin#GPIO#Pinstate#N]"
-      // The command is stored in valueName & format
-      String command;
-      command.reserve(valueName.length() + format.length() + 1);
-      command  = valueName;
-      command += '#';
-      command += format;
-      command.replace('#', ',');
-
-      if (getGPIOPinStateValues(command)) {
-        newString += command;
-      }
-/* @giig1967g
-      if (PluginCall(PLUGIN_REQUEST, 0, command))
-      {
-        // Do not call transformValue here.
-        // The "format" is not empty so must not call the formatter function.
-        newString += command;
-      }
-*/
-    }
-    else if (deviceName.equals(F("var")) || deviceName.equals(F("int")))
-    {
-      // Address an internal variable either as float or as int
-      // For example: Let,10,[VAR#9]
-      unsigned int varNum;
-
-      if (validUIntFromString(valueName, varNum)) {
-        unsigned char nr_decimals = maxNrDecimals_double(getCustomFloatVar(varNum));
-        bool trimTrailingZeros    = true;
-
-        if (deviceName.equals(F("int"))) {
-          nr_decimals = 0;
-        } else if (!format.isEmpty())
-        {
-          // There is some formatting here, so do not throw away decimals
-          trimTrailingZeros = false;
-        }
-        String value = doubleToString(getCustomFloatVar(varNum), nr_decimals, trimTrailingZeros);
-        value.trim();
-        transformValue(newString, minimal_lineSize, value, format, tmpString);
-      }
-    }
-    else
-    {
-      // Address a value from a plugin.
-      // For example: "[bme#temp]"
-      // If value name is unknown, run a PLUGIN_GET_CONFIG command.
-      // For example: "[<taskname>#getLevel]"
-      taskIndex_t taskIndex = findTaskIndexByName(deviceName);
-
-      if (validTaskIndex(taskIndex) && Settings.TaskDeviceEnabled[taskIndex]) {
-        byte valueNr = findDeviceValueIndexByName(valueName, taskIndex);
-
-        if (valueNr != VARS_PER_TASK) {
-          // here we know the task and value, so find the uservar
-          // Try to format and transform the values
-          bool   isvalid;
-          String value = formatUserVar(taskIndex, valueNr, isvalid);
-
-          if (isvalid) {
-            transformValue(newString, minimal_lineSize, value, format, tmpString);
-          }
-        } else {
-          // try if this is a get config request
-          struct EventStruct TempEvent(taskIndex);
-          String tmpName = valueName;
-
-          if (PluginCall(PLUGIN_GET_CONFIG, &TempEvent, tmpName))
-          {
-            transformValue(newString, minimal_lineSize, tmpName, format, tmpString);
-          }
-        }
-      }
-    }
-
+    parseTemplate_marker(newString, deviceName, valueName, format, minimal_lineSize, tmpString);
 
     // Conversion is done (or impossible) for the found "[...#...]"
     // Continue with the next one.
@@ -189,6 +111,436 @@ String parseTemplate_padded(String& tmpString, byte minimal_lineSize, bool useUR
   return newString;
 }
 
+void parseTemplate_marker(
+  String      & newString,
+  const String& deviceName,
+  const String& valueName,
+  String      & format,
+  byte          minimal_lineSize,
+  const String& tmpString)
+{
+  // deviceName is lower case, so we can compare literal string (no need for equalsIgnoreCase)
+  if (deviceName.equals(F("plugin")))
+  {
+    // Handle a plugin request.
+    // For example: "[Plugin#GPIO#Pinstate#N]"
+    // The command is stored in valueName & format
+    String command;
+    command.reserve(valueName.length() + format.length() + 1);
+    command  = valueName;
+    command += '#';
+    command += format;
+    command.replace('#', ',');
+
+    if (getGPIOPinStateValues(command)) {
+      newString += command;
+    }
+/* @giig1967g
+    if (PluginCall(PLUGIN_REQUEST, 0, command))
+    {
+      // Do not call transformValue here.
+      // The "format" is not empty so must not call the formatter function.
+      newString += command;
+    }
+*/
+  }
+  else if (deviceName.equals(F("var")) || deviceName.equals(F("int")))
+  {
+    // Address an internal variable either as float or as int
+    // For example: Let,10,[VAR#9]
+    unsigned int varNum;
+
+    if (validUIntFromString(valueName, varNum)) {
+      transformCustomVariable(newString, minimal_lineSize, varNum, deviceName.equals(F("int")), format, tmpString);
+    }
+  }
+  else
+  {
+    // Address a value from a plugin.
+    // For example: "[bme#temp]"
+    // If value name is unknown, run a PLUGIN_GET_CONFIG command.
+    // For example: "[<taskname>#getLevel]"
+    taskIndex_t taskIndex = findTaskIndexByName(deviceName);
+
+    if (validTaskIndex(taskIndex) && Settings.TaskDeviceEnabled[taskIndex]) {
+      byte valueNr = findDeviceValueIndexByName(valueName, taskIndex);
+
+      if (valueNr != VARS_PER_TASK) {
+        // here we know the task and value, so find the uservar
+        // Try to format and transform the values
+        bool   isvalid;
+        String value = formatUserVar(taskIndex, valueNr, isvalid);
+
+        if (isvalid) {
+          transformValue(newString, minimal_lineSize, value, format, tmpString);
+        }
+      } else {
+        // try if this is a get config request
+        struct EventStruct TempEvent(taskIndex);
+        String tmpName = valueName;
+
+        if (PluginCall(PLUGIN_GET_CONFIG, &TempEvent, tmpName))
+        {
+          transformValue(newString, minimal_lineSize, tmpName, format, tmpString);
+        }
+      }
+    }
+  }
+}
+
+/********************************************************************************************\
+   Parse string template, cached per owner
+ \*********************************************************************************************/
+String parseTemplate_cached(const String& tmpString, uint32_t owner)
+{
+  return parseTemplate_cached(tmpString, owner, 0, false);
+}
+
+String parseTemplate_cached(const String& tmpString, uint32_t owner, byte minimal_lineSize, bool useURLencode)
+{
+  if (parseTemplate_CallBack_ptr == nullptr) {
+    // Keep current loaded taskSettings to restore at the end.
+    const byte currentTaskIndex = ExtraTaskSettings.TaskIndex;
+
+    ParsedTemplateStruct *parsed = Cache.parsedTemplates.get(owner, tmpString, useURLencode);
+
+    if (parsed == nullptr) {
+      parsed = Cache.parsedTemplates.create(owner);
+
+      if ((parsed != nullptr) && !parseTemplate_compile(tmpString, useURLencode, *parsed)) {
+        // Keep it in the cache, so it is not parsed again to find out it cannot be compiled.
+        parsed->segments.clear();
+      }
+    }
+
+    if ((parsed != nullptr) && parsed->compiled) {
+      Cache.parsedTemplates.beginUse();
+      String result = parseTemplate_render(*parsed, minimal_lineSize, useURLencode);
+      Cache.parsedTemplates.endUse();
+
+      // Restore previous loaded taskSettings
+      if (currentTaskIndex != 255)
+      {
+        LoadTaskSettings(currentTaskIndex);
+      }
+      return result;
+    }
+  }
+  String tmp(tmpString);
+
+  return parseTemplate_padded(tmp, minimal_lineSize, useURLencode);
+}
+
+// Check for '%' or '{' from the given position on.
+// Without these, parseStandardConversions() and parse_string_commands() leave the text unchanged.
+static bool hasConversionMarkup(const String& text, unsigned int startpos)
+{
+  const unsigned int length = text.length();
+
+  for (unsigned int i = startpos; i < length; ++i) {
+    if ((text[i] == '%') || (text[i] == '{')) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void addTemplateLiteral(const String& tmpString, int startpos, int endpos, ParsedTemplateStruct& parsed)
+{
+  if (endpos <= startpos) {
+    return;
+  }
+
+  if (!parsed.segments.empty() && (parsed.segments.back().type == ParsedTemplateSegment::Type::Literal)) {
+    parsed.segments.back().text += tmpString.substring(startpos, endpos);
+    return;
+  }
+  ParsedTemplateSegment segment;
+
+  segment.type = ParsedTemplateSegment::Type::Literal;
+  segment.text = tmpString.substring(startpos, endpos);
+  parsed.segments.push_back(std::move(segment));
+}
+
+// Split text into literals and system variables, like SystemVariables::parseSystemVariables() would replace them.
+void addTemplateText(const String& tmpString, int startpos, int endpos, ParsedTemplateStruct& parsed)
+{
+  int literalStart = startpos;
+  int pos          = startpos;
+
+  while (pos < endpos) {
+    const int varStart = tmpString.indexOf('%', pos);
+
+    if ((varStart == -1) || (varStart >= endpos)) {
+      break;
+    }
+    const int varEnd = tmpString.indexOf('%', varStart + 1);
+
+    if ((varEnd == -1) || (varEnd >= endpos)) {
+      break;
+    }
+    const String token = tmpString.substring(varStart, varEnd + 1);
+    ParsedTemplateSegment segment;
+
+    const SystemVariables::Enum enumval = SystemVariables::fromString(token);
+    unsigned int varNum;
+
+    if (enumval != SystemVariables::Enum::UNKNOWN) {
+      segment.type  = ParsedTemplateSegment::Type::SystemVariable;
+      segment.index = enumval;
+    } else if (token.startsWith(F("%sunrise")) || token.startsWith(F("%sunset"))) {
+      // Contains an offset, e.g. "%sunrise-1h%"
+      segment.type = ParsedTemplateSegment::Type::SystemVariable_dynamic;
+      segment.text = token;
+    } else if (token.startsWith(F("%v")) &&
+               validUIntFromString(token.substring(2, token.length() - 1), varNum) &&
+               token.equals(String(F("%v")) + String(varNum) + '%')) {
+      segment.type  = ParsedTemplateSegment::Type::CustomVariable;
+      segment.index = varNum;
+    } else {
+      // Not a system variable, the closing '%' may be the start of one.
+      pos = varEnd;
+      continue;
+    }
+    addTemplateLiteral(tmpString, literalStart, varStart, parsed);
+    parsed.segments.push_back(std::move(segment));
+    pos          = varEnd + 1;
+    literalStart = pos;
+  }
+  addTemplateLiteral(tmpString, literalStart, endpos, parsed);
+}
+
+bool parseTemplate_compile(const String& tmpString, bool useURLencode, ParsedTemplateStruct& parsed)
+{
+  parsed.source       = tmpString;
+  parsed.useURLencode = useURLencode;
+  parsed.compiled     = false;
+  parsed.segments.clear();
+
+  String tmp(tmpString);
+
+  #ifndef BUILD_NO_SPECIAL_CHARACTERS_STRINGCONVERTER
+  parseSpecialCharacters(tmp, useURLencode);
+  #endif // ifndef BUILD_NO_SPECIAL_CHARACTERS_STRINGCONVERTER
+
+  int startpos     = 0;
+  int lastStartpos = 0;
+  int endpos       = 0;
+  String deviceName, valueName, format;
+
+  while (findNextDevValNameInString(tmp, startpos, endpos, deviceName, valueName, format)) {
+    for (int i = startpos; i < endpos; ++i) {
+      if (tmp[i] == '%') {
+        // System variables are replaced before looking up "[...#...]", so the result may differ each time.
+        parsed.segments.clear();
+        return false;
+      }
+    }
+    addTemplateText(tmp, lastStartpos, startpos, parsed);
+
+    ParsedTemplateSegment segment;
+    segment.type = ParsedTemplateSegment::Type::Marker;
+    unsigned int varNum;
+
+    if (deviceName.equals(F("var")) || deviceName.equals(F("int"))) {
+      if (validUIntFromString(valueName, varNum)) {
+        segment.type  = deviceName.equals(F("int")) ?
+                        ParsedTemplateSegment::Type::IntVariable :
+                        ParsedTemplateSegment::Type::Variable;
+        segment.index = varNum;
+        segment.text  = format;
+      }
+    } else if (!deviceName.equals(F("plugin"))) {
+      const taskIndex_t taskIndex = findTaskIndexByName(deviceName);
+
+      if (validTaskIndex(taskIndex) && Settings.TaskDeviceEnabled[taskIndex]) {
+        const byte valueNr = findDeviceValueIndexByName(valueName, taskIndex);
+
+        if (valueNr != VARS_PER_TASK) {
+          segment.type      = ParsedTemplateSegment::Type::TaskValue;
+          segment.taskIndex = taskIndex;
+          segment.valueNr   = valueNr;
+          segment.text      = format;
+        }
+      }
+    }
+
+    if (segment.type == ParsedTemplateSegment::Type::Marker) {
+      // Must be looked up every time, e.g. plugin requests or unknown task names.
+      segment.text = tmp.substring(startpos, endpos + 1);
+    }
+    parsed.segments.push_back(std::move(segment));
+
+    lastStartpos = endpos + 1;
+    startpos     = endpos + 1;
+  }
+  addTemplateText(tmp, lastStartpos, tmp.length(), parsed);
+  parsed.segments.shrink_to_fit();
+
+  parsed.literalHasMarkup = false;
+
+  for (auto it = parsed.segments.begin(); it != parsed.segments.end() && !parsed.literalHasMarkup; ++it) {
+    if (it->type == ParsedTemplateSegment::Type::Literal) {
+      parsed.literalHasMarkup = hasConversionMarkup(it->text, 0);
+    }
+  }
+  parsed.compiled = true;
+  return true;
+}
+
+// Append a custom variable like doubleToString(value, 6, true) does, without a temporary String.
+// The result only contains digits, '-', '.' or "nan"/"inf", so it never needs to be URL encoded.
+static void appendCustomFloatVar(String& newString, unsigned int varNum)
+{
+  char buf[33];
+  const char *formatted = dtostrf(getCustomFloatVar(varNum), 8, 6, buf);
+
+  while (*formatted == ' ') {
+    ++formatted;
+  }
+  const char *dot = strchr(formatted, '.');
+
+  if (dot == nullptr) {
+    newString += formatted;
+    return;
+  }
+  size_t length = strlen(formatted);
+
+  while (formatted[length - 1] == '0') {
+    --length;
+  }
+
+  if ((formatted + length - 1) == dot) {
+    --length;
+  }
+  newString.concat(formatted, length);
+}
+
+String parseTemplate_render(ParsedTemplateStruct& parsed, byte minimal_lineSize, bool useURLencode)
+{
+  START_TIMER;
+  String newString;
+
+  newString.reserve(parsed.lastLength > minimal_lineSize ? parsed.lastLength : minimal_lineSize);
+
+  // parseTemplate() also processes markup formed by inserted values, so check those too.
+  bool hasMarkup = parsed.literalHasMarkup;
+
+  for (auto it = parsed.segments.begin(); it != parsed.segments.end(); ++it) {
+    const unsigned int segmentStart = newString.length();
+
+    switch (it->type) {
+      case ParsedTemplateSegment::Type::Literal:
+        newString += it->text;
+        break;
+      case ParsedTemplateSegment::Type::SystemVariable:
+      {
+        const String value = SystemVariables::getSystemVariable(static_cast<SystemVariables::Enum>(it->index));
+
+        if (useURLencode) {
+          URLEncode(value.c_str(), newString);
+        } else {
+          newString += value;
+        }
+        break;
+      }
+      case ParsedTemplateSegment::Type::SystemVariable_dynamic:
+      {
+        String value = it->text;
+        SystemVariables::parseSystemVariables(value, useURLencode);
+        newString += value;
+        break;
+      }
+      case ParsedTemplateSegment::Type::CustomVariable:
+        appendCustomFloatVar(newString, it->index);
+        break;
+      case ParsedTemplateSegment::Type::TaskValue:
+      {
+        if (Settings.TaskDeviceEnabled[it->taskIndex]) {
+          struct EventStruct TempEvent(it->taskIndex);
+          bool isvalid;
+
+          if (it->text.isEmpty()) {
+            // No transformation, so format straight into the result.
+            const unsigned int length = newString.length();
+            doFormatUserVar(&TempEvent, it->valueNr, true, isvalid, newString);
+
+            if (!isvalid) {
+              newString.remove(length);
+            }
+          } else {
+            String value = doFormatUserVar(&TempEvent, it->valueNr, true, isvalid);
+
+            if (isvalid) {
+              transformValue(newString, minimal_lineSize, std::move(value), it->text, parsed.source);
+            }
+          }
+        }
+        break;
+      }
+      case ParsedTemplateSegment::Type::Variable:
+      case ParsedTemplateSegment::Type::IntVariable:
+        transformCustomVariable(newString, minimal_lineSize, it->index,
+                                it->type == ParsedTemplateSegment::Type::IntVariable,
+                                it->text, parsed.source);
+        break;
+      case ParsedTemplateSegment::Type::Marker:
+      {
+        int    startpos = 0;
+        int    endpos   = 0;
+        String deviceName, valueName, format;
+
+        if (findNextDevValNameInString(it->text, startpos, endpos, deviceName, valueName, format)) {
+          parseTemplate_marker(newString, deviceName, valueName, format, minimal_lineSize, parsed.source);
+        }
+        break;
+      }
+    }
+
+    if (!hasMarkup && (it->type != ParsedTemplateSegment::Type::Literal)) {
+      hasMarkup = hasConversionMarkup(newString, segmentStart);
+    }
+  }
+
+  if (hasMarkup) {
+    parseStandardConversions(newString, useURLencode);
+
+    // process other markups as well
+    parse_string_commands(newString);
+  }
+
+  // padding spaces
+  while (newString.length() < minimal_lineSize) {
+    newString += ' ';
+  }
+  parsed.lastLength = newString.length();
+  STOP_TIMER(PARSE_TEMPLATE_CACHED);
+  return newString;
+}
+
+void transformCustomVariable(
+  String      & newString,
+  byte          lineSize,
+  unsigned int  varNum,
+  bool          asInt,
+  const String& valueFormat,
+  const String& tmpString)
+{
+  unsigned char nr_decimals = maxNrDecimals_double(getCustomFloatVar(varNum));
+  bool trimTrailingZeros    = true;
+
+  if (asInt) {
+    nr_decimals = 0;
+  } else if (!valueFormat.isEmpty())
+  {
+    // There is some formatting here, so do not throw away decimals
+    trimTrailingZeros = false;
+  }
+  String value = doubleToString(getCustomFloatVar(varNum), nr_decimals, trimTrailingZeros);
+  value.trim();
+  transformValue(newString, lineSize, std::move(value), valueFormat, tmpString);
+}
+
 /********************************************************************************************\
    Transform values
  \*********************************************************************************************/
@@ -199,7 +551,7 @@ void transformValue(
   String      & newString,
   byte          lineSize,
   String        value,
-  String      & valueFormat,
+  const String& valueFormat,
   const String& tmpString)
 {
   // FIXME TD-er: This function does append to newString and uses its length to perform right aling.
@@ -214,18 +566,21 @@ void transformValue(
   if (valueFormat.length() > 0) // do the checks only if a Format is defined to optimize loop
   {
     String valueJust;
+    String tempValueFormat;
 
     int hashtagIndex = valueFormat.indexOf('#');
 
     if (hashtagIndex >= 0)
     {
-      valueJust   = valueFormat.substring(hashtagIndex + 1); // Justification part
-      valueFormat = valueFormat.substring(0, hashtagIndex);  // Transformation part
+      valueJust       = valueFormat.substring(hashtagIndex + 1); // Justification part
+      tempValueFormat = valueFormat.substring(0, hashtagIndex);  // Transformation part
+    } else {
+      tempValueFormat = valueFormat;
     }
 
-    // valueFormat="transformation"
+    // tempValueFormat="transformation"
     // valueJust="justification"
-    if (valueFormat.length() > 0) // do the checks only if a Format is defined to optimize loop
+    if (tempValueFormat.length() > 0) // do the checks only if a Format is defined to optimize loop
     {
       int logicVal    = 0;
       double valFloat = 0.0;
@@ -239,7 +594,6 @@ void transformValue(
           logicVal = 1;
         }
       }
-      String tempValueFormat = valueFormat;
       {
         const int invertedIndex = tempValueFormat.indexOf('!');
 
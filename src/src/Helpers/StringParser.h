@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 
+#include "../DataStructs/ParsedTemplateStruct.h"
 #include "../Globals/Plugins.h"
 
 /********************************************************************************************\
@@ -20,6 +21,41 @@ String parseTemplate_padded(String& tmpString,
                             byte    minimal_lineSize,
                             bool    useURLencode);
 
+// Handle a single [...#...] marker, the result is appended to newString.
+void parseTemplate_marker(String      & newString,
+                          const String& deviceName,
+                          const String& valueName,
+                          String      & format,
+                          byte          minimal_lineSize,
+                          const String& tmpString);
+
+
+/********************************************************************************************\
+   Parse string template, cached per owner
+   For templates which are parsed repeatedly by the same owner, e.g. display lines of a task or
+   controller templates. See ParsedTemplateCache for owner IDs.
+   The template is split once into literal text, system variables and task values,
+   so only the values need to be looked up when it is used again.
+   The parsed template is kept until the template or the (task) settings change.
+ \*********************************************************************************************/
+String parseTemplate_cached(const String& tmpString,
+                            uint32_t      owner);
+
+String parseTemplate_cached(const String& tmpString,
+                            uint32_t      owner,
+                            byte          minimal_lineSize,
+                            bool          useURLencode);
+
+// Split a template into segments.
+// Returns false when the template cannot be split, e.g. when system variables are used in [...#...]
+bool   parseTemplate_compile(const String        & tmpString,
+                             bool                  useURLencode,
+                             ParsedTemplateStruct& parsed);
+
+String parseTemplate_render(ParsedTemplateStruct& parsed,
+                            byte                  minimal_lineSize,
+                            bool                  useURLencode);
+
 
 /********************************************************************************************\
    Transform values
@@ -31,7 +67,16 @@ void transformValue(
   String      & newString,
   byte          lineSize,
   String        value,
-  String      & valueFormat,
+  const String& valueFormat,
+  const String& tmpString);
+
+// Syntax: [var#n#transformation#justification] or [int#n#transformation#justification]
+void transformCustomVariable(
+  String      & newString,
+  byte          lineSize,
+  unsigned int  varNum,
+  bool          asInt,
+  const String& valueFormat,
   const String& tmpString);
 
 
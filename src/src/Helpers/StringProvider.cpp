@@ -15,6 +15,7 @@
 #include "../Globals/ESPEasy_Scheduler.h"
 #include "../Globals/ESPEasy_time.h"
 #include "../Globals/ESPEasyWiFiEvent.h"
+#include "../Globals/EventQueue.h"
 #include "../Globals/NetworkState.h"
 #include "../Globals/SecuritySettings.h"
 #include "../Globals/Settings.h"
@@ -56,6 +57,8 @@ const __FlashStringHelper * getLabel(LabelType::Enum label) {
 
     case LabelType::FREE_MEM:               return F("Free RAM");
     case LabelType::FREE_STACK:             return F("Free Stack");
+    case LabelType::EVENT_QUEUE_MAX_USED:   return F("Event Queue Max Used");
+    case LabelType::EVENT_QUEUE_DROPPED:    return F("Event Queue Dropped");
 #if defined(CORE_POST_2_5_0) || defined(ESP32)
     case LabelType::HEAP_MAX_FREE_BLOCK:    return F("Heap Max Free Block");
 #endif // if defined(CORE_POST_2_5_0) || defined(ESP32)
@@ -217,6 +220,8 @@ String getValue(LabelType::Enum label) {
 
     case LabelType::FREE_MEM:               return String(ESP.getFreeHeap());
     case LabelType::FREE_STACK:             return String(getCurrentFreeStack());
+    case LabelType::EVENT_QUEUE_MAX_USED:   return String(eventQueue.getHighWaterMark());
+    case LabelType::EVENT_QUEUE_DROPPED:    return String(eventQueue.getDropped());
 #if defined(CORE_POST_2_5_0)
     case LabelType::HEAP_MAX_FREE_BLOCK:    return String(ESP.getMaxFreeBlockSize());
 #endif // if defined(CORE_POST_2_5_0)
@@ -30,6 +30,8 @@ struct LabelType {
 
     FREE_MEM,            // 9876
     FREE_STACK,          // 3456
+    EVENT_QUEUE_MAX_USED, // 120 (bytes)
+    EVENT_QUEUE_DROPPED,  // 0
 #if defined(CORE_POST_2_5_0) || defined(ESP32)
     HEAP_MAX_FREE_BLOCK, // 7654
 #endif // if defined(CORE_POST_2_5_0) || defined(ESP32)
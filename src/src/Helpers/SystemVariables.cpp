@@ -29,239 +29,355 @@
 #include "../Helpers/StringProvider.h"
 
 
+// FNV-1a hash, to be evaluated at compile time for the system variable names.
+// Written as a single return statement to be a valid C++11 constexpr function.
+static constexpr uint32_t sysvar_hash(const char *str, uint32_t hash = 2166136261u)
+{
+  return (*str == 0)
+         ? hash
+         : sysvar_hash(str + 1, static_cast<uint32_t>((hash ^ static_cast<uint8_t>(*str)) * 16777619u));
+}
 
-String getReplacementString(const String& format, String& s) {
-  int startpos = s.indexOf(format);
-  int endpos   = s.indexOf('%', startpos + 1);
-  String R     = s.substring(startpos, endpos + 1);
-
-#ifndef BUILD_NO_DEBUG
+// Same hash as above, computed at run time on a part of a string.
+static uint32_t sysvar_hash_n(const char *str, size_t length)
+{
+  uint32_t hash = 2166136261u;
 
-  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-    String log = F("ReplacementString SunTime: ");
-    log += R;
-    log += F(" offset: ");
-    log += ESPEasy_time::getSecOffset(R);
-    addLog(LOG_LEVEL_DEBUG, log);
+  for (size_t i = 0; i < length; ++i) {
+    hash = static_cast<uint32_t>((hash ^ static_cast<uint8_t>(str[i])) * 16777619u);
   }
-#endif // ifndef BUILD_NO_DEBUG
-  return R;
+  return hash;
 }
 
-void replSunRiseTimeString(const String& format, String& s, boolean useURLencode) {
-  String R = getReplacementString(format, s);
 
-  repl(R, node_time.getSunriseTimeString(':', ESPEasy_time::getSecOffset(R)), s, useURLencode);
+
+String timeReplacement_leadZero(int value) 
+{
+  char valueString[5] = { 0 };
+  sprintf_P(valueString, PSTR("%02d"), value);
+  return valueString;
 }
 
-void replSunSetTimeString(const String& format, String& s, boolean useURLencode) {
-  String R = getReplacementString(format, s);
+// FIXME TD-er: Try to match these with  StringProvider::getValue
 
-  repl(R, node_time.getSunsetTimeString(':', ESPEasy_time::getSecOffset(R)), s, useURLencode);
+String SystemVariables::getSystemVariable(SystemVariables::Enum enumval)
+{
+  String value;
+
+  switch (enumval)
+  {
+    case BOOT_CAUSE:        value = String(lastBootCause); break; // Integer value to be used in rules
+    case BSSID:             value = String((WiFiEventData.WiFiDisconnected()) ? F("00:00:00:00:00:00") : WiFi.BSSIDstr()); break;
+    case CR:                value = "\r"; break;
+    case IP:                value = getValue(LabelType::IP_ADDRESS); break;
+    case IP4:               value = String( (int) NetworkLocalIP()[3] ); break; // 4th IP octet
+    case SUBNET:            value = getValue(LabelType::IP_SUBNET); break;
+    case DNS:               value = getValue(LabelType::DNS); break;
+    case GATEWAY:           value = getValue(LabelType::GATEWAY); break;
+    case CLIENTIP:          value = getValue(LabelType::CLIENT_IP); break;
+    #ifdef USES_MQTT
+    case ISMQTT:            value = String(MQTTclient_connected); break;
+    #else // ifdef USES_MQTT
+    case ISMQTT:            value = "0"; break;
+    #endif // ifdef USES_MQTT
+
+    #ifdef USES_P037
+    case ISMQTTIMP:         value = String(P037_MQTTImport_connected); break;
+    #else // ifdef USES_P037
+    case ISMQTTIMP:         value = "0"; break;
+    #endif // USES_P037
+
+
+    case ISNTP:             value = String(statusNTPInitialized ? 1 : 0); break;
+    case ISWIFI:            value = String(WiFiEventData.wifiStatus); break; // 0=disconnected, 1=connected, 2=got ip, 4=services initialized
+    // TODO: PKR: Add ETH Objects
+    #ifdef HAS_ETHERNET
+    
+    case ETHWIFIMODE:       value = getValue(LabelType::ETH_WIFI_MODE); break; // 0=WIFI, 1=ETH
+    case ETHCONNECTED:      value = getValue(LabelType::ETH_CONNECTED); break; // 0=disconnected, 1=connected
+    case ETHDUPLEX:         value = getValue(LabelType::ETH_DUPLEX); break;
+    case ETHSPEED:          value = getValue(LabelType::ETH_SPEED); break;
+    case ETHSTATE:          value = getValue(LabelType::ETH_STATE); break;
+    case ETHSPEEDSTATE:     value = getValue(LabelType::ETH_SPEED_STATE); break;
+    #endif
+    case LCLTIME:           value = getValue(LabelType::LOCAL_TIME); break;
+    case LCLTIME_AM:        value = node_time.getDateTimeString_ampm('-', ':', ' '); break;
+    case LF:                value = "\n"; break;
+    case MAC:               value = getValue(LabelType::STA_MAC); break;
+    case MAC_INT:           value = String(getChipId()); break; // Last 24 bit of MAC address as integer, to be used in rules.
+    case RSSI:              value = getValue(LabelType::WIFI_RSSI); break;
+    case SPACE:             value = " "; break;
+    case SSID:              value = (WiFiEventData.WiFiDisconnected()) ? F("--") : WiFi.SSID(); break;
+    case SUNRISE_S:         value = getValue(LabelType::SUNRISE_S); break;
+    case SUNSET_S:          value = getValue(LabelType::SUNSET_S); break;
+    case SUNRISE_M:         value = getValue(LabelType::SUNRISE_M); break;
+    case SUNSET_M:          value = getValue(LabelType::SUNSET_M); break;
+    case SYSBUILD_DATE:     value = get_build_date(); break;
+    case SYSBUILD_DESCR:    value = getValue(LabelType::BUILD_DESC); break;
+    case SYSBUILD_FILENAME: value = getValue(LabelType::BINARY_FILENAME); break;
+    case SYSBUILD_GIT:      value = getValue(LabelType::GIT_BUILD); break;
+    case SYSBUILD_TIME:     value = get_build_time(); break;
+    case SYSDAY:            value = String(node_time.day()); break;
+    case SYSDAY_0:          value = timeReplacement_leadZero(node_time.day()); break;
+    case SYSHEAP:           value = String(ESP.getFreeHeap()); break;
+    case SYSHOUR:           value = String(node_time.hour()); break;
+    case SYSHOUR_0:         value = timeReplacement_leadZero(node_time.hour()); break;
+    case SYSLOAD:           value = String(getCPUload()); break;
+    case SYSMIN:            value = String(node_time.minute()); break;
+    case SYSMIN_0:          value = timeReplacement_leadZero(node_time.minute()); break;
+    case SYSMONTH:          value = String(node_time.month()); break;
+    case SYSNAME:           value = Settings.getHostname(); break;
+    case SYSSEC:            value = String(node_time.second()); break;
+    case SYSSEC_0:          value = timeReplacement_leadZero(node_time.second()); break;
+    case SYSSEC_D:          value = String(((node_time.hour() * 60) + node_time.minute()) * 60 + node_time.second()); break;
+    case SYSSTACK:          value = getValue(LabelType::FREE_STACK); break;
+    case SYSTIME:           value = node_time.getTimeString(':'); break;
+    case SYSTIME_AM:        value = node_time.getTimeString_ampm(':'); break;
+    case SYSTM_HM:          value = node_time.getTimeString(':', false); break;
+    case SYSTM_HM_AM:       value = node_time.getTimeString_ampm(':', false); break;
+    case SYSWEEKDAY:        value = String(node_time.weekday()); break;
+    case SYSWEEKDAY_S:      value = node_time.weekday_str(); break;
+    case SYSYEAR_0:
+    case SYSYEAR:           value = String(node_time.year()); break;
+    case SYSYEARS:          value = timeReplacement_leadZero(node_time.year() % 100); break;
+    case SYS_MONTH_0:       value = timeReplacement_leadZero(node_time.month()); break;
+    case S_CR:              value = F("\\r"); break;
+    case S_LF:              value = F("\\n"); break;
+    case UNIT_sysvar:       value = getValue(LabelType::UNIT_NR); break;
+    case UNIXDAY:           value = String(node_time.getUnixTime() / 86400); break;
+    case UNIXDAY_SEC:       value = String(node_time.getUnixTime() % 86400); break;
+    case UNIXTIME:          value = String(node_time.getUnixTime()); break;
+    case UPTIME:            value = String(getUptimeMinutes()); break;
+    case UPTIME_MS:         value = ull2String(getMicros64() / 1000); break;
+    #if FEATURE_ADC_VCC
+    case VCC:               value = String(vcc); break;
+    #else // if FEATURE_ADC_VCC
+    case VCC:               value = String(-1); break;
+    #endif // if FEATURE_ADC_VCC
+    case WI_CH:             value = String((WiFiEventData.WiFiDisconnected()) ? 0 : WiFi.channel()); break;
+
+    case SUNRISE:
+    case SUNSET:
+    case UNKNOWN:
+      // Value depends on the offset given in the variable, see parseSystemVariables()
+      break;
+  }
+  return value;
 }
 
+// Check whether the token starts with the (PROGMEM) prefix
+static bool sysvar_startsWith(const char *token, size_t length, const __FlashStringHelper *prefix)
+{
+  const size_t prefix_length = strlen_P(reinterpret_cast<PGM_P>(prefix));
 
-String timeReplacement_leadZero(int value) 
+  return (length >= prefix_length) && (strncmp_P(token, reinterpret_cast<PGM_P>(prefix), prefix_length) == 0);
+}
+
+// Parse the number in a "%v<n>%" token, written without leading zeroes.
+static bool sysvar_customVariableIndex(const char *token, size_t length, unsigned int& varNum)
 {
-  char valueString[5] = { 0 };
-  sprintf_P(valueString, PSTR("%02d"), value);
-  return valueString;
+  // At least "%v0%" and at most 9 digits
+  if ((length < 4) || (length > 12) || (token[1] != 'v')) {
+    return false;
+  }
+
+  if ((token[2] == '0') && (length != 4)) {
+    return false;
+  }
+  varNum = 0;
+
+  for (size_t i = 2; i < (length - 1); ++i) {
+    if (!isdigit(token[i])) {
+      return false;
+    }
+    varNum = (varNum * 10) + (token[i] - '0');
+  }
+  return true;
 }
 
-#define SMART_REPL_T(T, S)   if (s.indexOf(T) != -1) { (S((T), s, useURLencode)); }
+// Compute the value of the variable in s[varStart ... varEnd], including both '%' characters.
+// Return false when it is not a system variable.
+static bool sysvar_getValue(const String& s, int varStart, int varEnd, String& value)
+{
+  const char  *token  = s.c_str() + varStart;
+  const size_t length = varEnd - varStart + 1;
 
-// FIXME TD-er: Try to match these with  StringProvider::getValue
+  const SystemVariables::Enum enumval = SystemVariables::fromString(token, length);
+
+  if (enumval != SystemVariables::Enum::UNKNOWN) {
+    value = SystemVariables::getSystemVariable(enumval);
+    return true;
+  }
+
+  const bool sunrise = sysvar_startsWith(token, length, SystemVariables::toString(SystemVariables::Enum::SUNRISE));
+
+  if (sunrise || sysvar_startsWith(token, length, SystemVariables::toString(SystemVariables::Enum::SUNSET))) {
+    // May contain an offset, e.g. "%sunrise-1h%"
+    const int secOffset = ESPEasy_time::getSecOffset(s.substring(varStart, varEnd + 1));
+    value = sunrise ? node_time.getSunriseTimeString(':', secOffset) : node_time.getSunsetTimeString(':', secOffset);
+    return true;
+  }
+  unsigned int varNum;
+
+  if (sysvar_customVariableIndex(token, length, varNum)) {
+    const bool trimTrailingZeros = true;
+    value = doubleToString(getCustomFloatVar(varNum), 6, trimTrailingZeros);
+    return true;
+  }
+  return false;
+}
 
 void SystemVariables::parseSystemVariables(String& s, boolean useURLencode)
 {
   START_TIMER
 
-  if (s.indexOf('%') == -1) {
+  int varStart = s.indexOf('%');
+
+  if (varStart == -1) {
     STOP_TIMER(PARSE_SYSVAR_NOCHANGE);
     return;
   }
 
-  SystemVariables::Enum enumval = static_cast<SystemVariables::Enum>(0);
+  // Scan once from left to right, copying the text and replacing each variable with its value.
+  // Replaced values are not scanned again for variables.
+  String result;
+  int    copyStart = 0;
+
+  while (varStart != -1) {
+    const int varEnd = s.indexOf('%', varStart + 1);
 
-  do {
-    enumval = SystemVariables::nextReplacementEnum(s, enumval);
+    if (varEnd == -1) {
+      break;
+    }
     String value;
 
-    switch (enumval)
-    {
-      case BOOT_CAUSE:        value = String(lastBootCause); break; // Integer value to be used in rules
-      case BSSID:             value = String((WiFiEventData.WiFiDisconnected()) ? F("00:00:00:00:00:00") : WiFi.BSSIDstr()); break;
-      case CR:                value = "\r"; break;
-      case IP:                value = getValue(LabelType::IP_ADDRESS); break;
-      case IP4:               value = String( (int) NetworkLocalIP()[3] ); break; // 4th IP octet
-      case SUBNET:            value = getValue(LabelType::IP_SUBNET); break;
-      case DNS:               value = getValue(LabelType::DNS); break;
-      case GATEWAY:           value = getValue(LabelType::GATEWAY); break;
-      case CLIENTIP:          value = getValue(LabelType::CLIENT_IP); break;
-      #ifdef USES_MQTT
-      case ISMQTT:            value = String(MQTTclient_connected); break;
-      #else // ifdef USES_MQTT
-      case ISMQTT:            value = "0"; break;
-      #endif // ifdef USES_MQTT
-
-      #ifdef USES_P037
-      case ISMQTTIMP:         value = String(P037_MQTTImport_connected); break;
-      #else // ifdef USES_P037
-      case ISMQTTIMP:         value = "0"; break;
-      #endif // USES_P037
-
-
-      case ISNTP:             value = String(statusNTPInitialized ? 1 : 0); break;
-      case ISWIFI:            value = String(WiFiEventData.wifiStatus); break; // 0=disconnected, 1=connected, 2=got ip, 4=services initialized
-      // TODO: PKR: Add ETH Objects
-      #ifdef HAS_ETHERNET
-      
-      case ETHWIFIMODE:       value = getValue(LabelType::ETH_WIFI_MODE); break; // 0=WIFI, 1=ETH
-      case ETHCONNECTED:      value = getValue(LabelType::ETH_CONNECTED); break; // 0=disconnected, 1=connected
-      case ETHDUPLEX:         value = getValue(LabelType::ETH_DUPLEX); break;
-      case ETHSPEED:          value = getValue(LabelType::ETH_SPEED); break;
-      case ETHSTATE:          value = getValue(LabelType::ETH_STATE); break;
-      case ETHSPEEDSTATE:     value = getValue(LabelType::ETH_SPEED_STATE); break;
-      #endif
-      case LCLTIME:           value = getValue(LabelType::LOCAL_TIME); break;
-      case LCLTIME_AM:        value = node_time.getDateTimeString_ampm('-', ':', ' '); break;
-      case LF:                value = "\n"; break;
-      case MAC:               value = getValue(LabelType::STA_MAC); break;
-      case MAC_INT:           value = String(getChipId()); break; // Last 24 bit of MAC address as integer, to be used in rules.
-      case RSSI:              value = getValue(LabelType::WIFI_RSSI); break;
-      case SPACE:             value = " "; break;
-      case SSID:              value = (WiFiEventData.WiFiDisconnected()) ? F("--") : WiFi.SSID(); break;
-      case SUNRISE:           SMART_REPL_T(SystemVariables::toString(enumval), replSunRiseTimeString); break;
-      case SUNSET:            SMART_REPL_T(SystemVariables::toString(enumval), replSunSetTimeString); break;
-      case SUNRISE_S:         value = getValue(LabelType::SUNRISE_S); break;
-      case SUNSET_S:          value = getValue(LabelType::SUNSET_S); break;
-      case SUNRISE_M:         value = getValue(LabelType::SUNRISE_M); break;
-      case SUNSET_M:          value = getValue(LabelType::SUNSET_M); break;
-      case SYSBUILD_DATE:     value = get_build_date(); break;
-      case SYSBUILD_DESCR:    value = getValue(LabelType::BUILD_DESC); break;
-      case SYSBUILD_FILENAME: value = getValue(LabelType::BINARY_FILENAME); break;
-      case SYSBUILD_GIT:      value = getValue(LabelType::GIT_BUILD); break;
-      case SYSBUILD_TIME:     value = get_build_time(); break;
-      case SYSDAY:            value = String(node_time.day()); break;
-      case SYSDAY_0:          value = timeReplacement_leadZero(node_time.day()); break;
-      case SYSHEAP:           value = String(ESP.getFreeHeap()); break;
-      case SYSHOUR:           value = String(node_time.hour()); break;
-      case SYSHOUR_0:         value = timeReplacement_leadZero(node_time.hour()); break;
-      case SYSLOAD:           value = String(getCPUload()); break;
-      case SYSMIN:            value = String(node_time.minute()); break;
-      case SYSMIN_0:          value = timeReplacement_leadZero(node_time.minute()); break;
-      case SYSMONTH:          value = String(node_time.month()); break;
-      case SYSNAME:           value = Settings.getHostname(); break;
-      case SYSSEC:            value = String(node_time.second()); break;
-      case SYSSEC_0:          value = timeReplacement_leadZero(node_time.second()); break;
-      case SYSSEC_D:          value = String(((node_time.hour() * 60) + node_time.minute()) * 60 + node_time.second()); break;
-      case SYSSTACK:          value = getValue(LabelType::FREE_STACK); break;
-      case SYSTIME:           value = node_time.getTimeString(':'); break;
-      case SYSTIME_AM:        value = node_time.getTimeString_ampm(':'); break;
-      case SYSTM_HM:          value = node_time.getTimeString(':', false); break;
-      case SYSTM_HM_AM:       value = node_time.getTimeString_ampm(':', false); break;
-      case SYSWEEKDAY:        value = String(node_time.weekday()); break;
-      case SYSWEEKDAY_S:      value = node_time.weekday_str(); break;
-      case SYSYEAR_0:
-      case SYSYEAR:           value = String(node_time.year()); break;
-      case SYSYEARS:          value = timeReplacement_leadZero(node_time.year() % 100); break;
-      case SYS_MONTH_0:       value = timeReplacement_leadZero(node_time.month()); break;
-      case S_CR:              value = F("\\r"); break;
-      case S_LF:              value = F("\\n"); break;
-      case UNIT_sysvar:       value = getValue(LabelType::UNIT_NR); break;
-      case UNIXDAY:           value = String(node_time.getUnixTime() / 86400); break;
-      case UNIXDAY_SEC:       value = String(node_time.getUnixTime() % 86400); break;
-      case UNIXTIME:          value = String(node_time.getUnixTime()); break;
-      case UPTIME:            value = String(getUptimeMinutes()); break;
-      case UPTIME_MS:         value = ull2String(getMicros64() / 1000); break;
-      #if FEATURE_ADC_VCC
-      case VCC:               value = String(vcc); break;
-      #else // if FEATURE_ADC_VCC
-      case VCC:               value = String(-1); break;
-      #endif // if FEATURE_ADC_VCC
-      case WI_CH:             value = String((WiFiEventData.WiFiDisconnected()) ? 0 : WiFi.channel()); break;
-
-      case UNKNOWN:
-        break;
+    if (!sysvar_getValue(s, varStart, varEnd, value)) {
+      // Not a variable, the closing '%' may be the start of one.
+      varStart = varEnd;
+      continue;
     }
 
-    switch (enumval)
-    {
-      case SUNRISE:
-      case SUNSET:
-      case UNKNOWN:
+    if (copyStart == 0) {
+      result.reserve(s.length() + 16);
+    }
 
-        // Do not replace
-        break;
-      default:
+    result.concat(s.c_str() + copyStart, varStart - copyStart);
 
-        repl(SystemVariables::toString(enumval), value, s, useURLencode);
-        break;
+    if (useURLencode) {
+      result += URLEncode(value.c_str());
+    } else {
+      result += value;
     }
+    copyStart = varEnd + 1;
+    varStart  = s.indexOf('%', copyStart);
   }
-  while (enumval != SystemVariables::Enum::UNKNOWN);
-
-  int v_index = s.indexOf(F("%v"));
-
-  while ((v_index != -1)) {
-    unsigned int i;
-    if (validUIntFromString(s.substring(v_index + 2), i)) {
-      const String key = String(F("%v")) + String(i) + '%';
-      if (s.indexOf(key) != -1) {
-        const bool trimTrailingZeros = true;
-        const String value = doubleToString(getCustomFloatVar(i), 6, trimTrailingZeros);
-        repl(key, value, s, useURLencode);
-      }
-    }
-    v_index = s.indexOf(F("%v"), v_index + 1); // Find next occurance
+
+  if (copyStart == 0) {
+    STOP_TIMER(PARSE_SYSVAR_NOCHANGE);
+    return;
   }
+  result.concat(s.c_str() + copyStart, s.length() - copyStart);
+  s = std::move(result);
 
   STOP_TIMER(PARSE_SYSVAR);
 }
 
-#undef SMART_REPL_T
-
-
-SystemVariables::Enum SystemVariables::nextReplacementEnum(const String& str, SystemVariables::Enum last_tested)
+SystemVariables::Enum SystemVariables::fromString(const String& str)
 {
-  if (str.indexOf('%') == -1) {
-    return Enum::UNKNOWN;
-  }
-
-  SystemVariables::Enum nextTested = static_cast<SystemVariables::Enum>(0);
-
-  if (last_tested > nextTested) {
-    nextTested = static_cast<SystemVariables::Enum>(last_tested + 1);
-  }
+  return fromString(str.c_str(), str.length());
+}
 
-  if (nextTested >= Enum::UNKNOWN) {
-    return Enum::UNKNOWN;
+SystemVariables::Enum SystemVariables::fromString(const char *str, size_t length)
+{
+  Enum enumval = Enum::UNKNOWN;
+
+  // All case labels are computed at compile time.
+  // The compiler refuses duplicate case values, so the hash is collision free for all known variables.
+  switch (sysvar_hash_n(str, length)) {
+    case sysvar_hash("%bootcause%"):          enumval = Enum::BOOT_CAUSE; break;
+    case sysvar_hash("%bssid%"):              enumval = Enum::BSSID; break;
+    case sysvar_hash("%CR%"):                 enumval = Enum::CR; break;
+    case sysvar_hash("%ip4%"):                enumval = Enum::IP4; break;
+    case sysvar_hash("%ip%"):                 enumval = Enum::IP; break;
+    case sysvar_hash("%subnet%"):             enumval = Enum::SUBNET; break;
+    case sysvar_hash("%dns%"):                enumval = Enum::DNS; break;
+    case sysvar_hash("%gateway%"):            enumval = Enum::GATEWAY; break;
+    case sysvar_hash("%clientip%"):           enumval = Enum::CLIENTIP; break;
+    case sysvar_hash("%ismqtt%"):             enumval = Enum::ISMQTT; break;
+    case sysvar_hash("%ismqttimp%"):          enumval = Enum::ISMQTTIMP; break;
+    case sysvar_hash("%isntp%"):              enumval = Enum::ISNTP; break;
+    case sysvar_hash("%iswifi%"):             enumval = Enum::ISWIFI; break;
+    #ifdef HAS_ETHERNET
+    case sysvar_hash("%ethwifimode%"):        enumval = Enum::ETHWIFIMODE; break;
+    case sysvar_hash("%ethconnected%"):       enumval = Enum::ETHCONNECTED; break;
+    case sysvar_hash("%ethduplex%"):          enumval = Enum::ETHDUPLEX; break;
+    case sysvar_hash("%ethspeed%"):           enumval = Enum::ETHSPEED; break;
+    case sysvar_hash("%ethstate%"):           enumval = Enum::ETHSTATE; break;
+    case sysvar_hash("%ethspeedstate%"):      enumval = Enum::ETHSPEEDSTATE; break;
+    #endif // ifdef HAS_ETHERNET
+    case sysvar_hash("%lcltime%"):            enumval = Enum::LCLTIME; break;
+    case sysvar_hash("%lcltime_am%"):         enumval = Enum::LCLTIME_AM; break;
+    case sysvar_hash("%LF%"):                 enumval = Enum::LF; break;
+    case sysvar_hash("%mac%"):                enumval = Enum::MAC; break;
+    case sysvar_hash("%mac_int%"):            enumval = Enum::MAC_INT; break;
+    case sysvar_hash("%rssi%"):               enumval = Enum::RSSI; break;
+    case sysvar_hash("%SP%"):                 enumval = Enum::SPACE; break;
+    case sysvar_hash("%ssid%"):               enumval = Enum::SSID; break;
+    case sysvar_hash("%s_sunrise%"):          enumval = Enum::SUNRISE_S; break;
+    case sysvar_hash("%s_sunset%"):           enumval = Enum::SUNSET_S; break;
+    case sysvar_hash("%m_sunrise%"):          enumval = Enum::SUNRISE_M; break;
+    case sysvar_hash("%m_sunset%"):           enumval = Enum::SUNSET_M; break;
+    case sysvar_hash("%sysbuild_date%"):      enumval = Enum::SYSBUILD_DATE; break;
+    case sysvar_hash("%sysbuild_desc%"):      enumval = Enum::SYSBUILD_DESCR; break;
+    case sysvar_hash("%sysbuild_filename%"):  enumval = Enum::SYSBUILD_FILENAME; break;
+    case sysvar_hash("%sysbuild_git%"):       enumval = Enum::SYSBUILD_GIT; break;
+    case sysvar_hash("%sysbuild_time%"):      enumval = Enum::SYSBUILD_TIME; break;
+    case sysvar_hash("%sysday%"):             enumval = Enum::SYSDAY; break;
+    case sysvar_hash("%sysday_0%"):           enumval = Enum::SYSDAY_0; break;
+    case sysvar_hash("%sysheap%"):            enumval = Enum::SYSHEAP; break;
+    case sysvar_hash("%syshour%"):            enumval = Enum::SYSHOUR; break;
+    case sysvar_hash("%syshour_0%"):          enumval = Enum::SYSHOUR_0; break;
+    case sysvar_hash("%sysload%"):            enumval = Enum::SYSLOAD; break;
+    case sysvar_hash("%sysmin%"):             enumval = Enum::SYSMIN; break;
+    case sysvar_hash("%sysmin_0%"):           enumval = Enum::SYSMIN_0; break;
+    case sysvar_hash("%sysmonth%"):           enumval = Enum::SYSMONTH; break;
+    case sysvar_hash("%sysname%"):            enumval = Enum::SYSNAME; break;
+    case sysvar_hash("%syssec%"):             enumval = Enum::SYSSEC; break;
+    case sysvar_hash("%syssec_0%"):           enumval = Enum::SYSSEC_0; break;
+    case sysvar_hash("%syssec_d%"):           enumval = Enum::SYSSEC_D; break;
+    case sysvar_hash("%sysstack%"):           enumval = Enum::SYSSTACK; break;
+    case sysvar_hash("%systime%"):            enumval = Enum::SYSTIME; break;
+    case sysvar_hash("%systime_am%"):         enumval = Enum::SYSTIME_AM; break;
+    case sysvar_hash("%systm_hm%"):           enumval = Enum::SYSTM_HM; break;
+    case sysvar_hash("%systm_hm_am%"):        enumval = Enum::SYSTM_HM_AM; break;
+    case sysvar_hash("%sysweekday%"):         enumval = Enum::SYSWEEKDAY; break;
+    case sysvar_hash("%sysweekday_s%"):       enumval = Enum::SYSWEEKDAY_S; break;
+    case sysvar_hash("%sysyear%"):            enumval = Enum::SYSYEAR; break;
+    case sysvar_hash("%sysyears%"):           enumval = Enum::SYSYEARS; break;
+    case sysvar_hash("%sysyear_0%"):          enumval = Enum::SYSYEAR_0; break;
+    case sysvar_hash("%sysmonth_0%"):         enumval = Enum::SYS_MONTH_0; break;
+    case sysvar_hash("%R%"):                  enumval = Enum::S_CR; break;
+    case sysvar_hash("%N%"):                  enumval = Enum::S_LF; break;
+    case sysvar_hash("%unit%"):               enumval = Enum::UNIT_sysvar; break;
+    case sysvar_hash("%unixday%"):            enumval = Enum::UNIXDAY; break;
+    case sysvar_hash("%unixday_sec%"):        enumval = Enum::UNIXDAY_SEC; break;
+    case sysvar_hash("%unixtime%"):           enumval = Enum::UNIXTIME; break;
+    case sysvar_hash("%uptime%"):             enumval = Enum::UPTIME; break;
+    case sysvar_hash("%uptime_ms%"):          enumval = Enum::UPTIME_MS; break;
+    case sysvar_hash("%vcc%"):                enumval = Enum::VCC; break;
+    case sysvar_hash("%wi_ch%"):              enumval = Enum::WI_CH; break;
+    default: break;
   }
 
-  String str_prefix        = SystemVariables::toString(nextTested);
-  str_prefix               = str_prefix.substring(0, 2);
-  bool   str_prefix_exists = str.indexOf(str_prefix) != -1;
+  if (enumval != Enum::UNKNOWN) {
+    // Other strings may have the same hash, so check the name itself.
+    PGM_P name = reinterpret_cast<PGM_P>(SystemVariables::toString(enumval));
 
-  for (int i = nextTested; i < Enum::UNKNOWN; ++i) {
-    SystemVariables::Enum enumval = static_cast<SystemVariables::Enum>(i);
-    String new_str_prefix         = SystemVariables::toString(enumval);
-    new_str_prefix                = new_str_prefix.substring(0, 2);
-
-    if ((str_prefix == new_str_prefix) && !str_prefix_exists) {
-      // Just continue
-    } else {
-      str_prefix        = new_str_prefix;
-      str_prefix_exists = str.indexOf(str_prefix) != -1;
-
-      if (str_prefix_exists) {
-        if (str.indexOf(SystemVariables::toString(enumval)) != -1) {
-          return enumval;
-        }
-      }
+    if ((strlen_P(name) != length) || (strncmp_P(str, name, length) != 0)) {
+      return Enum::UNKNOWN;
     }
   }
-
-  return Enum::UNKNOWN;
+  return enumval;
 }
 
 const __FlashStringHelper * SystemVariables::toString(SystemVariables::Enum enumval)
@@ -90,12 +90,20 @@ public:
     UNKNOWN
   };
 
-  // Find the next thing to replace.
-  // Return UNKNOWN when nothing needs to be replaced.
-  static Enum nextReplacementEnum(const String& str, Enum last_tested);
-
   static const __FlashStringHelper * toString(Enum enumval);
 
+  // Find the system variable matching the complete string, e.g. "%sysname%"
+  // Return UNKNOWN when there is no such variable.
+  static Enum fromString(const String& str);
+  static Enum fromString(const char *str,
+                         size_t      length);
+
+  // Get the current value of the system variable.
+  // SUNRISE and SUNSET need an offset, so these can only be handled by parseSystemVariables()
+  static String getSystemVariable(Enum enumval);
+
+  // Replace all system variables and custom variables (%v<n>%) in a single pass.
+  // Values are only computed for the variables present in the string.
   static void parseSystemVariables(String& s, boolean useURLencode);
 
 
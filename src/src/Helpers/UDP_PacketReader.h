@@ -0,0 +1,101 @@
+#ifndef HELPERS_UDP_PACKETREADER_H
+#define HELPERS_UDP_PACKETREADER_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../Helpers/ESPEasy_time_calc.h"
+
+/*********************************************************************************************\
+* Read pending UDP packets within a budget of packets and time.
+*
+* All packets are read into the same (preallocated) buffer, so handling a packet does not
+* allocate memory. Packets not fitting in the buffer are discarded.
+*
+* Templated on the UDP class, so it can be replayed on the host with a fake UDP source.
+\*********************************************************************************************/
+
+enum class UDP_PacketType : uint8_t {
+  Command,     // Plain text command
+  Sysinfo,     // Binary sysinfo message
+  Plugin,      // Binary packet handled by a plugin
+  CPlugin,     // Binary packet passed to the controllers, not handled by a plugin
+  Dropped      // Ignored, e.g. too short or unexpected NTP reply
+};
+
+struct UDP_ReceiveStats {
+  void clear() { *this = UDP_ReceiveStats(); }
+
+  uint32_t commands      = 0;
+  uint32_t sysinfo       = 0;
+  uint32_t plugin        = 0;
+  uint32_t cplugin       = 0;
+  uint32_t dropped       = 0;
+  uint32_t oversize      = 0; // Packets of UDP_PACKETSIZE_MAX bytes or more
+  uint32_t budgetReached = 0; // Calls which stopped while packets may still be pending
+};
+
+// Handle up to maxPackets UDP packets, or until maxDuration_usec has passed.
+// 'handler' is called as UDP_PacketType handler(char *packet, int length) with the packet
+// zero terminated in buffer, which should be at least UDP_PACKETSIZE_MAX bytes.
+// Return the number of packets read.
+template<typename UDP, typename Handler>
+uint8_t readUDPPackets(UDP             & udp,
+                       char             *buffer,
+                       size_t            bufferSize,
+                       UDP_ReceiveStats& stats,
+                       Handler           handler,
+                       uint8_t           maxPackets       = UDP_RECEIVE_MAX_PACKETS,
+                       uint32_t          maxDuration_usec = UDP_RECEIVE_MAX_DURATION_USEC)
+{
+  const unsigned long start     = micros();
+  uint8_t             nrPackets = 0;
+
+  while (nrPackets < maxPackets) {
+    if ((nrPackets != 0) && (usecPassedSince(start) >= static_cast<long>(maxDuration_usec))) {
+      ++stats.budgetReached;
+      break;
+    }
+    const int packetSize = udp.parsePacket();
+
+    if (packetSize <= 0) {
+      break;
+    }
+    ++nrPackets;
+
+    if ((packetSize >= UDP_PACKETSIZE_MAX) || (static_cast<size_t>(packetSize) >= bufferSize)) {
+      // This node may also receive other UDP packets which may be quite large.
+      ++stats.oversize;
+    } else {
+      const int len = (packetSize >= 2) ? udp.read(buffer, packetSize) : 0;
+
+      if (len >= 2) {
+        buffer[len] = 0;
+
+        switch (handler(buffer, len)) {
+          case UDP_PacketType::Command: ++stats.commands; break;
+          case UDP_PacketType::Sysinfo: ++stats.sysinfo;  break;
+          case UDP_PacketType::Plugin:  ++stats.plugin;   break;
+          case UDP_PacketType::CPlugin: ++stats.cplugin;  break;
+          case UDP_PacketType::Dropped: ++stats.dropped;  break;
+        }
+      } else {
+        ++stats.dropped;
+      }
+    }
+
+    // Discard any remaining content of the packet, in blocks instead of per byte.
+    // Do not call udp.flush() as that's meant to sending the packet (on ESP8266)
+    while (udp.available() > 0) {
+      if (udp.read(buffer, bufferSize) <= 0) {
+        break;
+      }
+    }
+  }
+
+  if (nrPackets == maxPackets) {
+    ++stats.budgetReached;
+  }
+  return nrPackets;
+}
+
+#endif // HELPERS_UDP_PACKETREADER_H
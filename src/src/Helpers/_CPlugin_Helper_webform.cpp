@@ -30,6 +30,8 @@ const __FlashStringHelper * toString(ControllerSettingsStruct::VarType parameter
     case ControllerSettingsStruct::CONTROLLER_FULL_QUEUE_ACTION:        return  F("Full Queue Action");      
     case ControllerSettingsStruct::CONTROLLER_ALLOW_EXPIRE:             return  F("Allow Expire");           
     case ControllerSettingsStruct::CONTROLLER_DEDUPLICATE:              return  F("De-duplicate");           
+    case ControllerSettingsStruct::CONTROLLER_SEND_BATCH:               return  F("Send in Batches");        
+    case ControllerSettingsStruct::CONTROLLER_SPILL_TO_FILE:            return  F("Spill Queue to File");    
     
     case ControllerSettingsStruct::CONTROLLER_CHECK_REPLY:              return  F("Check Reply");            
 
@@ -46,6 +48,8 @@ const __FlashStringHelper * toString(ControllerSettingsStruct::VarType parameter
     case ControllerSettingsStruct::CONTROLLER_CLEAN_SESSION:            return  F("Clean Session");          
     case ControllerSettingsStruct::CONTROLLER_USE_EXTENDED_CREDENTIALS: return  F("Use Extended Credentials");  
     case ControllerSettingsStruct::CONTROLLER_SEND_BINARY:              return  F("Send Binary");            
+    case ControllerSettingsStruct::CONTROLLER_SEND_JSON:                return  F("Publish Task as JSON");   
+    case ControllerSettingsStruct::CONTROLLER_CACHE_QUANTIZE:           return  F("Round to Task Decimals"); 
     case ControllerSettingsStruct::CONTROLLER_TIMEOUT:                  return  F("Client Timeout");         
     case ControllerSettingsStruct::CONTROLLER_SAMPLE_SET_INITIATOR:     return  F("Sample Set Initiator");   
 
@@ -206,6 +210,14 @@ void addControllerParameterForm(const ControllerSettingsStruct& ControllerSettin
     case ControllerSettingsStruct::CONTROLLER_DEDUPLICATE:
       addFormCheckBox(displayName, internalName, ControllerSettings.deduplicate());
       break;
+    case ControllerSettingsStruct::CONTROLLER_SEND_BATCH:
+      addFormCheckBox(displayName, internalName, ControllerSettings.sendBatch());
+      addFormNote(F("Send multiple queued messages in a single request"));
+      break;
+    case ControllerSettingsStruct::CONTROLLER_SPILL_TO_FILE:
+      addFormCheckBox(displayName, internalName, ControllerSettings.spillToFile());
+      addFormNote(F("Store messages on the file system when the queue is full, sent when the controller is available again"));
+      break;
     case ControllerSettingsStruct::CONTROLLER_CHECK_REPLY:
     {
       const __FlashStringHelper * options[2];
@@ -253,6 +265,14 @@ void addControllerParameterForm(const ControllerSettingsStruct& ControllerSettin
     case ControllerSettingsStruct::CONTROLLER_SEND_BINARY:
       addFormCheckBox(displayName, internalName, ControllerSettings.sendBinary());
       break;
+    case ControllerSettingsStruct::CONTROLLER_SEND_JSON:
+      addFormCheckBox(displayName, internalName, ControllerSettings.sendJSON());
+      addFormNote(F("Publish all values of a task as one JSON object, %valname% is removed from the publish topic"));
+      break;
+    case ControllerSettingsStruct::CONTROLLER_CACHE_QUANTIZE:
+      addFormCheckBox(displayName, internalName, ControllerSettings.cacheQuantize());
+      addFormNote(F("Store values rounded to the number of decimals set in the task, using less space"));
+      break;
     case ControllerSettingsStruct::CONTROLLER_TIMEOUT:
       addFormNumericBox(displayName, internalName, ControllerSettings.ClientTimeout, 10, CONTROLLER_CLIENTTIMEOUT_MAX);
       addUnit(F("ms"));
@@ -333,6 +353,12 @@ void saveControllerParameterForm(ControllerSettingsStruct        & ControllerSet
     case ControllerSettingsStruct::CONTROLLER_DEDUPLICATE:
       ControllerSettings.deduplicate(isFormItemChecked(internalName));
       break;
+    case ControllerSettingsStruct::CONTROLLER_SEND_BATCH:
+      ControllerSettings.sendBatch(isFormItemChecked(internalName));
+      break;
+    case ControllerSettingsStruct::CONTROLLER_SPILL_TO_FILE:
+      ControllerSettings.spillToFile(isFormItemChecked(internalName));
+      break;
     case ControllerSettingsStruct::CONTROLLER_CHECK_REPLY:
       ControllerSettings.MustCheckReply = getFormItemInt(internalName, ControllerSettings.MustCheckReply);
       break;
@@ -376,6 +402,12 @@ void saveControllerParameterForm(ControllerSettingsStruct        & ControllerSet
     case ControllerSettingsStruct::CONTROLLER_SEND_BINARY:
       ControllerSettings.sendBinary(isFormItemChecked(internalName));
       break;
+    case ControllerSettingsStruct::CONTROLLER_SEND_JSON:
+      ControllerSettings.sendJSON(isFormItemChecked(internalName));
+      break;
+    case ControllerSettingsStruct::CONTROLLER_CACHE_QUANTIZE:
+      ControllerSettings.cacheQuantize(isFormItemChecked(internalName));
+      break;
     case ControllerSettingsStruct::CONTROLLER_TIMEOUT:
       ControllerSettings.ClientTimeout = getFormItemInt(internalName, ControllerSettings.ClientTimeout);
       break;
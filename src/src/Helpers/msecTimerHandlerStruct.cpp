@@ -6,11 +6,14 @@
 
 
 #define MAX_SCHEDULER_WAIT_TIME 5 // Max delay used in the scheduler for passing idle time.
+#define INITIAL_TIMER_QUEUE_SIZE 64 // Typical number of scheduled timers, allocated at once.
 
   msecTimerHandlerStruct::msecTimerHandlerStruct() : get_called(0), get_called_ret_id(0), max_queue_length(0),
     last_exec_time_usec(0), total_idle_time_usec(0),  idle_time_pct(0.0f), is_idle(false), eco_mode(true)
   {
     last_log_start_time = millis();
+    _timer_heap.reserve(INITIAL_TIMER_QUEUE_SIZE);
+    _heap_pos.reserve(INITIAL_TIMER_QUEUE_SIZE);
   }
 
   void msecTimerHandlerStruct::setEcoMode(bool enabled) {
@@ -23,12 +26,26 @@
     insert(item);
   }
 
+  bool msecTimerHandlerStruct::remove(unsigned long id) {
+    uint16_t pos;
+
+    if (!_heap_pos.find(id, pos)) {
+      return false;
+    }
+    removeAt(pos);
+    return true;
+  }
+
+  size_t msecTimerHandlerStruct::size() const {
+    return _timer_heap.size();
+  }
+
   // Check if timeout has been reached and also return its set timer.
   // Return 0 if no item has reached timeout moment.
   unsigned long msecTimerHandlerStruct::getNextId(unsigned long& timer) {
     ++get_called;
 
-    if (_timer_ids.empty()) {
+    if (_timer_heap.empty()) {
       recordIdle();
 
       if (eco_mode) {
@@ -36,7 +53,7 @@
       }
       return 0;
     }
-    timer_id_couple item = _timer_ids.front();
+    const timer_id_couple item = _timer_heap.front();
     const long passed    = timePassedSince(item._timer);
 
     if (passed < 0) {
@@ -57,10 +74,10 @@
       return 0;
     }
     recordRunning();
-    unsigned long size = _timer_ids.size();
+    unsigned long size = _timer_heap.size();
 
     if (size > max_queue_length) { max_queue_length = size; }
-    _timer_ids.pop_front();
+    removeAt(0);
     timer = item._timer;
     ++get_called_ret_id;
     return item._id;
@@ -68,13 +85,13 @@
 
 
   bool msecTimerHandlerStruct::getTimerForId(unsigned long id, unsigned long& timer) const {
-    for (auto it = _timer_ids.begin(); it != _timer_ids.end(); ++it) {
-      if (it->_id == id) {
-        timer = it->_timer;
-        return true;
-      }
+    uint16_t pos;
+
+    if (!_heap_pos.find(id, pos)) {
+      return false;
     }
-    return false;
+    timer = _timer_heap[pos]._timer;
+    return true;
   }
 
   String msecTimerHandlerStruct::getQueueStats() {
@@ -106,31 +123,97 @@
     return idle_time_pct;
   }
 
-  struct match_id {
-    match_id(unsigned long id) : _id(id) {}
+  void msecTimerHandlerStruct::insert(const timer_id_couple& item) {
+    if (item._id == 0) { return; }
+
+    // Make sure only one is present with the same id.
+    uint16_t pos;
+
+    if (_heap_pos.find(item._id, pos)) {
+      // Reschedule
+      const bool earlier = isBefore(item, _timer_heap[pos]);
+      _timer_heap[pos]._timer = item._timer;
 
-    bool operator()(const timer_id_couple& item) {
-      return _id == item._id;
+      if (earlier) {
+        siftUp(pos);
+      } else {
+        siftDown(pos);
+      }
+      return;
     }
 
-    unsigned long _id;
-  };
+    if (_timer_heap.size() >= 0xFFFF) {
+      // Positions are stored as 16 bit value.
+      return;
+    }
+    _timer_heap.push_back(item);
+    _heap_pos.set(item._id, _timer_heap.size() - 1);
+    siftUp(_timer_heap.size() - 1);
+  }
 
-  void msecTimerHandlerStruct::insert(const timer_id_couple& item) {
-    if (item._id == 0) { return; }
+  void msecTimerHandlerStruct::removeAt(size_t pos) {
+    const size_t last = _timer_heap.size() - 1;
 
-    // Make sure only one is present with the same id.
-    _timer_ids.remove_if(match_id(item._id));
-    const bool mustSort = !_timer_ids.empty();
-    _timer_ids.push_front(item);
+    _heap_pos.erase(_timer_heap[pos]._id);
 
-    if (mustSort) {
-      _timer_ids.sort(); // TD-er: Must check if this is an expensive operation.
+    if (pos != last) {
+      _timer_heap[pos] = _timer_heap[last];
+      _heap_pos.set(_timer_heap[pos]._id, pos);
     }
+    _timer_heap.pop_back();
+
+    if (pos < _timer_heap.size()) {
+      // The moved item may need to go either way.
+      siftDown(pos);
+      siftUp(pos);
+    }
+  }
+
+  void msecTimerHandlerStruct::siftUp(size_t pos) {
+    while (pos > 0) {
+      const size_t parent = (pos - 1) / 2;
+
+      if (!isBefore(_timer_heap[pos], _timer_heap[parent])) {
+        return;
+      }
+      swapItems(pos, parent);
+      pos = parent;
+    }
+  }
+
+  void msecTimerHandlerStruct::siftDown(size_t pos) {
+    const size_t size = _timer_heap.size();
+
+    while (true) {
+      const size_t left  = 2 * pos + 1;
+      const size_t right = left + 1;
+      size_t first       = pos;
+
+      if ((left < size) && isBefore(_timer_heap[left], _timer_heap[first])) {
+        first = left;
+      }
+
+      if ((right < size) && isBefore(_timer_heap[right], _timer_heap[first])) {
+        first = right;
+      }
+
+      if (first == pos) {
+        return;
+      }
+      swapItems(pos, first);
+      pos = first;
+    }
+  }
+
+  void msecTimerHandlerStruct::swapItems(size_t a, size_t b) {
+    std::swap(_timer_heap[a], _timer_heap[b]);
+    _heap_pos.set(_timer_heap[a]._id, a);
+    _heap_pos.set(_timer_heap[b]._id, b);
+  }
 
-    // It should be a relative light operation, to insert into a sorted list.
-    // Perhaps it is better to use std::set ????
-    // Keep in mind: order is based on timer, uniqueness is based on id.
+  bool msecTimerHandlerStruct::isBefore(const timer_id_couple& a, const timer_id_couple& b) {
+    // Compare via the time difference, to handle millis() overflow.
+    return timeDiff(a._timer, b._timer) > 0;
   }
 
   void msecTimerHandlerStruct::recordIdle() {
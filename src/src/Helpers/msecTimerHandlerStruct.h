@@ -3,9 +3,10 @@
 
 
 #include <Arduino.h>
-#include <list>
+#include <vector>
 
 #include "../DataStructs/timer_id_couple.h"
+#include "../DataStructs/timer_id_index.h"
 
 
 struct msecTimerHandlerStruct {
@@ -13,9 +14,16 @@ struct msecTimerHandlerStruct {
 
   void setEcoMode(bool enabled);
 
+  // Schedule the id, or reschedule when it is already present.
   void registerAt(unsigned long id,
                   unsigned long timer);
 
+  // Remove a scheduled id.
+  // Return false when the id was not scheduled.
+  bool remove(unsigned long id);
+
+  size_t size() const;
+
   // Check if timeout has been reached and also return its set timer.
   // Return 0 if no item has reached timeout moment.
   unsigned long getNextId(unsigned long& timer);
@@ -35,6 +43,18 @@ private:
 
   void insert(const timer_id_couple& item);
 
+  void removeAt(size_t pos);
+
+  // Restore the heap property for the item at pos.
+  void siftUp(size_t pos);
+  void siftDown(size_t pos);
+
+  void swapItems(size_t a,
+                 size_t b);
+
+  static bool isBefore(const timer_id_couple& a,
+                       const timer_id_couple& b);
+
   void recordIdle();
 
   void recordRunning();
@@ -52,8 +72,11 @@ private:
   bool          is_idle;
   bool          eco_mode;
 
-  // The list of set timers
-  std::list<timer_id_couple>_timer_ids;
+  // Set timers, stored as a binary min heap ordered on timer.
+  std::vector<timer_id_couple>_timer_heap;
+
+  // Position of each id in the heap.
+  timer_id_index _heap_pos;
 };
 
 #endif // HELPERS_MSECTIMERHANDLERSTRUCT_H
@@ -108,7 +108,15 @@ void P012_data_struct::lcdWrite(const String& text, byte col, byte row) {
 // Perform some specific changes for LCD display
 // https://www.letscontrolit.com/forum/viewtopic.php?t=2368
 String P012_data_struct::P012_parseTemplate(String& tmpString, byte lineSize) {
-  String result            = parseTemplate_padded(tmpString, lineSize);
+  return P012_replaceSpecialChars(parseTemplate_padded(tmpString, lineSize));
+}
+
+String P012_data_struct::P012_parseTemplate(const String& tmpString, byte lineSize, taskIndex_t taskIndex, byte lineNr) {
+  return P012_replaceSpecialChars(
+    parseTemplate_cached(tmpString, ParsedTemplateCache::taskOwner(taskIndex, lineNr), lineSize, false));
+}
+
+String P012_data_struct::P012_replaceSpecialChars(String result) {
   const char degree[3]     = { 0xc2, 0xb0, 0 }; // Unicode degree symbol
   const char degree_lcd[2] = { 0xdf, 0 };       // P012_LCD degree symbol
 
@@ -23,6 +23,11 @@ struct P012_data_struct : public PluginTaskData_base {
 
   String P012_parseTemplate(String& tmpString, byte lineSize);
 
+  // Parse a display line stored in the task settings, the parsed template is cached per line.
+  String P012_parseTemplate(const String& tmpString, byte lineSize, taskIndex_t taskIndex, byte lineNr);
+
+  String P012_replaceSpecialChars(String result);
+
   void createCustomChars();
 
 
@@ -227,7 +227,15 @@ void P023_data_struct::checkDisplayTimer() {
 
 // Perform some specific changes for OLED display
 String P023_data_struct::parseTemplate(String& tmpString, byte lineSize) {
-  String result             = parseTemplate_padded(tmpString, lineSize);
+  return replaceSpecialChars(parseTemplate_padded(tmpString, lineSize));
+}
+
+String P023_data_struct::parseTemplate(const String& tmpString, byte lineSize, taskIndex_t taskIndex, byte lineNr) {
+  return replaceSpecialChars(
+    parseTemplate_cached(tmpString, ParsedTemplateCache::taskOwner(taskIndex, lineNr), lineSize, false));
+}
+
+String P023_data_struct::replaceSpecialChars(String result) {
   const char degree[3]      = { 0xc2, 0xb0, 0 }; // Unicode degree symbol
   const char degree_oled[2] = { 0x7F, 0 };       // P023_OLED degree symbol
 
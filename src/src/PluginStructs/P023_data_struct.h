@@ -35,6 +35,14 @@ struct P023_data_struct : public PluginTaskData_base {
   String parseTemplate(String& tmpString,
                        byte    lineSize);
 
+  // Parse a display line stored in the task settings, the parsed template is cached per line.
+  String parseTemplate(const String& tmpString,
+                       byte          lineSize,
+                       taskIndex_t   taskIndex,
+                       byte          lineNr);
+
+  String replaceSpecialChars(String result);
+
   void   resetDisplay();
 
   void   StartUp_OLED();
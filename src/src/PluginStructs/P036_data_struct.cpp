@@ -1051,9 +1051,9 @@ void P036_data_struct::P036_DisplayPage(struct EventStruct *event)
     //      Construct the outgoing string
     for (uint8_t i = 0; i < ScrollingPages.linesPerFrame; i++)
     {
-      tmpString =
-        String(DisplayLinesV1[(ScrollingPages.linesPerFrame * frameCounter) + i].Content);
-      ScrollingPages.LineOut[i] = P36_parseTemplate(tmpString, 20);
+      const uint8_t lineNr = (ScrollingPages.linesPerFrame * frameCounter) + i;
+      tmpString                 = String(DisplayLinesV1[lineNr].Content);
+      ScrollingPages.LineOut[i] = P36_parseTemplate(tmpString, 20, event->TaskIndex, lineNr);
     }
 
     // now loop round looking for the next frame with some content
@@ -1085,9 +1085,9 @@ void P036_data_struct::P036_DisplayPage(struct EventStruct *event)
       //        Contruct incoming strings
       for (uint8_t i = 0; i < ScrollingPages.linesPerFrame; i++)
       {
-        tmpString =
-          String(DisplayLinesV1[(ScrollingPages.linesPerFrame * frameCounter) + i].Content);
-        ScrollingPages.LineIn[i] = P36_parseTemplate(tmpString, 20);
+        const uint8_t lineNr = (ScrollingPages.linesPerFrame * frameCounter) + i;
+        tmpString                = String(DisplayLinesV1[lineNr].Content);
+        ScrollingPages.LineIn[i] = P36_parseTemplate(tmpString, 20, event->TaskIndex, lineNr);
 
         if (ScrollingPages.LineIn[i].length() > 0) { foundText = true; }
       }
@@ -1109,8 +1109,9 @@ void P036_data_struct::P036_DisplayPage(struct EventStruct *event)
       for (uint8_t i = 0; i < NFrames; i++) {
         for (uint8_t k = 0; k < ScrollingPages.linesPerFrame; k++)
         {
-          tmpString = String(DisplayLinesV1[(ScrollingPages.linesPerFrame * i) + k].Content);
-          tmpString = P36_parseTemplate(tmpString, 20);
+          const uint8_t lineNr = (ScrollingPages.linesPerFrame * i) + k;
+          tmpString = String(DisplayLinesV1[lineNr].Content);
+          tmpString = P36_parseTemplate(tmpString, 20, event->TaskIndex, lineNr);
 
           if (tmpString.length() > 0) {
             // page not empty
@@ -1172,7 +1173,15 @@ void P036_data_struct::P036_DisplayPage(struct EventStruct *event)
 
 // Perform some specific changes for OLED display
 String P036_data_struct::P36_parseTemplate(String& tmpString, uint8_t lineSize) {
-  String result = parseTemplate_padded(tmpString, lineSize);
+  return P36_trimResult(parseTemplate_padded(tmpString, lineSize));
+}
+
+String P036_data_struct::P36_parseTemplate(const String& tmpString, uint8_t lineSize, taskIndex_t taskIndex, uint8_t lineNr) {
+  return P36_trimResult(
+    parseTemplate_cached(tmpString, ParsedTemplateCache::taskOwner(taskIndex, lineNr), lineSize, false));
+}
+
+String P036_data_struct::P36_trimResult(String result) {
 
   // OLED lib uses this routine to convert UTF8 to extended ASCII
   // http://playground.arduino.cc/Main/Utf8ascii
@@ -210,6 +210,14 @@ struct P036_data_struct : public PluginTaskData_base {
   String  P36_parseTemplate(String& tmpString,
                             uint8_t lineSize);
 
+  // Parse a display line stored in the task settings, the parsed template is cached per line.
+  String  P36_parseTemplate(const String& tmpString,
+                            uint8_t       lineSize,
+                            taskIndex_t   taskIndex,
+                            uint8_t       lineNr);
+
+  String  P36_trimResult(String result);
+
   void    registerButtonState(uint8_t newButtonState, bool bPin3Invers);
 
   void    markButtonStateProcessed();
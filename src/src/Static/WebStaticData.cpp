@@ -3,6 +3,7 @@
 #include "../Globals/Cache.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../WebServer/HTML_wrappers.h"
+#include "../WebServer/LoadFromFS.h"
 
 String generate_external_URL(const String& fname) {
     String url;
@@ -20,12 +21,17 @@ void serve_CSS() {
     #ifndef WEBSERVER_CSS
     url = generate_external_URL(F("espeasy_default.css"));
     #else
-    addHtml(F("<style>"));
+    size_t size = 0;
+    url = F(EMBEDDED_STATIC_URL_PREFIX "espeasy_default.min.css");
 
-    // Send CSS in chunks
-    TXBuffer.addFlashString((PGM_P)FPSTR(DATA_ESPEASY_DEFAULT_MIN_CSS));
-    addHtml(F("</style>"));
-    return;
+    if (!clientAcceptsGzip() || (getEmbeddedStaticFile_gz(url, size) == nullptr)) {
+      addHtml(F("<style>"));
+
+      // Send CSS in chunks
+      TXBuffer.addFlashString((PGM_P)FPSTR(DATA_ESPEASY_DEFAULT_MIN_CSS));
+      addHtml(F("</style>"));
+      return;
+    }
     #endif
   }
 
@@ -76,41 +82,48 @@ void serve_JS(JSfiles_e JSfile) {
         #ifndef WEBSERVER_INCLUDE_JS
         url = generate_external_URL(url);
         #else
-        html_add_script(true);
-        switch (JSfile) {
-          case JSfiles_e::UpdateSensorValuesDevicePage:
-            #ifdef WEBSERVER_DEVICES
-            TXBuffer.addFlashString((PGM_P)FPSTR(DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS));
-            #endif
-            break;
-          case JSfiles_e::FetchAndParseLog:
-            #ifdef WEBSERVER_LOG
-            TXBuffer.addFlashString((PGM_P)FPSTR(DATA_FETCH_AND_PARSE_LOG_JS));
-            #endif
-            break;
-          case JSfiles_e::SaveRulesFile:
-            #ifdef WEBSERVER_RULES
-            TXBuffer.addFlashString((PGM_P)FPSTR(jsSaveRules));
-            #endif
-            break;
-          case JSfiles_e::GitHubClipboard:
-            #ifdef WEBSERVER_GITHUB_COPY
-            TXBuffer.addFlashString((PGM_P)FPSTR(DATA_GITHUB_CLIPBOARD_JS));
-            #endif
-            break;
-          case JSfiles_e::Reboot:
-            TXBuffer.addFlashString((PGM_P)FPSTR(DATA_REBOOT_JS));
-            break;
-          case JSfiles_e::Toasting:
-            TXBuffer.addFlashString((PGM_P)FPSTR(jsToastMessageBegin));
-            // we can push custom messages here in future releases...
-            addHtml(F("Submitted"));
-            TXBuffer.addFlashString((PGM_P)FPSTR(jsToastMessageEnd));
-            break;
+        size_t size = 0;
+        const String embeddedUrl = String(F(EMBEDDED_STATIC_URL_PREFIX)) + url;
+
+        if (clientAcceptsGzip() && (getEmbeddedStaticFile_gz(embeddedUrl, size) != nullptr)) {
+          url = embeddedUrl;
+        } else {
+          html_add_script(true);
+          switch (JSfile) {
+            case JSfiles_e::UpdateSensorValuesDevicePage:
+              #ifdef WEBSERVER_DEVICES
+              TXBuffer.addFlashString((PGM_P)FPSTR(DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS));
+              #endif
+              break;
+            case JSfiles_e::FetchAndParseLog:
+              #ifdef WEBSERVER_LOG
+              TXBuffer.addFlashString((PGM_P)FPSTR(DATA_FETCH_AND_PARSE_LOG_JS));
+              #endif
+              break;
+            case JSfiles_e::SaveRulesFile:
+              #ifdef WEBSERVER_RULES
+              TXBuffer.addFlashString((PGM_P)FPSTR(jsSaveRules));
+              #endif
+              break;
+            case JSfiles_e::GitHubClipboard:
+              #ifdef WEBSERVER_GITHUB_COPY
+              TXBuffer.addFlashString((PGM_P)FPSTR(DATA_GITHUB_CLIPBOARD_JS));
+              #endif
+              break;
+            case JSfiles_e::Reboot:
+              TXBuffer.addFlashString((PGM_P)FPSTR(DATA_REBOOT_JS));
+              break;
+            case JSfiles_e::Toasting:
+              TXBuffer.addFlashString((PGM_P)FPSTR(jsToastMessageBegin));
+              // we can push custom messages here in future releases...
+              addHtml(F("Submitted"));
+              TXBuffer.addFlashString((PGM_P)FPSTR(jsToastMessageEnd));
+              break;
 
+          }
+          html_add_script_end();
+          return;
         }
-        html_add_script_end();
-        return;
         #endif
     }
     addHtml(F("<script"));
@@ -118,4 +131,46 @@ void serve_JS(JSfiles_e JSfile) {
     addHtmlAttribute(F("src"), url);
     addHtml('>');
     html_add_script_end();
-}
\ No newline at end of file
+}
+
+PGM_P getEmbeddedStaticFile_gz(const String& path, size_t& size) {
+  size = 0;
+  #ifdef WEBSERVER_EMBED_GZIP
+  if (!path.startsWith(F(EMBEDDED_STATIC_URL_PREFIX))) {
+    return nullptr;
+  }
+  const String fname = path.substring(strlen(EMBEDDED_STATIC_URL_PREFIX));
+
+  #if defined(WEBSERVER_CSS) && !defined(WEBSERVER_EMBED_CUSTOM_CSS)
+  if (fname.equals(F("espeasy_default.min.css"))) {
+    size = sizeof(DATA_ESPEASY_DEFAULT_MIN_CSS_GZ);
+    return DATA_ESPEASY_DEFAULT_MIN_CSS_GZ;
+  }
+  #endif
+  #ifdef WEBSERVER_INCLUDE_JS
+  #ifdef WEBSERVER_DEVICES
+  if (fname.equals(F("update_sensor_values_device_page.js"))) {
+    size = sizeof(DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_GZ);
+    return DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_GZ;
+  }
+  #endif
+  #ifdef WEBSERVER_LOG
+  if (fname.equals(F("fetch_and_parse_log.js"))) {
+    size = sizeof(DATA_FETCH_AND_PARSE_LOG_JS_GZ);
+    return DATA_FETCH_AND_PARSE_LOG_JS_GZ;
+  }
+  #endif
+  #ifdef WEBSERVER_GITHUB_COPY
+  if (fname.equals(F("github_clipboard.js"))) {
+    size = sizeof(DATA_GITHUB_CLIPBOARD_JS_GZ);
+    return DATA_GITHUB_CLIPBOARD_JS_GZ;
+  }
+  #endif
+  if (fname.equals(F("reboot.js"))) {
+    size = sizeof(DATA_REBOOT_JS_GZ);
+    return DATA_REBOOT_JS_GZ;
+  }
+  #endif // ifdef WEBSERVER_INCLUDE_JS
+  #endif // ifdef WEBSERVER_EMBED_GZIP
+  return nullptr;
+}
@@ -25,6 +25,13 @@ enum class JSfiles_e {
 
 void serve_JS(JSfiles_e JSfile);
 
+// Embedded static files are served gzip compressed as a separate file with this URL prefix,
+// so the browser can cache them. Clients not accepting gzip get them inlined in the page.
+#define EMBEDDED_STATIC_URL_PREFIX "/static/"
+
+// Return the gzip compressed embedded static file for the URL path, or nullptr when not embedded.
+PGM_P getEmbeddedStaticFile_gz(const String& path, size_t& size);
+
 
 #ifdef WEBSERVER_FAVICON
 /*********************************************************************************************\
@@ -80,17 +87,26 @@ static const char githublogo[] PROGMEM = {
 };
 
 static const char DATA_GITHUB_CLIPBOARD_JS[] PROGMEM = {0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x47,0x69,0x74,0x68,0x75,0x62,0x43,0x6c,0x69,0x70,0x62,0x6f,0x61,0x72,0x64,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x3d,0x22,0x45,0x53,0x50,0x20,0x45,0x61,0x73,0x79,0x20,0x7c,0x20,0x49,0x6e,0x66,0x6f,0x72,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x20,0x7c,0x5c,0x6e,0x20,0x2d,0x2d,0x2d,0x2d,0x2d,0x7c,0x2d,0x2d,0x2d,0x2d,0x2d,0x7c,0x5c,0x6e,0x22,0x3b,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x6f,0x70,0x3d,0x31,0x30,0x30,0x3b,0x66,0x6f,0x72,0x28,0x76,0x61,0x72,0x20,0x6f,0x3d,0x31,0x3b,0x6f,0x3c,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x6f,0x70,0x3b,0x6f,0x2b,0x2b,0x29,0x7b,0x76,0x61,0x72,0x20,0x6e,0x3d,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x22,0x2b,0x6f,0x2c,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x6e,0x29,0x3b,0x69,0x66,0x28,0x6e,0x75,0x6c,0x6c,0x3d,0x3d,0x74,0x29,0x6f,0x3d,0x6d,0x61,0x78,0x5f,0x6c,0x6f,0x6f,0x70,0x2b,0x31,0x3b,0x65,0x6c,0x73,0x65,0x7b,0x76,0x61,0x72,0x20,0x61,0x3d,0x22,0x7c,0x22,0x3b,0x6f,0x25,0x32,0x3d,0x3d,0x30,0x26,0x26,0x28,0x61,0x2b,0x3d,0x22,0x5c,0x6e,0x22,0x29,0x2c,0x65,0x2b,0x3d,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x3c,0x5b,0x42,0x62,0x5d,0x5b,0x52,0x72,0x5d,0x5c,0x73,0x2a,0x5c,0x2f,0x3f,0x3e,0x2f,0x67,0x69,0x6d,0x2c,0x22,0x5c,0x6e,0x22,0x29,0x2b,0x61,0x7d,0x7d,0x65,0x3d,0x28,0x65,0x3d,0x65,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x3c,0x5c,0x2f,0x5b,0x44,0x64,0x5d,0x5b,0x49,0x69,0x5d,0x5b,0x56,0x76,0x5d,0x5c,0x73,0x2a,0x5c,0x2f,0x3f,0x3e,0x2f,0x67,0x69,0x6d,0x2c,0x22,0x5c,0x6e,0x22,0x29,0x29,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x3c,0x5b,0x5e,0x3e,0x5d,0x2a,0x3e,0x2f,0x67,0x69,0x6d,0x2c,0x22,0x22,0x29,0x3b,0x76,0x61,0x72,0x20,0x6c,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x22,0x29,0x3b,0x6c,0x2e,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x20,0x2d,0x31,0x30,0x30,0x30,0x70,0x78,0x3b,0x20,0x74,0x6f,0x70,0x3a,0x20,0x2d,0x31,0x30,0x30,0x30,0x70,0x78,0x22,0x2c,0x6c,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x65,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x62,0x6f,0x64,0x79,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x6c,0x29,0x2c,0x6c,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x29,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x65,0x78,0x65,0x63,0x43,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x22,0x29,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x62,0x6f,0x64,0x79,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x43,0x68,0x69,0x6c,0x64,0x28,0x6c,0x29,0x2c,0x61,0x6c,0x65,0x72,0x74,0x28,0x27,0x43,0x6f,0x70,0x69,0x65,0x64,0x3a,0x20,0x22,0x27,0x2b,0x65,0x2b,0x27,0x22,0x20,0x74,0x6f,0x20,0x63,0x6c,0x69,0x70,0x62,0x6f,0x61,0x72,0x64,0x21,0x27,0x29,0x7d, 0};
+#ifdef WEBSERVER_EMBED_GZIP
+static const char DATA_GITHUB_CLIPBOARD_JS_GZ[] PROGMEM = {0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x92,0x61,0x6f,0xdb,0x20,0x10,0x86,0xff,0x0a,0x43,0x5a,0x03,0xb5,0xeb,0x24,0xfb,0x18,0x4a,0x27,0x35,0x8b,0xb6,0x48,0x9b,0x34,0x6d,0xd5,0xbe,0xd8,0x5e,0x85,0xed,0x4b,0x8b,0x84,0x39,0x84,0x71,0x14,0x6b,0xc9,0x7f,0x1f,0x4e,0x9b,0xa4,0xda,0xf8,0x80,0x80,0x7b,0xef,0xe1,0xde,0x83,0x4d,0x6f,0xeb,0xa0,0xd1,0x92,0x0e,0xc2,0x67,0x1d,0x9e,0xfb,0x6a,0x69,0xb4,0xab,0x50,0xf9,0x86,0xf1,0x3f,0x5b,0xe5,0x09,0x48,0xba,0xfa,0xf9,0x9d,0xac,0x54,0x37,0x90,0x3d,0x59,0xdb,0x0d,0xfa,0x56,0x1d,0x53,0xf6,0x85,0x25,0x37,0xe3,0xd8,0xbf,0xcc,0x85,0xa5,0xa2,0x55,0xbb,0x47,0x83,0xe8,0xe4,0x7c,0x36,0x13,0x51,0xca,0x46,0x04,0xca,0xb9,0xc0,0xdb,0x53,0x48,0x60,0x92,0xbc,0xa0,0xad,0xa4,0x35,0xba,0xe1,0x01,0x76,0xe1,0x91,0x26,0x98,0x06,0xd9,0x60,0xdd,0xb7,0x60,0x43,0xf6,0x04,0x61,0x65,0x60,0x5c,0xde,0x0f,0xeb,0x86,0x59,0x2e,0xf4,0x86,0xd9,0xde,0x18,0x29,0x03,0x47,0x79,0x62,0x25,0x73,0x01,0xa6,0x83,0x23,0x4d,0x49,0xba,0xa7,0x02,0xdf,0x7f,0x90,0x72,0x76,0x75,0xc5,0x54,0x22,0x69,0xac,0x88,0xa7,0x90,0xc8,0x90,0x69,0x6b,0xc1,0x7f,0x79,0xf8,0xf6,0x35,0xf3,0xe0,0x8c,0xaa,0x81,0x4d,0x6f,0xf3,0xfb,0xaa,0xcc,0x7f,0xf8,0xb2,0xe8,0xae,0x8b,0xe9,0xc7,0xbb,0xe9,0x93,0x6e,0xd3,0x63,0x4a,0xa2,0x0e,0x07,0x90,0x0c,0x24,0xbc,0x51,0x17,0xd3,0xfc,0x53,0x53,0xe6,0x6b,0x5d,0xe6,0xbf,0xb6,0xff,0xe7,0xf0,0xb7,0xe0,0xdf,0x77,0xe5,0xf5,0x6b,0x8c,0x72,0x31,0x16,0x67,0x2e,0xd6,0x6a,0x0f,0x2a,0xc0,0xab,0x3b,0x46,0x43,0x74,0xaf,0xe2,0x51,0x14,0x9a,0xac,0x0b,0x83,0x89,0x0d,0x77,0xd8,0xe9,0xb1,0xc5,0x0b,0xa2,0xaa,0x0e,0x4d,0x1f,0x40,0x18,0xd8,0x84,0x05,0xb9,0x89,0x6d,0x9d,0xb9,0x9d,0x20,0x01,0xdd,0x79,0x47,0x53,0x73,0xf1,0x27,0x21,0x3d,0xdf,0x54,0x61,0x33,0x64,0xca,0x39,0xb0,0xcd,0xf2,0x59,0x9b,0x86,0x19,0x1e,0xa5,0x1d,0x18,0xa8,0x03,0xe3,0x17,0x1d,0xec,0xa0,0x5e,0x62,0xdb,0x2a,0xdb,0xb0,0xe3,0x8b,0x50,0xfe,0x0f,0xc4,0x43,0x8b,0x5b,0x38,0x43,0x94,0x01,0x1f,0xd8,0x64,0x89,0x4e,0x43,0xb3,0x20,0x74,0x92,0x40,0x32,0xa1,0xb1,0x28,0x52,0x9f,0x7e,0xcf,0xbb,0x09,0x3f,0xfc,0x05,0x0b,0xe0,0x55,0x44,0x5d,0x02,0x00,0x00};
+#endif
 
 #endif
 
 #if defined(WEBSERVER_CSS) && !defined(WEBSERVER_EMBED_CUSTOM_CSS)
 static const char DATA_ESPEASY_DEFAULT_MIN_CSS[] PROGMEM = {0x2e,0x63,0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x2c,0x68,0x31,0x2c,0x68,0x32,0x2c,0x68,0x33,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x37,0x30,0x30,0x7d,0x68,0x31,0x2c,0x68,0x36,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x37,0x44,0x7d,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x2c,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x27,0x27,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2c,0x2e,0x6d,0x65,0x6e,0x75,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x64,0x69,0x76,0x5f,0x6c,0x2c,0x2e,0x6d,0x65,0x6e,0x75,0x7b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x7d,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x2c,0x2e,0x64,0x69,0x76,0x5f,0x72,0x7b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x72,0x69,0x67,0x68,0x74,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x7d,0x2a,0x7b,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x32,0x70,0x74,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x7d,0x68,0x31,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x36,0x70,0x74,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x38,0x70,0x78,0x20,0x30,0x7d,0x68,0x32,0x2c,0x68,0x33,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x32,0x70,0x74,0x7d,0x68,0x32,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x34,0x34,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x46,0x46,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x20,0x2d,0x34,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x36,0x70,0x78,0x7d,0x68,0x33,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x45,0x45,0x45,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x34,0x34,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x31,0x36,0x70,0x78,0x20,0x2d,0x34,0x70,0x78,0x20,0x30,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x7d,0x68,0x36,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x30,0x70,0x74,0x7d,0x63,0x6f,0x64,0x65,0x2c,0x6b,0x62,0x64,0x2c,0x70,0x72,0x65,0x2c,0x73,0x61,0x6d,0x70,0x2c,0x74,0x74,0x2c,0x78,0x6d,0x70,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x6d,0x6f,0x6e,0x6f,0x73,0x70,0x61,0x63,0x65,0x2c,0x6d,0x6f,0x6e,0x6f,0x73,0x70,0x61,0x63,0x65,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x65,0x6d,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x37,0x44,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x46,0x46,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x34,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x20,0x31,0x36,0x70,0x78,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x68,0x65,0x6c,0x70,0x2c,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x2c,0x69,0x6e,0x70,0x75,0x74,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,0x72,0x61,0x79,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x73,0x6f,0x6c,0x69,0x64,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x70,0x78,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x6c,0x69,0x6e,0x6b,0x2e,0x77,0x69,0x64,0x65,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x6c,0x69,0x6e,0x6b,0x2e,0x72,0x65,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x72,0x65,0x64,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x68,0x65,0x6c,0x70,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x30,0x25,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x32,0x70,0x78,0x20,0x34,0x70,0x78,0x7d,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x2c,0x69,0x6e,0x70,0x75,0x74,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,0x7d,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x33,0x36,0x39,0x7d,0x69,0x6e,0x70,0x75,0x74,0x3a,0x68,0x6f,0x76,0x65,0x72,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x7d,0x69,0x6e,0x70,0x75,0x74,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x65,0x65,0x65,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x34,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x20,0x38,0x70,0x78,0x7d,0x69,0x6e,0x70,0x75,0x74,0x2e,0x77,0x69,0x64,0x65,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x2e,0x77,0x69,0x64,0x65,0x7b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x30,0x30,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x30,0x25,0x7d,0x2e,0x77,0x69,0x64,0x65,0x6e,0x75,0x6d,0x62,0x65,0x72,0x7b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x30,0x30,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x70,0x78,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2c,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x32,0x70,0x74,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x33,0x35,0x70,0x78,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x7b,0x2d,0x6d,0x6f,0x7a,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x73,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x34,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x7b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x7d,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,0x72,0x65,0x79,0x7d,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x65,0x65,0x65,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x32,0x35,0x70,0x78,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,0x74,0x6f,0x70,0x3a,0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x35,0x70,0x78,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x7e,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x3a,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x7e,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x37,0x44,0x7d,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x3a,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x7e,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x2c,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x2e,0x63,0x68,0x65,0x63,0x6b,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x2d,0x6d,0x73,0x2d,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x72,0x6f,0x74,0x61,0x74,0x65,0x28,0x34,0x35,0x64,0x65,0x67,0x29,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x72,0x6f,0x74,0x61,0x74,0x65,0x28,0x34,0x35,0x64,0x65,0x67,0x29,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x66,0x66,0x66,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x30,0x20,0x33,0x70,0x78,0x20,0x33,0x70,0x78,0x20,0x30,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x30,0x70,0x78,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x37,0x70,0x78,0x3b,0x74,0x6f,0x70,0x3a,0x33,0x70,0x78,0x3b,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x72,0x6f,0x74,0x61,0x74,0x65,0x28,0x34,0x35,0x64,0x65,0x67,0x29,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x70,0x78,0x7d,0x23,0x74,0x6f,0x61,0x73,0x74,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2c,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x2c,0x2e,0x6c,0x6f,0x67,0x76,0x69,0x65,0x77,0x65,0x72,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,0x72,0x61,0x79,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x73,0x6f,0x6c,0x69,0x64,0x7d,0x23,0x74,0x6f,0x61,0x73,0x74,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2c,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x70,0x78,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x7b,0x2d,0x6d,0x6f,0x7a,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x6d,0x73,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x32,0x30,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x39,0x70,0x78,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x75,0x73,0x65,0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x7b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x7d,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x65,0x65,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x30,0x25,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x32,0x36,0x70,0x78,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,0x74,0x6f,0x70,0x3a,0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x36,0x70,0x78,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x7e,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x3a,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x7e,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x37,0x44,0x7d,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x3a,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x7e,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x32,0x20,0x2e,0x64,0x6f,0x74,0x6d,0x61,0x72,0x6b,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x66,0x66,0x66,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x35,0x30,0x25,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x38,0x70,0x78,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x38,0x70,0x78,0x3b,0x74,0x6f,0x70,0x3a,0x38,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x70,0x78,0x7d,0x2e,0x6c,0x6f,0x67,0x76,0x69,0x65,0x77,0x65,0x72,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x27,0x4c,0x75,0x63,0x69,0x64,0x61,0x20,0x43,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x27,0x2c,0x4d,0x6f,0x6e,0x61,0x63,0x6f,0x2c,0x6d,0x6f,0x6e,0x6f,0x73,0x70,0x61,0x63,0x65,0x3b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x20,0x38,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x30,0x25,0x7d,0x23,0x74,0x6f,0x61,0x73,0x74,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x37,0x44,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,0x3b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x33,0x30,0x25,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x37,0x70,0x78,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x32,0x38,0x32,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x2d,0x31,0x32,0x35,0x70,0x78,0x3b,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x35,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x31,0x36,0x70,0x78,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x66,0x69,0x78,0x65,0x64,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x3a,0x68,0x69,0x64,0x64,0x65,0x6e,0x3b,0x7a,0x2d,0x69,0x6e,0x64,0x65,0x78,0x3a,0x31,0x7d,0x23,0x74,0x6f,0x61,0x73,0x74,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2e,0x73,0x68,0x6f,0x77,0x7b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x61,0x6e,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x66,0x61,0x64,0x65,0x69,0x6e,0x20,0x2e,0x35,0x73,0x2c,0x66,0x61,0x64,0x65,0x6f,0x75,0x74,0x20,0x2e,0x35,0x73,0x20,0x32,0x2e,0x35,0x73,0x3b,0x61,0x6e,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x66,0x61,0x64,0x65,0x69,0x6e,0x20,0x2e,0x35,0x73,0x2c,0x66,0x61,0x64,0x65,0x6f,0x75,0x74,0x20,0x2e,0x35,0x73,0x20,0x32,0x2e,0x35,0x73,0x3b,0x76,0x69,0x73,0x69,0x62,0x69,0x6c,0x69,0x74,0x79,0x3a,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x7d,0x40,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x6b,0x65,0x79,0x66,0x72,0x61,0x6d,0x65,0x73,0x20,0x66,0x61,0x64,0x65,0x69,0x6e,0x7b,0x66,0x72,0x6f,0x6d,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x32,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,0x7d,0x74,0x6f,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x33,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x39,0x7d,0x7d,0x40,0x6b,0x65,0x79,0x66,0x72,0x61,0x6d,0x65,0x73,0x20,0x66,0x61,0x64,0x65,0x69,0x6e,0x7b,0x66,0x72,0x6f,0x6d,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x32,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,0x7d,0x74,0x6f,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x33,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x39,0x7d,0x7d,0x40,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x6b,0x65,0x79,0x66,0x72,0x61,0x6d,0x65,0x73,0x20,0x66,0x61,0x64,0x65,0x6f,0x75,0x74,0x7b,0x66,0x72,0x6f,0x6d,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x33,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x39,0x7d,0x74,0x6f,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x30,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,0x7d,0x7d,0x40,0x6b,0x65,0x79,0x66,0x72,0x61,0x6d,0x65,0x73,0x20,0x66,0x61,0x64,0x65,0x6f,0x75,0x74,0x7b,0x66,0x72,0x6f,0x6d,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x33,0x30,0x25,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x2e,0x39,0x7d,0x74,0x6f,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x30,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,0x30,0x7d,0x7d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x30,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x31,0x46,0x31,0x46,0x31,0x7d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x31,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x43,0x46,0x46,0x39,0x35,0x7d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x32,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x39,0x44,0x43,0x45,0x46,0x45,0x7d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x33,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x41,0x34,0x46,0x43,0x37,0x39,0x7d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x34,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x32,0x41,0x42,0x33,0x39,0x7d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x39,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x35,0x30,0x7d,0x2e,0x6c,0x6f,0x67,0x76,0x69,0x65,0x77,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x32,0x37,0x32,0x37,0x32,0x37,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x31,0x46,0x31,0x46,0x31,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x35,0x33,0x30,0x70,0x78,0x3b,0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x3a,0x61,0x75,0x74,0x6f,0x7d,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6d,0x75,0x6c,0x74,0x69,0x72,0x6f,0x77,0x20,0x74,0x68,0x2c,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x74,0x68,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x34,0x34,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x38,0x38,0x38,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x46,0x46,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x37,0x30,0x30,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x36,0x70,0x78,0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6d,0x75,0x6c,0x74,0x69,0x72,0x6f,0x77,0x2c,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3a,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x3b,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x32,0x30,0x70,0x78,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6d,0x75,0x6c,0x74,0x69,0x72,0x6f,0x77,0x20,0x74,0x72,0x2c,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x74,0x64,0x2c,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x74,0x72,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x74,0x64,0x7b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x30,0x70,0x78,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6d,0x75,0x6c,0x74,0x69,0x72,0x6f,0x77,0x20,0x74,0x64,0x7b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2e,0x6d,0x75,0x6c,0x74,0x69,0x72,0x6f,0x77,0x20,0x74,0x72,0x3a,0x6e,0x74,0x68,0x2d,0x63,0x68,0x69,0x6c,0x64,0x28,0x65,0x76,0x65,0x6e,0x29,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x44,0x45,0x45,0x36,0x46,0x46,0x7d,0x2e,0x68,0x69,0x67,0x68,0x6c,0x69,0x67,0x68,0x74,0x20,0x74,0x64,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x64,0x62,0x66,0x66,0x30,0x30,0x37,0x35,0x7d,0x2e,0x61,0x70,0x68,0x65,0x61,0x64,0x65,0x72,0x2c,0x2e,0x68,0x65,0x61,0x64,0x65,0x72,0x6d,0x65,0x6e,0x75,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x38,0x46,0x38,0x46,0x38,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x38,0x70,0x78,0x20,0x31,0x32,0x70,0x78,0x7d,0x2e,0x6e,0x6f,0x74,0x65,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x34,0x34,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x69,0x74,0x61,0x6c,0x69,0x63,0x7d,0x2e,0x68,0x65,0x61,0x64,0x65,0x72,0x6d,0x65,0x6e,0x75,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x44,0x44,0x44,0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x39,0x30,0x70,0x78,0x3b,0x6c,0x65,0x66,0x74,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x66,0x69,0x78,0x65,0x64,0x3b,0x72,0x69,0x67,0x68,0x74,0x3a,0x30,0x3b,0x74,0x6f,0x70,0x3a,0x30,0x3b,0x7a,0x2d,0x69,0x6e,0x64,0x65,0x78,0x3a,0x31,0x7d,0x2e,0x62,0x6f,0x64,0x79,0x6d,0x65,0x6e,0x75,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x39,0x36,0x70,0x78,0x7d,0x2e,0x6d,0x65,0x6e,0x75,0x62,0x61,0x72,0x7b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x69,0x6e,0x68,0x65,0x72,0x69,0x74,0x3b,0x74,0x6f,0x70,0x3a,0x35,0x35,0x70,0x78,0x7d,0x2e,0x6d,0x65,0x6e,0x75,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x73,0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,0x20,0x34,0x70,0x78,0x20,0x30,0x20,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x34,0x34,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x34,0x70,0x78,0x20,0x31,0x36,0x70,0x78,0x20,0x38,0x70,0x78,0x3b,0x77,0x68,0x69,0x74,0x65,0x2d,0x73,0x70,0x61,0x63,0x65,0x3a,0x6e,0x6f,0x77,0x72,0x61,0x70,0x7d,0x2e,0x6d,0x65,0x6e,0x75,0x2e,0x61,0x63,0x74,0x69,0x76,0x65,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x46,0x46,0x46,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x37,0x44,0x20,0x23,0x44,0x44,0x44,0x20,0x23,0x46,0x46,0x46,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x7d,0x2e,0x6d,0x65,0x6e,0x75,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x44,0x45,0x46,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x7d,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x6f,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x67,0x72,0x65,0x65,0x6e,0x7d,0x2e,0x6f,0x66,0x66,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x72,0x65,0x64,0x7d,0x2e,0x64,0x69,0x76,0x5f,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x38,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x34,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x32,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x31,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x7d,0x2e,0x61,0x6c,0x65,0x72,0x74,0x2c,0x2e,0x77,0x61,0x72,0x6e,0x69,0x6e,0x67,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x35,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x32,0x30,0x70,0x78,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x7d,0x2e,0x64,0x69,0x76,0x5f,0x62,0x72,0x7b,0x63,0x6c,0x65,0x61,0x72,0x3a,0x62,0x6f,0x74,0x68,0x7d,0x2e,0x61,0x6c,0x65,0x72,0x74,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x34,0x34,0x33,0x33,0x36,0x7d,0x2e,0x77,0x61,0x72,0x6e,0x69,0x6e,0x67,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x63,0x61,0x31,0x37,0x7d,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x7b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x32,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x32,0x30,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x31,0x35,0x70,0x78,0x3b,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x2e,0x33,0x73,0x7d,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x7d,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x7b,0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x2d,0x78,0x3a,0x61,0x75,0x74,0x6f,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x20,0x61,0x6e,0x64,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x36,0x30,0x70,0x78,0x29,0x7b,0x2e,0x73,0x68,0x6f,0x77,0x6d,0x65,0x6e,0x75,0x6c,0x61,0x62,0x65,0x6c,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x6d,0x65,0x6e,0x75,0x7b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x31,0x76,0x77,0x3b,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x38,0x70,0x78,0x7d,0x7d,0x0a, 0};
+#ifdef WEBSERVER_EMBED_GZIP
+static const char DATA_ESPEASY_DEFAULT_MIN_CSS_GZ[] PROGMEM = {0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x18,0xdb,0x8e,0x9b,0x38,0xf4,0x7d,0xbf,0x02,0xa9,0x1a,0x4d,0xbb,0x02,0x44,0xc8,0x65,0x12,0xf2,0xd2,0xee,0x4c,0xf2,0xb4,0xfb,0x0d,0x95,0x01,0x13,0xac,0x01,0x1b,0x19,0x67,0x92,0x14,0xb1,0xdf,0xbe,0xc7,0x06,0x83,0xb9,0x64,0x3a,0x5b,0x55,0x51,0x3b,0xe6,0xf8,0xf8,0xdc,0x6f,0xb6,0x1b,0x65,0xac,0xc4,0xa1,0xa0,0x76,0xba,0xb0,0x53,0xdf,0x4e,0x97,0x55,0xc2,0xa8,0x70,0x2e,0x98,0x9c,0x52,0x11,0x3c,0x79,0x5e,0x2d,0x37,0x36,0x55,0xc4,0x32,0xc6,0x83,0x4f,0xde,0xd3,0x4b,0xed,0x46,0x29,0x8e,0x5e,0x73,0xc4,0x5f,0x03,0x94,0x08,0xcc,0x6d,0x37,0x66,0xa2,0xff,0x04,0x54,0x2a,0x30,0x15,0xc1,0xe3,0x63,0xed,0x86,0x67,0x21,0x18,0xb5,0xdd,0x1c,0xd3,0x73,0x25,0xf0,0x55,0x38,0x31,0x8e,0x18,0x47,0x82,0x30,0x1a,0x50,0x46,0x71,0xed,0xc6,0xe4,0xed,0x7b,0xd6,0x62,0x24,0x19,0x43,0x22,0xc8,0x70,0x22,0x80,0x8b,0x96,0x4c,0x61,0xf0,0x76,0x8f,0x4b,0xb9,0xf6,0xad,0x34,0x49,0x92,0xd4,0x7f,0x56,0x21,0xbb,0x3a,0x25,0xf9,0x41,0xe8,0x29,0x08,0x19,0x8f,0x31,0x77,0x00,0xb2,0x57,0x6a,0x24,0x28,0x27,0xd9,0x2d,0x28,0x11,0x2d,0x9d,0x12,0x73,0x92,0x34,0x60,0xc0,0xc6,0xc1,0xc2,0x2f,0xc4,0x1e,0xc4,0x3e,0x11,0x1a,0x78,0xfb,0x02,0xc5,0xb1,0xa4,0x20,0xf5,0xad,0x0c,0xa4,0x4d,0x8f,0xb4,0x2d,0xae,0x16,0x6c,0xf7,0x46,0xea,0xc8,0x00,0xb0,0x0a,0x51,0xf4,0x7a,0xe2,0xec,0x4c,0x63,0xa7,0x95,0x6e,0xb5,0x5a,0x69,0x41,0x8f,0xc7,0x63,0xc7,0xca,0x72,0x56,0xc5,0xb5,0xe3,0xb7,0x29,0xae,0x35,0xd0,0x9b,0x9e,0x3e,0x1c,0x0e,0x7b,0x83,0x50,0x7b,0x1a,0xe4,0xb9,0x2a,0x02,0x56,0x2f,0xf2,0x4a,0x92,0xd8,0x98,0x22,0x79,0x20,0x52,0xc4,0x62,0x6c,0xbf,0x86,0xb1,0x5d,0x70,0x6c,0x97,0x28,0x2f,0x6c,0x21,0xec,0x6b,0x5e,0x54,0xa6,0x61,0x72,0x46,0x59,0x59,0xa0,0x08,0xdb,0xdd,0xca,0xb4,0x10,0xce,0xb5,0x07,0x67,0x04,0x84,0x50,0xd8,0x37,0xf6,0x56,0x8e,0x6c,0xd7,0x0e,0x47,0x31,0x39,0x97,0x52,0xa8,0x19,0xe5,0x4d,0xcd,0xa5,0x12,0x52,0x1d,0xcd,0xc2,0x4d,0x71,0x56,0xd8,0x7d,0x70,0xd9,0x84,0x16,0x67,0x61,0x97,0x38,0xc3,0x91,0xb0,0x65,0xec,0x20,0x8e,0x51,0xd5,0xb2,0x69,0x68,0x9f,0x38,0xba,0x69,0xc6,0xa5,0xb8,0x65,0x38,0x28,0x59,0x46,0x62,0x0d,0xba,0x90,0x58,0xa4,0xc1,0xc2,0xe0,0x91,0x11,0xfa,0xea,0x02,0x18,0x57,0x31,0x29,0x8b,0x0c,0xdd,0x02,0x42,0x01,0x86,0x9d,0x30,0x63,0xd1,0xeb,0x5e,0x45,0x28,0xca,0xc8,0x89,0x06,0x11,0x84,0x30,0xe6,0xfb,0x96,0x84,0xe7,0x3d,0x0c,0x69,0x70,0x1c,0x4f,0x6d,0x02,0xc0,0x81,0x36,0xd5,0xd0,0x26,0x6b,0xef,0xa1,0xd3,0xde,0x07,0xed,0xa5,0xe3,0x3e,0xaa,0x6f,0x6f,0x56,0xcd,0x21,0x48,0xd9,0x1b,0x64,0x5b,0x2f,0x44,0xf0,0x69,0xb9,0xd9,0xd5,0x8a,0x4a,0xb3,0xd7,0xd2,0x9a,0x20,0x6a,0x0f,0x46,0x51,0x54,0xdf,0x61,0x3a,0xc1,0xc5,0x18,0xdf,0x73,0x22,0xe4,0x45,0x43,0x46,0x19,0xb6,0xa5,0xd5,0x18,0x39,0x47,0xd7,0xd6,0x09,0x6b,0xcf,0x83,0x63,0xcd,0x7a,0x2b,0x8d,0x29,0xf7,0xe9,0x39,0x0f,0x41,0xb2,0x79,0xac,0x85,0x5c,0x83,0x7d,0x20,0x1c,0x11,0x78,0x08,0xca,0x4c,0xb7,0xf4,0x47,0xf9,0xa7,0xc5,0x71,0x64,0xe5,0x08,0x96,0x6b,0x19,0x7b,0x67,0x5e,0x82,0xdc,0x05,0x23,0xd2,0x8d,0x06,0x99,0xca,0xc9,0xd9,0x0f,0xe7,0x5c,0xca,0x88,0x69,0xcc,0xa3,0xa2,0xd7,0xc9,0xcb,0x19,0xe0,0x05,0x87,0xaf,0x44,0x4c,0x37,0x74,0xf0,0x34,0x51,0xd3,0xd8,0xa5,0x61,0x2e,0x8d,0xd3,0x7e,0x0b,0x56,0xc8,0xc2,0xc2,0x4a,0xa2,0xaa,0x1d,0xc7,0x19,0x94,0xbd,0x37,0xbc,0x1f,0x53,0x33,0x84,0xb3,0x94,0x1d,0xab,0xa1,0xf0,0x7b,0x06,0x79,0x49,0xc4,0xcd,0x24,0x86,0x42,0x08,0xf4,0xb3,0xc0,0x46,0xfc,0x40,0x99,0x2c,0x51,0x98,0xcd,0xc5,0xe5,0x89,0xe3,0x9b,0x81,0x79,0xc7,0xbd,0x69,0x53,0xf3,0x7d,0x69,0x3e,0xa5,0xcb,0x0c,0xbf,0x7d,0xa3,0x54,0xe3,0x21,0x89,0x69,0x08,0xdf,0xc4,0x59,0xa3,0xc2,0xbf,0xef,0x72,0x93,0x81,0x37,0x56,0x3a,0x50,0x07,0x70,0xfc,0xfe,0xc9,0xb9,0xfe,0xd3,0xa5,0xb2,0x72,0xcd,0x9c,0x89,0x7e,0xca,0x49,0x37,0x32,0x23,0xc2,0x06,0x2e,0x36,0x69,0x4c,0xd8,0xcb,0xd0,0x11,0x1c,0x5a,0x4c,0xc2,0x78,0x1e,0x70,0x26,0x90,0xc0,0x9f,0x57,0xeb,0x18,0x9f,0xbe,0x74,0x11,0x74,0x6f,0xbf,0x2d,0xa0,0xaa,0x6a,0x59,0xb2,0x9f,0x0d,0x4b,0x97,0x67,0x2d,0x21,0xc1,0x96,0xaa,0xdc,0xb7,0xee,0x59,0x78,0xda,0x3d,0x4f,0xb0,0x90,0xee,0x58,0xca,0xbf,0x77,0xe8,0xb7,0x69,0x05,0x7e,0xfa,0x24,0x18,0x2a,0x45,0x8e,0xcb,0x12,0x9d,0x70,0xd7,0xb2,0x6d,0x37,0x63,0xa7,0x37,0x82,0x2f,0xb2,0x40,0x7c,0xa0,0xb2,0xde,0x21,0x53,0x4d,0x0b,0xae,0x61,0xca,0xdf,0x91,0x71,0x6d,0x4e,0x85,0x0c,0x4a,0x5f,0x1e,0xf8,0x5e,0x9f,0x66,0xca,0x16,0x3b,0x59,0x93,0xfe,0x4f,0xa6,0xf9,0xbf,0x90,0x6a,0x9d,0xb2,0xb3,0xe9,0x33,0xad,0xf5,0x3a,0xa1,0x36,0x1f,0x4e,0xa8,0xcd,0xd0,0x72,0xc3,0x8c,0xba,0xcf,0x7e,0x98,0x4f,0xfe,0x38,0xcc,0xef,0x1f,0x54,0xe9,0x34,0x9c,0xde,0x3e,0x9c,0x4c,0xf7,0xd8,0x8c,0xe8,0x8c,0xf3,0xc7,0xb7,0x46,0x88,0x66,0x03,0x33,0x12,0x60,0x6a,0xc7,0xad,0x36,0xe3,0xb6,0x0d,0xfc,0x6d,0xdf,0x51,0xa4,0xdd,0xba,0x48,0xee,0xfb,0x98,0x39,0xeb,0x3c,0xfe,0x7d,0x8e,0x48,0x8c,0xac,0x67,0x46,0x41,0x17,0xfc,0x68,0xff,0xc3,0x28,0x8a,0x98,0x31,0xf9,0xf4,0x7d,0x08,0x7a,0x8f,0x37,0xed,0x72,0x46,0xfb,0x1a,0xa4,0xc1,0xbb,0xc3,0x91,0x39,0x10,0xb5,0xd1,0xbb,0x04,0x9d,0xfa,0x09,0xd6,0x1c,0xb8,0x9e,0xb4,0x8a,0xfe,0xd6,0x1f,0x45,0xb8,0xb3,0x50,0x85,0x39,0x87,0x6f,0x5d,0x7d,0x4d,0x11,0xe5,0x24,0xd5,0xbb,0x2b,0x21,0x57,0x1c,0xcf,0x4c,0x33,0x6f,0xa4,0x24,0x21,0xc9,0x64,0x84,0xa7,0x24,0x86,0x06,0xbc,0xff,0xe1,0x10,0x1a,0xe3,0x6b,0xb0,0x18,0xaa,0xe4,0x96,0x29,0xbb,0x54,0x3a,0x1b,0x11,0x25,0x79,0x33,0xb2,0x27,0x28,0xc6,0x84,0x5a,0xee,0xba,0xb4,0xe5,0x92,0x9d,0x85,0x5c,0x5b,0x3e,0xfc,0xb7,0xff,0x18,0x96,0x21,0x82,0x5a,0x66,0xb8,0xfe,0xaa,0xf9,0xbc,0xe2,0x5b,0xc2,0x11,0x88,0x60,0x35,0x14,0xaa,0x84,0xb3,0xbc,0xea,0x72,0xfe,0xa1,0x4f,0xcf,0x5a,0xb0,0xca,0xb0,0xa6,0x86,0xbb,0xbb,0xba,0xfe,0xfa,0x7b,0xa8,0xcc,0xcb,0x04,0xaa,0x0c,0xc8,0x8d,0x8e,0xf5,0xf4,0x3c,0x83,0xcb,0x58,0xa4,0x5f,0x23,0xe2,0x66,0xf8,0x0d,0x67,0xdf,0x3d,0x7d,0x15,0x3b,0x2e,0xe4,0x4f,0x83,0x17,0x1d,0xf8,0xf9,0x78,0xdc,0xad,0x35,0xd8,0xd7,0xe0,0xdd,0xcb,0xf3,0xe1,0x78,0xd0,0xe0,0xa5,0x06,0x7f,0x5b,0x1d,0x9f,0x9f,0x76,0x1a,0xbc,0xea,0x88,0xf8,0xdf,0xfe,0x5a,0x76,0xe0,0x5d,0x07,0x5e,0x7b,0xb5,0xd9,0x30,0x26,0x61,0xef,0x3f,0xc9,0xdf,0x7e,0x20,0xa1,0x4e,0xdf,0xf5,0x52,0xc6,0xab,0x2c,0x68,0x70,0x93,0xbb,0x04,0xe8,0x2c,0x58,0xad,0x13,0xf5,0xdd,0x11,0x55,0xc8,0xa9,0xc6,0xcd,0xcf,0x99,0x20,0x9c,0x5d,0x2c,0x91,0xda,0x0d,0x84,0x42,0xbb,0x43,0x19,0x7c,0xdf,0xb9,0x7b,0x0d,0xfa,0xd9,0xa7,0xed,0x76,0x6b,0x5e,0x48,0x46,0xb7,0x5c,0xf3,0x3e,0xb6,0x57,0x29,0xe3,0xe8,0x6b,0x6c,0x9b,0x3a,0x93,0x64,0x1a,0xc9,0x35,0x10,0xca,0xe8,0xa5,0x19,0x2a,0x4a,0x1c,0xe8,0x85,0x16,0x01,0xea,0x8b,0x91,0xca,0x2b,0x7f,0x30,0xf6,0x3e,0x4c,0x54,0xe6,0x23,0x95,0xe3,0xd1,0x37,0xaf,0xcc,0xcb,0xe0,0x08,0xb7,0x6a,0x1d,0x20,0xed,0x3f,0xa1,0x3c,0xd8,0x35,0x0b,0xde,0x4f,0x15,0x06,0xae,0x01,0x15,0xa9,0x13,0xa5,0x24,0x8b,0x3f,0x43,0xa0,0xd0,0x2f,0x33,0x8e,0x78,0x39,0x1c,0x36,0xc7,0x63,0xed,0xa6,0xc0,0x24,0x93,0x8c,0x24,0xcb,0x29,0x5a,0x1c,0x26,0x89,0xe7,0x3d,0x41,0xdc,0xa2,0x22,0xc5,0x90,0x23,0x30,0x8c,0x35,0x7f,0xd5,0xbb,0xc0,0xf4,0xc0,0x71,0x2b,0x7f,0x9d,0xc0,0xf2,0x6e,0x0e,0x37,0x01,0xe8,0x02,0x94,0x09,0x5c,0x19,0x51,0xd0,0x54,0x57,0x35,0xc1,0x10,0x01,0xea,0x40,0xa7,0x34,0x09,0xeb,0x07,0x03,0x95,0x6f,0x30,0xb8,0x58,0xed,0x28,0xf6,0xf2,0xf2,0xa2,0x03,0x77,0xe7,0xcd,0xf4,0xef,0xa6,0xc2,0xaa,0xd7,0x08,0x00,0x37,0x4d,0xbc,0xaf,0xa5,0x6e,0xc8,0xe2,0x9b,0x62,0x60,0xdc,0x05,0x76,0xaa,0xbb,0x4b,0x68,0x88,0xc0,0x61,0x9a,0x12,0xa1,0x29,0xe6,0x44,0x28,0x1a,0xeb,0xb5,0x46,0xa9,0x06,0x93,0xa1,0x1a,0xef,0x0a,0xc8,0x14,0x2a,0xa6,0x6d,0xc5,0x52,0xcf,0x01,0x30,0x21,0x0e,0x86,0x30,0x75,0xbd,0x6e,0xfe,0x99,0xef,0x08,0xe3,0xdb,0x77,0xd3,0xd7,0x52,0x22,0xb0,0xa3,0x9a,0x20,0xf4,0xfd,0x0b,0x47,0x45,0x23,0x84,0x8b,0x22,0x39,0x47,0xcd,0x99,0x1f,0x52,0x68,0x98,0x5f,0xd0,0xf1,0x94,0xd5,0x2c,0xb5,0xd7,0x87,0x79,0x43,0x69,0xe6,0xb2,0xfa,0x72,0x98,0xa2,0x7d,0x6f,0x5f,0x1b,0xcc,0x21,0xa4,0x76,0x01,0xd0,0xdd,0x63,0x30,0x85,0xef,0x24,0xa9,0x8c,0x0b,0x77,0xf3,0x3c,0x34,0xd3,0x83,0xb7,0xde,0x4c,0x0f,0x6e,0x2f,0xb1,0xbe,0xd9,0x3b,0xa5,0x2d,0xd4,0x65,0x13,0x65,0x98,0x0b,0xdb,0xbd,0x20,0x4e,0x61,0xa3,0x1a,0x0e,0x9d,0x8b,0xb5,0x71,0x46,0x65,0xac,0xf1,0x0c,0xa5,0xa4,0x08,0x79,0x15,0x65,0x18,0xf1,0x00,0x4e,0xa4,0x2d,0xb5,0x19,0xc1,0x92,0xd5,0x6a,0xb9,0xdc,0xd4,0x1d,0x9b,0x19,0x8c,0x24,0x42,0x8b,0xa7,0xfe,0x0d,0x6c,0x3c,0xa6,0xf6,0x23,0x83,0x2f,0x15,0x51,0x2f,0x18,0x7a,0xda,0x1c,0x8f,0xc6,0x4a,0x6c,0x15,0x40,0x4d,0xbc,0xb9,0xcb,0xb2,0x27,0xdc,0xfa,0xc5,0xf0,0x43,0x09,0xc3,0x32,0xa0,0x55,0xba,0x50,0x3b,0x57,0x55,0xaa,0xcd,0xea,0xf4,0x35,0xc7,0x31,0x41,0x56,0x19,0x49,0x77,0x58,0x88,0xc6,0xd6,0xe7,0x7e,0x74,0xda,0x6d,0x40,0x80,0x2f,0x95,0x1a,0x20,0xa4,0x4b,0x33,0x14,0xe2,0x6c,0xe4,0xd0,0x36,0x33,0xba,0x69,0x6b,0xf1,0x76,0x31,0x86,0xaf,0x95,0x9c,0xe6,0xea,0x3f,0xfe,0x03,0x85,0x6a,0x35,0xf0,0x9b,0x14,0x00,0x00};
+#endif
 #endif // WEBSERVER_CSS
 
 // JavaScript blobs
 
 #ifdef WEBSERVER_INCLUDE_JS
 static const char DATA_REBOOT_JS[] PROGMEM = {0x69,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x72,0x62,0x74,0x6d,0x73,0x67,0x22,0x29,0x2c,0x69,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x22,0x50,0x6c,0x65,0x61,0x73,0x65,0x20,0x72,0x65,0x62,0x6f,0x6f,0x74,0x3a,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x27,0x72,0x65,0x62,0x6f,0x6f,0x74,0x27,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x6b,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x52,0x65,0x62,0x6f,0x6f,0x74,0x27,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x73,0x75,0x62,0x6d,0x69,0x74,0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x27,0x72,0x28,0x29,0x27,0x3e,0x22,0x3b,0x76,0x61,0x72,0x20,0x78,0x3d,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x3b,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x64,0x28,0x29,0x7b,0x69,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x22,0x22,0x2c,0x63,0x6c,0x65,0x61,0x72,0x54,0x69,0x6d,0x65,0x6f,0x75,0x74,0x28,0x74,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x28,0x29,0x7b,0x69,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2b,0x3d,0x22,0x2e,0x22,0x2c,0x78,0x2e,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x64,0x2c,0x78,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x47,0x45,0x54,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x29,0x2c,0x78,0x2e,0x73,0x65,0x6e,0x64,0x28,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x62,0x28,0x29,0x7b,0x69,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x22,0x52,0x65,0x62,0x6f,0x6f,0x74,0x69,0x6e,0x67,0x2e,0x2e,0x22,0x2c,0x74,0x3d,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x63,0x2c,0x32,0x65,0x33,0x29,0x7d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x28,0x29,0x7b,0x69,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2b,0x3d,0x22,0x20,0x28,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x69,0x6e,0x67,0x29,0x22,0x2c,0x78,0x2e,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x62,0x2c,0x78,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x22,0x47,0x45,0x54,0x22,0x2c,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x6f,0x72,0x69,0x67,0x69,0x6e,0x2b,0x22,0x2f,0x3f,0x63,0x6d,0x64,0x3d,0x72,0x65,0x62,0x6f,0x6f,0x74,0x22,0x29,0x2c,0x78,0x2e,0x73,0x65,0x6e,0x64,0x28,0x29,0x7d, 0};
+#ifdef WEBSERVER_EMBED_GZIP
+static const char DATA_REBOOT_JS_GZ[] PROGMEM = {0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x91,0x4f,0x4b,0x03,0x31,0x10,0xc5,0xbf,0x4a,0xc8,0x65,0x77,0xe9,0x12,0x41,0x6f,0xd6,0x28,0x08,0xc5,0x16,0x5a,0x90,0xd2,0x83,0xd7,0xdd,0x64,0x5c,0x86,0x66,0x27,0x6b,0x32,0xe9,0x1f,0xc4,0xef,0x6e,0xca,0x8a,0xb6,0x7a,0xf1,0x36,0x13,0xde,0x7b,0xf9,0x3d,0x06,0xb5,0xf5,0x26,0xf5,0x40,0xac,0x3a,0xe0,0x99,0x83,0xd3,0xf8,0x78,0x5c,0xd8,0x52,0x86,0x96,0xfb,0xd8,0xc9,0xaa,0x46,0x85,0x44,0x10,0xe6,0x9b,0xd5,0x52,0xcb,0x67,0x07,0x4d,0x04,0x11,0xa0,0xf5,0x9e,0x6f,0xc5,0x1d,0xd2,0x90,0x58,0xa0,0xd5,0xc5,0xf8,0x54,0x08,0xe3,0x9a,0x18,0x75,0xd1,0x26,0x66,0x4f,0xc2,0x21,0x6d,0x0b,0xb1,0x6b,0x5c,0x02,0x5d,0xac,0xbf,0x24,0x7c,0x1c,0xf2,0x16,0x53,0xdb,0x63,0xde,0x3c,0x19,0x87,0x66,0x9b,0x13,0xca,0xaa,0xb8,0x97,0xd3,0x5d,0x13,0xc4,0x41,0x13,0xec,0xc5,0xcb,0x6a,0x39,0x67,0x1e,0xd6,0xf0,0x96,0x20,0xf2,0xf4,0x35,0x91,0x61,0xcc,0xa1,0xb6,0xac,0xde,0x2f,0xa8,0x64,0x6d,0x32,0x57,0xd8,0x60,0x0f,0x3e,0x71,0xc9,0xd5,0xc7,0xb7,0xd6,0x5c,0x6a,0x27,0x5a,0x2a,0x59,0x1f,0x94,0x27,0xe7,0x1b,0xab,0xed,0x69,0x1c,0x80,0x4a,0xf9,0x34,0xdb,0xc8,0x7a,0x8f,0x64,0xfd,0x5e,0x39,0x6f,0x9a,0x93,0x59,0xf9,0x80,0x1d,0x52,0x95,0x45,0x11,0x28,0xff,0xfa,0x13,0xdb,0xfe,0x46,0x18,0xbb,0x21,0x75,0x2a,0xe7,0xb3,0x8e,0xc0,0x0b,0x62,0x08,0xb9,0x79,0x69,0xea,0x6b,0xb8,0x39,0xf3,0x86,0x3f,0x48,0xa2,0x0c,0x63,0xc7,0xec,0xaf,0xce,0xf0,0xda,0xff,0xe0,0x4d,0xe4,0xd5,0x83,0xe9,0xad,0x1e,0x0f,0x20,0xcf,0x68,0x3f,0x01,0xb9,0x58,0x77,0xab,0xde,0x01,0x00,0x00};
+#endif
 #endif
 
 static const char jsToastMessageBegin[] PROGMEM = {
@@ -176,11 +192,17 @@ static const char jsSaveRules[] PROGMEM = {
 #endif
 
 #ifdef WEBSERVER_INCLUDE_JS
-const char DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS[] PROGMEM = {0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x2c,0x61,0x29,0x7b,0x76,0x61,0x72,0x20,0x73,0x2c,0x6c,0x2c,0x6f,0x3d,0x30,0x3b,0x69,0x73,0x4e,0x61,0x4e,0x28,0x61,0x29,0x26,0x26,0x28,0x61,0x3d,0x31,0x29,0x2c,0x6e,0x75,0x6c,0x6c,0x3d,0x3d,0x65,0x26,0x26,0x28,0x65,0x3d,0x31,0x65,0x33,0x29,0x3b,0x76,0x61,0x72,0x20,0x6e,0x3d,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6f,0x3e,0x30,0x3f,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x6e,0x29,0x3a,0x2b,0x2b,0x61,0x3e,0x31,0x3f,0x6f,0x3d,0x31,0x3a,0x28,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x6a,0x73,0x6f,0x6e,0x3f,0x76,0x69,0x65,0x77,0x3d,0x73,0x65,0x6e,0x73,0x6f,0x72,0x75,0x70,0x64,0x61,0x74,0x65,0x22,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x61,0x29,0x7b,0x76,0x61,0x72,0x20,0x6f,0x3b,0x32,0x30,0x30,0x3d,0x3d,0x3d,0x61,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x61,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x61,0x29,0x7b,0x66,0x6f,0x72,0x28,0x65,0x3d,0x61,0x2e,0x54,0x54,0x4c,0x2c,0x73,0x3d,0x30,0x3b,0x73,0x3c,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x73,0x2b,0x2b,0x29,0x69,0x66,0x28,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x22,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x22,0x29,0x29,0x66,0x6f,0x72,0x28,0x6c,0x3d,0x30,0x3b,0x6c,0x3c,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x6c,0x2b,0x2b,0x29,0x74,0x72,0x79,0x7b,0x6f,0x3d,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6c,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x6f,0x3d,0x65,0x2e,0x6e,0x61,0x6d,0x65,0x7d,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x79,0x7b,0x69,0x66,0x28,0x22,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x22,0x21,0x3d,0x3d,0x6f,0x29,0x7b,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x3d,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6c,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x2c,0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x56,0x61,0x6c,0x75,0x65,0x3d,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6c,0x5d,0x2e,0x4e,0x72,0x44,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x2c,0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x56,0x61,0x6c,0x75,0x65,0x3c,0x32,0x35,0x35,0x26,0x26,0x28,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x3d,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x56,0x61,0x6c,0x75,0x65,0x29,0x29,0x3b,0x76,0x61,0x72,0x20,0x72,0x3d,0x22,0x76,0x61,0x6c,0x75,0x65,0x5f,0x22,0x2b,0x28,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x2b,0x22,0x5f,0x22,0x2b,0x28,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6c,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x2c,0x74,0x3d,0x22,0x76,0x61,0x6c,0x75,0x65,0x6e,0x61,0x6d,0x65,0x5f,0x22,0x2b,0x28,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x2b,0x22,0x5f,0x22,0x2b,0x28,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6c,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x2c,0x75,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x72,0x29,0x2c,0x63,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x74,0x29,0x3b,0x6e,0x75,0x6c,0x6c,0x21,0x3d,0x3d,0x75,0x26,0x26,0x28,0x75,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x29,0x2c,0x6e,0x75,0x6c,0x6c,0x21,0x3d,0x3d,0x63,0x26,0x26,0x28,0x63,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x73,0x5d,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6c,0x5d,0x2e,0x4e,0x61,0x6d,0x65,0x2b,0x22,0x3a,0x22,0x29,0x7d,0x7d,0x65,0x3d,0x61,0x2e,0x54,0x54,0x4c,0x2c,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x6e,0x29,0x2c,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x2c,0x30,0x29,0x7d,0x29,0x3a,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x4c,0x6f,0x6f,0x6b,0x73,0x20,0x6c,0x69,0x6b,0x65,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x70,0x72,0x6f,0x62,0x6c,0x65,0x6d,0x2e,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x43,0x6f,0x64,0x65,0x3a,0x20,0x22,0x2b,0x61,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x7d,0x29,0x2e,0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x61,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x61,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x2c,0x65,0x3d,0x35,0x65,0x33,0x2c,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x6e,0x29,0x2c,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x2c,0x30,0x29,0x7d,0x29,0x2c,0x6f,0x3d,0x31,0x29,0x7d,0x2c,0x65,0x29,0x7d,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x31,0x65,0x33,0x2c,0x30,0x29,0x3b,0};
+const char DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS[] PROGMEM = {0x76,0x61,0x72,0x20,0x73,0x65,0x6e,0x73,0x6f,0x72,0x55,0x70,0x64,0x61,0x74,0x65,0x55,0x52,0x4c,0x3d,0x27,0x2f,0x6a,0x73,0x6f,0x6e,0x3f,0x76,0x69,0x65,0x77,0x3d,0x73,0x65,0x6e,0x73,0x6f,0x72,0x75,0x70,0x64,0x61,0x74,0x65,0x27,0x3b,0x69,0x66,0x28,0x74,0x79,0x70,0x65,0x6f,0x66,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x21,0x3d,0x3d,0x27,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x29,0x7b,0x6c,0x69,0x73,0x74,0x65,0x6e,0x46,0x6f,0x72,0x53,0x65,0x6e,0x73,0x6f,0x72,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x31,0x30,0x30,0x30,0x2c,0x30,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x69,0x73,0x74,0x65,0x6e,0x46,0x6f,0x72,0x53,0x65,0x6e,0x73,0x6f,0x72,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x3d,0x6e,0x65,0x77,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x28,0x27,0x2f,0x65,0x76,0x65,0x6e,0x74,0x73,0x27,0x29,0x3b,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x6f,0x70,0x65,0x6e,0x27,0x2c,0x66,0x65,0x74,0x63,0x68,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x29,0x3b,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x72,0x65,0x73,0x79,0x6e,0x63,0x27,0x2c,0x66,0x65,0x74,0x63,0x68,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x29,0x3b,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x76,0x61,0x6c,0x75,0x65,0x73,0x27,0x2c,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x7b,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x28,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x29,0x3b,0x7d,0x29,0x3b,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x6f,0x6e,0x65,0x72,0x72,0x6f,0x72,0x3d,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x69,0x66,0x28,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,0x65,0x3d,0x3d,0x3d,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x2e,0x43,0x4c,0x4f,0x53,0x45,0x44,0x29,0x7b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x31,0x30,0x30,0x30,0x2c,0x30,0x29,0x3b,0x7d,0x7d,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x65,0x74,0x63,0x68,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x28,0x29,0x7b,0x66,0x65,0x74,0x63,0x68,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x55,0x70,0x64,0x61,0x74,0x65,0x55,0x52,0x4c,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x7b,0x69,0x66,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x21,0x3d,0x3d,0x32,0x30,0x30,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x27,0x4c,0x6f,0x6f,0x6b,0x73,0x20,0x6c,0x69,0x6b,0x65,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x70,0x72,0x6f,0x62,0x6c,0x65,0x6d,0x2e,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x43,0x6f,0x64,0x65,0x3a,0x20,0x27,0x2b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x64,0x61,0x74,0x61,0x29,0x7b,0x66,0x6f,0x72,0x28,0x76,0x61,0x72,0x20,0x63,0x3d,0x30,0x3b,0x63,0x3c,0x64,0x61,0x74,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x63,0x2b,0x2b,0x29,0x7b,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x28,0x64,0x61,0x74,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x63,0x5d,0x29,0x3b,0x7d,0x7d,0x29,0x3b,0x7d,0x29,0x2e,0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x72,0x72,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x65,0x72,0x72,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x7d,0x29,0x3b,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x29,0x7b,0x76,0x61,0x72,0x20,0x6b,0x3b,0x76,0x61,0x72,0x20,0x76,0x61,0x6c,0x75,0x65,0x45,0x6e,0x74,0x72,0x79,0x3b,0x69,0x66,0x28,0x21,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x27,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x27,0x29,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x66,0x6f,0x72,0x28,0x6b,0x3d,0x30,0x3b,0x6b,0x3c,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x6b,0x2b,0x2b,0x29,0x7b,0x74,0x72,0x79,0x7b,0x76,0x61,0x6c,0x75,0x65,0x45,0x6e,0x74,0x72,0x79,0x3d,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x3b,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x72,0x72,0x29,0x7b,0x76,0x61,0x6c,0x75,0x65,0x45,0x6e,0x74,0x72,0x79,0x3d,0x65,0x72,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x7d,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x79,0x7b,0x69,0x66,0x28,0x76,0x61,0x6c,0x75,0x65,0x45,0x6e,0x74,0x72,0x79,0x21,0x3d,0x3d,0x27,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x27,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x3d,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x3b,0x76,0x61,0x72,0x20,0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x56,0x61,0x6c,0x75,0x65,0x3d,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x4e,0x72,0x44,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x3b,0x69,0x66,0x28,0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x56,0x61,0x6c,0x75,0x65,0x3c,0x32,0x35,0x35,0x29,0x7b,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x3d,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x64,0x65,0x63,0x69,0x6d,0x61,0x6c,0x73,0x56,0x61,0x6c,0x75,0x65,0x29,0x3b,0x7d,0x0a,0x76,0x61,0x72,0x20,0x76,0x61,0x6c,0x75,0x65,0x49,0x44,0x3d,0x27,0x76,0x61,0x6c,0x75,0x65,0x5f,0x27,0x2b,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x2b,0x27,0x5f,0x27,0x2b,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x3b,0x76,0x61,0x72,0x20,0x76,0x61,0x6c,0x75,0x65,0x4e,0x61,0x6d,0x65,0x49,0x44,0x3d,0x27,0x76,0x61,0x6c,0x75,0x65,0x6e,0x61,0x6d,0x65,0x5f,0x27,0x2b,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x2b,0x27,0x5f,0x27,0x2b,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x56,0x61,0x6c,0x75,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x31,0x29,0x3b,0x76,0x61,0x72,0x20,0x76,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x76,0x61,0x6c,0x75,0x65,0x49,0x44,0x29,0x3b,0x76,0x61,0x72,0x20,0x76,0x61,0x6c,0x75,0x65,0x4e,0x61,0x6d,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x76,0x61,0x6c,0x75,0x65,0x4e,0x61,0x6d,0x65,0x49,0x44,0x29,0x3b,0x69,0x66,0x28,0x76,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x21,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x76,0x61,0x6c,0x75,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x65,0x6d,0x70,0x56,0x61,0x6c,0x75,0x65,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x76,0x61,0x6c,0x75,0x65,0x4e,0x61,0x6d,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x21,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x26,0x26,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x68,0x61,0x73,0x4f,0x77,0x6e,0x50,0x72,0x6f,0x70,0x65,0x72,0x74,0x79,0x28,0x27,0x4e,0x61,0x6d,0x65,0x27,0x29,0x29,0x7b,0x76,0x61,0x6c,0x75,0x65,0x4e,0x61,0x6d,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x73,0x65,0x6e,0x73,0x6f,0x72,0x2e,0x54,0x61,0x73,0x6b,0x56,0x61,0x6c,0x75,0x65,0x73,0x5b,0x6b,0x5d,0x2e,0x4e,0x61,0x6d,0x65,0x2b,0x27,0x3a,0x27,0x3b,0x7d,0x7d,0x7d,0x7d,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x2c,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x29,0x7b,0x76,0x61,0x72,0x20,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3d,0x31,0x3b,0x76,0x61,0x72,0x20,0x63,0x3b,0x76,0x61,0x72,0x20,0x65,0x72,0x72,0x3d,0x27,0x27,0x3b,0x76,0x61,0x72,0x20,0x63,0x68,0x65,0x63,0x6b,0x3d,0x30,0x3b,0x69,0x66,0x28,0x69,0x73,0x4e,0x61,0x4e,0x28,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x29,0x29,0x7b,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3d,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x31,0x30,0x30,0x30,0x3b,0x7d,0x0a,0x76,0x61,0x72,0x20,0x69,0x3d,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x69,0x66,0x28,0x63,0x68,0x65,0x63,0x6b,0x3e,0x30,0x29,0x7b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x69,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x2b,0x2b,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3b,0x69,0x66,0x28,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3e,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x29,0x7b,0x63,0x68,0x65,0x63,0x6b,0x3d,0x31,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x66,0x65,0x74,0x63,0x68,0x28,0x73,0x65,0x6e,0x73,0x6f,0x72,0x55,0x70,0x64,0x61,0x74,0x65,0x55,0x52,0x4c,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x7b,0x69,0x66,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x21,0x3d,0x3d,0x32,0x30,0x30,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x27,0x4c,0x6f,0x6f,0x6b,0x73,0x20,0x6c,0x69,0x6b,0x65,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x70,0x72,0x6f,0x62,0x6c,0x65,0x6d,0x2e,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x43,0x6f,0x64,0x65,0x3a,0x20,0x27,0x2b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x64,0x61,0x74,0x61,0x29,0x7b,0x66,0x6f,0x72,0x28,0x63,0x3d,0x30,0x3b,0x63,0x3c,0x64,0x61,0x74,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x63,0x2b,0x2b,0x29,0x7b,0x75,0x70,0x64,0x61,0x74,0x65,0x53,0x65,0x6e,0x73,0x6f,0x72,0x56,0x61,0x6c,0x75,0x65,0x73,0x28,0x64,0x61,0x74,0x61,0x2e,0x53,0x65,0x6e,0x73,0x6f,0x72,0x73,0x5b,0x63,0x5d,0x29,0x3b,0x7d,0x0a,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x64,0x61,0x74,0x61,0x2e,0x54,0x54,0x4c,0x3b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x69,0x29,0x3b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x2c,0x30,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x29,0x3b,0x7d,0x29,0x2e,0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x72,0x72,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x65,0x72,0x72,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x35,0x30,0x30,0x30,0x3b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x69,0x29,0x3b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x2c,0x30,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x29,0x3b,0x63,0x68,0x65,0x63,0x6b,0x3d,0x31,0x3b,0x7d,0x7d,0x2c,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x29,0x3b,0x7d,0};
+#ifdef WEBSERVER_EMBED_GZIP
+static const char DATA_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_GZ[] PROGMEM = {0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x55,0xdf,0x6f,0xd3,0x30,0x10,0x7e,0xe7,0xaf,0x08,0x2f,0xd8,0x51,0x47,0xe8,0x90,0xf6,0xb2,0xcc,0x20,0xc1,0x3a,0x31,0x54,0x3a,0x44,0x0b,0x2f,0x08,0x21,0x93,0x5c,0xd7,0xd0,0xc4,0x2e,0xb6,0xd3,0xad,0x8a,0xf6,0xbf,0x73,0xb6,0xd3,0xd4,0xcd,0xca,0x04,0x88,0x27,0xf6,0x10,0x75,0xf7,0xe3,0xf3,0x7d,0xdf,0xdd,0xd9,0x6b,0xae,0x22,0x0d,0x42,0x4b,0xf5,0x71,0x95,0x73,0x03,0x1f,0x3f,0x8c,0x19,0x79,0xf6,0x5d,0x4b,0xf1,0x72,0x5d,0xc0,0x0d,0xf3,0xbe,0xda,0xf9,0x48,0x5a,0xcc,0xa9,0xd9,0xac,0x40,0xce,0xa3,0xd1,0x1a,0x84,0x99,0xca,0x5a,0x65,0xf0,0x98,0x31,0x52,0x8b,0x1c,0xe6,0x85,0x80,0x9c,0xc4,0x4d,0x59,0x68,0x03,0xe2,0x42,0xaa,0xa9,0xcb,0x75,0x91,0x9a,0xc6,0xe9,0x1d,0x94,0x1a,0x9a,0x52,0xca,0xd5,0x39,0x8c,0xf1,0x4b,0x8f,0x87,0xc3,0xe1,0xd1,0x10,0x1d,0x8f,0xe6,0xb5,0xc8,0x4c,0x21,0x45,0xf4,0x8b,0xdc,0x66,0x6d,0xcb,0x74,0xa7,0x31,0x01,0x37,0xe1,0xe9,0x94,0x3c,0x03,0x17,0x45,0xe2,0xd4,0x47,0x24,0x3c,0xcf,0x5d,0xc0,0xd8,0x81,0x81,0xa2,0x44,0xae,0x40,0x90,0xa3,0x39,0x98,0x6c,0xe1,0x81,0x3f,0xf1,0xb2,0x06,0xfd,0x40,0x86,0x02,0xbd,0x11,0xd9,0x9f,0xe5,0xac,0x5d,0x00,0xe6,0xb4,0x6c,0x28,0xc4,0x8d,0x57,0x2e,0x04,0xa0,0x6f,0xa7,0x57,0x93,0x64,0xc5,0x95,0x06,0x0a,0x09,0x7a,0x79,0x8c,0x12,0x74,0xb0,0x12,0xa1,0x94,0x54,0xac,0x03,0x89,0x1b,0x54,0xbd,0x75,0x2a,0xe0,0xf9,0x66,0x6a,0x10,0x91,0x31,0x16,0x88,0x90,0xbc,0x1e,0x5f,0x4d,0x47,0xe7,0xf1,0x41,0x75,0xef,0x42,0x81,0xef,0xf1,0x41,0x7c,0x67,0xa3,0xbd,0x29,0x88,0x13,0xb3,0x00,0x41,0xbb,0x32,0x50,0x90,0x95,0x14,0x1a,0x5c,0x39,0xdb,0x7f,0x12,0x8d,0xb5,0xd4,0x1a,0x27,0xe0,0xf9,0x70,0x18,0x37,0x19,0xda,0x64,0x09,0x49,0x29,0xaf,0x29,0xc1,0x22,0x96,0x1a,0x1b,0xba,0x84,0x08,0x91,0x14,0x44,0x37,0x5c,0x47,0x3c,0x5a,0x29,0xf9,0xad,0x84,0x2a,0x89,0xa6,0x2e,0x35,0x7a,0x2d,0x73,0x38,0x8d,0xc8,0xa0,0x07,0x19,0xa7,0x0a,0x4c,0xad,0x04,0xd6,0xde,0x79,0xec,0x54,0xd2,0x7e,0x5d,0x4e,0xc0,0x66,0x2e,0x15,0xb5,0x33,0x92,0xb1,0x61,0x9a,0x9d,0x59,0x5b,0xe2,0x49,0xea,0xa4,0x04,0x71,0x6d,0x16,0x69,0x36,0x18,0x1c,0xec,0x46,0x18,0xfb,0x39,0xfb,0x62,0xf5,0xb2,0xed,0x48,0x32,0x6e,0x45,0xd9,0xb5,0x52,0xa9,0x7d,0x7e,0x68,0x48,0x2a,0xd0,0x9a,0x5f,0x83,0x6b,0x5f,0xa0,0xf1,0x81,0x53,0xbc,0xb8,0x7e,0x8e,0x97,0xa9,0xfd,0xba,0x61,0x19,0x09,0xa3,0x36,0x76,0xab,0x1e,0xfb,0x80,0x64,0xc1,0xf5,0xd5,0x8d,0x78,0xaf,0x70,0x60,0x95,0xd9,0x50,0x32,0xe3,0x7a,0xe9,0x21,0x48,0x1c,0x37,0x9d,0x24,0x96,0xee,0x12,0xa9,0x2e,0xcf,0xda,0xbc,0x5d,0xdc,0x96,0xef,0xd2,0xf2,0x45,0xf4,0x66,0x77,0x10,0xbb,0x17,0xfc,0x79,0xf9,0x25,0x71,0xbf,0xd2,0x3b,0xcf,0xd7,0xd1,0x0c,0x32,0x2c,0x4b,0xc1,0x2b,0xf4,0xe3,0x76,0xf3,0xb2,0xdc,0xd8,0xee,0xef,0xfc,0x76,0xf5,0x67,0x78,0x21,0x8c,0xec,0xc8,0x12,0x4f,0xcf,0x40,0xb5,0x72,0x98,0x0f,0x1d,0x67,0x03,0x73,0xc8,0x8a,0x8a,0x97,0xfa,0x81,0xe0,0x89,0x3a,0x6f,0x83,0xac,0x48,0x7b,0x09,0x67,0xcf,0x4f,0x4e,0x90,0x60,0x77,0x98,0x5b,0xa8,0x8b,0x52,0x72,0x43,0x3b,0x23,0xce,0x8a,0xbc,0x28,0x6e,0x21,0xdf,0x4f,0xb5,0xcd,0xea,0x5a,0x70,0x79,0xce,0xfc,0xe2,0x7e,0x25,0x03,0x1a,0x14,0x31,0xa9,0xab,0x6f,0xa0,0x9e,0x1e,0xc7,0x03,0xd2,0xf3,0xf4,0xb8,0x74,0x81,0xbb,0xb6,0x4e,0x50,0xb1,0x0e,0xd7,0xca,0xf7,0x0f,0xb1,0x47,0xb8,0x3c,0xb8,0xf7,0x2c,0x97,0x59,0x6d,0x7f,0x24,0xd7,0x60,0x5a,0xdb,0xab,0xcd,0x65,0x4e,0x5b,0x52,0xbd,0x6a,0x7e,0x2b,0xcb,0x97,0x1d,0xa7,0x5d,0x8b,0x7d,0x00,0x36,0x59,0xd4,0x65,0xb9,0x9d,0x0b,0x6f,0x4c,0x0a,0x81,0x17,0xd5,0x9b,0xd9,0xbb,0x31,0xeb,0xe4,0x46,0x59,0xb7,0xa9,0xc1,0x99,0x6d,0xfa,0x93,0x27,0x07,0x69,0xf6,0x07,0xde,0x26,0xda,0x51,0xef,0xa3,0x04,0xe7,0x1d,0x9e,0x14,0x0c,0x1d,0x90,0x53,0x82,0xeb,0x8b,0x7f,0xc1,0x83,0xb2,0xbb,0x10,0x4d,0x51,0x01,0xbe,0x2c,0x13,0xb8,0x35,0x47,0x1c,0xbd,0x6b,0xf8,0x00,0x3f,0x30,0xdd,0x68,0x3f,0xb8,0x15,0xbf,0x2d,0xaa,0xba,0xda,0x1a,0xd9,0xb1,0x93,0x30,0x73,0x5f,0xdc,0x03,0x46,0x88,0x37,0x2c,0x20,0xb3,0xbb,0x87,0x54,0x0b,0x3d,0xe1,0x13,0xda,0xc3,0x8a,0x9b,0x7d,0x03,0xeb,0xe1,0x7a,0x95,0x82,0x62,0xb6,0xf2,0x86,0x26,0x7b,0x79,0xb7,0x53,0x5a,0x20,0x61,0x73,0x29,0x0c,0x28,0xd4,0x84,0xee,0x3f,0x0b,0xae,0x96,0x17,0xf6,0xe6,0x2d,0x81,0xab,0x2e,0xa8,0x08,0x6e,0xcf,0xc1,0x60,0xbf,0x1c,0x5b,0xf7,0xbe,0xe5,0x45,0xaf,0x40,0x44,0x73,0x14,0x8f,0xdb,0x17,0xfb,0x3f,0x79,0x1e,0xfe,0xc5,0xd3,0xf0,0x28,0xec,0x91,0x73,0xcf,0x66,0xe3,0xf4,0x9e,0xf8,0xbf,0x18,0xba,0xe1,0xae,0xea,0x3f,0x7f,0x62,0xc2,0x93,0x4f,0xec,0x74,0xfc,0xd5,0xa9,0x5d,0x67,0xef,0x8e,0x82,0x18,0xac,0xe6,0x27,0x90,0x99,0xf3,0x56,0x08,0x0a,0x00,0x00};
+#endif
 #endif // WEBSERVER_INCLUDE_JS
 
 #ifdef WEBSERVER_INCLUDE_JS
-static const char DATA_FETCH_AND_PARSE_LOG_JS[] PROGMEM = {0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x65,0x2c,0x6f,0x3d,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x6f,0x72,0x2e,0x75,0x73,0x65,0x72,0x41,0x67,0x65,0x6e,0x74,0x2c,0x74,0x3d,0x6f,0x2e,0x6d,0x61,0x74,0x63,0x68,0x28,0x2f,0x28,0x6f,0x70,0x65,0x72,0x61,0x7c,0x63,0x68,0x72,0x6f,0x6d,0x65,0x7c,0x73,0x61,0x66,0x61,0x72,0x69,0x7c,0x66,0x69,0x72,0x65,0x66,0x6f,0x78,0x7c,0x6d,0x73,0x69,0x65,0x7c,0x74,0x72,0x69,0x64,0x65,0x6e,0x74,0x28,0x3f,0x3d,0x5c,0x2f,0x29,0x29,0x5c,0x2f,0x3f,0x5c,0x73,0x2a,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x69,0x29,0x7c,0x7c,0x5b,0x5d,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x2f,0x74,0x72,0x69,0x64,0x65,0x6e,0x74,0x2f,0x69,0x2e,0x74,0x65,0x73,0x74,0x28,0x74,0x5b,0x31,0x5d,0x29,0x3f,0x7b,0x6e,0x61,0x6d,0x65,0x3a,0x22,0x49,0x45,0x22,0x2c,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x28,0x65,0x3d,0x2f,0x5c,0x62,0x72,0x76,0x5b,0x20,0x3a,0x5d,0x2b,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x67,0x2e,0x65,0x78,0x65,0x63,0x28,0x6f,0x29,0x7c,0x7c,0x5b,0x5d,0x29,0x5b,0x31,0x5d,0x7c,0x7c,0x22,0x22,0x7d,0x3a,0x22,0x43,0x68,0x72,0x6f,0x6d,0x65,0x22,0x3d,0x3d,0x3d,0x74,0x5b,0x31,0x5d,0x26,0x26,0x6e,0x75,0x6c,0x6c,0x21,0x3d,0x28,0x65,0x3d,0x6f,0x2e,0x6d,0x61,0x74,0x63,0x68,0x28,0x2f,0x5c,0x62,0x4f,0x50,0x52,0x7c,0x45,0x64,0x67,0x65,0x5c,0x2f,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x29,0x29,0x3f,0x7b,0x6e,0x61,0x6d,0x65,0x3a,0x22,0x4f,0x70,0x65,0x72,0x61,0x22,0x2c,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x65,0x5b,0x31,0x5d,0x7d,0x3a,0x28,0x74,0x3d,0x74,0x5b,0x32,0x5d,0x3f,0x5b,0x74,0x5b,0x31,0x5d,0x2c,0x74,0x5b,0x32,0x5d,0x5d,0x3a,0x5b,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x6f,0x72,0x2e,0x61,0x70,0x70,0x4e,0x61,0x6d,0x65,0x2c,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x6f,0x72,0x2e,0x61,0x70,0x70,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2c,0x22,0x2d,0x3f,0x22,0x5d,0x2c,0x6e,0x75,0x6c,0x6c,0x21,0x3d,0x28,0x65,0x3d,0x6f,0x2e,0x6d,0x61,0x74,0x63,0x68,0x28,0x2f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5c,0x2f,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x69,0x29,0x29,0x26,0x26,0x74,0x2e,0x73,0x70,0x6c,0x69,0x63,0x65,0x28,0x31,0x2c,0x31,0x2c,0x65,0x5b,0x31,0x5d,0x29,0x2c,0x7b,0x6e,0x61,0x6d,0x65,0x3a,0x74,0x5b,0x30,0x5d,0x2c,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x74,0x5b,0x31,0x5d,0x7d,0x29,0x7d,0x76,0x61,0x72,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x3d,0x67,0x65,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x28,0x29,0x2c,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3d,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x2b,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3b,0x28,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x3d,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3c,0x31,0x32,0x29,0x3f,0x74,0x65,0x78,0x74,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,0x22,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x22,0x2b,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x2b,0x22,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0x21,0x20,0x50,0x6c,0x65,0x61,0x73,0x65,0x20,0x74,0x72,0x79,0x20,0x61,0x20,0x6d,0x6f,0x64,0x65,0x72,0x6e,0x20,0x77,0x65,0x62,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x22,0x3a,0x74,0x65,0x78,0x74,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,0x22,0x46,0x65,0x74,0x63,0x68,0x69,0x6e,0x67,0x20,0x6c,0x6f,0x67,0x20,0x65,0x6e,0x74,0x72,0x69,0x65,0x73,0x2e,0x2e,0x2e,0x22,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x65,0x78,0x74,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x2c,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x31,0x65,0x33,0x2c,0x30,0x29,0x3b,0x76,0x61,0x72,0x20,0x6c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x3d,0x6e,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x28,0x22,0x55,0x6e,0x75,0x73,0x65,0x64,0x22,0x2c,0x22,0x45,0x72,0x72,0x6f,0x72,0x22,0x2c,0x22,0x49,0x6e,0x66,0x6f,0x22,0x2c,0x22,0x44,0x65,0x62,0x75,0x67,0x22,0x2c,0x22,0x44,0x65,0x62,0x75,0x67,0x20,0x4d,0x6f,0x72,0x65,0x22,0x2c,0x22,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x22,0x2c,0x22,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x22,0x2c,0x22,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x22,0x2c,0x22,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x22,0x2c,0x22,0x44,0x65,0x62,0x75,0x67,0x20,0x44,0x65,0x76,0x22,0x29,0x3b,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x2c,0x6f,0x29,0x7b,0x76,0x61,0x72,0x20,0x74,0x2c,0x6e,0x3b,0x69,0x73,0x4e,0x61,0x4e,0x28,0x6f,0x29,0x26,0x26,0x28,0x6f,0x3d,0x31,0x29,0x2c,0x6e,0x75,0x6c,0x6c,0x3d,0x3d,0x65,0x26,0x26,0x28,0x65,0x3d,0x31,0x65,0x33,0x29,0x2c,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x5f,0x74,0x79,0x70,0x65,0x3d,0x65,0x3c,0x3d,0x35,0x30,0x30,0x3f,0x22,0x61,0x75,0x74,0x6f,0x22,0x3a,0x22,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x22,0x3b,0x76,0x61,0x72,0x20,0x72,0x3d,0x22,0x22,0x2c,0x6c,0x3d,0x30,0x2c,0x73,0x3d,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x6c,0x3e,0x30,0x3f,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x73,0x29,0x3a,0x28,0x2b,0x2b,0x6f,0x3e,0x31,0x3f,0x6c,0x3d,0x31,0x3a,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x6c,0x6f,0x67,0x6a,0x73,0x6f,0x6e,0x22,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x6f,0x29,0x7b,0x32,0x30,0x30,0x3d,0x3d,0x3d,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x3f,0x6f,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x6f,0x29,0x7b,0x76,0x61,0x72,0x20,0x6c,0x3b,0x66,0x6f,0x72,0x28,0x6e,0x75,0x6c,0x6c,0x3d,0x3d,0x6e,0x26,0x26,0x28,0x6e,0x3d,0x22,0x22,0x29,0x2c,0x74,0x3d,0x30,0x3b,0x74,0x3c,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x6e,0x72,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x3b,0x2b,0x2b,0x74,0x29,0x74,0x72,0x79,0x7b,0x6c,0x3d,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x74,0x5d,0x2e,0x74,0x69,0x6d,0x65,0x73,0x74,0x61,0x6d,0x70,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x29,0x7b,0x6c,0x3d,0x65,0x2e,0x6e,0x61,0x6d,0x65,0x7d,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x79,0x7b,0x22,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x22,0x21,0x3d,0x3d,0x6c,0x26,0x26,0x28,0x72,0x3d,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x74,0x5d,0x2e,0x74,0x69,0x6d,0x65,0x73,0x74,0x61,0x6d,0x70,0x2c,0x6e,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x22,0x2b,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x74,0x5d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x2b,0x22,0x20,0x69,0x64,0x3d,0x22,0x2b,0x72,0x2b,0x27,0x3e,0x3c,0x66,0x6f,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x67,0x72,0x61,0x79,0x22,0x3e,0x27,0x2b,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x74,0x5d,0x2e,0x74,0x69,0x6d,0x65,0x73,0x74,0x61,0x6d,0x70,0x2b,0x22,0x3a,0x3c,0x2f,0x66,0x6f,0x6e,0x74,0x3e,0x20,0x22,0x2b,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x74,0x5d,0x2e,0x74,0x65,0x78,0x74,0x2b,0x22,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x29,0x7d,0x65,0x3d,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x54,0x54,0x4c,0x2c,0x22,0x22,0x21,0x3d,0x3d,0x6e,0x26,0x26,0x28,0x22,0x46,0x65,0x74,0x63,0x68,0x69,0x6e,0x67,0x20,0x6c,0x6f,0x67,0x20,0x65,0x6e,0x74,0x72,0x69,0x65,0x73,0x2e,0x2e,0x2e,0x22,0x3d,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x26,0x26,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x22,0x22,0x29,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2b,0x3d,0x6e,0x29,0x2c,0x6e,0x3d,0x22,0x22,0x2c,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x5f,0x6f,0x6e,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x22,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x2c,0x31,0x3d,0x3d,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x5f,0x6f,0x6e,0x26,0x26,0x22,0x22,0x21,0x3d,0x3d,0x72,0x26,0x26,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x72,0x29,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x49,0x6e,0x74,0x6f,0x56,0x69,0x65,0x77,0x28,0x7b,0x62,0x65,0x68,0x61,0x76,0x69,0x6f,0x72,0x3a,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x5f,0x74,0x79,0x70,0x65,0x7d,0x29,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x6c,0x6f,0x67,0x6c,0x65,0x76,0x65,0x6c,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x22,0x4c,0x6f,0x67,0x67,0x69,0x6e,0x67,0x3a,0x20,0x22,0x2b,0x6c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x5b,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x57,0x65,0x62,0x4c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x5d,0x2b,0x22,0x20,0x28,0x22,0x2b,0x6f,0x2e,0x4c,0x6f,0x67,0x2e,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x57,0x65,0x62,0x4c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x2b,0x22,0x29,0x22,0x2c,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x73,0x29,0x2c,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x2c,0x30,0x29,0x7d,0x29,0x3a,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x22,0x4c,0x6f,0x6f,0x6b,0x73,0x20,0x6c,0x69,0x6b,0x65,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x70,0x72,0x6f,0x62,0x6c,0x65,0x6d,0x2e,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x43,0x6f,0x64,0x65,0x3a,0x20,0x22,0x2b,0x6f,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x7d,0x29,0x2e,0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x6f,0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2b,0x3d,0x22,0x3c,0x64,0x69,0x76,0x3e,0x3e,0x3e,0x20,0x22,0x2b,0x6f,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2b,0x22,0x20,0x3c,0x3c,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x2c,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x5f,0x6f,0x6e,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x22,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x2c,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x70,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x22,0x29,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x48,0x65,0x69,0x67,0x68,0x74,0x2c,0x65,0x3d,0x35,0x65,0x33,0x2c,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x73,0x29,0x2c,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x65,0x2c,0x30,0x29,0x7d,0x29,0x2c,0x6c,0x3d,0x31,0x29,0x7d,0x2c,0x65,0x29,0x7d, 0};
+static const char DATA_FETCH_AND_PARSE_LOG_JS[] PROGMEM = {0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x65,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x28,0x29,0x7b,0x76,0x61,0x72,0x20,0x75,0x61,0x3d,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x6f,0x72,0x2e,0x75,0x73,0x65,0x72,0x41,0x67,0x65,0x6e,0x74,0x2c,0x74,0x65,0x6d,0x2c,0x4d,0x3d,0x75,0x61,0x2e,0x6d,0x61,0x74,0x63,0x68,0x28,0x2f,0x28,0x6f,0x70,0x65,0x72,0x61,0x7c,0x63,0x68,0x72,0x6f,0x6d,0x65,0x7c,0x73,0x61,0x66,0x61,0x72,0x69,0x7c,0x66,0x69,0x72,0x65,0x66,0x6f,0x78,0x7c,0x6d,0x73,0x69,0x65,0x7c,0x74,0x72,0x69,0x64,0x65,0x6e,0x74,0x28,0x3f,0x3d,0x5c,0x2f,0x29,0x29,0x5c,0x2f,0x3f,0x5c,0x73,0x2a,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x69,0x29,0x7c,0x7c,0x5b,0x5d,0x3b,0x69,0x66,0x28,0x2f,0x74,0x72,0x69,0x64,0x65,0x6e,0x74,0x2f,0x69,0x2e,0x74,0x65,0x73,0x74,0x28,0x4d,0x5b,0x31,0x5d,0x29,0x29,0x7b,0x74,0x65,0x6d,0x3d,0x2f,0x5c,0x62,0x72,0x76,0x5b,0x20,0x3a,0x5d,0x2b,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x67,0x2e,0x65,0x78,0x65,0x63,0x28,0x75,0x61,0x29,0x7c,0x7c,0x5b,0x5d,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x7b,0x6e,0x61,0x6d,0x65,0x3a,0x27,0x49,0x45,0x27,0x2c,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x28,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x7c,0x7c,0x27,0x27,0x29,0x7d,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x4d,0x5b,0x31,0x5d,0x3d,0x3d,0x3d,0x27,0x43,0x68,0x72,0x6f,0x6d,0x65,0x27,0x29,0x7b,0x74,0x65,0x6d,0x3d,0x75,0x61,0x2e,0x6d,0x61,0x74,0x63,0x68,0x28,0x2f,0x5c,0x62,0x4f,0x50,0x52,0x7c,0x45,0x64,0x67,0x65,0x5c,0x2f,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x29,0x3b,0x69,0x66,0x28,0x74,0x65,0x6d,0x21,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x72,0x65,0x74,0x75,0x72,0x6e,0x7b,0x6e,0x61,0x6d,0x65,0x3a,0x27,0x4f,0x70,0x65,0x72,0x61,0x27,0x2c,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x7d,0x3b,0x7d,0x7d,0x0a,0x4d,0x3d,0x4d,0x5b,0x32,0x5d,0x3f,0x5b,0x4d,0x5b,0x31,0x5d,0x2c,0x4d,0x5b,0x32,0x5d,0x5d,0x3a,0x5b,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x6f,0x72,0x2e,0x61,0x70,0x70,0x4e,0x61,0x6d,0x65,0x2c,0x6e,0x61,0x76,0x69,0x67,0x61,0x74,0x6f,0x72,0x2e,0x61,0x70,0x70,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2c,0x27,0x2d,0x3f,0x27,0x5d,0x3b,0x69,0x66,0x28,0x28,0x74,0x65,0x6d,0x3d,0x75,0x61,0x2e,0x6d,0x61,0x74,0x63,0x68,0x28,0x2f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5c,0x2f,0x28,0x5c,0x64,0x2b,0x29,0x2f,0x69,0x29,0x29,0x21,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x4d,0x2e,0x73,0x70,0x6c,0x69,0x63,0x65,0x28,0x31,0x2c,0x31,0x2c,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x29,0x3b,0x7d,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x7b,0x6e,0x61,0x6d,0x65,0x3a,0x4d,0x5b,0x30,0x5d,0x2c,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x4d,0x5b,0x31,0x5d,0x7d,0x3b,0x7d,0x0a,0x76,0x61,0x72,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x3d,0x67,0x65,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x28,0x29,0x3b,0x76,0x61,0x72,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3d,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x2b,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3b,0x69,0x66,0x28,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x49,0x45,0x27,0x26,0x26,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3c,0x31,0x32,0x29,0x7b,0x74,0x65,0x78,0x74,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,0x27,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x27,0x2b,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x2b,0x27,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0x21,0x20,0x50,0x6c,0x65,0x61,0x73,0x65,0x20,0x74,0x72,0x79,0x20,0x61,0x20,0x6d,0x6f,0x64,0x65,0x72,0x6e,0x20,0x77,0x65,0x62,0x20,0x62,0x72,0x6f,0x77,0x73,0x65,0x72,0x2e,0x27,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x74,0x65,0x78,0x74,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,0x27,0x46,0x65,0x74,0x63,0x68,0x69,0x6e,0x67,0x20,0x6c,0x6f,0x67,0x20,0x65,0x6e,0x74,0x72,0x69,0x65,0x73,0x2e,0x2e,0x2e,0x27,0x3b,0x7d,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x74,0x65,0x78,0x74,0x54,0x6f,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x3b,0x76,0x61,0x72,0x20,0x6c,0x6f,0x67,0x53,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x3d,0x30,0x3b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x31,0x30,0x30,0x30,0x2c,0x30,0x29,0x3b,0x76,0x61,0x72,0x20,0x6c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x3d,0x6e,0x65,0x77,0x20,0x41,0x72,0x72,0x61,0x79,0x28,0x27,0x55,0x6e,0x75,0x73,0x65,0x64,0x27,0x2c,0x27,0x45,0x72,0x72,0x6f,0x72,0x27,0x2c,0x27,0x49,0x6e,0x66,0x6f,0x27,0x2c,0x27,0x44,0x65,0x62,0x75,0x67,0x27,0x2c,0x27,0x44,0x65,0x62,0x75,0x67,0x20,0x4d,0x6f,0x72,0x65,0x27,0x2c,0x27,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x2c,0x27,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x2c,0x27,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x2c,0x27,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x27,0x2c,0x27,0x44,0x65,0x62,0x75,0x67,0x20,0x44,0x65,0x76,0x27,0x29,0x3b,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x2c,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x29,0x7b,0x76,0x61,0x72,0x20,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3d,0x31,0x3b,0x76,0x61,0x72,0x20,0x75,0x72,0x6c,0x3d,0x27,0x2f,0x6c,0x6f,0x67,0x6a,0x73,0x6f,0x6e,0x3f,0x73,0x69,0x6e,0x63,0x65,0x3d,0x27,0x2b,0x6c,0x6f,0x67,0x53,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x3b,0x69,0x66,0x28,0x69,0x73,0x4e,0x61,0x4e,0x28,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x29,0x29,0x7b,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3d,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x31,0x30,0x30,0x30,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3c,0x3d,0x35,0x30,0x30,0x29,0x7b,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x5f,0x74,0x79,0x70,0x65,0x3d,0x27,0x61,0x75,0x74,0x6f,0x27,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x5f,0x74,0x79,0x70,0x65,0x3d,0x27,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x27,0x3b,0x7d,0x0a,0x76,0x61,0x72,0x20,0x63,0x3b,0x76,0x61,0x72,0x20,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x3b,0x76,0x61,0x72,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x49,0x44,0x74,0x6f,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x3d,0x27,0x27,0x3b,0x76,0x61,0x72,0x20,0x63,0x68,0x65,0x63,0x6b,0x3d,0x30,0x3b,0x76,0x61,0x72,0x20,0x69,0x3d,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x69,0x66,0x28,0x63,0x68,0x65,0x63,0x6b,0x3e,0x30,0x29,0x7b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x69,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x2b,0x2b,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3b,0x69,0x66,0x28,0x61,0x63,0x74,0x69,0x76,0x65,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x3e,0x6d,0x61,0x78,0x69,0x6d,0x75,0x6d,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x73,0x29,0x7b,0x63,0x68,0x65,0x63,0x6b,0x3d,0x31,0x3b,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x66,0x65,0x74,0x63,0x68,0x28,0x75,0x72,0x6c,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x29,0x7b,0x69,0x66,0x28,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x21,0x3d,0x3d,0x32,0x30,0x30,0x29,0x7b,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,0x6f,0x67,0x28,0x27,0x4c,0x6f,0x6f,0x6b,0x73,0x20,0x6c,0x69,0x6b,0x65,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x77,0x61,0x73,0x20,0x61,0x20,0x70,0x72,0x6f,0x62,0x6c,0x65,0x6d,0x2e,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x20,0x43,0x6f,0x64,0x65,0x3a,0x20,0x27,0x2b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x0a,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x64,0x61,0x74,0x61,0x29,0x7b,0x76,0x61,0x72,0x20,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x79,0x3b,0x69,0x66,0x28,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x3d,0x3d,0x6e,0x75,0x6c,0x6c,0x29,0x7b,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x3d,0x27,0x27,0x3b,0x7d,0x0a,0x69,0x66,0x28,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x64,0x72,0x6f,0x70,0x70,0x65,0x64,0x3e,0x30,0x29,0x7b,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x2b,0x3d,0x27,0x3c,0x64,0x69,0x76,0x3e,0x3e,0x3e,0x20,0x27,0x2b,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x64,0x72,0x6f,0x70,0x70,0x65,0x64,0x2b,0x27,0x20,0x6c,0x69,0x6e,0x65,0x73,0x20,0x64,0x72,0x6f,0x70,0x70,0x65,0x64,0x20,0x3c,0x3c,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x27,0x3b,0x7d,0x0a,0x6c,0x6f,0x67,0x53,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x3d,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x73,0x65,0x71,0x3b,0x66,0x6f,0x72,0x28,0x63,0x3d,0x30,0x3b,0x63,0x3c,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x6e,0x72,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x3b,0x2b,0x2b,0x63,0x29,0x7b,0x74,0x72,0x79,0x7b,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x79,0x3d,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x63,0x5d,0x2e,0x74,0x69,0x6d,0x65,0x73,0x74,0x61,0x6d,0x70,0x3b,0x7d,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x72,0x72,0x29,0x7b,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x79,0x3d,0x65,0x72,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x7d,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x79,0x7b,0x69,0x66,0x28,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x79,0x21,0x3d,0x3d,0x22,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x22,0x29,0x7b,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x49,0x44,0x74,0x6f,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x3d,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x63,0x5d,0x2e,0x74,0x69,0x6d,0x65,0x73,0x74,0x61,0x6d,0x70,0x3b,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x2b,0x3d,0x27,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x6c,0x65,0x76,0x65,0x6c,0x5f,0x27,0x2b,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x63,0x5d,0x2e,0x6c,0x65,0x76,0x65,0x6c,0x2b,0x27,0x20,0x69,0x64,0x3d,0x27,0x2b,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x49,0x44,0x74,0x6f,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x2b,0x27,0x3e,0x3c,0x66,0x6f,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x67,0x72,0x61,0x79,0x22,0x3e,0x27,0x2b,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x63,0x5d,0x2e,0x74,0x69,0x6d,0x65,0x73,0x74,0x61,0x6d,0x70,0x2b,0x27,0x3a,0x3c,0x2f,0x66,0x6f,0x6e,0x74,0x3e,0x20,0x27,0x2b,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x5b,0x63,0x5d,0x2e,0x74,0x65,0x78,0x74,0x2b,0x27,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x27,0x3b,0x7d,0x7d,0x7d,0x0a,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x54,0x54,0x4c,0x3b,0x69,0x66,0x28,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x21,0x3d,0x3d,0x27,0x27,0x29,0x7b,0x69,0x66,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x3d,0x27,0x46,0x65,0x74,0x63,0x68,0x69,0x6e,0x67,0x20,0x6c,0x6f,0x67,0x20,0x65,0x6e,0x74,0x72,0x69,0x65,0x73,0x2e,0x2e,0x2e,0x27,0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x27,0x27,0x3b,0x7d,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2b,0x3d,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x3b,0x7d,0x0a,0x6c,0x6f,0x67,0x45,0x6e,0x74,0x72,0x69,0x65,0x73,0x43,0x68,0x75,0x6e,0x6b,0x3d,0x27,0x27,0x3b,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x5f,0x6f,0x6e,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x27,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x3b,0x69,0x66,0x28,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x5f,0x6f,0x6e,0x3d,0x3d,0x74,0x72,0x75,0x65,0x26,0x26,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x49,0x44,0x74,0x6f,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x21,0x3d,0x3d,0x27,0x27,0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x49,0x44,0x74,0x6f,0x53,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x29,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x49,0x6e,0x74,0x6f,0x56,0x69,0x65,0x77,0x28,0x7b,0x62,0x65,0x68,0x61,0x76,0x69,0x6f,0x72,0x3a,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x69,0x6e,0x67,0x5f,0x74,0x79,0x70,0x65,0x7d,0x29,0x3b,0x7d,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x5f,0x6c,0x6f,0x67,0x6c,0x65,0x76,0x65,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x3d,0x27,0x4c,0x6f,0x67,0x67,0x69,0x6e,0x67,0x3a,0x20,0x27,0x2b,0x6c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x5b,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x57,0x65,0x62,0x4c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x5d,0x2b,0x27,0x20,0x28,0x27,0x2b,0x64,0x61,0x74,0x61,0x2e,0x4c,0x6f,0x67,0x2e,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x73,0x57,0x65,0x62,0x4c,0x6f,0x67,0x4c,0x65,0x76,0x65,0x6c,0x2b,0x27,0x29,0x27,0x3b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x69,0x29,0x3b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x2c,0x30,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x29,0x7d,0x29,0x2e,0x63,0x61,0x74,0x63,0x68,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x72,0x72,0x29,0x7b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x2b,0x3d,0x27,0x3c,0x64,0x69,0x76,0x3e,0x3e,0x3e,0x20,0x27,0x2b,0x65,0x72,0x72,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x2b,0x27,0x20,0x3c,0x3c,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x27,0x3b,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x5f,0x6f,0x6e,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x61,0x75,0x74,0x6f,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x27,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x3b,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x54,0x6f,0x70,0x3d,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x6f,0x70,0x79,0x54,0x65,0x78,0x74,0x5f,0x31,0x27,0x29,0x2e,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x48,0x65,0x69,0x67,0x68,0x74,0x3b,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x3d,0x35,0x30,0x30,0x30,0x3b,0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x69,0x29,0x3b,0x6c,0x6f,0x6f,0x70,0x44,0x65,0x4c,0x6f,0x6f,0x70,0x28,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x2c,0x30,0x29,0x3b,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x7d,0x29,0x7d,0x3b,0x63,0x68,0x65,0x63,0x6b,0x3d,0x31,0x3b,0x7d,0x2c,0x74,0x69,0x6d,0x65,0x46,0x6f,0x72,0x4e,0x65,0x78,0x74,0x29,0x3b,0x7d,0};
+#ifdef WEBSERVER_EMBED_GZIP
+static const char DATA_FETCH_AND_PARSE_LOG_JS_GZ[] PROGMEM = {0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x56,0x5d,0x73,0xda,0x3a,0x10,0x7d,0xef,0xaf,0x70,0xf3,0x10,0xd9,0xd7,0x5c,0x03,0x99,0xe9,0x4b,0x40,0x64,0xda,0x24,0x9d,0x66,0x26,0xa4,0x9d,0x86,0xf6,0x3e,0x00,0x93,0x11,0xf6,0x62,0x74,0x63,0x5b,0xae,0x24,0x93,0x30,0xc0,0x7f,0xbf,0x2b,0x7f,0x80,0x71,0x49,0xa7,0xe9,0x7d,0xc1,0xb6,0xb4,0xda,0x3d,0x7b,0x76,0xf7,0x88,0x79,0x96,0xf8,0x9a,0x8b,0xc4,0x0a,0x41,0x7f,0x90,0xe2,0x49,0x81,0xb4,0x9d,0xf5,0x92,0x49,0x2b,0x63,0x34,0x61,0x4b,0x1e,0x32,0x2d,0xa4,0x97,0xe1,0xfa,0xfb,0x10,0x12,0xdd,0xd2,0x10,0xb7,0x86,0x34,0x63,0x5e,0xcc,0xb4,0xbf,0xb0,0xdb,0xb6,0x48,0x41,0xb2,0x8d,0xbf,0x90,0x22,0x86,0x8d,0x62,0x73,0x26,0xf9,0x66,0xce,0x25,0xcc,0xc5,0xf3,0x26,0x56,0x1c,0x36,0x5a,0xf2,0x00,0x4f,0xda,0x17,0x74,0xd2,0x76,0x9c,0x49,0xfb,0x62,0xa2,0xfe,0xb2,0x27,0x81,0xeb,0xb4,0xb9,0xb3,0xd9,0x8c,0xa7,0x3d,0x3e,0xb7,0xdb,0xa5,0x51,0x9b,0x7b,0x1a,0x94,0xb6,0x87,0xe3,0xee,0xd4,0x71,0xd6,0x18,0x8c,0xb6,0x27,0x33,0xb9,0x1c,0x5b,0xe7,0x53,0xb7,0x38,0x14,0x7a,0xf0,0x0c,0xbe,0x9d,0xb1,0xe2,0xb0,0x04,0x9d,0xc9,0x64,0x9d,0xb0,0x18,0xce,0xc9,0xcd,0x35,0x69,0x2d,0x41,0x2a,0x4c,0xe8,0xdc,0xc6,0xc3,0xe8,0x65,0xb3,0x21,0xc4,0xd9,0xf6,0xb6,0x6f,0x30,0x8a,0xf1,0x4a,0x29,0x25,0x97,0x39,0x58,0x52,0xf8,0xdf,0xa7,0x32,0x99,0x7d,0xfe,0xf2,0x75,0x73,0x1d,0x84,0x30,0x69,0x17,0xb1,0x1c,0x83,0x0d,0x8d,0xde,0xd2,0x24,0x8b,0x22,0x67,0x7d,0x10,0xec,0xb3,0x49,0x7c,0x1f,0xaf,0x08,0x87,0x91,0xb6,0x6f,0x86,0x74,0x38,0x3e,0x9b,0x5e,0x8c,0x4d,0xbc,0x96,0x79,0x9d,0x9e,0x8f,0xf7,0x5c,0xb2,0x34,0xbd,0x43,0x07,0xad,0x83,0x95,0xef,0x85,0x97,0x16,0xf9,0xfb,0x82,0xe4,0x8c,0xd8,0x87,0xd8,0xca,0x28,0x15,0x30,0xee,0x38,0x15,0xa6,0xa1,0xa7,0xd2,0x88,0xfb,0x60,0x77,0x5b,0xdd,0x56,0x01,0xc2,0xc1,0x74,0xeb,0x50,0x87,0xe3,0xce,0x74,0x87,0x73,0x58,0xa0,0x7c,0x63,0x6a,0x3c,0x2b,0x2a,0x4e,0xeb,0xc5,0xef,0x99,0x0d,0x3f,0x93,0x12,0xcb,0x51,0x2e,0xd2,0xd2,0xce,0x33,0xde,0xdc,0xea,0xa3,0x74,0x68,0xc0,0xd6,0xf7,0xa9,0xa9,0xc2,0xe9,0x69,0xc3,0xaa,0xdf,0x3d,0x33,0x74,0x3f,0xeb,0x91,0xb8,0xe2,0x08,0x98,0xad,0x28,0xb9,0x96,0x52,0xc8,0x73,0x8b,0xb8,0x87,0xd1,0x5c,0x62,0x71,0x65,0x25,0x42,0x5b,0x2a,0x4b,0x53,0x21,0x35,0x04,0x6f,0xad,0x2f,0x11,0x30,0x05,0x96,0x96,0x2b,0x8b,0x59,0xb1,0x08,0x40,0x26,0xd6,0x13,0xcc,0xaa,0x0c,0x3c,0xb2,0x85,0x48,0x41,0x33,0xc2,0x47,0x40,0xf2,0x78,0x12,0x5a,0x91,0x08,0x2d,0x8c,0x20,0x39,0x28,0xcf,0xf3,0x08,0xa6,0x1f,0x08,0x3f,0x8b,0x71,0xc9,0xc3,0xdc,0xaf,0x23,0x30,0xaf,0x1f,0x56,0x37,0x81,0x4d,0x7c,0x91,0xae,0x46,0xe8,0xe6,0xa1,0x4b,0x1c,0x8f,0x27,0x09,0xc8,0x4f,0xa3,0xe1,0x2d,0x3d,0xf0,0x9c,0x73,0x84,0x3e,0xef,0xe1,0x47,0x06,0x89,0x0f,0xb4,0xd3,0x8b,0x84,0x48,0xaf,0xe0,0x16,0x7f,0xed,0x6e,0xa7,0xd3,0x69,0x75,0x9c,0xca,0xe8,0x16,0x96,0x10,0xd1,0x04,0x9e,0xac,0xf7,0x52,0xb2,0x95,0x4d,0xbe,0x25,0x38,0x4e,0x01,0x69,0x15,0x04,0xe0,0xf3,0x26,0x99,0x0b,0x7c,0x5c,0xc1,0x2c,0x0b,0xab,0xa7,0x35,0x14,0x12,0xf0,0xe3,0x5b,0x12,0xc0,0x9c,0x27,0xb9,0xfd,0xef,0xbc,0x17,0x87,0xaf,0x60,0x49,0x9c,0xde,0xbc,0x1a,0xee,0x1a,0x38,0xcd,0x63,0xf8,0x28,0xe4,0x1d,0xa6,0xd3,0x62,0xb8,0xbb,0x84,0xaf,0x26,0x09,0xa5,0x55,0x31,0xf6,0x31,0x7b,0xe6,0x71,0x16,0x57,0x8b,0xb4,0x9b,0xa7,0x91,0xc9,0x88,0x92,0x36,0x26,0xf3,0xaf,0x12,0xc9,0x85,0xe2,0x26,0x67,0xe2,0xd6,0x18,0x30,0x5d,0xc0,0xd5,0x1d,0xbb,0xb3,0x1b,0x4e,0x9d,0xf5,0xe1,0x02,0x6d,0x04,0x28,0x26,0xb3,0x86,0x8a,0x96,0x7d,0x5d,0x5f,0x32,0x8c,0xfe,0x64,0xd8,0xa7,0xef,0x3a,0x1d,0x67,0xad,0x7c,0x29,0xa2,0x08,0x8b,0xfc,0xa0,0x57,0x29,0xa2,0x62,0x99,0x16,0x58,0xe0,0xbc,0x1d,0x9a,0x7b,0x2a,0x16,0x42,0x2f,0x48,0xd9,0xfd,0x7e,0x55,0xa1,0xeb,0xa2,0x33,0x2e,0x17,0x59,0xf2,0x58,0x6f,0xff,0x9b,0x2b,0x2d,0xee,0x73,0x17,0x23,0x41,0x09,0x29,0xb6,0x16,0xe0,0x3f,0x62,0xbd,0xcd,0x3b,0xa7,0x0a,0xf4,0x4d,0xa2,0x41,0x2e,0x59,0x64,0x57,0x6c,0xa3,0x7e,0x22,0xd0,0xdc,0x6e,0x80,0xf8,0x7c,0xec,0x5c,0xb9,0x33,0xe2,0x4e,0xa9,0x58,0x88,0xc1,0x75,0x0f,0xa9,0x31,0x1c,0x1e,0xae,0x0c,0x1a,0x64,0xa1,0xb7,0x3c,0x7c,0xb7,0xcc,0x6f,0x6e,0xfa,0xdb,0xc6,0xe2,0x38,0x9e,0x5e,0x40,0xb2,0x87,0x20,0x41,0xa5,0x22,0x51,0x90,0x43,0xa9,0x3e,0x3c,0xa5,0x99,0xce,0xd4,0x5b,0x4a,0xcf,0x0c,0x71,0x3e,0xae,0x89,0x08,0x3c,0x24,0xc0,0x26,0xd8,0x1b,0x8f,0xca,0x8a,0xf8,0x23,0xce,0xd8,0x02,0x24,0x58,0x4f,0x4c,0xe1,0xa4,0xa5,0x52,0xcc,0x70,0x38,0x3c,0xeb,0x3e,0x3f,0x6a,0x5d,0xe2,0xe4,0x99,0x89,0x6d,0xb8,0xac,0x25,0xb5,0xdb,0x31,0x9d,0x62,0x37,0x71,0x05,0x4c,0xb3,0xa2,0xcf,0x4a,0xda,0x57,0x26,0xe9,0x46,0x09,0xaa,0x0e,0x68,0x2e,0x13,0x52,0xf4,0x80,0x71,0xe2,0xdd,0x8a,0xd0,0x0b,0xa4,0x48,0x53,0x08,0x0c,0xcb,0x0d,0x5b,0x97,0x92,0x7e,0xc0,0x97,0x83,0xc1,0x00,0xc1,0x36,0xed,0x51,0x60,0xb0,0x27,0x40,0x59,0xe5,0xb7,0xd5,0xef,0xf7,0xdb,0xc6,0xda,0xf8,0xaf,0x4f,0xf5,0xee,0xa0,0x82,0x1f,0xbd,0xb9,0x90,0xb6,0x8f,0x85,0xf7,0xfb,0xbb,0xe5,0x44,0x96,0x31,0x7b,0xae,0xeb,0x63,0xc7,0xca,0x55,0x85,0x63,0xb5,0x3f,0x5b,0x9a,0x8c,0xfd,0xa9,0x67,0x9a,0x17,0x09,0x8b,0xd3,0xde,0xd6,0xcf,0x65,0x1d,0xa4,0x74,0xf6,0x47,0xf0,0x2b,0x57,0xd0,0xde,0x16,0x87,0x99,0x45,0xd1,0x6a,0xbd,0xe7,0x66,0x85,0x55,0x3b,0x19,0x61,0x13,0xe7,0x9a,0x71,0x82,0xd5,0x3b,0xd2,0xa2,0xbf,0x8e,0x79,0x9c,0x22,0xcb,0x8f,0x98,0x52,0x34,0x32,0x22,0xf5,0x50,0xe3,0xaa,0xe6,0x22,0xdf,0x33,0xaa,0x1c,0xd0,0x9d,0x56,0xd7,0xe3,0xba,0x64,0xd0,0x9f,0x8b,0x44,0x5b,0xbe,0x88,0x84,0xa4,0x27,0x21,0xaa,0xdc,0xc9,0xe0,0xb8,0xaf,0x1d,0x1c,0x97,0x9c,0xf7,0xdb,0xe6,0xd4,0x41,0x85,0xea,0x96,0x38,0xe2,0x2e,0xd9,0x15,0x06,0xaf,0xd5,0xba,0x22,0xec,0x4e,0x8c,0x46,0xb7,0x47,0x5a,0x08,0xd9,0xc2,0x6b,0xdf,0xf0,0xf7,0x5a,0x9d,0x7f,0xf9,0xd2,0x70,0xd6,0xaf,0xf5,0x45,0xfe,0xe0,0xa2,0x71,0x69,0x53,0x90,0xf2,0x9e,0x6c,0x0e,0x82,0x51,0xb9,0x42,0xdd,0x1e,0x44,0x42,0x5f,0x8c,0xb1,0x37,0xc3,0x18,0xb9,0x76,0x40,0x90,0xcb,0xcc,0xc1,0x71,0xaa,0x65,0x06,0xa7,0xa7,0x47,0x4a,0x5b,0xf2,0xf8,0x92,0xff,0x23,0x27,0x1c,0xaf,0xf0,0x8b,0x8a,0x27,0xbe,0x73,0x78,0xb2,0xd7,0x33,0x58,0xe0,0x3f,0x1d,0xbc,0xe9,0x0f,0xd5,0x78,0xeb,0xfc,0x92,0x9c,0xc2,0xf3,0x03,0xa6,0x9e,0xb7,0xdf,0x21,0xaf,0x58,0xf8,0x10,0xfd,0x18,0x25,0xaa,0x2e,0xd8,0xf1,0xae,0x23,0xee,0x41,0x6b,0xdc,0x54,0xff,0xc0,0xec,0xb6,0xdc,0x9c,0x62,0xf7,0xda,0xb5,0x36,0x3b,0x62,0xe2,0x12,0x87,0xf4,0x7e,0xd2,0xea,0x17,0x2e,0xce,0xce,0x5e,0xf0,0x9c,0x2d,0x12,0x9b,0x0f,0xf3,0x4e,0xe4,0xf2,0xa9,0x7e,0x75,0xd9,0x6b,0x82,0x65,0x84,0x00,0xc7,0x44,0xb1,0x10,0x10,0xf8,0x5e,0x9d,0xfe,0x4f,0xd1,0x7f,0x0f,0x8f,0x2a,0xab,0x98,0xd2,0xd7,0xd8,0x7f,0x02,0x1e,0x2e,0x74,0xaf,0x3e,0x9f,0xef,0xcc,0x8d,0xfd,0x47,0x74,0xf6,0x76,0x57,0x5c,0xab,0x66,0x83,0xcd,0xf2,0x1f,0xd3,0xc4,0xba,0x97,0xab,0x0c,0x00,0x00};
+#endif
 #endif // WEBSERVER_INCLUDE_JS
 
 #endif // WEBSTATICDATA_h
@@ -9,6 +9,8 @@
 
 #include "../Globals/ESPEasyWiFiEvent.h"
 
+#include "../Static/WebStaticData.h"
+
 // ********************************************************************************
 // Web Interface handle other requests
 // ********************************************************************************
@@ -24,6 +26,12 @@ void handleNotFound() {
   // if Wifi setup, launch setup wizard if AP_DONT_FORCE_SETUP is not set.
  if (WiFiEventData.wifiSetup && !Settings.ApDontForceSetup())
   {
+#ifdef WEBSERVER_EMBED_GZIP
+    // The setup page itself links to the embedded CSS.
+    if (web_server.uri().startsWith(F(EMBEDDED_STATIC_URL_PREFIX)) && loadFromFS(true, web_server.uri())) {
+      return;
+    }
+#endif
     web_server.send(200, F("text/html"), F("<meta HTTP-EQUIV='REFRESH' content='0; url=/setup'>"));
    return;
   }
@@ -11,8 +11,83 @@
 #include "../DataTypes/TaskIndex.h"
 #include "../Globals/C016_ControllerCache.h"
 #include "../Globals/ExtraTaskSettings.h"
+#include "../Globals/TXBuffer.h"
 #include "../Helpers/ESPEasy_math.h"
 #include "../Helpers/ESPEasy_Storage.h"
+#include "../Helpers/Numerical.h"
+
+
+// Parse the optional arguments 'from', 'to' (UNIX timestamps) and 'task' (task index) of a query on the cache.
+// Return true when any of them is given.
+static bool getCacheQueryArgs(uint32_t& from, uint32_t& to, taskIndex_t& taskIndex) {
+  bool hasQuery = false;
+  unsigned int value;
+
+  from      = 0;
+  to        = UINT32_MAX;
+  taskIndex = INVALID_TASK_INDEX;
+
+  if (validUIntFromString(webArg(F("from")), value)) {
+    from     = value;
+    hasQuery = true;
+  }
+
+  if (validUIntFromString(webArg(F("to")), value)) {
+    to       = value;
+    hasQuery = true;
+  }
+
+  if (validUIntFromString(webArg(F("task")), value) && (value < TASKS_MAX)) {
+    taskIndex = value;
+    hasQuery  = true;
+  }
+  return hasQuery;
+}
+
+// Stream a sample value without creating a String object.
+// Values which are not a number are left empty in CSV and null in JSON.
+static void stream_cache_value(float value, int8_t decimals, bool json) {
+  if (!isfinite(value)) {
+    if (json) {
+      addHtml(F("null"));
+    }
+    return;
+  }
+
+  // Large enough for any float with 6 decimals
+  char buf[48];
+
+  dtostrf(value, 0, (decimals < 0) ? 6 : decimals, buf);
+  TXBuffer += buf;
+}
+
+// Stream a sample as a JSON array: [timestamp,task index,value 1,...]
+// or a CSV line: timestamp;task index;value count;value 1;value 2;value 3;value 4
+static void stream_cache_sample(const ControllerCacheSample& sample, bool json) {
+  const char separator = json ? ',' : ';';
+
+  if (json) {
+    addHtml('[');
+  }
+  TXBuffer += sample.timestamp;
+  addHtml(separator);
+  TXBuffer += static_cast<uint32_t>(sample.TaskIndex);
+
+  if (!json) {
+    addHtml(separator);
+    TXBuffer += static_cast<uint32_t>(sample.valueCount);
+  }
+
+  for (byte i = 0; i < VARS_PER_TASK; ++i) {
+    if (i < sample.valueCount) {
+      addHtml(separator);
+      stream_cache_value(sample.values[i], sample.decimals, json);
+    } else if (!json) {
+      addHtml(separator);
+    }
+  }
+  addHtml(json ? ']' : '\n');
+}
 
 
 // ********************************************************************************
@@ -93,9 +168,45 @@ void handle_dumpcache() {
   TXBuffer.endStream();
 }
 
+// Without arguments: the column names and the cache files to be decoded by the client.
+// With arguments from, to and/or task: the samples in the time range as JSON arrays.
+// The time index of the cache files is used to skip data outside the range,
+// so a client can efficiently fetch only the samples added since its last request.
 void handle_cache_json() {
   if (!isLoggedIn()) { return; }
 
+  uint32_t    from, to;
+  taskIndex_t taskIndex;
+
+  if (getCacheQueryArgs(from, to, taskIndex)) {
+    TXBuffer.startJsonStream();
+    addHtml(F("{\"samples\": [\n"));
+    ControllerCacheSample sample;
+    uint32_t nrSamples = 0;
+    uint32_t last      = 0;
+
+    if (C016_startQuery(from, to, taskIndex)) {
+      while (C016_getNextSample(sample)) {
+        if (nrSamples != 0) {
+          addHtml(F(",\n"));
+        }
+        stream_cache_sample(sample, true);
+        last = sample.timestamp;
+        ++nrSamples;
+
+        if ((nrSamples % 64) == 0) {
+          delay(0);
+        }
+      }
+    }
+    addHtml(F("],\n"));
+    stream_next_json_object_value(F("nrsamples"), String(nrSamples));
+    stream_last_json_object_value(F("last"), String(last));
+    addHtml('\n');
+    TXBuffer.endStream();
+    return;
+  }
+
   TXBuffer.startJsonStream();
   addHtml(F("{\"columns\": ["));
 
@@ -140,8 +251,30 @@ void handle_cache_json() {
   TXBuffer.endStream();
 }
 
+// Stream the samples as CSV, optionally limited by the arguments from, to and task. (see handle_cache_json)
 void handle_cache_csv() {
   if (!isLoggedIn()) { return; }
+
+  uint32_t    from, to;
+  taskIndex_t taskIndex;
+
+  getCacheQueryArgs(from, to, taskIndex);
+
+  TXBuffer.startStream();
+  addHtml(F("UNIX timestamp;task index;value count;value 1;value 2;value 3;value 4\n"));
+  ControllerCacheSample sample;
+  uint32_t nrSamples = 0;
+
+  if (C016_startQuery(from, to, taskIndex)) {
+    while (C016_getNextSample(sample)) {
+      stream_cache_sample(sample, false);
+
+      if ((++nrSamples % 64) == 0) {
+        delay(0);
+      }
+    }
+  }
+  TXBuffer.endStream();
 }
 
 #endif // ifdef USES_C016
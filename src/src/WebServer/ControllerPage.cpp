@@ -9,6 +9,9 @@
 #include "../WebServer/Markup_Buttons.h"
 #include "../WebServer/Markup_Forms.h"
 
+#include "../ControllerQueue/ControllerQueueSpillFile.h"
+#include "../ControllerQueue/DelayQueueElements.h"
+
 #include "../DataStructs/ESPEasy_EventStruct.h"
 
 #include "../ESPEasyCore/Controller.h"
@@ -46,6 +49,20 @@ void handle_controllers() {
   // submitted data
   if ((protocol != -1) && !controllerNotSet)
   {
+    if (Settings.Protocol[controllerindex] != protocol) {
+      // Stop the previous controller in this slot and drop the messages it stored in the spill file.
+      // These must not be sent by the new controller.
+      protocolIndex_t ProtocolIndex = getProtocolIndex_from_ControllerIndex(controllerindex);
+
+      if (validProtocolIndex(ProtocolIndex)) {
+        struct EventStruct TempEvent;
+        TempEvent.ControllerIndex = controllerindex;
+        String dummy;
+        CPluginCall(ProtocolIndex, CPlugin::Function::CPLUGIN_EXIT, &TempEvent, dummy);
+      }
+      ControllerQueueSpillFile::removeFiles(controllerindex);
+    }
+
     bool mustInit = false;
     bool mustCallCpluginSave = false;
     {
@@ -102,6 +119,11 @@ void handle_controllers() {
         CPluginCall(ProtocolIndex, cfunction, &TempEvent, dummy);
       }
     }
+
+    if (!Settings.ControllerEnabled[controllerindex]) {
+      // The messages in memory are dropped when the controller is disabled, so also the stored ones.
+      ControllerQueueSpillFile::removeFiles(controllerindex);
+    }
   }
 
   html_add_form();
@@ -197,6 +219,7 @@ void handle_controllers_ShowAllControllersTable()
   html_table_header(F("Protocol"));
   html_table_header(F("Host"));
   html_table_header(F("Port"));
+  html_table_header(F("Queue"));
 
   MakeControllerSettings(ControllerSettings);
   if (AllocatedControllerSettings()) {
@@ -252,9 +275,25 @@ void handle_controllers_ShowAllControllersTable()
 
         html_TD();
         addHtmlInt(ControllerSettings.Port);
+        html_TD();
+        {
+          // Messages in the queue in memory and (when spilled) stored on the file system.
+          size_t ramDepth  = 0;
+          size_t fileDepth = 0;
+
+          if (getControllerQueueDepth(x, ramDepth, fileDepth)) {
+            addHtmlInt(ramDepth);
+
+            if (fileDepth > 0) {
+              addHtml(F(" + "));
+              addHtmlInt(fileDepth);
+              addHtml(F(" on file"));
+            }
+          }
+        }
       }
       else {
-        html_TD(3);
+        html_TD(4);
       }
     }
   }
@@ -328,6 +367,10 @@ void handle_controllers_ControllerSettingsPage(controllerIndex_t controllerindex
               addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_ALLOW_EXPIRE);
             }
             addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_DEDUPLICATE);
+            if (Protocol[ProtocolIndex].supportsBatch) {
+              addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_SEND_BATCH);
+            }
+            addControllerParameterForm(ControllerSettings, controllerindex, ControllerSettingsStruct::CONTROLLER_SPILL_TO_FILE);
           }
 
           if (Protocol[ProtocolIndex].usesCheckReply) {
@@ -2,9 +2,12 @@
 
 #include "../WebServer/WebServer.h"
 #include "../WebServer/CustomPage.h"
+#include "../Globals/Cache.h"
 #include "../Globals/RamTracker.h"
+#include "../Helpers/CRC_functions.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Network.h"
+#include "../Static/WebStaticData.h"
 
 #ifdef FEATURE_SD
 #include <SD.h>
@@ -14,6 +17,76 @@ bool match_ext(const String& path, const __FlashStringHelper * ext) {
   return (path.endsWith(ext) || path.endsWith(String(ext) + F(".gz")));
 }
 
+bool clientAcceptsGzip() {
+  return web_server.header(F("Accept-Encoding")).indexOf(F("gzip")) != -1;
+}
+
+// Send the caching headers for content with the given hash.
+// Return true when the client already has this content and a 304 Not Modified is sent.
+static bool sendCacheHeaders(uint32_t contentHash) {
+  String etag;
+
+  etag.reserve(12);
+  etag += '"';
+  etag += String(contentHash, HEX);
+  etag += '"';
+
+  // prevent reloading stuff on every click
+  web_server.sendHeader(F("Cache-Control"), F("max-age=3600, public"));
+  web_server.sendHeader(F("Vary"),          F("Accept-Encoding"));
+  web_server.sendHeader(F("ETag"),          etag);
+
+  if (web_server.header(F("If-None-Match")).indexOf(etag) != -1) {
+    web_server.send(304);
+    return true;
+  }
+  return false;
+}
+
+// Hash of the file content, cached until the file is opened for writing.
+static uint32_t getFileContentHash(const String& path, fs::File& file) {
+  auto it = Cache.fileETagMap.find(path);
+
+  if (it != Cache.fileETagMap.end()) {
+    return it->second;
+  }
+  uint8_t  buffer[128];
+  uint32_t crc = 0xffffffff;
+  int      read;
+
+  while ((read = file.read(buffer, sizeof(buffer))) > 0) {
+    crc = calc_CRC32(buffer, read, crc);
+  }
+  file.seek(0);
+  Cache.fileETagMap[path] = crc;
+  return crc;
+}
+
+#ifdef WEBSERVER_EMBED_GZIP
+
+// Serve a gzip compressed static file embedded in the firmware.
+static bool loadFromFlash(const String& path, const String& dataType) {
+  size_t size = 0;
+  PGM_P  data = getEmbeddedStaticFile_gz(path, size);
+
+  if ((data == nullptr) || (size < 8)) {
+    return false;
+  }
+
+  // The gzip trailer contains the CRC32 and size of the uncompressed content.
+  uint32_t trailer[2];
+
+  memcpy_P(trailer, data + size - 8, sizeof(trailer));
+
+  if (!sendCacheHeaders(trailer[0] ^ trailer[1])) {
+    web_server.sendHeader(F("Content-Encoding"), F("gzip"));
+    web_server.send_P(200, dataType.c_str(), data, size);
+  }
+  return true;
+}
+
+#endif // ifdef WEBSERVER_EMBED_GZIP
+
 
 // ********************************************************************************
 // Web Interface server web file from FS
@@ -69,14 +142,28 @@ bool loadFromFS(boolean spiffs, String path) {
   }
 #endif // ifndef BUILD_NO_DEBUG
 
+#ifdef WEBSERVER_EMBED_GZIP
+  const String requestPath = path;
+#endif // ifdef WEBSERVER_EMBED_GZIP
+
 #if !defined(ESP32)
   path = path.substring(1);
 #endif // if !defined(ESP32)
 
   if (spiffs)
   {
+    // Serve a compressed variant when present.
+    // streamFile() adds the Content-Encoding header for .gz files.
+    if (!path.endsWith(F(".gz")) && clientAcceptsGzip() && fileExists(path + F(".gz"))) {
+      path += F(".gz");
+    }
+
     if (!fileExists(path)) {
+#ifdef WEBSERVER_EMBED_GZIP
+      return loadFromFlash(requestPath, dataType);
+#else
       return false;
+#endif // ifdef WEBSERVER_EMBED_GZIP
     }
     fs::File dataFile = tryOpenFile(path.c_str(), "r");
 
@@ -84,10 +171,10 @@ bool loadFromFS(boolean spiffs, String path) {
       return false;
     }
 
-    // prevent reloading stuff on every click
-    web_server.sendHeader(F("Cache-Control"), F("max-age=3600, public"));
-    web_server.sendHeader(F("Vary"),          "*");
-    web_server.sendHeader(F("ETag"),          F("\"2.0.0\""));
+    if (sendCacheHeaders(getFileContentHash(path, dataFile))) {
+      dataFile.close();
+      return true;
+    }
 
     if (path.endsWith(F(".dat"))) {
       web_server.sendHeader(F("Content-Disposition"), F("attachment;"));
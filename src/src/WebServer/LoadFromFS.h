@@ -6,4 +6,7 @@
 
 bool loadFromFS(boolean spiffs, String path);
 
+// Return true when the client sent an Accept-Encoding header including gzip
+bool clientAcceptsGzip();
+
 #endif
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "../Globals/Logging.h"
 #include "../Globals/Settings.h"
 #include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Numerical.h"
 #include "../Static/WebStaticData.h"
 
 // ********************************************************************************
@@ -67,29 +68,44 @@ void handle_log_JSON() {
     addHtml(F("],\n"));
   }
   addHtml(F("\"Entries\": ["));
-  bool logLinesAvailable       = true;
-  int  nrEntries               = 0;
-  unsigned long firstTimeStamp = 0;
-  unsigned long lastTimeStamp  = 0;
-
-  while (logLinesAvailable) {
-    String message;
-    byte loglevel;
-    if (Logging.getNext(logLinesAvailable, lastTimeStamp, message, loglevel)) {
-      addHtml('{');
-      stream_next_json_object_value(F("timestamp"), String(lastTimeStamp));
-      stream_next_json_object_value(F("text"),  message);
-      stream_last_json_object_value(F("level"), String(loglevel));
-      if (logLinesAvailable) {
-        addHtml(F(",\n"));
-      }
-      if (nrEntries == 0) {
-        firstTimeStamp = lastTimeStamp;
-      }
-      ++nrEntries;
+
+  // Clients not sending 'since' get the lines not yet read by any of these clients.
+  static uint32_t lastSequenceRead = 0;
+  unsigned int    value            = 0;
+  const bool      hasCursor        = validUIntFromString(webArg(F("since")), value);
+  const uint32_t  since            = hasCursor ? value : lastSequenceRead;
+  uint32_t        sequence         = since;
+  uint32_t        firstSequence    = 0;
+  int nrEntries                    = 0;
+  unsigned long firstTimeStamp     = 0;
+  unsigned long lastTimeStamp      = 0;
+  String message;
+  byte   loglevel;
+
+  while (Logging.getNext(sequence, lastTimeStamp, message, loglevel)) {
+    if (nrEntries == 0) {
+      firstTimeStamp = lastTimeStamp;
+      firstSequence  = sequence;
+    } else {
+      addHtml(F(",\n"));
     }
+    addHtml('{');
+    stream_next_json_object_value(F("seq"),       String(sequence));
+    stream_next_json_object_value(F("timestamp"), String(lastTimeStamp));
+    stream_next_json_object_value(F("text"),      message);
+    stream_last_json_object_value(F("level"), String(loglevel));
+    ++nrEntries;
+  }
+
+  if (!hasCursor) {
+    lastSequenceRead = sequence;
+  }
+
+  // Lines overwritten before they could be read
+  uint32_t nrDropped = 0;
 
-    // Do we need to do something here and maybe limit number of lines at once?
+  if ((since != 0) && (firstSequence > (since + 1))) {
+    nrDropped = firstSequence - since - 1;
   }
   addHtml(F("],\n"));
   long logTimeSpan       = timeDiff(firstTimeStamp, lastTimeStamp);
@@ -112,6 +128,8 @@ void handle_log_JSON() {
   stream_next_json_object_value(F("TTL"),                 String(refreshSuggestion));
   stream_next_json_object_value(F("timeHalfBuffer"),      String(newOptimum));
   stream_next_json_object_value(F("nrEntries"),           String(nrEntries));
+  stream_next_json_object_value(F("seq"),                 String(sequence));
+  stream_next_json_object_value(F("dropped"),             String(nrDropped));
   stream_next_json_object_value(F("SettingsWebLogLevel"), String(Settings.WebLogLevel));
   stream_last_json_object_value(F("logTimeSpan"), String(logTimeSpan));
   addHtml(F("}\n"));
@@ -0,0 +1,197 @@
+#include "../WebServer/ServerSentEvents.h"
+
+#ifdef WEBSERVER_EVENTS
+
+#include "../WebServer/WebServer.h"
+#include "../DataStructs/ESPEasy_EventStruct.h"
+#include "../DataStructs/SSE_EventBuffer.h"
+#include "../Globals/ExtraTaskSettings.h"
+#include "../Globals/Plugins.h"
+#include "../Globals/RuntimeData.h"
+#include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Numerical.h"
+#include "../Helpers/StringConverter.h"
+
+#include "../../_Plugin_Helper.h"
+
+#include <list>
+#include <vector>
+
+/*********************************************************************************************\
+* Server-Sent Events clients
+*
+* The connection of a client is kept after handle_events() returns and the events are written
+* from events_loop(), only as much as the client accepts without blocking.
+*
+* Only values changed since the last event of a task are sent, so a new client first has to
+* fetch all values (e.g. /json?view=sensorupdate) after the connection is opened.
+* When events are dropped because a client does not read fast enough, a 'resync' event is sent
+* to let the client fetch all values again.
+\*********************************************************************************************/
+struct EventStreamClient {
+  explicit EventStreamClient(const WiFiClient& wifiClient) :
+    client(wifiClient), buffer(WEBSERVER_EVENTS_BUFFER_SIZE), lastSent(millis()) {}
+
+  WiFiClient      client;
+  SSE_EventBuffer buffer;
+  unsigned long   lastSent;
+};
+
+struct EventStreamTaskValues {
+  float values[VARS_PER_TASK] = { 0 };
+  byte  valueCount            = 0; // 0 = Nothing sent yet
+};
+
+static std::list<EventStreamClient> eventStreamClients;
+
+// Last sent values per task, only allocated while clients are connected.
+static std::vector<EventStreamTaskValues> eventStreamTaskValues;
+
+
+static void events_removeDisconnected() {
+  for (auto it = eventStreamClients.begin(); it != eventStreamClients.end();) {
+    // Also remove clients not reading any data for a long time.
+    const bool stalled = !it->buffer.empty() && (timePassedSince(it->lastSent) > (2 * WEBSERVER_EVENTS_KEEPALIVE));
+
+    if (it->client.connected() && !stalled) {
+      ++it;
+    } else {
+      it->client.stop();
+      it = eventStreamClients.erase(it);
+    }
+  }
+
+  if (eventStreamClients.empty() && !eventStreamTaskValues.empty()) {
+    std::vector<EventStreamTaskValues>().swap(eventStreamTaskValues);
+  }
+}
+
+// ********************************************************************************
+// Web Interface Server-Sent Events stream
+// Events:
+//   values  {"TaskNumber":1,"TaskValues":[{"ValueNumber":1,"NrDecimals":2,"Value":21.37}]}
+//   resync  Events were dropped, fetch all values again. (data is ignored, but may not be empty)
+// ********************************************************************************
+void handle_events() {
+  #ifndef BUILD_NO_RAM_TRACKER
+  checkRAM(F("handle_events"));
+  #endif // ifndef BUILD_NO_RAM_TRACKER
+
+  events_removeDisconnected();
+
+  if (eventStreamClients.size() >= WEBSERVER_EVENTS_MAX_CLIENTS) {
+    // Client should fall back to polling.
+    web_server.send(503, F("text/plain"), F("Too many clients"));
+    return;
+  }
+
+  if (eventStreamTaskValues.empty()) {
+    eventStreamTaskValues.resize(TASKS_MAX);
+  }
+  eventStreamClients.emplace_back(web_server.client());
+  EventStreamClient& sse = eventStreamClients.back();
+
+  sse.client.setNoDelay(true);
+
+  // Write the headers ourselves, as the web server would close the connection.
+  sse.buffer.add(F("HTTP/1.1 200 OK\r\n"
+                   "Content-Type: text/event-stream\r\n"
+                   "Cache-Control: no-cache\r\n"
+                   "Connection: keep-alive\r\n"
+                   "\r\n"
+                   "retry: 5000\n\n"));
+  writeBufferedEvents(sse.client, sse.buffer);
+
+  #ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    String log = F("Events: Client connected, nr clients: ");
+    log += eventStreamClients.size();
+    addLog(LOG_LEVEL_DEBUG, log);
+  }
+  #endif // ifndef BUILD_NO_DEBUG
+}
+
+void events_sendTaskValues(struct EventStruct *event) {
+  if (eventStreamClients.empty() || eventStreamTaskValues.empty() || !validTaskIndex(event->TaskIndex)) {
+    return;
+  }
+  EventStreamTaskValues& sent = eventStreamTaskValues[event->TaskIndex];
+  byte valueCount             = getValueCountForTask(event->TaskIndex);
+
+  if (valueCount > VARS_PER_TASK) {
+    valueCount = VARS_PER_TASK;
+  }
+  String data;
+  bool   changed = false;
+
+  for (byte x = 0; x < valueCount; ++x) {
+    const float value = UserVar[event->BaseVarIndex + x];
+
+    // Compare the bits, to also detect a change from or to NaN
+    if ((x < sent.valueCount) && (memcmp(&sent.values[x], &value, sizeof(float)) == 0)) {
+      continue;
+    }
+    sent.values[x] = value;
+
+    if (!changed) {
+      data.reserve(48 + (valueCount * 56));
+      data  = F("event: values\ndata: {\"TaskNumber\":");
+      data += event->TaskIndex + 1;
+      data += F(",\"TaskValues\":[");
+      changed = true;
+    } else {
+      data += ',';
+    }
+    const String formatted = formatUserVarNoCheck(event, x);
+    byte nrDecimals        = ExtraTaskSettings.TaskDeviceValueDecimals[x];
+
+    if (mustConsiderAsString(formatted)) {
+      // Flag as not to treat as a float
+      nrDecimals = 255;
+    }
+    data += F("{\"ValueNumber\":");
+    data += x + 1;
+    data += F(",\"NrDecimals\":");
+    data += nrDecimals;
+    data += ',';
+    data += to_json_object_value(F("Value"), formatted);
+    data += '}';
+  }
+  sent.valueCount = valueCount;
+
+  if (!changed) {
+    return;
+  }
+  data += F("]}\n\n");
+
+  for (auto it = eventStreamClients.begin(); it != eventStreamClients.end(); ++it) {
+    it->buffer.add(data);
+  }
+}
+
+void events_loop() {
+  if (eventStreamClients.empty()) {
+    return;
+  }
+  events_removeDisconnected();
+
+  for (auto it = eventStreamClients.begin(); it != eventStreamClients.end(); ++it) {
+    if (it->buffer.getNrDropped() != 0) {
+      if (it->buffer.add(F("event: resync\ndata: 1\n\n"))) {
+        it->buffer.clearDropped();
+      }
+    }
+
+    if (it->buffer.empty() && (timePassedSince(it->lastSent) > WEBSERVER_EVENTS_KEEPALIVE)) {
+      // Comment line, ignored by the client. Detects closed connections.
+      it->buffer.add(F(":\n\n"));
+    }
+
+    if (writeBufferedEvents(it->client, it->buffer) != 0) {
+      it->lastSent = millis();
+    }
+  }
+}
+
+#endif // ifdef WEBSERVER_EVENTS
@@ -0,0 +1,22 @@
+#ifndef WEBSERVER_WEBSERVER_SERVERSENTEVENTS_H
+#define WEBSERVER_WEBSERVER_SERVERSENTEVENTS_H
+
+#include "../WebServer/common.h"
+
+#ifdef WEBSERVER_EVENTS
+
+// ********************************************************************************
+// Stream of task value changes as Server-Sent Events (/events)
+// ********************************************************************************
+void handle_events();
+
+// Queue an event with the values of the task which changed since the last event.
+// ExtraTaskSettings must be loaded for the task.
+void events_sendTaskValues(struct EventStruct *event);
+
+// Send pending events and remove disconnected clients.
+void events_loop();
+
+#endif // ifdef WEBSERVER_EVENTS
+
+#endif // ifndef WEBSERVER_WEBSERVER_SERVERSENTEVENTS_H
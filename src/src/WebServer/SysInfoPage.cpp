@@ -18,6 +18,7 @@
 #include "../Globals/CRCValues.h"
 #include "../Globals/ESPEasy_time.h"
 #include "../Globals/ESPEasyWiFiEvent.h"
+#include "../Globals/EventQueue.h"
 #include "../Globals/NetworkState.h"
 #include "../Globals/RTC.h"
 
@@ -27,6 +28,7 @@
 #include "../Helpers/Hardware.h"
 #include "../Helpers/Memory.h"
 #include "../Helpers/Misc.h"
+#include "../Helpers/Networking.h"
 #include "../Helpers/OTA.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringGenerator_GPIO.h"
@@ -98,6 +100,8 @@ void handle_sysinfo_json() {
             0
   # endif // ifndef BUILD_NO_RAM_TRACKER
             );
+  json_number(F("event_queue_max"),     getValue(LabelType::EVENT_QUEUE_MAX_USED));
+  json_number(F("event_queue_dropped"), getValue(LabelType::EVENT_QUEUE_DROPPED));
   json_close();
 
   json_open(false, F("boot"));
@@ -140,6 +144,16 @@ void handle_sysinfo_json() {
   json_close();
 # endif // ifdef HAS_ETHERNET
 
+  json_open(false, F("udp"));
+  json_number(F("commands"),       String(udpReceiveStats.commands));
+  json_number(F("sysinfo"),        String(udpReceiveStats.sysinfo));
+  json_number(F("plugin"),         String(udpReceiveStats.plugin));
+  json_number(F("cplugin"),        String(udpReceiveStats.cplugin));
+  json_number(F("dropped"),        String(udpReceiveStats.dropped));
+  json_number(F("oversize"),       String(udpReceiveStats.oversize));
+  json_number(F("budget_reached"), String(udpReceiveStats.budgetReached));
+  json_close();
+
   json_open(false, F("firmware"));
   json_prop(F("build"),       String(BUILD));
   json_prop(F("notes"),       F(BUILD_NOTES));
@@ -373,6 +387,27 @@ void handle_sysinfo_memory() {
     addHtml(html);
   }
 
+  addRowLabel(LabelType::EVENT_QUEUE_MAX_USED);
+  {
+    String html;
+    html.reserve(32);
+    html += eventQueue.getHighWaterMark();
+    html += F(" of ");
+    html += eventQueue.getCapacity();
+    html += F(" bytes");
+    addHtml(html);
+  }
+  addRowLabel(LabelType::EVENT_QUEUE_DROPPED);
+  {
+    String html;
+    html.reserve(32);
+    html += eventQueue.getDropped();
+    html += F(" (coalesced: ");
+    html += eventQueue.getCoalesced();
+    html += ')';
+    addHtml(html);
+  }
+
 # if defined(ESP32) && defined(ESP32_ENABLE_PSRAM)
 
   if (ESP.getPsramSize() > 0) {
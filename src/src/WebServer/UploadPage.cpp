@@ -5,6 +5,7 @@
 #include "../WebServer/HTML_wrappers.h"
 
 #include "../Globals/Cache.h"
+#include "../Globals/RulesIndex.h"
 #include "../Helpers/ESPEasy_Storage.h"
 
 #include "../../ESPEasy-Globals.h"
@@ -174,6 +175,11 @@ void handleFileUpload() {
   {
     if (uploadFile) { uploadFile.close(); }
 
+    if (RulesIndexStruct::isRulesFileName(upload.filename)) {
+      // Rules may have been processed while the file was being written.
+      rulesIndex.invalidate();
+    }
+
     if (loglevelActiveFor(LOG_LEVEL_INFO)) {
       String log = F("Upload: END, Size: ");
       log += upload.totalSize;
@@ -0,0 +1,108 @@
+#include "../WebServer/ValuesBinPage.h"
+
+#include "../WebServer/WebServer.h"
+#include "../DataStructs/CBOR_Writer.h"
+#include "../Globals/ESPEasy_time.h"
+#include "../Globals/Plugins.h"
+#include "../Globals/RuntimeData.h"
+#include "../Globals/Settings.h"
+#include "../Helpers/Numerical.h"
+
+#include "../../_Plugin_Helper.h"
+
+#include <vector>
+
+// Map with 4 keys and per task: [task nr, sequence, timestamp, [values]]
+#define VALUES_BIN_HEADER_SIZE_MAX  32
+#define VALUES_BIN_TASK_SIZE_MAX    (1 + 2 + 5 + 5 + 1 + (VARS_PER_TASK * 5))
+
+
+// ********************************************************************************
+// Web Interface get task values as CBOR
+// Optional argument 'since': only include tasks updated after this sequence number.
+//
+// Response:
+//   { "unit": unit nr, "time": current unix time, "seq": sequence nr of last update,
+//     "tasks": [ [task nr, sequence nr, unix time of update, [value1, ...]], ... ] }
+// Tasks with a 'Long' sensor type (e.g. RFID tags) have a single unsigned integer value.
+//
+// When 'since' is larger than the current sequence nr (e.g. the node has rebooted),
+// all tasks are included.
+// ********************************************************************************
+void handle_values_bin() {
+  #ifndef BUILD_NO_RAM_TRACKER
+  checkRAM(F("handle_values_bin"));
+  #endif // ifndef BUILD_NO_RAM_TRACKER
+
+  const uint32_t sequence = taskValueTracker.getSequence();
+  uint32_t       since    = 0;
+  unsigned int   value;
+
+  if (validUIntFromString(webArg(F("since")), value) && (value <= sequence)) {
+    since = value;
+  }
+
+  std::vector<uint8_t> buffer;
+
+  buffer.resize(VALUES_BIN_HEADER_SIZE_MAX + (TASKS_MAX * VALUES_BIN_TASK_SIZE_MAX));
+  CBOR_Writer writer(&buffer[0], buffer.size());
+
+  writer.startMap(4);
+  writer.addText("unit");
+  writer.addUint(Settings.Unit);
+  writer.addText("time");
+  writer.addUint(node_time.getUnixTime());
+  writer.addText("seq");
+  writer.addUint(sequence);
+  writer.addText("tasks");
+  writer.startIndefiniteArray();
+
+  for (taskIndex_t taskIndex = 0; taskIndex < TASKS_MAX; ++taskIndex) {
+    const uint32_t taskSequence = taskValueTracker.getSequence(taskIndex);
+
+    if ((since != 0) && (taskSequence <= since)) {
+      continue;
+    }
+
+    if (!Settings.TaskDeviceEnabled[taskIndex] || !validDeviceIndex(getDeviceIndex_from_TaskIndex(taskIndex))) {
+      continue;
+    }
+    byte valueCount = taskValueTracker.getValueCount(taskIndex);
+
+    if (valueCount == TASK_VALUE_COUNT_UNKNOWN) {
+      // Not updated since boot
+      valueCount = getValueCountForTask(taskIndex);
+    }
+
+    if (valueCount > VARS_PER_TASK) {
+      valueCount = VARS_PER_TASK;
+    }
+
+    writer.startArray(4);
+    writer.addUint(taskIndex + 1);
+    writer.addUint(taskSequence);
+    writer.addUint(taskValueTracker.getTimestamp(taskIndex));
+
+    EventStruct tempEvent(taskIndex);
+
+    if (tempEvent.getSensorType() == Sensor_VType::SENSOR_TYPE_LONG) {
+      // Single value stored in two floats (e.g. RFID tags)
+      writer.startArray(1);
+      writer.addUint(UserVar.getSensorTypeLong(taskIndex));
+      continue;
+    }
+    writer.startArray(valueCount);
+
+    for (byte varNr = 0; varNr < valueCount; ++varNr) {
+      writer.addFloat(UserVar[taskIndex * VARS_PER_TASK + varNr]);
+    }
+  }
+  writer.endIndefinite();
+
+  if (writer.overflow()) {
+    web_server.send(500, F("text/plain"), F("Buffer too small"));
+    return;
+  }
+  web_server.sendHeader(F("Cache-Control"), F("no-cache"));
+  web_server.send_P(200, PSTR("application/cbor"), reinterpret_cast<const char *>(&buffer[0]), writer.size());
+}
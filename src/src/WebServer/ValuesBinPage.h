@@ -0,0 +1,11 @@
+#ifndef WEBSERVER_WEBSERVER_VALUESBINPAGE_H
+#define WEBSERVER_WEBSERVER_VALUESBINPAGE_H
+
+#include "../WebServer/common.h"
+
+// ********************************************************************************
+// Compact binary (CBOR) snapshot of the task values, for frequent polling.
+// ********************************************************************************
+void handle_values_bin();
+
+#endif // ifndef WEBSERVER_WEBSERVER_VALUESBINPAGE_H
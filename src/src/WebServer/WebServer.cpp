@@ -27,6 +27,7 @@
 #include "../WebServer/PinStates.h"
 #include "../WebServer/RootPage.h"
 #include "../WebServer/Rules.h"
+#include "../WebServer/ServerSentEvents.h"
 #include "../WebServer/SettingsArchive.h"
 #include "../WebServer/SetupPage.h"
 #include "../WebServer/SysInfoPage.h"
@@ -34,6 +35,7 @@
 #include "../WebServer/TimingStats.h"
 #include "../WebServer/ToolsPage.h"
 #include "../WebServer/UploadPage.h"
+#include "../WebServer/ValuesBinPage.h"
 #include "../WebServer/WiFiScanner.h"
 
 
@@ -326,6 +328,9 @@ void WebServerInit()
   web_server.on(F("/cache_csv"),  handle_cache_csv);  // C016 specific entrie
 #endif // USES_C016
 
+  #ifdef WEBSERVER_EVENTS
+  web_server.on(F("/events"),          handle_events);
+  #endif // ifdef WEBSERVER_EVENTS
   #ifdef WEBSERVER_FACTORY_RESET
   web_server.on(F("/factoryreset"),    handle_factoryreset);
   #endif // ifdef WEBSERVER_FACTORY_RESET
@@ -344,6 +349,7 @@ void WebServerInit()
   #endif // ifdef WEBSERVER_I2C_SCANNER
   web_server.on(F("/json"),            handle_json); // Also part of WEBSERVER_NEW_UI
   web_server.on(F("/csv"),             handle_csvval);
+  web_server.on(F("/values.bin"),      handle_values_bin);
   web_server.on(F("/log"),             handle_log);
   web_server.on(F("/login"),           handle_login);
   web_server.on(F("/logjson"),         handle_log_JSON); // Also part of WEBSERVER_NEW_UI
@@ -406,6 +412,10 @@ void WebServerInit()
 
   web_server.onNotFound(handleNotFound);
 
+  // Request headers used by loadFromFS() for compressed and cached content
+  const char *headerKeys[] = { "Accept-Encoding", "If-None-Match" };
+  web_server.collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+
   #if defined(ESP8266) || defined(ESP32)
   {
     # ifndef NO_HTTP_UPDATER
@@ -34,12 +34,14 @@ if (browser.name = 'IE' && browser.version < 12) {
     textToDisplay = 'Fetching log entries...';
 }
 document.getElementById('copyText_1').innerHTML = textToDisplay;
+var logSequence = 0;
 loopDeLoop(1000, 0);
 var logLevel = new Array('Unused', 'Error', 'Info', 'Debug', 'Debug More', 'Undefined', 'Undefined', 'Undefined', 'Undefined', 'Debug Dev');
 
 function loopDeLoop(timeForNext, activeRequests) {
     var maximumRequests = 1;
-    var url = '/logjson';
+    // Only fetch the lines newer than the last line received.
+    var url = '/logjson?since=' + logSequence;
     if (isNaN(activeRequests)) {
         activeRequests = maximumRequests;
     }
@@ -74,6 +76,10 @@ function loopDeLoop(timeForNext, activeRequests) {
                     if (logEntriesChunk == null) {
                         logEntriesChunk = '';
                     }
+                    if (data.Log.dropped > 0) {
+                        logEntriesChunk += '<div>>> ' + data.Log.dropped + ' lines dropped <<</div>';
+                    }
+                    logSequence = data.Log.seq;
                     for (c = 0; c < data.Log.nrEntries; ++c) {
                         try {
                             logEntry = data.Log.Entries[c].timestamp;
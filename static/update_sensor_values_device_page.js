@@ -1,11 +1,82 @@
-loopDeLoop(1000, 0);
+var sensorUpdateURL = '/json?view=sensorupdate';
+
+if (typeof EventSource !== 'undefined') {
+    listenForSensorEvents();
+} else {
+    loopDeLoop(1000, 0);
+}
+
+// Receive changed values pushed by the node, fall back to polling when not possible.
+function listenForSensorEvents() {
+    var source = new EventSource('/events');
+    // Events only contain changed values, so fetch all values when (re)connected
+    // or when the node had to drop events.
+    source.addEventListener('open', fetchSensorValues);
+    source.addEventListener('resync', fetchSensorValues);
+    source.addEventListener('values', function(e) {
+        updateSensorValues(JSON.parse(e.data));
+    });
+    source.onerror = function() {
+        // While CONNECTING the browser will retry by itself.
+        if (source.readyState === EventSource.CLOSED) {
+            loopDeLoop(1000, 0);
+        }
+    };
+}
+
+function fetchSensorValues() {
+    fetch(sensorUpdateURL).then(function(response) {
+        if (response.status !== 200) {
+            console.log('Looks like there was a problem. Status Code: ' + response.status);
+            return;
+        }
+        response.json().then(function(data) {
+            for (var c = 0; c < data.Sensors.length; c++) {
+                updateSensorValues(data.Sensors[c]);
+            }
+        });
+    }).catch(function(err) {
+        console.log(err.message);
+    });
+}
+
+function updateSensorValues(sensor) {
+    var k;
+    var valueEntry;
+    if (!sensor.hasOwnProperty('TaskValues')) {
+        return;
+    }
+    for (k = 0; k < sensor.TaskValues.length; k++) {
+        try {
+            valueEntry = sensor.TaskValues[k].Value;
+        } catch (err) {
+            valueEntry = err.name;
+        } finally {
+            if (valueEntry !== 'TypeError') {
+                var tempValue = sensor.TaskValues[k].Value;
+                var decimalsValue = sensor.TaskValues[k].NrDecimals;
+                if (decimalsValue < 255) {
+                    tempValue = parseFloat(tempValue).toFixed(decimalsValue);
+                }
+                var valueID = 'value_' + (sensor.TaskNumber - 1) + '_' + (sensor.TaskValues[k].ValueNumber - 1);
+                var valueNameID = 'valuename_' + (sensor.TaskNumber - 1) + '_' + (sensor.TaskValues[k].ValueNumber - 1);
+                var valueElement = document.getElementById(valueID);
+                var valueNameElement = document.getElementById(valueNameID);
+                if (valueElement !== null) {
+                    valueElement.innerHTML = tempValue;
+                }
+                if (valueNameElement !== null && sensor.TaskValues[k].hasOwnProperty('Name')) {
+                    valueNameElement.innerHTML = sensor.TaskValues[k].Name + ':';
+                }
+            }
+        }
+    }
+}
 
 function loopDeLoop(timeForNext, activeRequests) {
     var maximumRequests = 1;
     var c;
-    var k;
     var err = '';
-    var url = '/json?view=sensorupdate';
     var check = 0;
     if (isNaN(activeRequests)) {
         activeRequests = maximumRequests;
@@ -22,42 +93,14 @@ function loopDeLoop(timeForNext, activeRequests) {
         if (activeRequests > maximumRequests) {
             check = 1;
         } else {
-            fetch(url).then(function(response) {
-                var valueEntry;
+            fetch(sensorUpdateURL).then(function(response) {
                 if (response.status !== 200) {
                     console.log('Looks like there was a problem. Status Code: ' + response.status);
                     return;
                 }
                 response.json().then(function(data) {
-                    timeForNext = data.TTL;
                     for (c = 0; c < data.Sensors.length; c++) {
-                        if (data.Sensors[c].hasOwnProperty('TaskValues')) {
-                            for (k = 0; k < data.Sensors[c].TaskValues.length; k++) {
-                                try {
-                                    valueEntry = data.Sensors[c].TaskValues[k].Value;
-                                } catch (err) {
-                                    valueEntry = err.name;
-                                } finally {
-                                    if (valueEntry !== 'TypeError') {
-                                        tempValue = data.Sensors[c].TaskValues[k].Value;
-                                        decimalsValue = data.Sensors[c].TaskValues[k].NrDecimals;
-                                        if (decimalsValue < 255) {
-                                          tempValue = parseFloat(tempValue).toFixed(decimalsValue);
-                                        }
-                                        var valueID = 'value_' + (data.Sensors[c].TaskNumber - 1) + '_' + (data.Sensors[c].TaskValues[k].ValueNumber - 1);
-                                        var valueNameID = 'valuename_' + (data.Sensors[c].TaskNumber - 1) + '_' + (data.Sensors[c].TaskValues[k].ValueNumber - 1);
-                                        var valueElement = document.getElementById(valueID);
-                                        var valueNameElement = document.getElementById(valueNameID);
-                                        if (valueElement !== null) {
-                                            valueElement.innerHTML = tempValue;
-                                        }
-                                        if (valueNameElement !== null) {
-                                            valueNameElement.innerHTML = data.Sensors[c].TaskValues[k].Name + ':';
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                        updateSensorValues(data.Sensors[c]);
                     }
                     timeForNext = data.TTL;
                     clearInterval(i);
@@ -74,4 +117,4 @@ function loopDeLoop(timeForNext, activeRequests) {
             check = 1;
         }
     }, timeForNext);
-}
\ No newline at end of file
+}
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+
+from esptest import *
+
+# hardware requirements:
+# - node 0
+
+# benchmark:
+# - runs events against benchmark/rules1.txt, parsing the rules file for every event
+#   versus using the index of the rules blocks. Reports events/s and heap use of both engines.
+
+events=[
+    "StartTimer=1,1",
+    "StopTimer=1",
+    "Rules#Timer=1",
+    "Rules#Timer=2",
+    "Rules#Timer=3",
+    "NoHandler",
+]
+
+runs=100
+
+
+@step()
+def prepare():
+    node[0].reboot()
+    node[0].pingserial()
+    with open("benchmark/rules1.txt", "rb") as f:
+        r=requests.post(node[0]._url+"upload", files={'datafile': ('rules1.txt', f)})
+        r.raise_for_status()
+    espeasy[0].control(cmd="rules,1")
+
+
+@step()
+def benchmark():
+    for event in events:
+        r=requests.get(node[0]._url+"control", params={'cmd': "rulesbenchmark,{runs},{event}".format(runs=runs, event=event)})
+        r.raise_for_status()
+        log.info("{event}: {result}".format(event=event, result=r.text.strip()))
+
+
+
+if __name__=='__main__':
+    completed()
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+from esptest import *
+
+# hardware requirements:
+# - node 0
+
+# benchmark:
+# - parses a 200 character template with 10 system variables (PARSE_SYSVAR).
+#   Reports average/worst case parse time.
+
+runs=[10, 100, 1000]
+
+
+@step()
+def prepare():
+    node[0].reboot()
+    node[0].pingserial()
+
+
+@step()
+def benchmark():
+    for run in runs:
+        r=requests.get(node[0]._url+"control", params={'cmd': "sysvarbenchmark,{runs}".format(runs=run)})
+        r.raise_for_status()
+        log.info(r.text.strip())
+
+
+
+if __name__=='__main__':
+    completed()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# Offline fallback for the online JS minifier used by embed_files.sh.
+# Only removes comments and whitespace, names are not shortened. A line break is kept
+# wherever removing it could change automatic semicolon insertion.
+#
+# Usage: minify_js.py <file.js>   (result is written to stdout)
+
+import sys
+
+IDENT_CHARS = set('abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_$')
+
+# A line break after one of these can not end a statement.
+JOIN_AFTER = set('([{,;=:?&|*%<>!')
+
+# A line break before one of these does not end a statement either.
+JOIN_BEFORE = set(')]},;.?:=')
+
+# A '/' after one of these starts a regular expression, not a division.
+REGEX_AFTER = set('(,=:[!&|?{};+-*%<>~^')
+REGEX_AFTER_WORDS = {'return', 'typeof', 'case', 'in', 'of', 'new', 'delete', 'void', 'throw'}
+
+
+def last_word(out):
+    end = len(out)
+    start = end
+    while start > 0 and out[start - 1] in IDENT_CHARS:
+        start -= 1
+    return ''.join(out[start:end])
+
+
+def minify(src):
+    out = []
+    i = 0
+    n = len(src)
+    pending_space = False
+    pending_newline = False
+
+    def emit(text):
+        nonlocal pending_space, pending_newline
+        if out and (pending_space or pending_newline):
+            prev = out[-1]
+            first = text[0]
+            if pending_newline and prev not in JOIN_AFTER and first not in JOIN_BEFORE:
+                out.append('\n')
+            elif (prev in IDENT_CHARS and first in IDENT_CHARS) or (prev in '+-/' and first == prev):
+                out.append(' ')
+        pending_space = False
+        pending_newline = False
+        out.extend(text)
+
+    while i < n:
+        c = src[i]
+        if c in ' \t\r\n':
+            if c == '\n':
+                pending_newline = True
+            else:
+                pending_space = True
+            i += 1
+        elif src.startswith('//', i):
+            while i < n and src[i] != '\n':
+                i += 1
+        elif src.startswith('/*', i):
+            end = src.find('*/', i + 2)
+            if end < 0:
+                raise ValueError('unterminated comment')
+            if '\n' in src[i:end]:
+                pending_newline = True
+            else:
+                pending_space = True
+            i = end + 2
+        elif c in '"\'':
+            j = i + 1
+            while src[j] != c:
+                if src[j] == '\\':
+                    j += 1
+                elif src[j] == '\n':
+                    raise ValueError('unterminated string')
+                j += 1
+            emit(src[i:j + 1])
+            i = j + 1
+        elif c == '/' and (not out or out[-1] in REGEX_AFTER or last_word(out) in REGEX_AFTER_WORDS):
+            j = i + 1
+            in_class = False
+            while in_class or src[j] != '/':
+                if src[j] == '\\':
+                    j += 1
+                elif src[j] == '[':
+                    in_class = True
+                elif src[j] == ']':
+                    in_class = False
+                elif src[j] == '\n':
+                    raise ValueError('unterminated regular expression')
+                j += 1
+            j += 1
+            while j < n and src[j] in IDENT_CHARS:
+                j += 1
+            emit(src[i:j])
+            i = j
+        else:
+            emit(c)
+            i += 1
+    return ''.join(out)
+
+
+if __name__ == '__main__':
+    with open(sys.argv[1], encoding='utf-8') as f:
+        sys.stdout.write(minify(f.read()))
@@ -0,0 +1,1024 @@
+// Micro benchmarks of the ESPEasy core, run on the build host.
+//
+// Usage: benchmark [fixture dir] [nr runs] [filter]
+//   fixture dir : directory with the rules files, default test/benchmark
+//   nr runs     : number of runs per benchmark, default 10000
+//   filter      : only run benchmarks whose name contains this text
+//
+// For each benchmark the average duration (ns/op) and the number of heap
+// allocations per operation (allocs/op) are reported.
+// N.B. The host String keeps up to 15 characters without allocation, the ESP8266 core only 11.
+//      So allocation counts may be slightly lower than on the device.
+
+#include "../../../src/ESPEasy_common.h"
+
+#include "../../../src/src/ControllerQueue/QueueFingerprintSet.h"
+#include "../../../src/src/DataStructs/C013_p2p_SensorDataBatch.h"
+#include "../../../src/src/DataStructs/CBOR_Writer.h"
+#include "../../../src/src/DataStructs/ControllerCacheBlock.h"
+#include "../../../src/src/DataStructs/EventQueue.h"
+#include "../../../src/src/DataStructs/LogStruct.h"
+#include "../../../src/src/DataStructs/MQTT_TopicTrie.h"
+#include "../../../src/src/DataStructs/SSE_EventBuffer.h"
+#include "../../../src/src/ESPEasyCore/ESPEasyRules.h"
+#include "../../../src/src/ESPEasyCore/ESPEasy_Log.h"
+#include "../../../src/src/Globals/Cache.h"
+#include "../../../src/src/Globals/RulesIndex.h"
+#include "../../../src/src/Globals/RuntimeData.h"
+#include "../../../src/src/Globals/Settings.h"
+#include "../../../src/src/Helpers/CRC_functions.h"
+#include "../../../src/src/Helpers/Convert.h"
+#include "../../../src/src/Helpers/Numerical.h"
+#include "../../../src/src/Helpers/Rules_calculate.h"
+#include "../../../src/src/Helpers/StringConverter.h"
+#include "../../../src/src/Helpers/StringParser.h"
+#include "../../../src/src/Helpers/UDP_PacketReader.h"
+#include "../../../src/src/Helpers/msecTimerHandlerStruct.h"
+
+#include "native_stubs.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <new>
+#include <string>
+
+/*********************************************************************************************\
+* Allocation counting
+\*********************************************************************************************/
+static uint64_t allocCount = 0;
+static uint64_t allocBytes = 0;
+
+void * operator new(size_t size) {
+  ++allocCount;
+  allocBytes += size;
+  void *ptr = malloc(size == 0 ? 1 : size);
+
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void * operator new[](size_t size) {
+  return operator new(size);
+}
+
+// Not inlined, else GCC sees free() called on memory from operator new and warns.
+__attribute__((noinline)) void operator delete(void *ptr) noexcept {
+  free(ptr);
+}
+
+__attribute__((noinline)) void operator delete[](void *ptr) noexcept {
+  free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void *ptr, size_t) noexcept {
+  free(ptr);
+}
+
+__attribute__((noinline)) void operator delete[](void *ptr, size_t) noexcept {
+  free(ptr);
+}
+
+/*********************************************************************************************\
+* Benchmark runner
+\*********************************************************************************************/
+static uint32_t    nrRuns = 10000;
+static std::string nameFilter;
+
+static bool benchmarkSelected(const char *name) {
+  return nameFilter.empty() || (std::string(name).find(nameFilter) != std::string::npos);
+}
+
+static void runBenchmark(const char *name, const std::function<void()>& run) {
+  if (!benchmarkSelected(name)) {
+    return;
+  }
+
+  // Warm up, to fill caches like the rules index and parsed templates.
+  run();
+
+  const uint64_t startAllocCount = allocCount;
+  const uint64_t startAllocBytes = allocBytes;
+  const auto     start           = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < nrRuns; ++i) {
+    run();
+  }
+  const auto     end      = std::chrono::steady_clock::now();
+  const uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  printf("%-32s %12.1f ns/op %8.2f allocs/op %10.1f bytes/op\n",
+         name,
+         static_cast<double>(duration) / nrRuns,
+         static_cast<double>(allocCount - startAllocCount) / nrRuns,
+         static_cast<double>(allocBytes - startAllocBytes) / nrRuns);
+}
+
+/*********************************************************************************************\
+* Benchmarks
+\*********************************************************************************************/
+static void benchmarkCalculate() {
+  const String formulas[] = {
+    F("1+2*3"),
+    F("(20.5-3)*1.8+32"),
+    F("sqrt(16)+abs(-4)^2"),
+    F("(((1+2)*(3+4))/(5-6))%7")
+  };
+
+  for (size_t i = 0; i < sizeof(formulas) / sizeof(formulas[0]); ++i) {
+    String name = F("Calculate ");
+    name += formulas[i];
+    runBenchmark(name.c_str(), [&]() {
+      double result = 0;
+      Calculate(formulas[i], result);
+    });
+  }
+
+  // Expressions as found in rules after the sensor values are filled in, which differ almost every time.
+  uint32_t counter = 0;
+
+  runBenchmark("Calculate changing values", [&]() {
+    const double temperature = 15.0 + (++counter % 2000) * 0.01;
+    const String value       = doubleToString(temperature, 2);
+    double result      = 0;
+    Calculate(value + F("*1.8+32"), result);
+  });
+
+  // Same expression as used in a rules condition, where the variable is read when evaluating.
+  const String expression = F("sqrt([var#1]*1.8+32)");
+
+  runBenchmark("Calculate variable", [&]() {
+    setCustomFloatVar(1, 15.0 + (++counter % 2000) * 0.01);
+    double result = 0;
+    Calculate(expression, result);
+  });
+}
+
+static void benchmarkParseTemplate() {
+  const String plainText   = F("Some text without any markup, as used on displays");
+  const String withVars    = F("Value [VAR#1] and [INT#2], result %c_dec2hex%(255)");
+  const String displayLine = F("Outside %v1% C, inside %v2% C on unit %unit%");
+
+  customFloatVar[1] = 12.34;
+  customFloatVar[2] = 5;
+
+  runBenchmark("parseTemplate plain", [&]() {
+    String s(plainText);
+    parseTemplate(s);
+  });
+  runBenchmark("parseTemplate variables", [&]() {
+    String s(withVars);
+    parseTemplate(s);
+  });
+  runBenchmark("parseTemplate_cached variables", [&]() {
+    parseTemplate_cached(withVars, 1);
+  });
+  // A display line without conversions or string commands, only the result should be allocated.
+  runBenchmark("parseTemplate_cached display", [&]() {
+    parseTemplate_cached(displayLine, 2);
+  });
+}
+
+// A node with a 12 line OLED display (P036) and an MQTT controller publishing for a number of tasks.
+// One run renders all display lines and the publish topic of each task once, like one update cycle.
+static void benchmarkParseTemplateOwners(uint8_t nrTasks) {
+  const String lines[] = {
+    F("%sysname%"),
+    F("IP %ip%"),
+    F("Up %uptime% min"),
+    F("Temp [VAR#1#D2.1] C"),
+    F("Hum %v2% %"),
+    F("Heap %sysheap%"),
+    F("Load %sysload%%"),
+    F("%systime%"),
+    F("%sysday_0%-%sysmonth_0%-%sysyear%"),
+    F("RSSI %rssi% dBm"),
+    F("Var [INT#2] / [VAR#1]"),
+    F("Unit %unit%")
+  };
+  const String topic = F("%sysname%/%tskname%/%valname%");
+  const size_t nrLines = sizeof(lines) / sizeof(lines[0]);
+
+  String name = F("parseTemplate 12 lines ");
+  name += nrTasks;
+  name += F(" topics");
+  runBenchmark(name.c_str(), [&]() {
+    for (size_t line = 0; line < nrLines; ++line) {
+      String s(lines[line]);
+      parseTemplate_padded(s, 16);
+    }
+
+    for (uint8_t task = 0; task < nrTasks; ++task) {
+      String s(topic);
+      parseTemplate(s);
+    }
+  });
+
+  Cache.parsedTemplates.clear();
+  name = F("parseTemplate_cached 12 lines ");
+  name += nrTasks;
+  name += F(" topics");
+  runBenchmark(name.c_str(), [&]() {
+    for (size_t line = 0; line < nrLines; ++line) {
+      parseTemplate_cached(lines[line], ParsedTemplateCache::taskOwner(0, line), 16, false);
+    }
+
+    for (uint8_t task = 0; task < nrTasks; ++task) {
+      parseTemplate_cached(topic, ParsedTemplateCache::controllerOwner(0, task), 0, false);
+    }
+  });
+  Cache.parsedTemplates.clear();
+}
+
+static void benchmarkSystemVariables() {
+  // Same template as used by the sysvarbenchmark command.
+  const String sysvarTemplate = F("Unit %unit% %sysname% up %uptime% min, heap %sysheap% load %sysload%% "
+                                  "at %systime% on %sysday_0%-%sysmonth_0%-%sysyear% RSSI %rssi% dBm - "
+                                  "some text to fill up a typical display, or controller message.");
+
+  runBenchmark("parseSystemVariables", [&]() {
+    String s(sysvarTemplate);
+    parseSystemVariables(s, false);
+  });
+}
+
+static void benchmarkTimers() {
+  msecTimerHandlerStruct handler;
+  unsigned long id = 0;
+
+  // Do not call delay() when no timer is due.
+  handler.setEcoMode(false);
+
+  // Keep 32 timers scheduled, like a busy node with several tasks and rules timers.
+  for (unsigned long i = 1; i <= 32; ++i) {
+    handler.registerAt(i, millis() + i);
+  }
+  runBenchmark("msecTimerHandler reschedule", [&]() {
+    id = (id % 32) + 1;
+    handler.registerAt(id, millis() + 1000 + id);
+  });
+  // Make all timers due, each handled timer is scheduled again to be due immediately.
+  for (unsigned long i = 1; i <= 32; ++i) {
+    handler.registerAt(i, millis());
+  }
+  runBenchmark("msecTimerHandler getNextId", [&]() {
+    unsigned long timer = 0;
+    const unsigned long next = handler.getNextId(timer);
+
+    if (next != 0) {
+      handler.registerAt(next, millis());
+    }
+  });
+}
+
+static void benchmarkEventQueue() {
+  EventQueueStruct queue;
+  const String     event = F("Bme#Temperature=21.50");
+
+  runBenchmark("EventQueue add+getNext", [&]() {
+    String next;
+    queue.add(event);
+    queue.getNext(next);
+  });
+  runBenchmark("EventQueue addTaskValueEvent", [&]() {
+    String next;
+    queue.addTaskValueEvent(event, true);
+    queue.getNext(next);
+  });
+}
+
+static void benchmarkCRC() {
+  const String text = F("Some text to compute the checksum over, like a settings block or a file");
+
+  runBenchmark("calc_CRC16", [&]() {
+    calc_CRC16(text);
+  });
+  runBenchmark("calc_CRC32", [&]() {
+    calc_CRC32(reinterpret_cast<const uint8_t *>(text.c_str()), text.length());
+  });
+}
+
+static void benchmarkQueueFingerprint() {
+  const String topic   = F("ESP_Easy/Bme/Temperature");
+  const String payload = F("21.50");
+  QueueFingerprintSet fingerprints;
+
+  // Same number of fingerprints as a well filled controller queue.
+  for (uint32_t i = 0; i < 50; ++i) {
+    QueueFingerprint fingerprint;
+    fingerprint.add(i);
+    fingerprints.add(fingerprint.get());
+  }
+  QueueFingerprint fingerprint;
+
+  fingerprint.add(topic);
+  fingerprint.add(payload);
+  const uint32_t value = fingerprint.get();
+
+  runBenchmark("QueueFingerprint topic+payload", [&]() {
+    QueueFingerprint tmp;
+    tmp.add(topic);
+    tmp.add(payload);
+    tmp.get();
+  });
+  runBenchmark("QueueFingerprintSet contains", [&]() {
+    fingerprints.contains(value);
+  });
+  runBenchmark("QueueFingerprintSet add+remove", [&]() {
+    fingerprints.add(value);
+    fingerprints.remove(value);
+  });
+}
+
+static void benchmarkMQTTTopicTrie() {
+  MQTT_TopicTrie trie;
+  std::vector<MQTT_TopicTrie::Subscriber> subscribers;
+
+  // Import node with 10 tasks, each subscribed to 4 topics.
+  for (taskIndex_t task = 0; task < 10; ++task) {
+    for (byte x = 0; x < 4; ++x) {
+      String topic = F("home/room");
+      topic += task;
+      topic += x == 3 ? F("/+/state") : F("/sensor/value");
+      topic += x;
+      trie.add(topic, task, x);
+    }
+  }
+
+  runBenchmark("MQTT_TopicTrie match", [&]() {
+    subscribers.clear();
+    trie.match("home/room7/sensor/value2", subscribers);
+  });
+  runBenchmark("MQTT_TopicTrie no match", [&]() {
+    trie.matches("home/garden/sensor/value2");
+  });
+}
+
+static void benchmarkControllerCacheBlock() {
+  ControllerCacheSample sample;
+
+  sample.timestamp      = 1600000000;
+  sample.TaskIndex      = 2;
+  sample.controller_idx = 0;
+  sample.sensorType     = Sensor_VType::SENSOR_TYPE_TEMP_HUM_BARO;
+  sample.valueCount     = 3;
+  sample.values[0]      = 21.5f;
+  sample.values[1]      = 48.25f;
+  sample.values[2]      = 1013.2f;
+
+  uint8_t block[CONTROLLER_CACHE_BLOCK_HEADER_SIZE + CONTROLLER_CACHE_MAX_RECORD_SIZE];
+  ControllerCacheBlockHeader header;
+
+  header.init(sample.timestamp - 60);
+
+  runBenchmark("ControllerCacheBlock encode float", [&]() {
+    sample.decimals = -1;
+    header.encode(sample, block + CONTROLLER_CACHE_BLOCK_HEADER_SIZE);
+  });
+  runBenchmark("ControllerCacheBlock encode dec 2", [&]() {
+    sample.decimals = 2;
+    header.encode(sample, block + CONTROLLER_CACHE_BLOCK_HEADER_SIZE);
+  });
+  header.addRecord(sample, header.encode(sample, block + CONTROLLER_CACHE_BLOCK_HEADER_SIZE));
+  header.write(block);
+
+  runBenchmark("ControllerCacheBlock decode", [&]() {
+    ControllerCacheBlockHeader  tmp;
+    ControllerCacheBlockDecoder decoder;
+    ControllerCacheSample       result;
+
+    tmp.read(block, sizeof(block));
+    decoder.init(tmp, block + CONTROLLER_CACHE_BLOCK_HEADER_SIZE);
+    decoder.next(result);
+  });
+}
+
+static void benchmarkC013Batch() {
+  // Node with 10 tasks, each update of a task changes 1 or 2 of its 4 values.
+  const taskIndex_t nrTasks = 10;
+  C013_SensorDataBatchEncoder encoder;
+  C013_SensorDataBatchDecoder decoder;
+  C013_SensorDataBatchRecord  record;
+  byte   frame[C013_BATCH_FRAME_SIZE_MAX];
+  float  values[VARS_PER_TASK] = { 21.5f, 48.0f, 1013.0f, 3.3f };
+  size_t frameSize             = 0;
+  uint32_t round               = 0;
+
+  auto updateAll = [&]() {
+    ++round;
+
+    for (taskIndex_t task = 0; task < nrTasks; ++task) {
+      values[0] = 20.0f + ((round + task) % 50) * 0.1f;
+      values[1] = 40.0f + (((round + task) / 2) % 20);
+      encoder.update(task, values, VARS_PER_TASK);
+    }
+  };
+
+  runBenchmark("C013 batch encode 10 tasks", [&]() {
+    updateAll();
+    frameSize = encoder.encodeFrame(1, 2, frame);
+  });
+  runBenchmark("C013 batch decode 10 tasks", [&]() {
+    decoder.init(frame, frameSize);
+
+    while (decoder.next(record)) {}
+  });
+
+  if (!nameFilter.empty() && (std::string("C013 bytes/update").find(nameFilter) == std::string::npos)) {
+    return;
+  }
+
+  // Bytes sent per task update to a single node.
+  // Each task is updated every 10 seconds, full state is sent every 60 seconds.
+  // Legacy: one C013_SensorDataStruct (24 bytes) per task update.
+  const uint32_t legacyFrameSize  = 24;
+  const uint32_t udpHeaderSize    = 28; // IPv4 + UDP header
+  const uint32_t nrRounds         = 600;
+  uint32_t       nrUpdates        = 0;
+  uint32_t       nrFrames         = 0;
+  uint32_t       nrBytes          = 0;
+  uint32_t       nrErrors         = 0;
+  uint32_t       nrEvents         = 0;
+  float          received[TASKS_MAX][VARS_PER_TASK] = { { 0 } };
+  C013_SensorDataSequence sequence;
+
+  for (uint32_t i = 0; i < nrRounds; ++i) {
+    if ((i % 6) == 0) {
+      encoder.requestFullState();
+    }
+    updateAll();
+    nrUpdates += nrTasks;
+
+    while (encoder.hasPending()) {
+      frameSize = encoder.encodeFrame(1, 2, frame);
+
+      if (frameSize == 0) { break; }
+      ++nrFrames;
+      nrBytes += frameSize;
+      decoder.init(frame, frameSize);
+
+      while (decoder.next(record)) {
+        bool newUpdate = false;
+
+        if (!sequence.accept(record.taskIndex, decoder.sourceUnit(), record.sequence, record.fullState, newUpdate)) {
+          ++nrErrors;
+        }
+
+        if (newUpdate) {
+          ++nrEvents;
+        }
+
+        for (byte x = 0; x < VARS_PER_TASK; ++x) {
+          if (record.valueMask & (1 << x)) {
+            received[record.taskIndex][x] = record.values[x];
+          }
+        }
+      }
+    }
+
+    // Receiver must have the same values as the sender.
+    for (taskIndex_t task = 0; task < nrTasks; ++task) {
+      values[0] = 20.0f + ((round + task) % 50) * 0.1f;
+      values[1] = 40.0f + (((round + task) / 2) % 20);
+
+      if (memcmp(received[task], values, sizeof(values)) != 0) {
+        ++nrErrors;
+      }
+    }
+  }
+
+  // Every task update must result in one rule event, a resend of the full state in none.
+  encoder.requestFullState();
+  frameSize = encoder.encodeFrame(1, 2, frame);
+  decoder.init(frame, frameSize);
+
+  while (decoder.next(record)) {
+    bool newUpdate = false;
+
+    if (!sequence.accept(record.taskIndex, decoder.sourceUnit(), record.sequence, record.fullState, newUpdate) || newUpdate) {
+      ++nrErrors;
+    }
+  }
+
+  // An update from another unit must be accepted, whatever its sequence number.
+  {
+    bool newUpdate = false;
+
+    if (!sequence.accept(0, 3, 0, false, newUpdate) || !newUpdate) {
+      ++nrErrors;
+    }
+  }
+
+  if (nrEvents != nrUpdates) {
+    ++nrErrors;
+  }
+  printf("C013 bytes/update legacy %6.1f batch %6.1f, incl. UDP/IP header legacy %6.1f batch %6.1f, errors %u\n",
+         static_cast<double>(legacyFrameSize),
+         static_cast<double>(nrBytes) / nrUpdates,
+         static_cast<double>(legacyFrameSize + udpHeaderSize),
+         static_cast<double>(nrBytes + nrFrames * udpHeaderSize) / nrUpdates,
+         nrErrors);
+}
+
+// Replays UDP packets, like the receive queue of the network stack.
+// Packets arriving when maxQueued packets are pending are dropped.
+class ReplayUDP {
+public:
+
+  explicit ReplayUDP(size_t maxQueued) : _maxQueued(maxQueued) {}
+
+  // Packet must remain valid until read
+  void receive(const std::string& packet) {
+    if (_queue.size() >= _maxQueued) {
+      ++nrDropped;
+    } else {
+      _queue.push_back(&packet);
+    }
+  }
+
+  bool pending() const {
+    return !_queue.empty();
+  }
+
+  int parsePacket() {
+    // Like the ESP8266 WiFiUDP, the unread part of the current packet is discarded.
+    _pos     = 0;
+    _current = nullptr;
+
+    if (_queue.empty()) {
+      return 0;
+    }
+    _current = _queue.front();
+    _queue.pop_front();
+    return _current->size();
+  }
+
+  int available() {
+    return _current == nullptr ? 0 : _current->size() - _pos;
+  }
+
+  int read(char *buffer, size_t len) {
+    len = std::min<size_t>(len, available());
+    memcpy(buffer, _current->data() + _pos, len);
+    _pos += len;
+    return len;
+  }
+
+  uint16_t remotePort() {
+    return 8266;
+  }
+
+  uint32_t nrDropped = 0;
+
+private:
+
+  std::deque<const std::string *> _queue;
+  const std::string              *_current = nullptr;
+  size_t                          _pos     = 0;
+  size_t                          _maxQueued;
+};
+
+static UDP_PacketType classifyUDPPacket(char *packet, int len) {
+  if (static_cast<uint8_t>(packet[0]) != 255) {
+    return UDP_PacketType::Command;
+  }
+  return packet[1] == 1 ? UDP_PacketType::Sysinfo : UDP_PacketType::CPlugin;
+}
+
+static void benchmarkUDPReceive() {
+  // Burst as seen when several nodes broadcast at once:
+  // per node a sysinfo message (43 bytes), sensor data (24 bytes) and a batched sensor data frame,
+  // plus a command and a large packet of another protocol.
+  std::vector<std::string> burst;
+
+  for (int node = 0; node < 8; ++node) {
+    std::string sysinfo(43, '\0');
+    sysinfo[0]  = static_cast<char>(255);
+    sysinfo[1]  = 1;
+    sysinfo[12] = node + 1;
+    burst.push_back(sysinfo);
+
+    std::string data(24, '\0');
+    data[0] = static_cast<char>(255);
+    data[1] = 5;
+    burst.push_back(data);
+
+    std::string batch(C013_BATCH_HEADER_SIZE + 2 * 11, '\0');
+    batch[0] = static_cast<char>(255);
+    batch[1] = C013_BATCH_FRAME_ID;
+    burst.push_back(batch);
+  }
+  burst.push_back("event,Burst");
+  burst.push_back(std::string(1200, 'x'));
+
+  char buffer[UDP_PACKETSIZE_MAX];
+  UDP_ReceiveStats stats;
+
+  ReplayUDP udpSingle(1);
+
+  runBenchmark("UDP read packet", [&]() {
+    udpSingle.receive(burst[0]);
+    readUDPPackets(udpSingle, buffer, sizeof(buffer), stats, classifyUDPPacket);
+  });
+  runBenchmark("UDP read oversize packet", [&]() {
+    udpSingle.receive(burst.back());
+    readUDPPackets(udpSingle, buffer, sizeof(buffer), stats, classifyUDPPacket);
+  });
+
+  if (!nameFilter.empty() && (std::string("UDP burst replay").find(nameFilter) == std::string::npos)) {
+    return;
+  }
+
+  // Replay the burst with 3 packets arriving per loop() iteration.
+  // The receive queue of the network stack holds 6 packets (ESP32 default CONFIG_LWIP_UDP_RECVMBOX_SIZE)
+  const size_t arrivalsPerLoop = 3;
+  const size_t maxQueued       = 6;
+
+  for (uint8_t maxPackets : { static_cast<uint8_t>(1), static_cast<uint8_t>(UDP_RECEIVE_MAX_PACKETS) }) {
+    ReplayUDP udp(maxQueued);
+    stats.clear();
+    uint32_t nrLoops = 0;
+    size_t   i       = 0;
+
+    while (i < burst.size() || udp.pending()) {
+      for (size_t n = 0; n < arrivalsPerLoop && i < burst.size(); ++n, ++i) {
+        udp.receive(burst[i]);
+      }
+      readUDPPackets(udp, buffer, sizeof(buffer), stats, classifyUDPPacket, maxPackets);
+      ++nrLoops;
+    }
+    printf("UDP burst replay max %u packets/call: %zu sent, %u handled, %u oversize, %u lost in network stack, %u loops\n",
+           maxPackets,
+           burst.size(),
+           stats.commands + stats.sysinfo + stats.plugin + stats.cplugin,
+           stats.oversize,
+           udp.nrDropped,
+           nrLoops);
+  }
+}
+
+static void benchmarkValuesBin() {
+  // Node with 12 tasks of 4 values, like handle_values_bin() with and without 'since'
+  // Half of the values can be stored exactly as half precision float.
+  const taskIndex_t nrTasks = 12;
+  TaskValueTracker  tracker;
+  uint8_t           buffer[32 + (TASKS_MAX * (1 + 2 + 5 + 5 + 1 + (VARS_PER_TASK * 5)))];
+  size_t            size = 0;
+
+  for (taskIndex_t task = 0; task < nrTasks; ++task) {
+    for (byte x = 0; x < VARS_PER_TASK; ++x) {
+      UserVar[task * VARS_PER_TASK + x] = (x % 2) ? 20.0f + task + x * 0.25f : 1013.25f + task * 0.1f;
+    }
+    tracker.markUpdated(task, 1600000000 + task, VARS_PER_TASK);
+  }
+  const uint32_t since = tracker.getSequence() - 2;
+
+  auto encode = [&](uint32_t since) {
+    CBOR_Writer writer(buffer, sizeof(buffer));
+
+    writer.startMap(4);
+    writer.addText("unit");
+    writer.addUint(1);
+    writer.addText("time");
+    writer.addUint(1600000100);
+    writer.addText("seq");
+    writer.addUint(tracker.getSequence());
+    writer.addText("tasks");
+    writer.startIndefiniteArray();
+
+    for (taskIndex_t task = 0; task < nrTasks; ++task) {
+      if ((since != 0) && (tracker.getSequence(task) <= since)) {
+        continue;
+      }
+      const byte valueCount = tracker.getValueCount(task);
+      writer.startArray(4);
+      writer.addUint(task + 1);
+      writer.addUint(tracker.getSequence(task));
+      writer.addUint(tracker.getTimestamp(task));
+      writer.startArray(valueCount);
+
+      for (byte x = 0; x < valueCount; ++x) {
+        writer.addFloat(UserVar[task * VARS_PER_TASK + x]);
+      }
+    }
+    writer.endIndefinite();
+    return writer.size();
+  };
+
+  // Same data as JSON text, with the float to string conversions done by /json
+  auto encodeJson = [&]() -> size_t {
+    String json;
+
+    json.reserve(1024);
+    json += F("{\"unit\":1,\"time\":1600000100,\"seq\":");
+    json += tracker.getSequence();
+    json += F(",\"tasks\":[");
+
+    for (taskIndex_t task = 0; task < nrTasks; ++task) {
+      if (task != 0) { json += ','; }
+      json += '[';
+      json += task + 1;
+      json += ',';
+      json += tracker.getSequence(task);
+      json += ',';
+      json += tracker.getTimestamp(task);
+      json += F(",[");
+
+      for (byte x = 0; x < VARS_PER_TASK; ++x) {
+        if (x != 0) { json += ','; }
+        json += toString(UserVar[task * VARS_PER_TASK + x], 2);
+      }
+      json += F("]]");
+    }
+    json += F("]}");
+    return json.length();
+  };
+
+  runBenchmark("values.bin 12 tasks", [&]() {
+    size = encode(0);
+  });
+  runBenchmark("values.bin since, 2 tasks", [&]() {
+    size = encode(since);
+  });
+  runBenchmark("values as JSON text 12 tasks", [&]() {
+    size = encodeJson();
+  });
+
+  if (nameFilter.empty() || (std::string("values.bin size").find(nameFilter) != std::string::npos)) {
+    printf("values.bin size 12 tasks %zu bytes, 2 changed tasks %zu bytes, JSON text 12 tasks %zu bytes\n",
+           encode(0), encode(since), encodeJson());
+  }
+}
+
+// Client accepting at most 'window' bytes per write, like a TCP connection with a full send buffer.
+class WindowedClient {
+public:
+
+  explicit WindowedClient(int window) : window(window) {}
+
+  int availableForWrite() {
+    return window - pending;
+  }
+
+  size_t write(const uint8_t *data, size_t length) {
+    pending  += length;
+    received += length;
+    return length;
+  }
+
+  // Receiver acknowledged all pending data
+  void ack() {
+    pending = 0;
+  }
+
+  int    window;
+  int    pending  = 0;
+  size_t received = 0;
+};
+
+static void benchmarkEventStream() {
+  // 'values' event of a task with 2 changed values, as sent by events_sendTaskValues()
+  const String event = F("event: values\ndata: {\"TaskNumber\":3,\"TaskValues\":["
+                         "{\"ValueNumber\":1,\"NrDecimals\":2,\"Value\":21.37},"
+                         "{\"ValueNumber\":2,\"NrDecimals\":1,\"Value\":48.5}]}\n\n");
+
+  SSE_EventBuffer buffer(WEBSERVER_EVENTS_BUFFER_SIZE);
+  WindowedClient  client(1460);
+
+  runBenchmark("SSE add and write event", [&]() {
+    buffer.add(event);
+    writeBufferedEvents(client, buffer);
+    client.ack();
+  });
+
+  if (!nameFilter.empty() && (std::string("SSE slow client").find(nameFilter) == std::string::npos)) {
+    return;
+  }
+
+  // 12 tasks send new values at once, every second, to a client accepting only 200 bytes per 100 msec.
+  WindowedClient slowClient(200);
+  SSE_EventBuffer slowBuffer(WEBSERVER_EVENTS_BUFFER_SIZE);
+  uint32_t added      = 0;
+  size_t   maxPending = 0;
+
+  for (int sec = 0; sec < 10; ++sec) {
+    for (int task = 0; task < 12; ++task) {
+      if (slowBuffer.add(event)) { ++added; }
+    }
+
+    for (int loop = 0; loop < 10; ++loop) {
+      maxPending = std::max(maxPending, slowBuffer.size());
+      writeBufferedEvents(slowClient, slowBuffer);
+      slowClient.ack();
+    }
+  }
+
+  while (!slowBuffer.empty()) {
+    writeBufferedEvents(slowClient, slowBuffer);
+    slowClient.ack();
+  }
+  printf("SSE slow client: %u events queued, %u dropped, max %zu bytes buffered, %zu bytes received (%s)\n",
+         added,
+         slowBuffer.getNrDropped(),
+         maxPending,
+         slowClient.received,
+         (slowClient.received == added * event.length()) ? "complete events" : "PARTIAL EVENTS");
+}
+
+static void benchmarkLogBuffer() {
+  static LogStruct log;
+  const char *line = "EVENT: Clock#Time=Sun,12:34";
+  uint32_t    sequence = 0;
+  unsigned long timestamp;
+  String        message;
+  byte          loglevel;
+
+  runBenchmark("log add line", [&]() {
+    log.add(LOG_LEVEL_INFO, line);
+  });
+  runBenchmark("log add line from ISR", [&]() {
+    log.addFromISR(LOG_LEVEL_INFO, line, 27, 1234);
+  });
+  runBenchmark("log add and read line", [&]() {
+    log.add(LOG_LEVEL_INFO, line);
+    log.getNext(sequence, timestamp, message, loglevel);
+  });
+
+  // Log line built as String first, compared to a line of which the formatting is deferred.
+  const String event = F("Clock#Time=Sun,12:34");
+
+  runBenchmark("log String line", [&]() {
+    String text = F("EVENT: ");
+    text += event;
+    log.add(LOG_LEVEL_INFO, text.c_str());
+  });
+  runBenchmark("log deferred line", [&]() {
+    LogArgs args;
+    args.addAll(event);
+    log.add(LOG_LEVEL_INFO, F("EVENT: %s"), args);
+  });
+  runBenchmark("log deferred line and read", [&]() {
+    LogArgs args;
+    args.addAll(event);
+    log.add(LOG_LEVEL_INFO, F("EVENT: %s"), args);
+    log.getNext(sequence, timestamp, message, loglevel);
+  });
+
+  if (!nameFilter.empty() && (std::string("log burst").find(nameFilter) == std::string::npos)) {
+    return;
+  }
+
+  // Burst of 200 lines of varying length, read by 2 clients polling with their own cursor.
+  // One reads after every 10 lines, the other only after every 100 lines.
+  static LogStruct burstLog;
+  uint32_t cursor[2]  = { 0, 0 };
+  uint32_t read[2]    = { 0, 0 };
+  uint32_t dropped[2] = { 0, 0 };
+  uint32_t corrupt    = 0;
+
+  for (int i = 1; i <= 200; ++i) {
+    String text = F("Burst line ");
+    text += i;
+    while (text.length() < static_cast<unsigned int>(20 + (i * 7) % 90)) { text += '.'; }
+    burstLog.add(LOG_LEVEL_INFO, text.c_str());
+
+    for (int client = 0; client < 2; ++client) {
+      if ((i % (client == 0 ? 10 : 100)) != 0) { continue; }
+      const uint32_t since = cursor[client];
+      bool first = true;
+
+      while (burstLog.getNext(cursor[client], timestamp, message, loglevel)) {
+        if (first && (cursor[client] > since + 1)) { dropped[client] += cursor[client] - since - 1; }
+        first = false;
+
+        if (!message.startsWith(String(F("Burst line ")) + cursor[client])) { ++corrupt; }
+        ++read[client];
+      }
+    }
+  }
+  printf("log burst 200 lines: client every 10 lines read %u dropped %u, client every 100 lines read %u dropped %u, %u corrupt\n",
+         read[0], dropped[0], read[1], dropped[1], corrupt);
+}
+
+static void benchmarkConvert() {
+  const String intString   = F("123456");
+  const String floatString = F("-1234.5678");
+
+  runBenchmark("validIntFromString", [&]() {
+    int value = 0;
+    validIntFromString(intString, value);
+  });
+  runBenchmark("validDoubleFromString", [&]() {
+    double value = 0;
+    validDoubleFromString(floatString, value);
+  });
+  runBenchmark("isNumerical", [&]() {
+    NumericalType detectedType;
+    isNumerical(floatString, detectedType);
+  });
+  runBenchmark("doubleToString", [&]() {
+    doubleToString(-1234.5678, 3);
+  });
+}
+
+static void benchmarkRules() {
+  // Same events as used by test/bench_rules.py
+  const String events[] = {
+    F("StartTimer=1,1"),
+    F("StopTimer=1"),
+    F("Rules#Timer=1"),
+    F("Rules#Timer=2"),
+    F("Rules#Timer=3"),
+    F("NoHandler")
+  };
+
+  Settings.UseRules = true;
+  checkRuleSets();
+
+  for (int indexed = 0; indexed < 2; ++indexed) {
+    for (size_t i = 0; i < sizeof(events) / sizeof(events[0]); ++i) {
+      String name = indexed ? F("rules indexed ") : F("rules file ");
+      name += events[i];
+      runBenchmark(name.c_str(), [&]() {
+        rulesProcessingActiveFiles(events[i], indexed != 0);
+      });
+    }
+  }
+
+  // Throughput on the mix of events above and the heap used by the compiled rules.
+  const size_t nrEvents = sizeof(events) / sizeof(events[0]);
+
+  for (int indexed = 0; indexed < 2 && benchmarkSelected("rules event mix"); ++indexed) {
+    const uint64_t startAllocCount = allocCount;
+    const auto     start           = std::chrono::steady_clock::now();
+
+    for (uint32_t run = 0; run < nrRuns; ++run) {
+      for (size_t i = 0; i < nrEvents; ++i) {
+        rulesProcessingActiveFiles(events[i], indexed != 0);
+      }
+    }
+    const auto     end      = std::chrono::steady_clock::now();
+    const uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    printf("%-32s %12.0f events/s %8.2f allocs/event\n",
+           indexed ? "rules indexed event mix" : "rules file event mix",
+           1e9 * nrRuns * nrEvents / duration,
+           static_cast<double>(allocCount - startAllocCount) / (nrRuns * nrEvents));
+  }
+
+  if (benchmarkSelected("rules index heap")) {
+    printf("%-32s %12u bytes in %u files\n", "rules index heap",
+           static_cast<unsigned>(rulesIndex.getMemoryUsage()),
+           static_cast<unsigned>(rulesIndex.size()));
+  }
+
+  // Complete processing of an event, including its log lines, like with only the web log active.
+  nativeLogLevel = LOG_LEVEL_INFO;
+
+  for (size_t i = 0; i < sizeof(events) / sizeof(events[0]); ++i) {
+    String name = F("rules event log info ");
+    name += events[i];
+    runBenchmark(name.c_str(), [&]() {
+      rulesProcessing(events[i]);
+    });
+  }
+  nativeLogLevel = LOG_LEVEL_NONE;
+}
+
+int main(int argc, char *argv[]) {
+  ESPEASY_FS.setRoot(argc > 1 ? argv[1] : "test/benchmark");
+
+  if (argc > 2) {
+    nrRuns = std::max(1, atoi(argv[2]));
+  }
+
+  if (argc > 3) {
+    nameFilter = argv[3];
+  }
+
+  benchmarkCalculate();
+  benchmarkParseTemplate();
+  benchmarkParseTemplateOwners(8);
+  benchmarkParseTemplateOwners(24);
+  benchmarkSystemVariables();
+  benchmarkTimers();
+  benchmarkEventQueue();
+  benchmarkCRC();
+  benchmarkQueueFingerprint();
+  benchmarkMQTTTopicTrie();
+  benchmarkControllerCacheBlock();
+  benchmarkC013Batch();
+  benchmarkUDPReceive();
+  benchmarkValuesBin();
+  benchmarkEventStream();
+  benchmarkLogBuffer();
+  benchmarkConvert();
+  benchmarkRules();
+
+  printf("Commands executed by rules: %u\n", nativeCommandCounter);
+  return 0;
+}
@@ -0,0 +1,240 @@
+// Stubs for the parts of ESPEasy which are not part of the native build.
+// The native build runs without plugins, network and serial console.
+// Files are read from the host file system, with the directory set via ESPEASY_FS.setRoot()
+
+#include "../../../src/ESPEasy_common.h"
+
+#include "../../../src/src/Commands/GPIO.h"
+#include "../../../src/src/Commands/InternalCommands.h"
+#include "../../../src/src/DataStructs/ESPEasy_EventStruct.h"
+#include "../../../src/src/DataStructs/LogStruct.h"
+#include "../../../src/src/ESPEasyCore/ESPEasyNetwork.h"
+#include "../../../src/src/ESPEasyCore/ESPEasy_Log.h"
+#include "../../../src/src/ESPEasyCore/ESPEasy_backgroundtasks.h"
+#include "../../../src/src/ESPEasyCore/Serial.h"
+#include "../../../src/src/Globals/ExtraTaskSettings.h"
+#include "../../../src/src/Globals/Plugins.h"
+#include "../../../src/src/Globals/RamTracker.h"
+#include "../../../src/src/Globals/Settings.h"
+#include "../../../src/src/Helpers/CompiletimeDefines.h"
+#include "../../../src/src/Helpers/ESPEasy_Storage.h"
+#include "../../../src/src/Helpers/Hardware.h"
+#include "../../../src/src/Helpers/Memory.h"
+#include "../../../src/src/Helpers/Misc.h"
+#include "../../../src/src/Helpers/Networking.h"
+#include "../../../src/src/Helpers/StringProvider.h"
+#include "../../../src/src/Helpers/_Plugin_SensorTypeHelper.h"
+
+#include "native_stubs.h"
+
+uint8_t   nativeLogLevel       = LOG_LEVEL_NONE;
+uint32_t  nativeCommandCounter = 0;
+LogStruct nativeWebLog;
+
+/*********************************************************************************************\
+* Logging
+\*********************************************************************************************/
+bool loglevelActiveFor(byte logLevel) {
+  return logLevel <= nativeLogLevel;
+}
+
+void addLog(byte logLevel, const __FlashStringHelper *str) {
+  addLog(logLevel, String(str));
+}
+
+void addLog(byte logLevel, const char *line) {
+  if (loglevelActiveFor(logLevel)) {
+    nativeWebLog.add(logLevel, line);
+  }
+}
+
+void addLog(byte logLevel, const String& string) {
+  addLog(logLevel, string.c_str());
+}
+
+void addToLog(byte logLevel, const __FlashStringHelper *format, const LogArgs& args, const LogArgs& fullArgs) {
+  nativeWebLog.add(logLevel, format, args);
+}
+
+void serialPrint(const __FlashStringHelper *text) {}
+
+void serialPrint(const String& text) {}
+
+void serialPrintln(const __FlashStringHelper *text) {}
+
+void serialPrintln(const String& text) {}
+
+#ifndef BUILD_NO_RAM_TRACKER
+void checkRAM(const String& flashString, int a) {}
+
+void checkRAM(const __FlashStringHelper *descr) {}
+#endif // ifndef BUILD_NO_RAM_TRACKER
+
+/*********************************************************************************************\
+* Commands, plugins and tasks
+\*********************************************************************************************/
+bool ExecuteCommand_all(EventValueSource::Enum source, const char *Line) {
+  // Only count, commands are not part of the native build.
+  ++nativeCommandCounter;
+  return true;
+}
+
+bool PluginCall(byte Function, struct EventStruct *event, String& str) {
+  return false;
+}
+
+bool validDeviceIndex(deviceIndex_t index) {
+  return false;
+}
+
+bool validTaskIndex(taskIndex_t index) {
+  return index < TASKS_MAX;
+}
+
+deviceIndex_t getDeviceIndex_from_TaskIndex(taskIndex_t taskIndex) {
+  return INVALID_DEVICE_INDEX;
+}
+
+int getValueCountForTask(taskIndex_t taskIndex) {
+  return 0;
+}
+
+int checkDeviceVTypeForTask(struct EventStruct *event) {
+  return -1;
+}
+
+const __FlashStringHelper * getSensorTypeLabel(Sensor_VType sensorType) {
+  return F("");
+}
+
+String getTaskDeviceName(taskIndex_t TaskIndex) {
+  return EMPTY_STRING;
+}
+
+bool getGPIOPinStateValues(String& str) {
+  return false;
+}
+
+/*********************************************************************************************\
+* Storage
+\*********************************************************************************************/
+String FileError(int line, const char *fname) {
+  String err = F("FS   : Error while reading/writing ");
+
+  err += fname;
+  err += F(" in ");
+  err += line;
+  addLog(LOG_LEVEL_ERROR, err);
+  return err;
+}
+
+bool fileExists(const String& fname) {
+  return ESPEASY_FS.exists(fname);
+}
+
+fs::File tryOpenFile(const String& fname, const String& mode) {
+  fs::File f;
+
+  if (fname.isEmpty() || fname.equals(F("/"))) {
+    return f;
+  }
+
+  if (!mode.startsWith(F("r")) || fileExists(fname)) {
+    f = ESPEASY_FS.open(fname, mode.c_str());
+  }
+  return f;
+}
+
+String LoadTaskSettings(taskIndex_t TaskIndex) {
+  if (ExtraTaskSettings.TaskIndex != TaskIndex) {
+    ExtraTaskSettings.clear();
+    ExtraTaskSettings.TaskIndex = TaskIndex;
+  }
+  return EMPTY_STRING;
+}
+
+String LoadStringArray(SettingsType::Enum settingsType, int index, String strings[], uint16_t nrStrings, uint16_t maxStringLength) {
+  for (uint16_t i = 0; i < nrStrings; ++i) {
+    strings[i] = EMPTY_STRING;
+  }
+  return EMPTY_STRING;
+}
+
+String SaveStringArray(SettingsType::Enum settingsType, int index, const String strings[], uint16_t nrStrings, uint16_t maxStringLength) {
+  return EMPTY_STRING;
+}
+
+/*********************************************************************************************\
+* Network
+\*********************************************************************************************/
+void CheckRunningServices() {}
+
+bool NetworkConnected(uint32_t timeout_ms) {
+  return false;
+}
+
+IPAddress NetworkLocalIP() {
+  return IPAddress();
+}
+
+bool hostReachable(const IPAddress& ip) {
+  return false;
+}
+
+bool resolveHostByName(const char *aHostname, IPAddress& aResult, uint32_t timeout_ms) {
+  return false;
+}
+
+bool beginWiFiUDP_randomPort(WiFiUDP& udp) {
+  return false;
+}
+
+String formatUnitToIPAddress(byte unit, byte formatCode) {
+  return EMPTY_STRING;
+}
+
+/*********************************************************************************************\
+* System
+\*********************************************************************************************/
+void backgroundtasks() {}
+
+void FeedSW_watchdog() {}
+
+unsigned long FreeMem(void) {
+  return ESP.getFreeHeap();
+}
+
+float getCPUload() {
+  return 0.0f;
+}
+
+uint32_t getChipId() {
+  return ESP.getChipId();
+}
+
+int getUptimeMinutes() {
+  return millis() / 60000;
+}
+
+String getRulesFileName(unsigned int filenr) {
+  String result;
+
+  if (filenr < 4) {
+    result += F("rules");
+    result += filenr + 1;
+    result += F(".txt");
+  }
+  return result;
+}
+
+String getValue(LabelType::Enum label) {
+  return EMPTY_STRING;
+}
+
+const __FlashStringHelper * get_build_date() {
+  return F(__DATE__);
+}
+
+const __FlashStringHelper * get_build_time() {
+  return F(__TIME__);
+}
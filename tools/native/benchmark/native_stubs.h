@@ -0,0 +1,17 @@
+#ifndef NATIVE_BENCHMARK_NATIVE_STUBS_H
+#define NATIVE_BENCHMARK_NATIVE_STUBS_H
+
+#include <stdint.h>
+
+struct LogStruct;
+
+// Log level used by the native build.
+extern uint8_t  nativeLogLevel;
+
+// Log lines are stored like on a node where only the web log is active.
+extern LogStruct nativeWebLog;
+
+// Number of commands "executed" by the rules engine, as commands are not part of the native build.
+extern uint32_t nativeCommandCounter;
+
+#endif // NATIVE_BENCHMARK_NATIVE_STUBS_H
@@ -0,0 +1,6 @@
+#ifndef NATIVE_SHIM_ADDRLIST_H
+#define NATIVE_SHIM_ADDRLIST_H
+
+// The native build has no network interfaces.
+
+#endif // NATIVE_SHIM_ADDRLIST_H
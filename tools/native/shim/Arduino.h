@@ -0,0 +1,136 @@
+#ifndef NATIVE_SHIM_ARDUINO_H
+#define NATIVE_SHIM_ARDUINO_H
+
+// Minimal Arduino/ESP8266 core for building ESPEasy core logic on the host.
+// Only what is needed by the sources listed in the native_benchmark environment.
+// Behavior follows the ESP8266 core, timing uses the host clock.
+
+#include <ctype.h>
+#include <limits.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#define ESPEASY_NATIVE_BUILD 1
+
+typedef uint8_t byte;
+typedef bool    boolean;
+typedef uint16_t word;
+
+// PROGMEM does not exist on the host, flash strings are regular strings.
+class __FlashStringHelper;
+#define PROGMEM
+#define PGM_P        const char *
+#define PSTR(s)      (s)
+#define F(s)         (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+#define FPSTR(p)     (reinterpret_cast<const __FlashStringHelper *>(p))
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define ICACHE_FLASH_ATTR
+
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_word(addr)  (*reinterpret_cast<const uint16_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#define pgm_read_float(addr) (*reinterpret_cast<const float *>(addr))
+#define pgm_read_ptr(addr)   (*reinterpret_cast<const void * const *>(addr))
+#define memcpy_P      memcpy
+#define memcmp_P      memcmp
+#define strlen_P      strlen
+#define strcmp_P      strcmp
+#define strncmp_P     strncmp
+#define strcasecmp_P  strcasecmp
+#define strncasecmp_P strncasecmp
+#define strcpy_P      strcpy
+#define strncpy_P     strncpy
+#define strstr_P      strstr
+#define sprintf_P     sprintf
+#define snprintf_P    snprintf
+#define vsnprintf_P   vsnprintf
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define HIGH         0x1
+#define LOW          0x0
+#define INPUT        0x00
+#define OUTPUT       0x01
+#define INPUT_PULLUP 0x02
+
+#define PI         3.1415926535897932384626433832795
+#define HALF_PI    1.5707963267948966192313216916398
+#define TWO_PI     6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+#define sq(x)        ((x) * (x))
+
+#define bitRead(value, bit)            (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit)             ((value) |= (1UL << (bit)))
+#define bitClear(value, bit)           ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define lowByte(w)                     ((uint8_t)((w) & 0xff))
+#define highByte(w)                    ((uint8_t)((w) >> 8))
+#define constrain(amt, low, high)      ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+
+using std::min;
+using std::max;
+
+inline bool isDigit(int c)      { return isdigit(c) != 0; }
+inline bool isAlpha(int c)      { return isalpha(c) != 0; }
+inline bool isAlphaNumeric(int c) { return isalnum(c) != 0; }
+inline bool isSpace(int c)      { return isspace(c) != 0; }
+inline bool isWhitespace(int c) { return c == ' ' || c == '\t'; }
+inline bool isHexadecimalDigit(int c) { return isxdigit(c) != 0; }
+inline bool isPrintable(int c)  { return isprint(c) != 0; }
+inline bool isUpperCase(int c)  { return isupper(c) != 0; }
+inline bool isLowerCase(int c)  { return islower(c) != 0; }
+inline bool isPunct(int c)      { return ispunct(c) != 0; }
+
+// Host clock, see native_core.cpp
+unsigned long millis();
+unsigned long micros();
+uint64_t      micros64();
+void          delay(unsigned long ms);
+void          delayMicroseconds(unsigned int us);
+void          yield();
+
+// Interrupt level of the Xtensa core, the native build has no interrupts.
+inline uint32_t xt_rsil(uint32_t) { return 0; }
+inline void     xt_wsr_ps(uint32_t) {}
+
+void          pinMode(uint8_t pin, uint8_t mode);
+void          digitalWrite(uint8_t pin, uint8_t val);
+int           digitalRead(uint8_t pin);
+int           analogRead(uint8_t pin);
+void          analogWrite(uint8_t pin, int val);
+
+long          random(long howbig);
+long          random(long howsmall, long howbig);
+void          randomSeed(unsigned long seed);
+
+char        * itoa(int value, char *str, int base);
+char        * ltoa(long value, char *str, int base);
+char        * ultoa(unsigned long value, char *str, int base);
+char        * dtostrf(double number, signed char width, unsigned char prec, char *s);
+
+#include "WString.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+
+#endif // NATIVE_SHIM_ARDUINO_H
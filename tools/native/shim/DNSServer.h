@@ -0,0 +1,16 @@
+#ifndef NATIVE_SHIM_DNSSERVER_H
+#define NATIVE_SHIM_DNSSERVER_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+// Declarations only, the DNS server is not part of the native build.
+class DNSServer {
+public:
+
+  bool start(const uint16_t& port, const String& domainName, const IPAddress& resolvedIP);
+  void stop();
+  void processNextRequest();
+};
+
+#endif // NATIVE_SHIM_DNSSERVER_H
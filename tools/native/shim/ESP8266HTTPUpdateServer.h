@@ -0,0 +1,14 @@
+#ifndef NATIVE_SHIM_ESP8266HTTPUPDATESERVER_H
+#define NATIVE_SHIM_ESP8266HTTPUPDATESERVER_H
+
+#include <ESP8266WebServer.h>
+
+// Declarations only, OTA updates are not part of the native build.
+class ESP8266HTTPUpdateServer {
+public:
+
+  void setup(ESP8266WebServer *server) {}
+  void setup(ESP8266WebServer *server, const String& path, const String& username, const String& password) {}
+};
+
+#endif // NATIVE_SHIM_ESP8266HTTPUPDATESERVER_H
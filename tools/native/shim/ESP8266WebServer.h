@@ -0,0 +1,75 @@
+#ifndef NATIVE_SHIM_ESP8266WEBSERVER_H
+#define NATIVE_SHIM_ESP8266WEBSERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <IPAddress.h>
+#include <WiFiClient.h>
+
+#include <functional>
+
+// Declarations only, the web server is not part of the native build.
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define HTTP_UPLOAD_BUFLEN     2048
+
+struct HTTPUpload {
+  HTTPUploadStatus status;
+  String           filename;
+  String           name;
+  String           type;
+  size_t           totalSize;
+  size_t           currentSize;
+  uint8_t          buf[HTTP_UPLOAD_BUFLEN];
+};
+
+class ESP8266WebServer {
+public:
+
+  typedef std::function<void (void)> THandlerFunction;
+
+  void        begin();
+  void        handleClient();
+  void        on(const String& uri, THandlerFunction handler);
+  void        on(const String& uri, HTTPMethod method, THandlerFunction fn);
+  void        on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn);
+  void        onNotFound(THandlerFunction fn);
+  void        onFileUpload(THandlerFunction fn);
+
+  String      uri() const;
+  HTTPMethod  method() const;
+  WiFiClient& client();
+  HTTPUpload& upload();
+
+  String      arg(const String& name) const;
+  String      arg(int i) const;
+  String      argName(int i) const;
+  int         args() const;
+  bool        hasArg(const String& name) const;
+  void        collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+  String      header(const String& name) const;
+  bool        hasHeader(const String& name) const;
+  String      hostHeader() const;
+
+  bool        authenticate(const char *username, const char *password);
+  void        requestAuthentication();
+
+  void        send(int code, const char *content_type = nullptr, const String& content = String(""));
+  void        send(int code, const String& content_type, const String& content);
+  void        send_P(int code, PGM_P content_type, PGM_P content);
+  void        send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
+  void        setContentLength(const size_t contentLength);
+  void        sendHeader(const String& name, const String& value, bool first = false);
+  void        sendContent(const String& content);
+  void        sendContent(const char *content, size_t size);
+  void        sendContent_P(PGM_P content);
+  void        sendContent_P(PGM_P content, size_t size);
+
+  template<typename T>
+  size_t streamFile(T& file, const String& contentType) { return 0; }
+};
+
+#endif // NATIVE_SHIM_ESP8266WEBSERVER_H
@@ -0,0 +1,63 @@
+#ifndef NATIVE_SHIM_ESP8266WIFI_H
+#define NATIVE_SHIM_ESP8266WIFI_H
+
+#include "ESP8266WiFiGeneric.h"
+#include "ESP8266WiFiType.h"
+#include "WiFiClient.h"
+
+#define WL_MAC_ADDR_LENGTH 6
+
+typedef enum {
+  WL_NO_SHIELD       = 255,
+  WL_IDLE_STATUS     = 0,
+  WL_NO_SSID_AVAIL   = 1,
+  WL_SCAN_COMPLETED  = 2,
+  WL_CONNECTED       = 3,
+  WL_CONNECT_FAILED  = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED    = 6
+} wl_status_t;
+
+// The native build is never connected to a network.
+class ESP8266WiFiClass {
+public:
+
+  wl_status_t status() { return WL_DISCONNECTED; }
+  bool        isConnected() { return false; }
+  WiFiMode_t  getMode() { return WIFI_OFF; }
+  bool        mode(WiFiMode_t) { return true; }
+  String      SSID() const { return String(); }
+  String      BSSIDstr() const { return F("00:00:00:00:00:00"); }
+  uint8_t   * BSSID() { return _bssid; }
+  int32_t     RSSI() { return 0; }
+  int32_t     channel() { return 0; }
+  IPAddress   localIP() { return IPAddress(); }
+  IPAddress   subnetMask() { return IPAddress(); }
+  IPAddress   gatewayIP() { return IPAddress(); }
+  IPAddress   dnsIP(uint8_t = 0) { return IPAddress(); }
+  IPAddress   softAPIP() { return IPAddress(); }
+  String      macAddress() { return F("00:00:00:00:00:00"); }
+  uint8_t   * macAddress(uint8_t *mac) { memset(mac, 0, WL_MAC_ADDR_LENGTH); return mac; }
+  String      softAPmacAddress() { return F("00:00:00:00:00:00"); }
+  uint8_t   * softAPmacAddress(uint8_t *mac) { memset(mac, 0, WL_MAC_ADDR_LENGTH); return mac; }
+  int8_t      scanComplete() { return 0; }
+  void        scanDelete() {}
+  int8_t      scanNetworks(bool async = false, bool show_hidden = false) { return 0; }
+  String      SSID(uint8_t networkItem) { return String(); }
+  int32_t     RSSI(uint8_t networkItem) { return 0; }
+  int32_t     channel(uint8_t networkItem) { return 0; }
+  uint8_t   * BSSID(uint8_t networkItem) { return _bssid; }
+  String      BSSIDstr(uint8_t networkItem) { return BSSIDstr(); }
+  uint8_t     encryptionType(uint8_t networkItem) { return 0; }
+  bool        isHidden(uint8_t networkItem) { return false; }
+  String      hostname() { return String(); }
+  bool        hostname(const String&) { return true; }
+
+private:
+
+  uint8_t _bssid[WL_MAC_ADDR_LENGTH] = { 0 };
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif // NATIVE_SHIM_ESP8266WIFI_H
@@ -0,0 +1,6 @@
+#ifndef NATIVE_SHIM_ESP8266WIFIGENERIC_H
+#define NATIVE_SHIM_ESP8266WIFIGENERIC_H
+
+#include "ESP8266WiFiType.h"
+
+#endif // NATIVE_SHIM_ESP8266WIFIGENERIC_H
@@ -0,0 +1,39 @@
+#ifndef NATIVE_SHIM_ESP_H
+#define NATIVE_SHIM_ESP_H
+
+#include <stdint.h>
+
+#include "WString.h"
+
+// Reports fixed values of a typical ESP8266 node.
+class EspClass {
+public:
+
+  uint32_t getFreeHeap() { return 40000; }
+  uint32_t getMaxFreeBlockSize() { return 30000; }
+  uint8_t  getHeapFragmentation() { return 10; }
+  uint32_t getFreeContStack() { return 3000; }
+  uint32_t getChipId() { return 0x123456; }
+  uint32_t getFlashChipId() { return 0x1640ef; }
+  uint32_t getFlashChipRealSize() { return 4194304; }
+  uint32_t getFlashChipSize() { return 4194304; }
+  uint32_t getFlashChipSpeed() { return 40000000; }
+  uint32_t getSketchSize() { return 900000; }
+  uint32_t getFreeSketchSpace() { return 1000000; }
+  uint8_t  getCpuFreqMHz() { return 80; }
+  uint32_t getCycleCount();
+  String   getResetReason() { return F("External System"); }
+  String   getResetInfo() { return String(); }
+  String   getCoreVersion() { return F("native"); }
+  const char * getSdkVersion() { return "native"; }
+  void     restart() {}
+  void     reset() {}
+  void     deepSleep(uint64_t) {}
+  void     wdtFeed() {}
+};
+
+typedef EspClass ESPClass;
+
+extern EspClass ESP;
+
+#endif // NATIVE_SHIM_ESP_H
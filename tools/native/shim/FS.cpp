@@ -0,0 +1,178 @@
+#include "FS.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+
+namespace fs {
+File::File(FILE *file, const String& name) :
+  _file(file, [](FILE *f) { fclose(f); }), _name(name) {}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+  return _file ? fwrite(buf, 1, size, _file.get()) : 0;
+}
+
+int File::available()
+{
+  if (!_file) { return 0; }
+  return static_cast<int>(size() - position());
+}
+
+int File::read()
+{
+  return _file ? fgetc(_file.get()) : -1;
+}
+
+int File::peek()
+{
+  if (!_file) { return -1; }
+  const int c = fgetc(_file.get());
+
+  if (c != EOF) {
+    ungetc(c, _file.get());
+  }
+  return c;
+}
+
+void File::flush()
+{
+  if (_file) { fflush(_file.get()); }
+}
+
+size_t File::read(uint8_t *buf, size_t size)
+{
+  return _file ? fread(buf, 1, size, _file.get()) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+  const int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+
+  return _file && fseek(_file.get(), pos, whence) == 0;
+}
+
+size_t File::position() const
+{
+  return _file ? ftell(_file.get()) : 0;
+}
+
+size_t File::size() const
+{
+  if (!_file) { return 0; }
+  struct stat st;
+
+  if (fstat(fileno(_file.get()), &st) != 0) {
+    return 0;
+  }
+  return st.st_size;
+}
+
+void File::close()
+{
+  _file.reset();
+}
+
+Dir::Dir(const String& hostPath, const String& dirName) : _hostPath(hostPath), _dirName(dirName)
+{
+  DIR *dir = opendir(hostPath.c_str());
+
+  if (dir == nullptr) {
+    return;
+  }
+  struct dirent *entry;
+
+  while ((entry = readdir(dir)) != nullptr) {
+    if (entry->d_type == DT_REG) {
+      _entries.push_back(String(entry->d_name));
+    }
+  }
+  closedir(dir);
+  std::sort(_entries.begin(), _entries.end());
+}
+
+bool Dir::next()
+{
+  ++_index;
+  return _index < static_cast<int>(_entries.size());
+}
+
+String Dir::fileName() const
+{
+  if ((_index < 0) || (_index >= static_cast<int>(_entries.size()))) {
+    return String();
+  }
+  return _entries[_index];
+}
+
+size_t Dir::fileSize() const
+{
+  struct stat st;
+  const String path = _hostPath + '/' + fileName();
+
+  if (stat(path.c_str(), &st) != 0) {
+    return 0;
+  }
+  return st.st_size;
+}
+
+File Dir::openFile(const char *mode)
+{
+  const String path = _hostPath + '/' + fileName();
+  FILE *f           = fopen(path.c_str(), mode);
+
+  return f ? File(f, fileName()) : File();
+}
+
+bool FS::info(FSInfo& info)
+{
+  info.totalBytes    = totalBytes();
+  info.usedBytes     = usedBytes();
+  info.blockSize     = 8192;
+  info.pageSize      = 256;
+  info.maxOpenFiles  = 5;
+  info.maxPathLength = 32;
+  return true;
+}
+
+String FS::hostPath(const String& path) const
+{
+  if (path.startsWith("/")) {
+    return _root + path;
+  }
+  return _root + '/' + path;
+}
+
+File FS::open(const String& path, const char *mode)
+{
+  // Binary mode, like on the ESP
+  String hostMode(mode);
+
+  hostMode += 'b';
+  FILE *f = fopen(hostPath(path).c_str(), hostMode.c_str());
+
+  return f ? File(f, path) : File();
+}
+
+bool FS::exists(const String& path)
+{
+  struct stat st;
+
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const String& path)
+{
+  return ::remove(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const String& pathFrom, const String& pathTo)
+{
+  return ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+} // namespace fs
+
+fs::FS SPIFFS;
+fs::FS LittleFS;
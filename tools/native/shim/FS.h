@@ -0,0 +1,131 @@
+#ifndef NATIVE_SHIM_FS_H
+#define NATIVE_SHIM_FS_H
+
+// File system on a directory of the host, see fs::FS::setRoot()
+// Files are opened via stdio, like the ESP8266 core copies of File share the same handle.
+
+#include <Arduino.h>
+
+#include <memory>
+#include <vector>
+
+namespace fs {
+enum SeekMode {
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+class File : public Stream {
+public:
+
+  File() {}
+
+  File(FILE *file, const String& name);
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+
+  int    available() override;
+  int    read() override;
+  int    peek() override;
+  void   flush() override;
+  size_t read(uint8_t *buf, size_t size);
+  bool   seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void   close();
+  const char * name() const { return _name.c_str(); }
+  const char * fullName() const { return _name.c_str(); }
+  bool   isFile() const { return static_cast<bool>(_file); }
+  bool   isDirectory() const { return false; }
+  File   openNextFile() { return File(); }
+  void   rewindDirectory() {}
+
+  operator bool() const { return static_cast<bool>(_file); }
+
+private:
+
+  std::shared_ptr<FILE>_file;
+  String _name;
+};
+
+class Dir {
+public:
+
+  Dir() {}
+
+  Dir(const String& hostPath, const String& dirName);
+
+  bool   next();
+  String fileName() const;
+  size_t fileSize() const;
+  bool   isFile() const { return true; }
+  bool   isDirectory() const { return false; }
+  File   openFile(const char *mode);
+
+private:
+
+  String _hostPath;
+  String _dirName;
+  std::vector<String>_entries;
+  int _index = -1;
+};
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+class FS {
+public:
+
+  // Directory on the host holding the files, e.g. "test/benchmark"
+  void   setRoot(const String& hostPath) { _root = hostPath; }
+
+  bool   begin() { return true; }
+  void   end() {}
+  bool   format() { return false; }
+  bool   gc() { return true; }
+  bool   info(FSInfo& info);
+
+  File   open(const String& path, const char *mode);
+  File   open(const char *path, const char *mode) { return open(String(path), mode); }
+  bool   exists(const String& path);
+  bool   exists(const char *path) { return exists(String(path)); }
+  bool   remove(const String& path);
+  bool   remove(const char *path) { return remove(String(path)); }
+  bool   rename(const String& pathFrom, const String& pathTo);
+  bool   mkdir(const String& path) { return true; }
+  bool   rmdir(const String& path) { return true; }
+  Dir    openDir(const String& path) { return Dir(hostPath(path), path); }
+  Dir    openDir(const char *path) { return openDir(String(path)); }
+
+  size_t totalBytes() { return 1024 * 1024; }
+  size_t usedBytes() { return 0; }
+
+private:
+
+  String hostPath(const String& path) const;
+
+  String _root = ".";
+};
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::Dir;
+using fs::FSInfo;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+extern fs::FS SPIFFS;
+
+#endif // NATIVE_SHIM_FS_H
@@ -0,0 +1,31 @@
+#ifndef NATIVE_SHIM_HARDWARESERIAL_H
+#define NATIVE_SHIM_HARDWARESERIAL_H
+
+#include "Stream.h"
+
+#include <stdio.h>
+
+enum SerialConfig { SERIAL_8N1 = 0x1c };
+enum SerialMode { SERIAL_FULL = 0, SERIAL_RX_ONLY = 1, SERIAL_TX_ONLY = 2 };
+
+// Output is written to stdout, there is never anything to read.
+class HardwareSerial : public Stream {
+public:
+
+  void   begin(unsigned long baud) {}
+  void   begin(unsigned long baud, SerialConfig config, SerialMode mode = SERIAL_FULL, uint8_t tx_pin = 1) {}
+  void   end() {}
+  void   setDebugOutput(bool) {}
+  int    availableForWrite() { return 128; }
+
+  size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+  using Print::write;
+
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+#endif // NATIVE_SHIM_HARDWARESERIAL_H
@@ -0,0 +1,60 @@
+#ifndef NATIVE_SHIM_IPADDRESS_H
+#define NATIVE_SHIM_IPADDRESS_H
+
+#include <Arduino.h>
+
+class IPAddress {
+public:
+
+  IPAddress() {}
+
+  IPAddress(uint8_t first_octet, uint8_t second_octet, uint8_t third_octet, uint8_t fourth_octet) {
+    _address[0] = first_octet;
+    _address[1] = second_octet;
+    _address[2] = third_octet;
+    _address[3] = fourth_octet;
+  }
+
+  IPAddress(uint32_t address) { memcpy(_address, &address, 4); }
+
+  IPAddress(const uint8_t *address) { memcpy(_address, address, 4); }
+
+  operator uint32_t() const {
+    uint32_t res;
+
+    memcpy(&res, _address, 4);
+    return res;
+  }
+
+  bool     operator==(const IPAddress& addr) const { return memcmp(_address, addr._address, 4) == 0; }
+  bool     operator!=(const IPAddress& addr) const { return !(*this == addr); }
+  uint8_t  operator[](int index) const { return _address[index]; }
+  uint8_t& operator[](int index) { return _address[index]; }
+
+  bool     isSet() const { return static_cast<uint32_t>(*this) != 0; }
+
+  String   toString() const {
+    char buf[16];
+
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _address[0], _address[1], _address[2], _address[3]);
+    return String(buf);
+  }
+
+  bool fromString(const String& address) {
+    unsigned int a, b, c, d;
+
+    if (sscanf(address.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) != 4) {
+      return false;
+    }
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+
+private:
+
+  uint8_t _address[4] = { 0, 0, 0, 0 };
+};
+
+extern const IPAddress INADDR_NONE;
+
+#endif // NATIVE_SHIM_IPADDRESS_H
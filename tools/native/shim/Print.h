@@ -0,0 +1,42 @@
+#ifndef NATIVE_SHIM_PRINT_H
+#define NATIVE_SHIM_PRINT_H
+
+#include "WString.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print {
+public:
+
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+
+    while (size--) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+
+  size_t write(const char *str) { return str ? write(reinterpret_cast<const uint8_t *>(str), strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write(reinterpret_cast<const uint8_t *>(buffer), size); }
+
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(const char *str) { return write(str); }
+  size_t print(const __FlashStringHelper *str) { return write(reinterpret_cast<const char *>(str)); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+
+  template<class T>
+  size_t print(T value) { return print(String(value)); }
+
+  size_t println() { return write("\r\n"); }
+
+  template<class T>
+  size_t println(T value) { return print(value) + println(); }
+};
+
+#endif // NATIVE_SHIM_PRINT_H
@@ -0,0 +1,17 @@
+#ifndef NATIVE_SHIM_SPI_H
+#define NATIVE_SHIM_SPI_H
+
+#include <Arduino.h>
+
+// SPI is not available in the native build.
+class SPIClass {
+public:
+
+  void    begin() {}
+  void    end() {}
+  uint8_t transfer(uint8_t) { return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif // NATIVE_SHIM_SPI_H
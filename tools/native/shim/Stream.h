@@ -0,0 +1,42 @@
+#ifndef NATIVE_SHIM_STREAM_H
+#define NATIVE_SHIM_STREAM_H
+
+#include "Print.h"
+
+class Stream : public Print {
+public:
+
+  virtual int  available() { return 0; }
+  virtual int  read() { return -1; }
+  virtual int  peek() { return -1; }
+  virtual void flush() {}
+
+  void         setTimeout(unsigned long) {}
+
+  virtual size_t readBytes(char *buffer, size_t length) {
+    size_t count = 0;
+
+    while (count < length) {
+      const int c = read();
+
+      if (c < 0) { break; }
+      buffer[count++] = static_cast<char>(c);
+    }
+    return count;
+  }
+
+  virtual size_t readBytes(uint8_t *buffer, size_t length) { return readBytes(reinterpret_cast<char *>(buffer), length); }
+
+  String readStringUntil(char terminator) {
+    String res;
+    int    c = read();
+
+    while (c >= 0 && c != terminator) {
+      res += static_cast<char>(c);
+      c    = read();
+    }
+    return res;
+  }
+};
+
+#endif // NATIVE_SHIM_STREAM_H
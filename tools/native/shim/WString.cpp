@@ -0,0 +1,270 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include <algorithm>
+
+namespace {
+template<class T>
+std::string toBase(T value, unsigned char base) {
+  if ((base < 2) || (base > 36)) { base = 10; }
+
+  if (value == 0) { return "0"; }
+  std::string res;
+
+  while (value != 0) {
+    const unsigned int digit = value % base;
+    res.insert(res.begin(), static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10));
+    value /= base;
+  }
+  return res;
+}
+
+template<class T, class U>
+std::string toSignedBase(T value, unsigned char base) {
+  if ((base == 10) && (value < 0)) {
+    return "-" + toBase(static_cast<U>(-(value + 1)) + 1, base);
+  }
+  return toBase(static_cast<U>(value), base);
+}
+
+std::string toDecimals(double value, unsigned char decimalPlaces) {
+  char buf[64];
+
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  return buf;
+}
+}
+
+String::String(unsigned char value, unsigned char base) : _s(toBase(value, base)) {}
+
+String::String(int value, unsigned char base) : _s(toSignedBase<int, unsigned int>(value, base)) {}
+
+String::String(unsigned int value, unsigned char base) : _s(toBase(value, base)) {}
+
+String::String(long value, unsigned char base) : _s(toSignedBase<long, unsigned long>(value, base)) {}
+
+String::String(unsigned long value, unsigned char base) : _s(toBase(value, base)) {}
+
+String::String(long long value, unsigned char base) : _s(toSignedBase<long long, unsigned long long>(value, base)) {}
+
+String::String(unsigned long long value, unsigned char base) : _s(toBase(value, base)) {}
+
+String::String(float value, unsigned char decimalPlaces) : _s(toDecimals(value, decimalPlaces)) {}
+
+String::String(double value, unsigned char decimalPlaces) : _s(toDecimals(value, decimalPlaces)) {}
+
+bool String::equalsIgnoreCase(const String& str) const
+{
+  return (_s.size() == str._s.size()) && (strcasecmp(_s.c_str(), str._s.c_str()) == 0);
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const
+{
+  if ((offset > _s.size()) || (prefix._s.size() > (_s.size() - offset))) {
+    return false;
+  }
+  return _s.compare(offset, prefix._s.size(), prefix._s) == 0;
+}
+
+bool String::endsWith(const String& suffix) const
+{
+  if (suffix._s.size() > _s.size()) {
+    return false;
+  }
+  return _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+}
+
+char& String::operator[](unsigned int index)
+{
+  static char dummy_writable_char;
+
+  if (index >= _s.size()) {
+    dummy_writable_char = 0;
+    return dummy_writable_char;
+  }
+  return _s[index];
+}
+
+void String::getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index) const
+{
+  if ((bufsize == 0) || (buf == nullptr)) {
+    return;
+  }
+
+  if (index >= _s.size()) {
+    buf[0] = 0;
+    return;
+  }
+  unsigned int n = bufsize - 1;
+
+  if (n > (_s.size() - index)) {
+    n = _s.size() - index;
+  }
+  memcpy(buf, _s.data() + index, n);
+  buf[n] = 0;
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const
+{
+  if (fromIndex >= _s.size()) {
+    return -1;
+  }
+  const size_t pos = _s.find(ch, fromIndex);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::indexOf(const String& str, unsigned int fromIndex) const
+{
+  if (fromIndex >= _s.size()) {
+    return -1;
+  }
+  const size_t pos = _s.find(str._s, fromIndex);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::lastIndexOf(char ch, unsigned int fromIndex) const
+{
+  if (_s.empty()) {
+    return -1;
+  }
+  const size_t pos = _s.rfind(ch, fromIndex);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::lastIndexOf(const String& str, unsigned int fromIndex) const
+{
+  if (str._s.size() > _s.size()) {
+    return -1;
+  }
+  const size_t pos = _s.rfind(str._s, fromIndex);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+String String::substring(unsigned int left, unsigned int right) const
+{
+  if (left > right) {
+    std::swap(left, right);
+  }
+  String res;
+
+  if (left >= _s.size()) {
+    return res;
+  }
+
+  if (right > _s.size()) {
+    right = _s.size();
+  }
+  res._s.assign(_s, left, right - left);
+  return res;
+}
+
+void String::replace(char find, char replace)
+{
+  std::replace(_s.begin(), _s.end(), find, replace);
+}
+
+void String::replace(const String& find, const String& replace)
+{
+  if (find._s.empty()) {
+    return;
+  }
+  size_t pos = _s.find(find._s);
+
+  while (pos != std::string::npos) {
+    _s.replace(pos, find._s.size(), replace._s);
+    pos = _s.find(find._s, pos + replace._s.size());
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+  if (index >= _s.size()) {
+    return;
+  }
+  _s.erase(index, count);
+}
+
+void String::toLowerCase()
+{
+  for (auto& c : _s) {
+    c = tolower(c);
+  }
+}
+
+void String::toUpperCase()
+{
+  for (auto& c : _s) {
+    c = toupper(c);
+  }
+}
+
+void String::trim()
+{
+  size_t begin = 0;
+  size_t end   = _s.size();
+
+  while (begin < end && isspace(_s[begin])) {
+    ++begin;
+  }
+
+  while (end > begin && isspace(_s[end - 1])) {
+    --end;
+  }
+  _s = _s.substr(begin, end - begin);
+}
+
+String operator+(const String& lhs, const String& rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const String& lhs, const char *rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const String& lhs, const __FlashStringHelper *rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const String& lhs, char rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(const char *lhs, const String& rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+String operator+(char lhs, const String& rhs)
+{
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
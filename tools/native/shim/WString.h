@@ -0,0 +1,150 @@
+#ifndef NATIVE_SHIM_WSTRING_H
+#define NATIVE_SHIM_WSTRING_H
+
+// Arduino String on top of std::string.
+// N.B. std::string uses a larger small string buffer than the ESP8266 core (15 vs. 11 characters),
+// so allocation counts of short strings may be a bit lower than on a node.
+
+#include <string>
+
+class __FlashStringHelper;
+
+class String {
+public:
+
+  String() {}
+
+  String(const char *cstr) : _s(cstr ? cstr : "") {}
+
+  String(const char *cstr, unsigned int length) : _s(cstr ? cstr : "", cstr ? length : 0) {}
+
+  String(const String& str) = default;
+  String(String&& str) = default;
+  String(const __FlashStringHelper *str) : _s(str ? reinterpret_cast<const char *>(str) : "") {}
+
+  explicit String(char c) : _s(1, c) {}
+
+  String(unsigned char value, unsigned char base = 10);
+  String(int value, unsigned char base = 10);
+  String(unsigned int value, unsigned char base = 10);
+  String(long value, unsigned char base = 10);
+  String(unsigned long value, unsigned char base = 10);
+  String(long long value, unsigned char base = 10);
+  String(unsigned long long value, unsigned char base = 10);
+  String(float value, unsigned char decimalPlaces = 2);
+  String(double value, unsigned char decimalPlaces = 2);
+
+  String& operator=(const String& rhs) = default;
+  String& operator=(String&& rhs) = default;
+  String& operator=(const char *cstr) { _s = cstr ? cstr : ""; return *this; }
+  String& operator=(const __FlashStringHelper *str) { _s = str ? reinterpret_cast<const char *>(str) : ""; return *this; }
+  String& operator=(char c) { _s.assign(1, c); return *this; }
+
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+  unsigned int length() const { return _s.size(); }
+  bool         isEmpty() const { return _s.empty(); }
+  const char * c_str() const { return _s.c_str(); }
+  char       * begin() { return &_s[0]; }
+  char       * end() { return &_s[0] + _s.size(); }
+  const char * begin() const { return _s.data(); }
+  const char * end() const { return _s.data() + _s.size(); }
+
+  bool concat(const String& str) { _s += str._s; return true; }
+  bool concat(const char *cstr) { if (cstr) { _s += cstr; } return true; }
+  bool concat(const char *cstr, unsigned int length) { if (cstr) { _s.append(cstr, length); } return true; }
+  bool concat(const __FlashStringHelper *str) { return concat(reinterpret_cast<const char *>(str)); }
+  bool concat(char c) { _s += c; return true; }
+  bool concat(unsigned char num) { return concat(String(num)); }
+  bool concat(int num) { return concat(String(num)); }
+  bool concat(unsigned int num) { return concat(String(num)); }
+  bool concat(long num) { return concat(String(num)); }
+  bool concat(unsigned long num) { return concat(String(num)); }
+  bool concat(long long num) { return concat(String(num)); }
+  bool concat(unsigned long long num) { return concat(String(num)); }
+  bool concat(float num) { return concat(String(num)); }
+  bool concat(double num) { return concat(String(num)); }
+
+  template<class T>
+  String& operator+=(const T& rhs) { concat(rhs); return *this; }
+  String& operator+=(const char *cstr) { concat(cstr); return *this; }
+  String& operator+=(const __FlashStringHelper *str) { concat(str); return *this; }
+
+  int  compareTo(const String& str) const { return _s.compare(str._s); }
+  bool equals(const String& str) const { return _s == str._s; }
+  bool equals(const char *cstr) const { return _s == (cstr ? cstr : ""); }
+  bool equalsIgnoreCase(const String& str) const;
+  bool equalsConstantTime(const String& str) const { return equals(str); }
+  bool startsWith(const String& prefix) const { return startsWith(prefix, 0); }
+  bool startsWith(const String& prefix, unsigned int offset) const;
+  bool endsWith(const String& suffix) const;
+
+  bool operator==(const String& rhs) const { return equals(rhs); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String& rhs) const { return !equals(rhs); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool operator<(const String& rhs) const { return compareTo(rhs) < 0; }
+  bool operator>(const String& rhs) const { return compareTo(rhs) > 0; }
+  bool operator<=(const String& rhs) const { return compareTo(rhs) <= 0; }
+  bool operator>=(const String& rhs) const { return compareTo(rhs) >= 0; }
+
+  char  charAt(unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+  void  setCharAt(unsigned int index, char c) { if (index < _s.size()) { _s[index] = c; } }
+  char  operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index);
+
+  void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const;
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const {
+    getBytes(reinterpret_cast<unsigned char *>(buf), bufsize, index);
+  }
+
+  int indexOf(char ch, unsigned int fromIndex = 0) const;
+  int indexOf(const String& str, unsigned int fromIndex = 0) const;
+  int indexOf(const char *str, unsigned int fromIndex = 0) const { return indexOf(String(str), fromIndex); }
+  int indexOf(const __FlashStringHelper *str, unsigned int fromIndex = 0) const { return indexOf(String(str), fromIndex); }
+  int lastIndexOf(char ch) const { return lastIndexOf(ch, _s.size()); }
+  int lastIndexOf(char ch, unsigned int fromIndex) const;
+  int lastIndexOf(const String& str) const { return lastIndexOf(str, _s.size()); }
+  int lastIndexOf(const String& str, unsigned int fromIndex) const;
+
+  String substring(unsigned int beginIndex) const { return substring(beginIndex, _s.size()); }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+  void replace(char find, char replace);
+  void replace(const String& find, const String& replace);
+  void remove(unsigned int index) { remove(index, static_cast<unsigned int>(-1)); }
+  void remove(unsigned int index, unsigned int count);
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+
+  long   toInt() const { return atol(_s.c_str()); }
+  float  toFloat() const { return static_cast<float>(atof(_s.c_str())); }
+  double toDouble() const { return atof(_s.c_str()); }
+
+  explicit operator bool() const { return true; }
+
+private:
+
+  std::string _s;
+};
+
+inline bool operator==(const char *lhs, const String& rhs) { return rhs.equals(lhs); }
+inline bool operator!=(const char *lhs, const String& rhs) { return !rhs.equals(lhs); }
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char *rhs);
+String operator+(const String& lhs, const __FlashStringHelper *rhs);
+String operator+(const String& lhs, char rhs);
+String operator+(const char *lhs, const String& rhs);
+String operator+(char lhs, const String& rhs);
+
+template<class T>
+String operator+(const String& lhs, T rhs) {
+  String res(lhs);
+
+  res.concat(rhs);
+  return res;
+}
+
+#endif // NATIVE_SHIM_WSTRING_H
@@ -0,0 +1,29 @@
+#ifndef NATIVE_SHIM_WIFICLIENT_H
+#define NATIVE_SHIM_WIFICLIENT_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#include "Client.h"
+
+// Networking is not available in the native build, a client never connects.
+class WiFiClient : public Client {
+public:
+
+  int       connect(IPAddress ip, uint16_t port) override { return 0; }
+  int       connect(const char *host, uint16_t port) override { return 0; }
+  uint8_t   connected() override { return 0; }
+  void      stop() override {}
+  size_t    write(uint8_t) override { return 0; }
+  size_t    write(const uint8_t *, size_t) override { return 0; }
+  using Print::write;
+  void      setNoDelay(bool) {}
+  size_t    availableForWrite() { return 0; }
+  IPAddress remoteIP() { return IPAddress(); }
+  uint16_t  remotePort() { return 0; }
+  IPAddress localIP() { return IPAddress(); }
+  uint16_t  localPort() { return 0; }
+  operator bool() override { return false; }
+};
+
+#endif // NATIVE_SHIM_WIFICLIENT_H
@@ -0,0 +1,29 @@
+#ifndef NATIVE_SHIM_WIFIUDP_H
+#define NATIVE_SHIM_WIFIUDP_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+// Networking is not available in the native build, no packets are ever received.
+class WiFiUDP : public Stream {
+public:
+
+  uint8_t   begin(uint16_t port) { return 0; }
+  void      stop() {}
+  int       parsePacket() { return 0; }
+  int       available() override { return 0; }
+  int       read() override { return -1; }
+  int       read(unsigned char *buffer, size_t len) { return 0; }
+  int       read(char *buffer, size_t len) { return 0; }
+  void      flush() override {}
+  int       beginPacket(IPAddress ip, uint16_t port) { return 0; }
+  int       beginPacket(const char *host, uint16_t port) { return 0; }
+  int       endPacket() { return 0; }
+  size_t    write(uint8_t) override { return 0; }
+  size_t    write(const uint8_t *, size_t) override { return 0; }
+  using Print::write;
+  IPAddress remoteIP() { return IPAddress(); }
+  uint16_t  remotePort() { return 0; }
+};
+
+#endif // NATIVE_SHIM_WIFIUDP_H
@@ -0,0 +1,23 @@
+#ifndef NATIVE_SHIM_WIRE_H
+#define NATIVE_SHIM_WIRE_H
+
+#include <Arduino.h>
+
+// I2C is not available in the native build.
+class TwoWire : public Stream {
+public:
+
+  void    begin() {}
+  void    begin(int sda, int scl) {}
+  void    setClock(uint32_t) {}
+  void    setClockStretchLimit(uint32_t) {}
+  void    beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool sendStop = true) { return 2; }
+  uint8_t requestFrom(uint8_t address, size_t quantity, bool sendStop = true) { return 0; }
+  size_t  write(uint8_t) override { return 0; }
+  using Print::write;
+};
+
+extern TwoWire Wire;
+
+#endif // NATIVE_SHIM_WIRE_H
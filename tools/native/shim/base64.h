@@ -0,0 +1,15 @@
+#ifndef NATIVE_SHIM_BASE64_H
+#define NATIVE_SHIM_BASE64_H
+
+#include <Arduino.h>
+
+class base64 {
+public:
+
+  static String encode(const uint8_t *data, size_t length, bool doNewLines = true);
+  static String encode(const String& text, bool doNewLines = true) {
+    return encode(reinterpret_cast<const uint8_t *>(text.c_str()), text.length(), doNewLines);
+  }
+};
+
+#endif // NATIVE_SHIM_BASE64_H
@@ -0,0 +1,19 @@
+#ifndef NATIVE_SHIM_CONT_H
+#define NATIVE_SHIM_CONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif // ifdef __cplusplus
+
+typedef struct cont_ {
+  unsigned int stack_guard1;
+} cont_t;
+
+int cont_get_free_stack(cont_t *cont);
+bool cont_can_yield(cont_t *cont);
+
+#ifdef __cplusplus
+}
+#endif // ifdef __cplusplus
+
+#endif // NATIVE_SHIM_CONT_H
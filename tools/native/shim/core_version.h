@@ -0,0 +1,9 @@
+#ifndef NATIVE_SHIM_CORE_VERSION_H
+#define NATIVE_SHIM_CORE_VERSION_H
+
+#define ARDUINO_ESP8266_GIT_VER  0x00000000
+#define ARDUINO_ESP8266_GIT_DESC native
+#define ARDUINO_ESP8266_RELEASE  "native"
+#define ARDUINO_ESP8266_RELEASE_3_0_0
+
+#endif // NATIVE_SHIM_CORE_VERSION_H
@@ -0,0 +1,22 @@
+#ifndef NATIVE_SHIM_ESP8266_MUTEX_H
+#define NATIVE_SHIM_ESP8266_MUTEX_H
+
+// Replaces lib/raburton_esp8266_mutex, which uses Xtensa assembly.
+// The native build runs single threaded, just like ESPEasy on the ESP8266.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int32_t mutex_t;
+
+inline void CreateMutux(mutex_t *mutex) { *mutex = 1; }
+
+inline bool GetMutex(mutex_t *mutex) {
+  if (*mutex != 1) { return false; }
+  *mutex = 0;
+  return true;
+}
+
+inline void ReleaseMutex(mutex_t *mutex) { *mutex = 1; }
+
+#endif // NATIVE_SHIM_ESP8266_MUTEX_H
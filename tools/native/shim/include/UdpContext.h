@@ -0,0 +1,7 @@
+#ifndef NATIVE_SHIM_UDPCONTEXT_H
+#define NATIVE_SHIM_UDPCONTEXT_H
+
+// Networking is not available in the native build.
+class UdpContext;
+
+#endif // NATIVE_SHIM_UDPCONTEXT_H
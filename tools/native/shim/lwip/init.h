@@ -0,0 +1,7 @@
+#ifndef NATIVE_SHIM_LWIP_INIT_H
+#define NATIVE_SHIM_LWIP_INIT_H
+
+#define LWIP_VERSION_MAJOR 2
+#define LWIP_VERSION_MINOR 1
+
+#endif // NATIVE_SHIM_LWIP_INIT_H
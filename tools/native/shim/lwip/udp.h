@@ -0,0 +1,6 @@
+#ifndef NATIVE_SHIM_LWIP_UDP_H
+#define NATIVE_SHIM_LWIP_UDP_H
+
+// Networking is not available in the native build.
+
+#endif // NATIVE_SHIM_LWIP_UDP_H
@@ -0,0 +1,141 @@
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <IPAddress.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <base64.h>
+#include <cont.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+namespace {
+const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+std::mt19937 randomGenerator;
+}
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+EspClass       ESP;
+ESP8266WiFiClass WiFi;
+TwoWire        Wire;
+SPIClass       SPI;
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+uint64_t micros64()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros()
+{
+  // 32 bit like on the ESP, to also run into the same overflow issues.
+  return static_cast<uint32_t>(micros64());
+}
+
+unsigned long millis()
+{
+  return static_cast<uint32_t>(micros64() / 1000);
+}
+
+void delay(unsigned long ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {}
+
+uint32_t EspClass::getCycleCount()
+{
+  // As if running at 80 MHz
+  return static_cast<uint32_t>(micros64() * 80);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+void digitalWrite(uint8_t pin, uint8_t val) {}
+
+int digitalRead(uint8_t pin) { return LOW; }
+
+int analogRead(uint8_t pin) { return 0; }
+
+void analogWrite(uint8_t pin, int val) {}
+
+long random(long howbig)
+{
+  if (howbig <= 0) { return 0; }
+  return std::uniform_int_distribution<long>(0, howbig - 1)(randomGenerator);
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig) { return howsmall; }
+  return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+  randomGenerator.seed(seed);
+}
+
+char * ultoa(unsigned long value, char *str, int base)
+{
+  const String res(value, static_cast<unsigned char>(base));
+
+  strcpy(str, res.c_str());
+  return str;
+}
+
+char * ltoa(long value, char *str, int base)
+{
+  const String res(value, static_cast<unsigned char>(base));
+
+  strcpy(str, res.c_str());
+  return str;
+}
+
+char * itoa(int value, char *str, int base)
+{
+  return ltoa(value, str, base);
+}
+
+char * dtostrf(double number, signed char width, unsigned char prec, char *s)
+{
+  sprintf(s, "%*.*f", width, prec, number);
+  return s;
+}
+
+extern "C" {
+int cont_get_free_stack(cont_t *cont) { return 4096; }
+
+bool cont_can_yield(cont_t *cont) { return true; }
+
+cont_t  g_cont;
+cont_t *g_pcont = &g_cont;
+}
+
+String base64::encode(const uint8_t *data, size_t length, bool doNewLines)
+{
+  static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  String res;
+
+  res.reserve(((length + 2) / 3) * 4);
+
+  for (size_t i = 0; i < length; i += 3) {
+    const uint32_t n = (static_cast<uint32_t>(data[i]) << 16) |
+                       ((i + 1 < length ? data[i + 1] : 0) << 8) |
+                       (i + 2 < length ? data[i + 2] : 0);
+    res += table[(n >> 18) & 0x3F];
+    res += table[(n >> 12) & 0x3F];
+    res += (i + 1 < length) ? table[(n >> 6) & 0x3F] : '=';
+    res += (i + 2 < length) ? table[n & 0x3F] : '=';
+  }
+  return res;
+}
@@ -0,0 +1,14 @@
+#ifndef NATIVE_SHIM_SPI_FLASH_H
+#define NATIVE_SHIM_SPI_FLASH_H
+
+#include <stdint.h>
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+typedef enum {
+  SPI_FLASH_RESULT_OK,
+  SPI_FLASH_RESULT_ERR,
+  SPI_FLASH_RESULT_TIMEOUT
+} SpiFlashOpResult;
+
+#endif // NATIVE_SHIM_SPI_FLASH_H
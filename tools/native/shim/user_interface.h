@@ -0,0 +1,35 @@
+#ifndef NATIVE_SHIM_USER_INTERFACE_H
+#define NATIVE_SHIM_USER_INTERFACE_H
+
+#include <stdint.h>
+
+struct rst_info {
+  uint32_t reason;
+  uint32_t exccause;
+  uint32_t epc1;
+  uint32_t epc2;
+  uint32_t epc3;
+  uint32_t excvaddr;
+  uint32_t depc;
+};
+
+enum rst_reason {
+  REASON_DEFAULT_RST      = 0,
+  REASON_WDT_RST          = 1,
+  REASON_EXCEPTION_RST    = 2,
+  REASON_SOFT_WDT_RST     = 3,
+  REASON_SOFT_RESTART     = 4,
+  REASON_DEEP_SLEEP_AWAKE = 5,
+  REASON_EXT_SYS_RST      = 6
+};
+
+typedef enum {
+  STATION_IDLE = 0,
+  STATION_CONNECTING,
+  STATION_WRONG_PASSWORD,
+  STATION_NO_AP_FOUND,
+  STATION_CONNECT_FAIL,
+  STATION_GOT_IP
+} station_status_t;
+
+#endif // NATIVE_SHIM_USER_INTERFACE_H